@@ -12,6 +12,7 @@
 ////////////////////////////////////////////////////////////////
 
 #include "math/math_type_traits.h"
+#include "math/uninit.h"
 #include "math/vector/vector.h"
 #include "math/vector/vector_type_traits.h"
 
@@ -33,23 +34,25 @@ namespace math
         // Constructors.
         ////////////////////////////////////////////////////////////////
 
-        [[nodiscard]] AABB() noexcept : lower(), upper() {};
+        [[nodiscard]] constexpr AABB() noexcept : lower(), upper() {};
 
-        [[nodiscard]] AABB(const T& lower, const T& upper) noexcept : lower(lower), upper(upper) {}
+        [[nodiscard]] constexpr explicit AABB(uninit_t) noexcept : lower(uninit), upper(uninit) {}
 
-        [[nodiscard]] AABB(const AABB<T>& rhs) noexcept : lower(rhs.lower), upper(rhs.upper) {}
+        [[nodiscard]] constexpr AABB(const T& lower, const T& upper) noexcept : lower(lower), upper(upper) {}
+
+        [[nodiscard]] constexpr AABB(const AABB<T>& rhs) noexcept = default;
 
         template<is_same_size_vector<T> U>
-        [[nodiscard]] explicit AABB(const AABB<U>& rhs) noexcept : lower(static_cast<T>(rhs.lower)), upper(static_cast<T>(rhs.upper)) {}
+        [[nodiscard]] constexpr explicit AABB(const AABB<U>& rhs) noexcept : lower(static_cast<T>(rhs.lower)), upper(static_cast<T>(rhs.upper)) {}
 
         ////////////////////////////////////////////////////////////////
         // Assignment operators.
         ////////////////////////////////////////////////////////////////
 
-        AABB<T>& operator=(const AABB<T>& rhs) noexcept { lower = rhs.lower; upper = rhs.upper; return *this; }
+        constexpr AABB<T>& operator=(const AABB<T>& rhs) noexcept = default;
 
         template<is_same_size_vector<T> U>
-        AABB<T>& operator=(const AABB<U>& rhs) noexcept { lower = static_cast<T>(rhs.lower); upper = static_cast<T>(rhs.upper); return *this; }
+        constexpr AABB<T>& operator=(const AABB<U>& rhs) noexcept { lower = static_cast<T>(rhs.lower); upper = static_cast<T>(rhs.upper); return *this; }
 
         ////////////////////////////////////////////////////////////////
         // Defaulted constructors and operators.
@@ -59,15 +62,33 @@ namespace math
 
         AABB(AABB<T>&& rhs) noexcept = default;
 
-        AABB<T>& operator=(AABB<T>&& rhs) noexcept = default;
+        constexpr AABB<T>& operator=(AABB<T>&& rhs) noexcept = default;
 
         ////////////////////////////////////////////////////////////////
         // Element access.
         ////////////////////////////////////////////////////////////////
 
-        [[nodiscard]] const T& operator[](const size_t i) const { assert(i < 2); return (&lower)[i]; }
-
-        [[nodiscard]] T& operator[](const size_t i) { assert(i < 2); return (&lower)[i]; }
+        [[nodiscard]] constexpr const T& operator[](const size_t i) const
+        {
+            assert(i < 2);
+            if consteval
+            {
+                const T* const members[] = { &lower, &upper };
+                return *members[i];
+            }
+            return (&lower)[i];
+        }
+
+        [[nodiscard]] constexpr T& operator[](const size_t i)
+        {
+            assert(i < 2);
+            if consteval
+            {
+                T* const members[] = { &lower, &upper };
+                return *members[i];
+            }
+            return (&lower)[i];
+        }
     };
 
     ////////////////////////////////////////////////////////////////
@@ -75,13 +96,13 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<is_aabb T>
-    [[nodiscard]] T infinite() noexcept { return T(pos_infinity<T::element_type>(), neg_infinity<T::element_type>()); }
+    [[nodiscard]] constexpr T infinite() noexcept { return T(pos_infinity<T::element_type>(), neg_infinity<T::element_type>()); }
 
     template<is_aabb T>
-    [[nodiscard]] T zero() noexcept { return T(T::element_type(0), T::element_type(0)); }
+    [[nodiscard]] constexpr T zero() noexcept { return T(T::element_type(0), T::element_type(0)); }
 
     template<is_aabb T>
-    [[nodiscard]] T one() noexcept { return T(T::element_type(0), T::element_type(1)); }
+    [[nodiscard]] constexpr T one() noexcept { return T(T::element_type(0), T::element_type(1)); }
 
     ////////////////////////////////////////////////////////////////
     // Check for special values.
@@ -101,27 +122,27 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<typename T>
-    [[nodiscard]] AABB<T> operator+(const AABB<T>& lhs, const AABB<T>& rhs) noexcept { return AABB<T>(min(lhs.lower, rhs.lower), max(lhs.upper, rhs.upper)); }
+    [[nodiscard]] constexpr AABB<T> operator+(const AABB<T>& lhs, const AABB<T>& rhs) noexcept { return AABB<T>(min(lhs.lower, rhs.lower), max(lhs.upper, rhs.upper)); }
 
     template<typename T>
-    AABB<T>& operator+=(AABB<T>& lhs, const AABB<T>& rhs) noexcept { return lhs = lhs + rhs;; }
+    constexpr AABB<T>& operator+=(AABB<T>& lhs, const AABB<T>& rhs) noexcept { return lhs = lhs + rhs;; }
 
     ////////////////////////////////////////////////////////////////
     // Comparison operators.
     ////////////////////////////////////////////////////////////////
 
     template<typename T>
-    [[nodiscard]] bool operator==(const AABB<T>& lhs, const AABB<T>& rhs) noexcept { return lhs.lower == rhs.lower && lhs.upper == rhs.upper; }
+    [[nodiscard]] constexpr bool operator==(const AABB<T>& lhs, const AABB<T>& rhs) noexcept { return lhs.lower == rhs.lower && lhs.upper == rhs.upper; }
 
     template<typename T>
-    [[nodiscard]] bool operator!=(const AABB<T>& lhs, const AABB<T>& rhs) noexcept { return !(lhs == rhs); }
+    [[nodiscard]] constexpr bool operator!=(const AABB<T>& lhs, const AABB<T>& rhs) noexcept { return !(lhs == rhs); }
 
     ////////////////////////////////////////////////////////////////
     // Center, clamp, distance etc.
     ////////////////////////////////////////////////////////////////
 
     template<typename T>
-    [[nodiscard]] T center(const AABB<T>& lhs) noexcept { return (lhs.lower + lhs.upper) * T::element_type(0.5); }
+    [[nodiscard]] T center(const AABB<T>& lhs) noexcept { return (lhs.lower + lhs.upper) * typename T::element_type(0.5); }
 
     template<typename T>
     [[nodiscard]] AABB<T> clamp(const AABB<T>& lhs, const AABB<T>& rhs) noexcept { return AABB<T>(clamp(lhs.lower, rhs.lower, rhs.upper), clamp(lhs.upper, rhs.lower, rhs.upper)); }
@@ -13,5 +13,5 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<is_size<2> T>
-    [[nodiscard]] typename T::element_type area(const AABB<T>& lhs) noexcept { return reduce_mul(lhs.upper - lhs.lower); }
+    [[nodiscard]] constexpr typename T::element_type area(const AABB<T>& lhs) noexcept { return reduce_mul(lhs.upper - lhs.lower); }
 }
\ No newline at end of file
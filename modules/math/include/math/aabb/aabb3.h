@@ -61,9 +61,9 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<is_size<3> T>
-    [[nodiscard]] typename T::element_type area(const AABB<T>& lhs) noexcept
+    [[nodiscard]] constexpr typename T::element_type area(const AABB<T>& lhs) noexcept
     {
         const auto v = lhs.upper - lhs.lower;
-        return T::element_type(2) * (v.x * (v.y + v.z) + v.y * v.z);
+        return typename T::element_type(2) * (v.x * (v.y + v.z) + v.y * v.z);
     }
 }
\ No newline at end of file
@@ -6,8 +6,69 @@
 
 #include <iostream>
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 namespace math
 {
+    /**
+     * @brief Instruction set extensions supported by the CPU the program is running on.
+     */
+    struct cpu_features
+    {
+        bool sse4_1 = false;
+        bool sse4_2 = false;
+        bool avx = false;
+        bool avx2 = false;
+        bool fma = false;
+        bool avx512f = false;
+        bool avx512vl = false;
+    };
+
+    /**
+     * @brief Query the running CPU with CPUID. Also checks that the OS saves the AVX and AVX-512 registers.
+     */
+    [[nodiscard]] inline cpu_features detect_cpu_features() noexcept
+    {
+        cpu_features f;
+#if defined(_MSC_VER) && !defined(__clang__)
+        int regs[4];
+        __cpuid(regs, 0);
+        const int max_leaf = regs[0];
+        __cpuid(regs, 1);
+        const int ecx1 = regs[2];
+        f.sse4_1 = (ecx1 >> 19) & 1;
+        f.sse4_2 = (ecx1 >> 20) & 1;
+        f.fma = (ecx1 >> 12) & 1;
+
+        // OSXSAVE, then XCR0 must have the SSE and AVX state bits (and opmask/ZMM state bits for AVX-512).
+        const unsigned long long xcr0 = ((ecx1 >> 27) & 1) ? _xgetbv(0) : 0;
+        const bool os_avx = (xcr0 & 0x6) == 0x6;
+        const bool os_avx512 = (xcr0 & 0xe6) == 0xe6;
+        f.avx = os_avx && ((ecx1 >> 28) & 1);
+        f.fma = f.fma && os_avx;
+        if (max_leaf >= 7)
+        {
+            __cpuidex(regs, 7, 0);
+            f.avx2 = os_avx && ((regs[1] >> 5) & 1);
+            f.avx512f = os_avx512 && ((regs[1] >> 16) & 1);
+            f.avx512vl = os_avx512 && ((regs[1] >> 31) & 1);
+        }
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        // The builtins also check OS support for the extended register state.
+        __builtin_cpu_init();
+        f.sse4_1 = __builtin_cpu_supports("sse4.1");
+        f.sse4_2 = __builtin_cpu_supports("sse4.2");
+        f.avx = __builtin_cpu_supports("avx");
+        f.avx2 = __builtin_cpu_supports("avx2");
+        f.fma = __builtin_cpu_supports("fma");
+        f.avx512f = __builtin_cpu_supports("avx512f");
+        f.avx512vl = __builtin_cpu_supports("avx512vl");
+#endif
+        return f;
+    }
+
     inline void print_isa()
     {
         std::cout << "This library was compiled with the following flags:\n";
@@ -32,6 +93,24 @@ namespace math
         std::cout << "    FMA\n";
 #endif
 
+#ifdef __AVX512F__
+        std::cout << "    AVX512F\n";
+#endif
+
+#ifdef __AVX512VL__
+        std::cout << "    AVX512VL\n";
+#endif
+
+        const cpu_features f = detect_cpu_features();
+        std::cout << "\nThe CPU supports the following extensions:\n";
+        if (f.sse4_1) std::cout << "    SSE4_1\n";
+        if (f.sse4_2) std::cout << "    SSE4_2\n";
+        if (f.avx) std::cout << "    AVX\n";
+        if (f.avx2) std::cout << "    AVX2\n";
+        if (f.fma) std::cout << "    FMA\n";
+        if (f.avx512f) std::cout << "    AVX512F\n";
+        if (f.avx512vl) std::cout << "    AVX512VL\n";
+
         std::cout << std::endl;
     }
 }
@@ -0,0 +1,72 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/matrix/mat3x4.h"
+#include "math/vector/vec3_span.h"
+
+/*
+ * Batch kernels with runtime CPU dispatch.
+ *
+ * The functions declared here are compiled once per instruction set in separate translation units (SSE4.1, AVX2 + FMA and
+ * AVX-512) and the best variant the running CPU supports is selected on first use. Unlike the SIMD types, which are resolved
+ * at compile time from the target flags, they do not depend on the flags of the code that calls them. This allows building
+ * portable binaries, which is the default unless MATH_NATIVE_ARCH is turned on.
+ *
+ * Only the kernels declared here are dispatched at runtime. The span functions of the SIMD headers (vec3_batch.h,
+ * quat_batch.h, dual_quat_batch.h, reduce_batch.h, half_batch.h, pack_batch.h, ...) are header-only and are selected at
+ * compile time with #ifdef __AVX__, __AVX2__, __F16C__ etc., so they use the instruction set of the code that includes them.
+ */
+
+namespace math
+{
+    enum class isa_level
+    {
+        generic,
+        sse4_1,
+        avx2,
+        avx512
+    };
+
+    [[nodiscard]] const char* to_string(isa_level isa) noexcept;
+
+    /**
+     * @brief Best instruction set supported by the running CPU.
+     */
+    [[nodiscard]] isa_level best_isa() noexcept;
+
+    /**
+     * @brief Instruction set of the kernels that are currently used.
+     */
+    [[nodiscard]] isa_level active_isa() noexcept;
+
+    /**
+     * @brief Use the kernels of a specific instruction set, e.g. to compare them. Not thread-safe with respect to concurrent
+     * kernel calls.
+     * @param isa Instruction set. Must not be better than best_isa().
+     * @return True if the instruction set was selected.
+     */
+    bool set_isa(isa_level isa) noexcept;
+
+    ////////////////////////////////////////////////////////////////
+    // Kernels.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Transform points with an affine transform.
+     * @param m Transform.
+     * @param in Points.
+     * @param out Transformed points. May alias in.
+     */
+    void transform_points(const matrix<float, 3, 4>& m, const vec3_span<const float>& in, const vec3_span<float>& out) noexcept;
+
+    /**
+     * @brief Transform directions with the linear part of an affine transform.
+     * @param m Transform.
+     * @param in Directions.
+     * @param out Transformed directions. May alias in.
+     */
+    void transform_directions(const matrix<float, 3, 4>& m, const vec3_span<const float>& in, const vec3_span<float>& out) noexcept;
+}
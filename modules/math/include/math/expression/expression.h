@@ -0,0 +1,317 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <type_traits>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/math_functions.h"
+#include "math/math_type_traits.h"
+#include "math/uninit.h"
+#include "math/matrix/matrix.h"
+#include "math/vector/vector.h"
+
+/*
+ * Opt-in lazy evaluation of element-wise expressions on vec<T, N> and matrix<T, N, M>.
+ *
+ * Wrapping an operand in lazy() makes the arithmetic operators build an expression tree instead of computing temporaries.
+ * The tree is evaluated in a single loop when it is converted to the result type, or explicitly by eval(). Products that are
+ * added to something are fused into a madd. Expressions hold references to their vec and matrix operands, so they must be
+ * evaluated within the full expression that created them and should never be stored in an auto variable:
+ *
+ *     const vec<double, 16> r = lazy(a) * b + lazy(c) * d - e;
+ */
+
+namespace math
+{
+    namespace expr
+    {
+        ////////////////////////////////////////////////////////////////
+        // Container traits.
+        ////////////////////////////////////////////////////////////////
+
+        template<typename T>
+        struct container_traits
+        {
+            static constexpr bool is_container = false;
+        };
+
+        template<typename T, size_t N>
+        struct container_traits<vec<T, N>>
+        {
+            static constexpr bool is_container = true;
+            using element_type = T;
+            static constexpr size_t size = N;
+
+            [[nodiscard]] static const T& get(const vec<T, N>& v, const size_t i) noexcept { return v[i]; }
+
+            [[nodiscard]] static T& get(vec<T, N>& v, const size_t i) noexcept { return v[i]; }
+        };
+
+        template<typename T, size_t N, size_t M>
+        struct container_traits<matrix<T, N, M>>
+        {
+            static constexpr bool is_container = true;
+            using element_type = T;
+            static constexpr size_t size = N * M;
+
+            [[nodiscard]] static const T& get(const matrix<T, N, M>& m, const size_t i) noexcept { return m[i / M][i % M]; }
+
+            [[nodiscard]] static T& get(matrix<T, N, M>& m, const size_t i) noexcept { return m[i / M][i % M]; }
+        };
+
+        template<typename T>
+        concept container = container_traits<T>::is_container;
+
+        template<typename E>
+        concept expression = requires
+        {
+            typename E::result_type;
+            typename E::is_expression;
+        };
+
+        template<typename T>
+        concept operand = expression<T> || container<T> || arithmetic<T>;
+
+        ////////////////////////////////////////////////////////////////
+        // Nodes.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * @brief Evaluates every element of an expression once and returns the result.
+         */
+        template<typename E>
+        [[nodiscard]] typename E::result_type evaluate(const E& e) noexcept
+        {
+            using traits = container_traits<typename E::result_type>;
+            typename E::result_type r(uninit);
+            for (size_t i = 0; i < traits::size; i++)
+                traits::get(r, i) = e[i];
+            return r;
+        }
+
+        /**
+         * @brief Reference to a vec or matrix.
+         */
+        template<container C>
+        struct terminal
+        {
+            using is_expression = void;
+            using result_type = C;
+            using element_type = typename container_traits<C>::element_type;
+
+            const C& value;
+
+            [[nodiscard]] element_type operator[](const size_t i) const noexcept { return container_traits<C>::get(value, i); }
+
+            [[nodiscard]] operator result_type() const noexcept { return evaluate(*this); }
+        };
+
+        /**
+         * @brief Scalar that is broadcast to every element. Has no result type of its own.
+         */
+        template<arithmetic T>
+        struct constant
+        {
+            T value;
+
+            [[nodiscard]] T operator[](size_t) const noexcept { return value; }
+        };
+
+        template<typename E>
+        struct node_result
+        {
+            using type = typename E::result_type;
+        };
+
+        template<arithmetic T>
+        struct node_result<constant<T>>
+        {
+            using type = void;
+        };
+
+        /**
+         * @brief Result type of the first operand that is not a constant.
+         */
+        template<typename... Es>
+        struct common_result
+        {
+            using type = void;
+        };
+
+        template<typename E, typename... Es>
+        struct common_result<E, Es...>
+        {
+            using type = std::conditional_t<std::is_void_v<typename node_result<E>::type>, typename common_result<Es...>::type, typename node_result<E>::type>;
+        };
+
+        template<typename... Es>
+        using common_result_t = typename common_result<Es...>::type;
+
+        template<typename Op, typename A>
+        struct unary
+        {
+            using is_expression = void;
+            using result_type = typename A::result_type;
+            using element_type = typename container_traits<result_type>::element_type;
+
+            A a;
+
+            [[nodiscard]] element_type operator[](const size_t i) const noexcept { return Op::template apply<element_type>(a[i]); }
+
+            [[nodiscard]] operator result_type() const noexcept { return evaluate(*this); }
+        };
+
+        template<typename Op, typename A, typename B>
+        struct binary
+        {
+            using is_expression = void;
+            using result_type = common_result_t<A, B>;
+            using element_type = typename container_traits<result_type>::element_type;
+
+            A a;
+            B b;
+
+            [[nodiscard]] element_type operator[](const size_t i) const noexcept { return Op::template apply<element_type>(a[i], b[i]); }
+
+            [[nodiscard]] operator result_type() const noexcept { return evaluate(*this); }
+        };
+
+        /**
+         * @brief a * b + c, produced when a product is added to another operand.
+         */
+        template<typename A, typename B, typename C>
+        struct fused_madd
+        {
+            using is_expression = void;
+            using result_type = common_result_t<A, B, C>;
+            using element_type = typename container_traits<result_type>::element_type;
+
+            A a;
+            B b;
+            C c;
+
+            [[nodiscard]] element_type operator[](const size_t i) const noexcept { return madd<element_type>(a[i], b[i], c[i]); }
+
+            [[nodiscard]] operator result_type() const noexcept { return evaluate(*this); }
+        };
+
+        struct negate
+        {
+            template<typename T>
+            [[nodiscard]] static T apply(const T a) noexcept { return -a; }
+        };
+
+        struct plus
+        {
+            template<typename T>
+            [[nodiscard]] static T apply(const T a, const T b) noexcept { return a + b; }
+        };
+
+        struct minus
+        {
+            template<typename T>
+            [[nodiscard]] static T apply(const T a, const T b) noexcept { return a - b; }
+        };
+
+        struct multiplies
+        {
+            template<typename T>
+            [[nodiscard]] static T apply(const T a, const T b) noexcept { return a * b; }
+        };
+
+        struct divides
+        {
+            template<typename T>
+            [[nodiscard]] static T apply(const T a, const T b) noexcept { return a / b; }
+        };
+
+        ////////////////////////////////////////////////////////////////
+        // Operand wrapping.
+        ////////////////////////////////////////////////////////////////
+
+        template<operand T>
+        [[nodiscard]] auto wrap(const T& v) noexcept
+        {
+            if constexpr (expression<T>)
+                return v;
+            else if constexpr (container<T>)
+                return terminal<T>{v};
+            else
+                return constant<T>{v};
+        }
+
+        template<typename T>
+        using wrap_t = decltype(wrap(std::declval<const T&>()));
+
+        /**
+         * @brief At least one side must already be an expression, so that the eager operators on vec and matrix are unaffected.
+         */
+        template<typename A, typename B>
+        concept lazy_pair = operand<A> && operand<B> && (expression<A> || expression<B>);
+
+        template<typename T>
+        struct is_product : std::false_type {};
+
+        template<typename A, typename B>
+        struct is_product<binary<multiplies, A, B>> : std::true_type {};
+
+        ////////////////////////////////////////////////////////////////
+        // Arithmetic operators.
+        ////////////////////////////////////////////////////////////////
+
+        template<expression A>
+        [[nodiscard]] auto operator-(const A& a) noexcept { return unary<negate, A>{a}; }
+
+        template<typename A, typename B> requires lazy_pair<A, B>
+        [[nodiscard]] auto operator+(const A& a, const B& b) noexcept
+        {
+            if constexpr (is_product<A>::value)
+                return fused_madd<decltype(a.a), decltype(a.b), wrap_t<B>>{a.a, a.b, wrap(b)};
+            else if constexpr (is_product<B>::value)
+                return fused_madd<decltype(b.a), decltype(b.b), wrap_t<A>>{b.a, b.b, wrap(a)};
+            else
+                return binary<plus, wrap_t<A>, wrap_t<B>>{wrap(a), wrap(b)};
+        }
+
+        template<typename A, typename B> requires lazy_pair<A, B>
+        [[nodiscard]] auto operator-(const A& a, const B& b) noexcept
+        {
+            // a * b - c is fused as a * b + (-c), which rounds the same.
+            if constexpr (is_product<A>::value && arithmetic<B>)
+                return fused_madd<decltype(a.a), decltype(a.b), constant<B>>{a.a, a.b, constant<B>{-b}};
+            else if constexpr (is_product<A>::value)
+                return fused_madd<decltype(a.a), decltype(a.b), unary<negate, wrap_t<B>>>{a.a, a.b, {wrap(b)}};
+            else
+                return binary<minus, wrap_t<A>, wrap_t<B>>{wrap(a), wrap(b)};
+        }
+
+        template<typename A, typename B> requires lazy_pair<A, B>
+        [[nodiscard]] auto operator*(const A& a, const B& b) noexcept { return binary<multiplies, wrap_t<A>, wrap_t<B>>{wrap(a), wrap(b)}; }
+
+        template<typename A, typename B> requires lazy_pair<A, B>
+        [[nodiscard]] auto operator/(const A& a, const B& b) noexcept { return binary<divides, wrap_t<A>, wrap_t<B>>{wrap(a), wrap(b)}; }
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Entry points.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Start a lazy expression. The returned object references v and must not outlive it.
+     */
+    template<expr::container C>
+    [[nodiscard]] expr::terminal<C> lazy(const C& v) noexcept { return expr::terminal<C>{v}; }
+
+    /**
+     * @brief Evaluate a lazy expression in a single loop over all elements.
+     */
+    template<expr::expression E>
+    [[nodiscard]] typename E::result_type eval(const E& e) noexcept { return expr::evaluate(e); }
+}
@@ -0,0 +1,178 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <bit>
+#include <cstdint>
+#include <immintrin.h>
+#include <limits>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/math_type_traits.h"
+
+namespace math
+{
+    namespace detail
+    {
+        /**
+         * @brief Convert a float to the bits of the nearest half, ties to even. Overflow results in infinity, NaN keeps the
+         * upper bits of its payload and becomes quiet, like F16C does.
+         */
+        [[nodiscard]] constexpr uint16_t float_to_half_bits(const float f) noexcept
+        {
+            uint32_t       u    = std::bit_cast<uint32_t>(f);
+            const uint32_t sign = (u >> 16) & 0x8000;
+            u &= 0x7fffffff;
+
+            // Infinity and NaN.
+            if (u >= 0x7f800000) return static_cast<uint16_t>(sign | 0x7c00 | (u > 0x7f800000 ? 0x200 | ((u >> 13) & 0x3ff) : 0));
+            // Overflow, 2^16 and larger. Smaller values that round up to infinity are handled by the carry below.
+            if (u >= 0x47800000) return static_cast<uint16_t>(sign | 0x7c00);
+
+            // Zero and denormals, smaller than 2^-14. Adding 0.5 aligns the bits of the half denormal with the lowest bits of
+            // the float mantissa, and lets the FPU do the rounding.
+            if (u < 0x38800000) return static_cast<uint16_t>(sign | (std::bit_cast<uint32_t>(std::bit_cast<float>(u) + 0.5f) - 0x3f000000));
+
+            // Normals. Rebias the exponent and round the 13 dropped mantissa bits to even. A carry into the exponent is correct.
+            u += 0xc8000fff + ((u >> 13) & 1);
+            return static_cast<uint16_t>(sign | (u >> 13));
+        }
+
+        /**
+         * @brief Convert the bits of a half to a float. Exact, except that NaN becomes quiet, like F16C does.
+         */
+        [[nodiscard]] constexpr float half_bits_to_float(const uint16_t h) noexcept
+        {
+            const uint32_t sign = static_cast<uint32_t>(h & 0x8000) << 16;
+            const uint32_t exp  = (h >> 10) & 0x1f;
+            const uint32_t mant = h & 0x3ff;
+
+            if (exp == 0x1f) return std::bit_cast<float>(sign | 0x7f800000 | (mant ? (mant << 13) | 0x400000 : 0));
+            if (exp == 0)
+            {
+                // Zero and denormals, mant * 2^-24.
+                const float f = static_cast<float>(mant) * 0x1p-24f;
+                return sign ? -f : f;
+            }
+            return std::bit_cast<float>(sign | ((exp + 112) << 23) | (mant << 13));
+        }
+    }
+
+    /**=================================================================================================
+     * Struct: float16
+     * =================================================================================================
+     * @struct  float16
+     *
+     * @brief   IEEE 754 half precision float. A storage type: it converts implicitly from and to float, so all arithmetic
+     *          is done in single precision and rounded back on assignment. Use the span conversions in
+     *          math/vector/simd/half_batch.h to convert large arrays.
+    **/
+    struct float16
+    {
+        uint16_t bits = 0;
+
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] constexpr float16() noexcept = default;
+
+        [[nodiscard]] constexpr float16(const float f) noexcept
+        {
+#ifdef __F16C__
+            if !consteval
+            {
+                bits = static_cast<uint16_t>(_cvtss_sh(f, _MM_FROUND_TO_NEAREST_INT));
+                return;
+            }
+#endif
+            bits = detail::float_to_half_bits(f);
+        }
+
+        /**
+         * @brief Construct from the bit pattern of a half.
+         */
+        [[nodiscard]] static constexpr float16 from_bits(const uint16_t b) noexcept
+        {
+            float16 h;
+            h.bits = b;
+            return h;
+        }
+
+        ////////////////////////////////////////////////////////////////
+        // Conversion.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] constexpr operator float() const noexcept
+        {
+#ifdef __F16C__
+            if !consteval { return _cvtsh_ss(bits); }
+#endif
+            return detail::half_bits_to_float(bits);
+        }
+
+        ////////////////////////////////////////////////////////////////
+        // Assignment operators.
+        ////////////////////////////////////////////////////////////////
+
+        constexpr float16& operator+=(const float rhs) noexcept { return *this = float16(float(*this) + rhs); }
+
+        constexpr float16& operator-=(const float rhs) noexcept { return *this = float16(float(*this) - rhs); }
+
+        constexpr float16& operator*=(const float rhs) noexcept { return *this = float16(float(*this) * rhs); }
+
+        constexpr float16& operator/=(const float rhs) noexcept { return *this = float16(float(*this) / rhs); }
+    };
+
+    using half = float16;
+
+    static_assert(sizeof(float16) == 2);
+
+    template<>
+    struct _is_floating_point<float16> : std::true_type {};
+
+    template<>
+    struct _is_signed<float16> : std::true_type {};
+}
+
+template<>
+class std::numeric_limits<math::float16>
+{
+public:
+    static constexpr bool              is_specialized    = true;
+    static constexpr bool              is_signed         = true;
+    static constexpr bool              is_integer        = false;
+    static constexpr bool              is_exact          = false;
+    static constexpr bool              has_infinity      = true;
+    static constexpr bool              has_quiet_NaN     = true;
+    static constexpr bool              has_signaling_NaN = true;
+    static constexpr bool              is_iec559         = true;
+    static constexpr bool              is_bounded        = true;
+    static constexpr bool              is_modulo         = false;
+    static constexpr bool              traps             = false;
+    static constexpr bool              tinyness_before   = false;
+    static constexpr float_round_style round_style       = round_to_nearest;
+    static constexpr int               digits            = 11;
+    static constexpr int               digits10          = 3;
+    static constexpr int               max_digits10      = 5;
+    static constexpr int               radix             = 2;
+    static constexpr int               min_exponent      = -13;
+    static constexpr int               min_exponent10    = -4;
+    static constexpr int               max_exponent      = 16;
+    static constexpr int               max_exponent10    = 4;
+
+    [[nodiscard]] static constexpr math::float16 min() noexcept { return math::float16::from_bits(0x0400); }
+    [[nodiscard]] static constexpr math::float16 max() noexcept { return math::float16::from_bits(0x7bff); }
+    [[nodiscard]] static constexpr math::float16 lowest() noexcept { return math::float16::from_bits(0xfbff); }
+    [[nodiscard]] static constexpr math::float16 epsilon() noexcept { return math::float16::from_bits(0x1400); }
+    [[nodiscard]] static constexpr math::float16 round_error() noexcept { return math::float16::from_bits(0x3800); }
+    [[nodiscard]] static constexpr math::float16 infinity() noexcept { return math::float16::from_bits(0x7c00); }
+    [[nodiscard]] static constexpr math::float16 quiet_NaN() noexcept { return math::float16::from_bits(0x7e00); }
+    [[nodiscard]] static constexpr math::float16 signaling_NaN() noexcept { return math::float16::from_bits(0x7d00); }
+    [[nodiscard]] static constexpr math::float16 denorm_min() noexcept { return math::float16::from_bits(0x0001); }
+};
@@ -1,34 +1,67 @@
 #pragma once
 
+#include <type_traits>
+
 #include "math/compilation_info.h"
 #include "math/constants.h"
+#include "math/dispatch.h"
+#include "math/float16.h"
 #include "math/math_functions.h"
+#include "math/parallel.h"
 #include "math/space_conversion.h"
+#include "math/uninit.h"
 
 #include "math/aabb/aabb.h"
 #include "math/aabb/aabb2.h"
 #include "math/aabb/aabb3.h"
 
+#include "math/expression/expression.h"
+
 #include "math/matrix/matrix.h"
+#include "math/matrix/mat3x4.h"
 #include "math/matrix/mat4x4.h"
-//#include "math/matrix/simd/mat4x4fa.h"
+#include "math/matrix/simd/mat3x4fa.h"
+#include "math/matrix/simd/mat4x4fa.h"
+
+#include "math/quaternion/dual_quat.h"
+#include "math/quaternion/quat.h"
+#include "math/quaternion/simd/dual_quat_batch.h"
+#include "math/quaternion/simd/quat_batch.h"
+#include "math/quaternion/simd/quatfa.h"
 
 #include "math/vector/vector.h"
+#include "math/vector/pack.h"
 #include "math/vector/vec2.h"
 #include "math/vector/vec3.h"
+#include "math/vector/vec3_span.h"
 #include "math/vector/vec4.h"
 #include "math/vector/vec8.h"
 #include "math/vector/vector_type_traits.h"
 
+#include "math/vector/simd/batch.h"
+#include "math/vector/simd/half_batch.h"
+#include "math/vector/simd/pack_batch.h"
+#include "math/vector/simd/reduce_batch.h"
+#include "math/vector/simd/simd_type.h"
+#include "math/vector/simd/vec2da.h"
+#include "math/vector/simd/vec2dba.h"
+#include "math/vector/simd/vec3_batch.h"
 #include "math/vector/simd/vec3ba.h"
+#include "math/vector/simd/vec3da.h"
+#include "math/vector/simd/vec3dba.h"
 #include "math/vector/simd/vec3fa.h"
 #include "math/vector/simd/vec3ia.h"
 #include "math/vector/simd/vec4ba.h"
+#include "math/vector/simd/vec4da.h"
+#include "math/vector/simd/vec4dba.h"
 #include "math/vector/simd/vec4fa.h"
 #include "math/vector/simd/vec4ia.h"
 #include "math/vector/simd/vec8ba.h"
 #include "math/vector/simd/vec8fa.h"
 #include "math/vector/simd/vec8ia.h"
+#include "math/vector/simd/vec16ba.h"
+#include "math/vector/simd/vec16fa.h"
+#include "math/vector/simd/vec16ia.h"
 
 namespace math
 {
@@ -38,6 +71,10 @@ namespace math
     using float3 = vec<float, 3>;
     using float4 = vec<float, 4>;
 
+    using half2 = vec<half, 2>;
+    using half3 = vec<half, 3>;
+    using half4 = vec<half, 4>;
+
     using double2 = vec<double, 2>;
     using double3 = vec<double, 3>;
     using double4 = vec<double, 4>;
@@ -71,13 +108,21 @@ namespace math
     using ulong4 = vec<uint64_t, 4>;
 
     using mat3x3f = matrix<float, 3, 3>;
+    using mat3x4f = matrix<float, 3, 4>;
     using mat4x4f = matrix<float, 4, 4>;
 
     using quaternion = float4;
+    using quatf = quat<float>;
+    using quatd = quat<double>;
+    using dual_quatf = dual_quat<float>;
+    using dual_quatd = dual_quat<double>;
 
     template<size_t N>
     using floatN = vec<float, N>;
 
+    template<size_t N>
+    using halfN = vec<half, N>;
+
     template<size_t N>
     using doubleN = vec<double, N>;
 
@@ -100,4 +145,12 @@ namespace math
     using longN = vec<int64_t, N>;
     template<size_t N>
     using ulongN = vec<uint64_t, N>;
-}
\ No newline at end of file
+
+    ////////////////////////////////////////////////////////////////
+    // Layout.
+    ////////////////////////////////////////////////////////////////
+
+    // Arrays of these types can be copied and relocated with memcpy.
+    template<typename T>
+    inline constexpr bool is_memcpy_safe_v = std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>;
+}
@@ -8,9 +8,6 @@
 
 namespace math
 {
-    template<typename T>
-    concept arithmetic = std::is_arithmetic_v<T>;
-
     template<typename T>
     concept less_than_comparable = requires (T x)
     {
@@ -97,6 +94,14 @@ namespace math
     template<typename T>
     concept integral = is_integral_v<T>;
 
+    ////////////////////////////////////////////////////////////////
+    // arithmetic
+    ////////////////////////////////////////////////////////////////
+
+    // Includes the library's own number types, such as float16.
+    template<typename T>
+    concept arithmetic = std::is_arithmetic_v<T> || _is_floating_point_v<T> || _is_integral_v<T>;
+
     ////////////////////////////////////////////////////////////////
     // is_signed
     ////////////////////////////////////////////////////////////////
@@ -0,0 +1,206 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/vector/vec3.h"
+#include "math/vector/vec4.h"
+#include "math/matrix/matrix.h"
+#include "math/matrix/mat4x4.h"
+
+namespace math
+{
+    /**=================================================================================================
+     * Struct: matrix<T, 3, 4>
+     * =================================================================================================
+     * @struct  matrix<T, 3, 4>
+     *
+     * @brief   Affine transform. Stores the upper three rows of a 4x4 transform, the last row is implicitly (0, 0, 0, 1).
+     *
+     * @tparam  T   Component type.
+    **/
+    template<typename T>
+    struct matrix<T, 3, 4>
+    {
+        using element_type = T;
+        using row_type = vec<T, 4>;
+        using column_type = vec<T, 3>;
+        static constexpr size_t size = 12;
+
+        row_type r0, r1, r2;
+
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] constexpr matrix() noexcept : r0(0), r1(0), r2(0) {}
+
+        [[nodiscard]] constexpr explicit matrix(uninit_t) noexcept : r0(uninit), r1(uninit), r2(uninit) {}
+
+        [[nodiscard]] constexpr explicit matrix(const T v) noexcept : r0(v), r1(v), r2(v) {}
+
+        [[nodiscard]] constexpr matrix(const row_type& r0, const row_type& r1, const row_type& r2) noexcept : r0(r0), r1(r1), r2(r2) {}
+
+        [[nodiscard]] constexpr explicit matrix(const matrix<T, 3, 3>& rhs) noexcept : r0(rhs[0], 0), r1(rhs[1], 0), r2(rhs[2], 0) {}
+
+        [[nodiscard]] constexpr matrix(const matrix<T, 3, 3>& rhs, const vec<T, 3>& translation) noexcept : r0(rhs[0], translation.x), r1(rhs[1], translation.y), r2(rhs[2], translation.z) {}
+
+        /**
+         * @brief Drop the last row of a 4x4 transform, which must be (0, 0, 0, 1).
+         */
+        [[nodiscard]] constexpr explicit matrix(const matrix<T, 4, 4>& rhs) noexcept : r0(rhs.r0), r1(rhs.r1), r2(rhs.r2) {}
+
+        [[nodiscard]] constexpr matrix(
+            const T a, const T b, const T c, const T d,
+            const T e, const T f, const T g, const T h,
+            const T i, const T j, const T k, const T l) noexcept :
+            r0(a, b, c, d),
+            r1(e, f, g, h),
+            r2(i, j, k, l)
+        {
+        }
+
+        [[nodiscard]] constexpr matrix(const matrix<T, 3, 4>& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Assignment operators.
+        ////////////////////////////////////////////////////////////////
+
+        constexpr matrix<T, 3, 4>& operator=(const T rhs) noexcept { r0 = rhs; r1 = rhs; r2 = rhs; return *this; }
+
+        constexpr matrix<T, 3, 4>& operator=(const matrix<T, 3, 4>& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Defaulted constructors and operators.
+        ////////////////////////////////////////////////////////////////
+
+        ~matrix() = default;
+
+        matrix(matrix<T, 3, 4>&& rhs) noexcept = default;
+
+        constexpr matrix<T, 3, 4>& operator=(matrix<T, 3, 4>&& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Casting operators.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] constexpr explicit operator matrix<T, 4, 4>() const noexcept { return matrix<T, 4, 4>(r0, r1, r2, row_type(T(0), T(0), T(0), T(1))); }
+
+        ////////////////////////////////////////////////////////////////
+        // Element access.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] constexpr const row_type& operator[](const size_t i) const
+        {
+            assert(i < 3);
+            if consteval
+            {
+                const row_type* const members[] = { &r0, &r1, &r2 };
+                return *members[i];
+            }
+            return (&r0)[i];
+        }
+
+        [[nodiscard]] constexpr row_type& operator[](const size_t i)
+        {
+            assert(i < 3);
+            if consteval
+            {
+                row_type* const members[] = { &r0, &r1, &r2 };
+                return *members[i];
+            }
+            return (&r0)[i];
+        }
+
+        [[nodiscard]] constexpr column_type column(const size_t j) const
+        {
+            assert(j < 4);
+            return column_type(r0[j], r1[j], r2[j]);
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////
+    // Construct special values.
+    ////////////////////////////////////////////////////////////////
+
+    template<typename T>
+    [[nodiscard]] constexpr matrix<T, 3, 4> affine_identity() noexcept
+    {
+        return matrix<T, 3, 4>(
+            T(1), T(0), T(0), T(0),
+            T(0), T(1), T(0), T(0),
+            T(0), T(0), T(1), T(0)
+            );
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Matrix-Matrix multiplication.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Compose two affine transforms as if they were 4x4 matrices. Applying the result applies rhs first, then lhs.
+     */
+    template<typename T>
+    [[nodiscard]] constexpr matrix<T, 3, 4> operator*(const matrix<T, 3, 4>& lhs, const matrix<T, 3, 4>& rhs) noexcept
+    {
+        // Every row of the result is a combination of the rows of rhs, plus the translation of lhs.
+        const auto row = [&](const vec<T, 4>& r) { return rhs.r0 * r.x + rhs.r1 * r.y + rhs.r2 * r.z + vec<T, 4>(T(0), T(0), T(0), r.w); };
+        return matrix<T, 3, 4>(row(lhs.r0), row(lhs.r1), row(lhs.r2));
+    }
+
+    template<typename T>
+    constexpr matrix<T, 3, 4>& operator*=(matrix<T, 3, 4>& lhs, const matrix<T, 3, 4>& rhs) noexcept
+    {
+        return lhs = lhs * rhs;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Matrix-Vector multiplication.
+    ////////////////////////////////////////////////////////////////
+
+    template<typename T>
+    [[nodiscard]] constexpr vec<T, 3> transform_point(const matrix<T, 3, 4>& lhs, const vec<T, 3>& rhs) noexcept
+    {
+        const vec<T, 4> p(rhs.x, rhs.y, rhs.z, T(1));
+        return vec<T, 3>(dot(lhs.r0, p), dot(lhs.r1, p), dot(lhs.r2, p));
+    }
+
+    template<typename T>
+    [[nodiscard]] constexpr vec<T, 3> transform_direction(const matrix<T, 3, 4>& lhs, const vec<T, 3>& rhs) noexcept
+    {
+        return vec<T, 3>(dot(lhs.r0.xyz(), rhs), dot(lhs.r1.xyz(), rhs), dot(lhs.r2.xyz(), rhs));
+    }
+
+    template<typename T>
+    [[nodiscard]] constexpr vec<T, 3> operator*(const matrix<T, 3, 4>& lhs, const vec<T, 3>& rhs) noexcept { return transform_point(lhs, rhs); }
+
+    ////////////////////////////////////////////////////////////////
+    // Transpose, invert.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Invert an affine transform. Returns a zero linear part if the transform is singular.
+     */
+    template<typename T>
+    [[nodiscard]] matrix<T, 3, 4> invert(const matrix<T, 3, 4>& lhs) noexcept
+    {
+        // The inverse of the linear part has the cofactors as columns, divided by the determinant.
+        const vec<T, 3> a0 = lhs.r0.xyz(), a1 = lhs.r1.xyz(), a2 = lhs.r2.xyz();
+        const vec<T, 3> c0 = cross(a1, a2), c1 = cross(a2, a0), c2 = cross(a0, a1);
+        const T det = dot(a0, c0);
+        const T invdet = det != T(0) ? T(1) / det : T(0);
+        const vec<T, 3> i0 = vec<T, 3>(c0.x, c1.x, c2.x) * invdet;
+        const vec<T, 3> i1 = vec<T, 3>(c0.y, c1.y, c2.y) * invdet;
+        const vec<T, 3> i2 = vec<T, 3>(c0.z, c1.z, c2.z) * invdet;
+        const vec<T, 3> t(lhs.r0.w, lhs.r1.w, lhs.r2.w);
+        return matrix<T, 3, 4>(vec<T, 4>(i0, -dot(i0, t)), vec<T, 4>(i1, -dot(i1, t)), vec<T, 4>(i2, -dot(i2, t)));
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Output.
+    ////////////////////////////////////////////////////////////////
+
+    template<typename T>
+    std::ostream& operator<<(std::ostream& out, const matrix<T, 3, 4>& m) { return out << "[" << m.r0 << "\n " << m.r1 << "\n " << m.r2 << "]"; }
+}
@@ -1,5 +1,11 @@
 #pragma once
 
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <span>
+
 ////////////////////////////////////////////////////////////////
 // Current target includes.
 ////////////////////////////////////////////////////////////////
@@ -24,19 +30,21 @@ namespace math
         // Constructors.
         ////////////////////////////////////////////////////////////////
 
-        [[nodiscard]] matrix() noexcept : r0(0), r1(0), r2(0), r3(0) {}
+        [[nodiscard]] constexpr matrix() noexcept : r0(0), r1(0), r2(0), r3(0) {}
 
-        [[nodiscard]] explicit matrix(const T v) noexcept : r0(v), r1(v), r2(v), r3(v) {}
+        [[nodiscard]] constexpr explicit matrix(uninit_t) noexcept : r0(uninit), r1(uninit), r2(uninit), r3(uninit) {}
 
-        [[nodiscard]] explicit matrix(const row_type& r) noexcept : r0(r), r1(r), r2(r), r3(r) {}
+        [[nodiscard]] constexpr explicit matrix(const T v) noexcept : r0(v), r1(v), r2(v), r3(v) {}
 
-        [[nodiscard]] matrix(const row_type& r0, const row_type& r1, const row_type& r2, const row_type& r3) noexcept : r0(r0), r1(r1), r2(r2), r3(r3) {}
+        [[nodiscard]] constexpr explicit matrix(const row_type& r) noexcept : r0(r), r1(r), r2(r), r3(r) {}
 
-        [[nodiscard]] explicit matrix(const matrix<T, 3, 3>& rhs) noexcept : r0(rhs[0], 0), r1(rhs[1], 0), r2(rhs[2], 0), r3(0, 0, 0, 1) {}
+        [[nodiscard]] constexpr matrix(const row_type& r0, const row_type& r1, const row_type& r2, const row_type& r3) noexcept : r0(r0), r1(r1), r2(r2), r3(r3) {}
 
-        [[nodiscard]] matrix(const matrix<T, 3, 3>& rhs, const row_type& r3) noexcept : r0(rhs[0], 0), r1(rhs[1], 0), r2(rhs[2], 0), r3(r3) {}
+        [[nodiscard]] constexpr explicit matrix(const matrix<T, 3, 3>& rhs) noexcept : r0(rhs[0], 0), r1(rhs[1], 0), r2(rhs[2], 0), r3(0, 0, 0, 1) {}
 
-        [[nodiscard]] matrix(
+        [[nodiscard]] constexpr matrix(const matrix<T, 3, 3>& rhs, const row_type& r3) noexcept : r0(rhs[0], 0), r1(rhs[1], 0), r2(rhs[2], 0), r3(r3) {}
+
+        [[nodiscard]] constexpr matrix(
             const T a, const T b, const T c, const T d,
             const T e, const T f, const T g, const T h,
             const T i, const T j, const T k, const T l,
@@ -48,21 +56,21 @@ namespace math
         {
         }
 
-        [[nodiscard]] matrix(const matrix<T, 4, 4>& rhs) noexcept : r0(rhs.r0), r1(rhs.r1), r2(rhs.r2), r3(rhs.r3) {}
+        [[nodiscard]] constexpr matrix(const matrix<T, 4, 4>& rhs) noexcept = default;
 
         template<typename U>
-        [[nodiscard]] explicit matrix(const matrix<T, 4, 4>& rhs) : r0(static_cast<row_type>(rhs.r0)), r1(static_cast<row_type>(rhs.r1)), r2(static_cast<row_type>(rhs.r2)), r3(static_cast<row_type>(rhs.r3)) {}
+        [[nodiscard]] constexpr explicit matrix(const matrix<T, 4, 4>& rhs) : r0(static_cast<row_type>(rhs.r0)), r1(static_cast<row_type>(rhs.r1)), r2(static_cast<row_type>(rhs.r2)), r3(static_cast<row_type>(rhs.r3)) {}
 
         ////////////////////////////////////////////////////////////////
         // Assignment operators.
         ////////////////////////////////////////////////////////////////
 
-        matrix<T, 4, 4>& operator=(const T rhs) noexcept { r0 = rhs; r1 = rhs; r2 = rhs; r3 = rhs; return *this; }
+        constexpr matrix<T, 4, 4>& operator=(const T rhs) noexcept { r0 = rhs; r1 = rhs; r2 = rhs; r3 = rhs; return *this; }
 
-        matrix<T, 4, 4>& operator=(const matrix<T, 4, 4>& rhs) noexcept { r0 = rhs.r0; r1 = rhs.r1; r2 = rhs.r2; r3 = rhs.r3; return *this; }
+        constexpr matrix<T, 4, 4>& operator=(const matrix<T, 4, 4>& rhs) noexcept = default;
 
         template<typename U>
-        matrix<T, 4, 4>& operator=(const matrix<T, 4, 4>& rhs) { r0 = static_cast<row_type>(rhs.r0); r1 = static_cast<row_type>(rhs.r1); r2 = static_cast<row_type>(rhs.r2); r3 = static_cast<row_type>(rhs.r3); return *this; }
+        constexpr matrix<T, 4, 4>& operator=(const matrix<T, 4, 4>& rhs) { r0 = static_cast<row_type>(rhs.r0); r1 = static_cast<row_type>(rhs.r1); r2 = static_cast<row_type>(rhs.r2); r3 = static_cast<row_type>(rhs.r3); return *this; }
 
         ////////////////////////////////////////////////////////////////
         // Defaulted constructors and operators.
@@ -72,17 +80,35 @@ namespace math
 
         matrix(matrix<T, 4, 4>&& rhs) noexcept = default;
 
-        matrix<T, 4, 4>& operator=(matrix<T, 4, 4>&& rhs) noexcept = default;
+        constexpr matrix<T, 4, 4>& operator=(matrix<T, 4, 4>&& rhs) noexcept = default;
 
         ////////////////////////////////////////////////////////////////
         // Element access.
         ////////////////////////////////////////////////////////////////
 
-        [[nodiscard]] const row_type& operator[](const size_t i) const { assert(i < 4); return (&r0)[i]; }
+        [[nodiscard]] constexpr const row_type& operator[](const size_t i) const
+        {
+            assert(i < 4);
+            if consteval
+            {
+                const row_type* const members[] = { &r0, &r1, &r2, &r3 };
+                return *members[i];
+            }
+            return (&r0)[i];
+        }
 
-        [[nodiscard]] row_type& operator[](const size_t i) { assert(i < 4); return (&r0)[i]; }
+        [[nodiscard]] constexpr row_type& operator[](const size_t i)
+        {
+            assert(i < 4);
+            if consteval
+            {
+                row_type* const members[] = { &r0, &r1, &r2, &r3 };
+                return *members[i];
+            }
+            return (&r0)[i];
+        }
 
-        [[nodiscard]] column_type column(const size_t j) const
+        [[nodiscard]] constexpr column_type column(const size_t j) const
         {
             assert(j < 4);
             return column_type(r0[j], r1[j], r2[j], r3[j]);
@@ -94,7 +120,7 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<typename T>
-    [[nodiscard]] matrix<T, 4, 4> operator*(const matrix<T, 4, 4>& lhs, const matrix<T, 4, 4>& rhs) noexcept
+    [[nodiscard]] constexpr matrix<T, 4, 4> operator*(const matrix<T, 4, 4>& lhs, const matrix<T, 4, 4>& rhs) noexcept
     {
         const auto c0 = rhs.column(0);
         const auto c1 = rhs.column(1);
@@ -110,7 +136,7 @@ namespace math
     }
 
     template<typename T>
-    matrix<T, 4, 4>& operator*=(matrix<T, 4, 4>& lhs, const matrix<T, 4, 4>& rhs) noexcept
+    constexpr matrix<T, 4, 4>& operator*=(matrix<T, 4, 4>& lhs, const matrix<T, 4, 4>& rhs) noexcept
     {
         return lhs = lhs * rhs;
     }
@@ -120,10 +146,10 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<typename T>
-    [[nodiscard]] vec<T, 4> operator*(const matrix<T, 4, 4>& lhs, const vec<T, 4>& rhs) noexcept { return vec<T, 4>(dot(lhs.r0, rhs), dot(lhs.r1, rhs), dot(lhs.r2, rhs), dot(lhs.r3, rhs)); }
+    [[nodiscard]] constexpr vec<T, 4> operator*(const matrix<T, 4, 4>& lhs, const vec<T, 4>& rhs) noexcept { return vec<T, 4>(dot(lhs.r0, rhs), dot(lhs.r1, rhs), dot(lhs.r2, rhs), dot(lhs.r3, rhs)); }
 
     template<typename T>
-    [[nodiscard]] vec<T, 3> operator*(const matrix<T, 4, 4>& lhs, const vec<T, 3>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 3> operator*(const matrix<T, 4, 4>& lhs, const vec<T, 3>& rhs) noexcept
     {
         const vec<T, 4> rhs2(rhs.x, rhs.y, rhs.z, T(1));
         return vec<T, 3>(dot(lhs.r0, rhs2), dot(lhs.r1, rhs2), dot(lhs.r2, rhs2));
@@ -134,10 +160,10 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<typename T>
-    [[nodiscard]] matrix<T, 4, 4> operator*(const matrix<T, 4, 4>& lhs, const T rhs) noexcept { return matrix<T, 4, 4>(lhs.r0 * rhs, lhs.r1 * rhs, lhs.r2 * rhs, lhs.r3 * rhs); }
+    [[nodiscard]] constexpr matrix<T, 4, 4> operator*(const matrix<T, 4, 4>& lhs, const T rhs) noexcept { return matrix<T, 4, 4>(lhs.r0 * rhs, lhs.r1 * rhs, lhs.r2 * rhs, lhs.r3 * rhs); }
 
     template<typename T>
-    matrix<T, 4, 4>& operator*=(matrix<T, 4, 4>& lhs, const T rhs) noexcept
+    constexpr matrix<T, 4, 4>& operator*=(matrix<T, 4, 4>& lhs, const T rhs) noexcept
     {
         lhs.r0 *= rhs;
         lhs.r1 *= rhs;
@@ -151,7 +177,7 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<typename T>
-    [[nodiscard]] matrix<T, 4, 4> transpose(const matrix <T, 4, 4>& lhs) noexcept { return matrix<T, 4, 4>(lhs.column(0), lhs.column(1), lhs.column(2), lhs.column(3)); }
+    [[nodiscard]] constexpr matrix<T, 4, 4> transpose(const matrix <T, 4, 4>& lhs) noexcept { return matrix<T, 4, 4>(lhs.column(0), lhs.column(1), lhs.column(2), lhs.column(3)); }
 
     [[nodiscard]] inline matrix<float, 4, 4> invert(const matrix <float, 4, 4>& lhs) noexcept
     {
@@ -205,33 +231,8 @@ namespace math
     // Rotation, scale, translation.
     ////////////////////////////////////////////////////////////////
 
-    inline void decompose(const matrix<float, 4, 4>& transform, matrix<float, 4, 4>& translation, matrix<float, 4, 4>& rotation, matrix<float, 4, 4>& scale) noexcept
-    {
-        // Extract translation.
-        translation[0][3] = transform[0][3];
-        translation[1][3] = transform[1][3];
-        translation[2][3] = transform[2][3];
-
-        // Extract scale.
-        scale[0][0] = length(transform.column(0).xyz());
-        scale[1][1] = length(transform.column(1).xyz());
-        scale[2][2] = length(transform.column(2).xyz());
-
-        // Extract rotation.
-        rotation[0][0] = transform[0][0] / scale[0][0];
-        rotation[0][1] = transform[0][1] / scale[1][1];
-        rotation[0][2] = transform[0][2] / scale[2][2];
-        rotation[1][0] = transform[1][0] / scale[0][0];
-        rotation[1][1] = transform[1][1] / scale[1][1];
-        rotation[1][2] = transform[1][2] / scale[2][2];
-        rotation[2][0] = transform[2][0] / scale[0][0];
-        rotation[2][1] = transform[2][1] / scale[1][1];
-        rotation[2][2] = transform[2][2] / scale[2][2];
-    }
-
-
     template<typename T>
-    [[nodiscard]] matrix<T, 4, 4> translation(const vec<T, 3>& translation) noexcept
+    [[nodiscard]] constexpr matrix<T, 4, 4> translation(const vec<T, 3>& translation) noexcept
     {
         return matrix<T, 4, 4>(
             T(1), T(0), T(0), translation.x,
@@ -242,7 +243,7 @@ namespace math
     }
 
     template<typename T>
-    [[nodiscard]] matrix<T, 4, 4> translation(const vec<T, 4>& translation) noexcept
+    [[nodiscard]] constexpr matrix<T, 4, 4> translation(const vec<T, 4>& translation) noexcept
     {
         return matrix<T, 4, 4>(
             T(1), T(0), T(0), translation.x,
@@ -270,6 +271,39 @@ namespace math
             );
     }
 
+    template<typename T>
+    [[nodiscard]] vec<T, 4> rotation_to_quat(const matrix<T, 3, 3>& r) noexcept
+    {
+        // Pick the largest of w, x, y and z to divide by to keep things stable.
+        const T trace = r[0][0] + r[1][1] + r[2][2];
+        vec<T, 4> q;
+        if (trace > T(0))
+        {
+            const T s = T(2) * sqrt(trace + T(1));
+            const T is = rcp(s);
+            q = vec<T, 4>((r[2][1] - r[1][2]) * is, (r[0][2] - r[2][0]) * is, (r[1][0] - r[0][1]) * is, T(0.25) * s);
+        }
+        else if (r[0][0] > r[1][1] && r[0][0] > r[2][2])
+        {
+            const T s = T(2) * sqrt(T(1) + r[0][0] - r[1][1] - r[2][2]);
+            const T is = rcp(s);
+            q = vec<T, 4>(T(0.25) * s, (r[0][1] + r[1][0]) * is, (r[0][2] + r[2][0]) * is, (r[2][1] - r[1][2]) * is);
+        }
+        else if (r[1][1] > r[2][2])
+        {
+            const T s = T(2) * sqrt(T(1) + r[1][1] - r[0][0] - r[2][2]);
+            const T is = rcp(s);
+            q = vec<T, 4>((r[0][1] + r[1][0]) * is, T(0.25) * s, (r[1][2] + r[2][1]) * is, (r[0][2] - r[2][0]) * is);
+        }
+        else
+        {
+            const T s = T(2) * sqrt(T(1) + r[2][2] - r[0][0] - r[1][1]);
+            const T is = rcp(s);
+            q = vec<T, 4>((r[0][2] + r[2][0]) * is, (r[1][2] + r[2][1]) * is, T(0.25) * s, (r[1][0] - r[0][1]) * is);
+        }
+        return normalize(q);
+    }
+
     template<typename T>
     [[nodiscard]] matrix<T, 4, 4> rotation_x(const T angle) noexcept
     {
@@ -310,7 +344,7 @@ namespace math
     }
 
     template<typename T>
-    [[nodiscard]] matrix<T, 4, 4> scale(const vec<T, 3>& scale) noexcept
+    [[nodiscard]] constexpr matrix<T, 4, 4> scale(const vec<T, 3>& scale) noexcept
     {
         return matrix<T, 4, 4>(
             scale.x, T(0), T(0), T(0),
@@ -336,6 +370,137 @@ namespace math
         return M;
     }
 
+    ////////////////////////////////////////////////////////////////
+    // Decomposition.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Split the upper 3x3 part of a transform into M = R * S, with R a proper rotation and S symmetric (scale and shear).
+     * Uses the scaled Newton iteration R' = (g * R + R^-T / g) / 2. A negative determinant is moved into S, so R is never a reflection.
+     * If M is singular, or so close to it that the determinant is lost in round-off (relative to the product of the row lengths),
+     * the rotation is the identity and S is the symmetric part (M + M^T) / 2.
+     * @param m Matrix to decompose.
+     * @param rotation Orthonormal factor.
+     * @param stretch Symmetric factor.
+     */
+    inline void polar_decompose(const matrix<float, 3, 3>& m, matrix<float, 3, 3>& rotation, matrix<float, 3, 3>& stretch) noexcept
+    {
+        const vec<float, 3>& m0 = m[0];
+        const vec<float, 3>& m1 = m[1];
+        const vec<float, 3>& m2 = m[2];
+
+        const float sign = dot(m0, cross(m1, m2)) < 0 ? -1.0f : 1.0f;
+        vec<float, 3> q0 = m0 * sign;
+        vec<float, 3> q1 = m1 * sign;
+        vec<float, 3> q2 = m2 * sign;
+
+        for (size_t i = 0; i < 16; i++)
+        {
+            // Rows of the cofactor matrix. Divided by the determinant these are the rows of the inverse transpose.
+            const vec<float, 3> c0 = cross(q1, q2);
+            const vec<float, 3> c1 = cross(q2, q0);
+            const vec<float, 3> c2 = cross(q0, q1);
+            const float det = dot(q0, c0);
+            // Hadamard's inequality bounds |det| by the product of the row lengths, which makes the tolerance scale-aware.
+            const float bound = length(q0) * length(q1) * length(q2);
+            if (det <= std::numeric_limits<float>::epsilon() * bound)
+            {
+                q0 = vec<float, 3>(1, 0, 0);
+                q1 = vec<float, 3>(0, 1, 0);
+                q2 = vec<float, 3>(0, 0, 1);
+                break;
+            }
+
+            // Frobenius norm scaling, gamma = sqrt(|R^-T| / |R|).
+            const float n = sqr_length(q0) + sqr_length(q1) + sqr_length(q2);
+            const float nc = sqr_length(c0) + sqr_length(c1) + sqr_length(c2);
+            const float rcp_det = rcp(det);
+            const float gamma = sqrt(sqrt(nc / n) * rcp_det);
+            const float a = 0.5f * gamma;
+            const float b = 0.5f * rcp_det * rcp(gamma);
+
+            const vec<float, 3> n0 = madd(q0, vec<float, 3>(a), c0 * b);
+            const vec<float, 3> n1 = madd(q1, vec<float, 3>(a), c1 * b);
+            const vec<float, 3> n2 = madd(q2, vec<float, 3>(a), c2 * b);
+            const float delta = sqr_length(n0 - q0) + sqr_length(n1 - q1) + sqr_length(n2 - q2);
+            q0 = n0;
+            q1 = n1;
+            q2 = n2;
+            if (delta < 1e-12f) break;
+        }
+
+        rotation[0] = q0;
+        rotation[1] = q1;
+        rotation[2] = q2;
+
+        // S = R^T * M, symmetrized to remove round-off.
+        for (size_t i = 0; i < 3; i++)
+            stretch[i] = madd(vec<float, 3>(q0[i]), m0, madd(vec<float, 3>(q1[i]), m1, q2[i] * m2));
+        for (size_t i = 0; i < 3; i++)
+            for (size_t j = i + 1; j < 3; j++)
+                stretch[i][j] = stretch[j][i] = 0.5f * (stretch[i][j] + stretch[j][i]);
+    }
+
+    /**
+     * @brief Decompose a transform into translation, rotation quaternion (x, y, z, w) and stretch, such that transform = T * R * S.
+     * Handles shear and negative scale, see polar_decompose.
+     * @param transform Affine transform.
+     * @param translation Translation.
+     * @param rotation Unit quaternion.
+     * @param stretch Symmetric scale and shear matrix.
+     */
+    inline void decompose(const matrix<float, 4, 4>& transform, vec<float, 3>& translation, vec<float, 4>& rotation, matrix<float, 3, 3>& stretch) noexcept
+    {
+        translation = vec<float, 3>(transform[0][3], transform[1][3], transform[2][3]);
+
+        matrix<float, 3, 3> m;
+        m[0] = transform.r0.xyz();
+        m[1] = transform.r1.xyz();
+        m[2] = transform.r2.xyz();
+        matrix<float, 3, 3> r;
+        polar_decompose(m, r, stretch);
+        rotation = rotation_to_quat(r);
+    }
+
+    /**
+     * @brief Decompose a transform into translation, rotation and stretch matrices, such that transform = translation * rotation * scale.
+     * @param transform Affine transform.
+     * @param translation Translation matrix.
+     * @param rotation Rotation matrix.
+     * @param scale Symmetric scale and shear matrix.
+     */
+    inline void decompose(const matrix<float, 4, 4>& transform, matrix<float, 4, 4>& translation, matrix<float, 4, 4>& rotation, matrix<float, 4, 4>& scale) noexcept
+    {
+        matrix<float, 3, 3> m;
+        m[0] = transform.r0.xyz();
+        m[1] = transform.r1.xyz();
+        m[2] = transform.r2.xyz();
+        matrix<float, 3, 3> r, s;
+        polar_decompose(m, r, s);
+
+        translation = math::translation(vec<float, 3>(transform[0][3], transform[1][3], transform[2][3]));
+        rotation = matrix<float, 4, 4>(r);
+        scale = matrix<float, 4, 4>(s);
+    }
+
+    /**
+     * @brief Decompose each transform of a range with the single transform version. A convenience for loaders, it is not
+     * vectorized. All output spans must be at least as large as the input span.
+     * @param transforms Affine transforms.
+     * @param translations Translations.
+     * @param rotations Unit quaternions.
+     * @param stretches Symmetric scale and shear matrices.
+     */
+    inline void decompose(const std::span<const matrix<float, 4, 4>> transforms, const std::span<vec<float, 3>> translations, const std::span<vec<float, 4>> rotations, const std::span<matrix<float, 3, 3>> stretches) noexcept
+    {
+        assert(translations.size() >= transforms.size());
+        assert(rotations.size() >= transforms.size());
+        assert(stretches.size() >= transforms.size());
+
+        for (size_t i = 0; i < transforms.size(); i++)
+            decompose(transforms[i], translations[i], rotations[i], stretches[i]);
+    }
+
     ////////////////////////////////////////////////////////////////
     // Output.
     ////////////////////////////////////////////////////////////////
@@ -1,11 +1,18 @@
 #pragma once
 
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <utility>
+
 ////////////////////////////////////////////////////////////////
 // Current target includes.
 ////////////////////////////////////////////////////////////////
 
 #include "math/vector/vector.h"
 #include "math/math_type_traits.h"
+#include "math/uninit.h"
 
 namespace math
 {
@@ -23,34 +30,32 @@ namespace math
         // Constructors.
         ////////////////////////////////////////////////////////////////
         
-        [[nodiscard]] matrix() noexcept : data() {}
+        [[nodiscard]] constexpr matrix() noexcept : data() {}
 
-        [[nodiscard]] explicit matrix(const T v) noexcept
+        [[nodiscard]] constexpr explicit matrix(uninit_t) noexcept : matrix(uninit, std::make_index_sequence<N>()) {}
+
+        [[nodiscard]] constexpr explicit matrix(const T v) noexcept
         {
             for (size_t i = 0; i < N; i++)
                 data[i] = v;
         }
 
-        [[nodiscard]] matrix(const matrix<T, N, M>& rhs) noexcept
-        {
-            for (size_t i = 0; i < N; i++)
-                data[i] = rhs.data[i];
-        }
+        [[nodiscard]] constexpr matrix(const matrix<T, N, M>& rhs) noexcept = default;
 
         template<std::convertible_to<T> ... Ts>
-        [[nodiscard]] explicit matrix(const Ts ... v)
+        [[nodiscard]] constexpr explicit matrix(const Ts ... v)
         {
             size_t i = 0;
             ((data[i / M][i++ % M] = v), ...);
         }
 
-        [[nodiscard]] explicit matrix(const T* ptr)
+        [[nodiscard]] constexpr explicit matrix(const T* ptr)
         {
             std::copy(ptr, ptr + size, data);
         }
 
         template<typename U>
-        [[nodiscard]] explicit matrix(const matrix<U, N, M>& rhs)
+        [[nodiscard]] constexpr explicit matrix(const matrix<U, N, M>& rhs)
         {
             for (size_t i = 0; i < N; i++)
                 data[i] = static_cast<row_type>(rhs.data[i]);
@@ -60,22 +65,17 @@ namespace math
         // Assignment operators.
         ////////////////////////////////////////////////////////////////
 
-        matrix<T, N, M>& operator=(const T rhs) noexcept
+        constexpr matrix<T, N, M>& operator=(const T rhs) noexcept
         {
             for (size_t i = 0; i < N; i++)
                 data[i] = rhs;
             return *this;
         }
 
-        matrix<T, N, M>& operator=(const matrix<T, N, M>& rhs) noexcept
-        {
-            for (size_t i = 0; i < N; i++)
-                data[i] = rhs.data[i];
-            return *this;
-        }
+        constexpr matrix<T, N, M>& operator=(const matrix<T, N, M>& rhs) noexcept = default;
 
         template<typename U>
-        matrix<T, N, M>& operator=(const matrix<U, N, M>& rhs)
+        constexpr matrix<T, N, M>& operator=(const matrix<U, N, M>& rhs)
         {
             for (size_t i = 0; i < N; i++)
                 data[i] = static_cast<row_type>(rhs.data[i]);
@@ -90,17 +90,17 @@ namespace math
 
         matrix(matrix<T, N, M>&& rhs) noexcept = default;
 
-        matrix<T, N, M>& operator=(matrix<T, N, M>&& rhs) noexcept = default;
+        constexpr matrix<T, N, M>& operator=(matrix<T, N, M>&& rhs) noexcept = default;
 
         ////////////////////////////////////////////////////////////////
         // Element access.
         ////////////////////////////////////////////////////////////////
         
-        [[nodiscard]] const row_type& operator[](const size_t i) const { assert(i < N); return data[i]; }
+        [[nodiscard]] constexpr const row_type& operator[](const size_t i) const { assert(i < N); return data[i]; }
 
-        [[nodiscard]] row_type& operator[](const size_t i) { assert(i < N); return data[i]; }
+        [[nodiscard]] constexpr row_type& operator[](const size_t i) { assert(i < N); return data[i]; }
 
-        [[nodiscard]] column_type column(const size_t j) const
+        [[nodiscard]] constexpr column_type column(const size_t j) const
         {
             assert(j < M);
             column_type col;
@@ -108,6 +108,10 @@ namespace math
                 col[i] = data[i][j];
             return col;
         }
+
+    private:
+        template<size_t... I>
+        [[nodiscard]] constexpr matrix(uninit_t, std::index_sequence<I...>) noexcept : data{ (static_cast<void>(I), row_type(uninit))... } {}
     };
 
     ////////////////////////////////////////////////////////////////
@@ -115,11 +119,11 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<is_square_matrix T>
-    [[nodiscard]] T identity() noexcept
+    [[nodiscard]] constexpr T identity() noexcept
     {
         T mat = zero<T>();
         for (size_t i = 0; i < T::row_type::size; i++)
-            mat[i][i] = T::element_type(1);
+            mat[i][i] = typename T::element_type(1);
         return mat;
     }
 
@@ -128,7 +132,7 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<typename T, size_t N, size_t K, size_t M>
-    [[nodiscard]] matrix<T, N, M> operator*(const matrix<T, N, K>& lhs, const matrix<T, K, M>& rhs) noexcept
+    [[nodiscard]] constexpr matrix<T, N, M> operator*(const matrix<T, N, K>& lhs, const matrix<T, K, M>& rhs) noexcept
     {
         matrix<T, N, M> mat;
         // Find out which is more optimal.
@@ -156,7 +160,7 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<typename T, size_t N, size_t M>
-    [[nodiscard]] vec<T, M> operator*(const matrix<T, N, M>& lhs, const vec<T, M>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, M> operator*(const matrix<T, N, M>& lhs, const vec<T, M>& rhs) noexcept
     {
         vec<T, M> v;
         for (size_t i = 0; i < N; i++)
@@ -165,14 +169,14 @@ namespace math
     }
 
     template<typename T, size_t N, size_t M>
-    [[nodiscard]] vec<T, M> operator*(const vec<T, M>& lhs, const matrix<T, N, M>& rhs) noexcept { return rhs * lhs; }
+    [[nodiscard]] constexpr vec<T, M> operator*(const vec<T, M>& lhs, const matrix<T, N, M>& rhs) noexcept { return rhs * lhs; }
 
     ////////////////////////////////////////////////////////////////
     // Matrix-Scalar multiplication.
     ////////////////////////////////////////////////////////////////
 
     template<typename T, size_t N, size_t M>
-    [[nodiscard]] matrix<T, N, M> operator*(const matrix<T, N, M>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr matrix<T, N, M> operator*(const matrix<T, N, M>& lhs, const T rhs) noexcept
     {
         matrix<T, N, M> mat;
         for (size_t i = 0; i < N; i++)
@@ -181,10 +185,10 @@ namespace math
     }
 
     template<typename T, size_t N, size_t M>
-    [[nodiscard]] matrix<T, N, M> operator*(const T lhs, const matrix<T, N, M>& rhs) noexcept { return rhs * lhs; }
+    [[nodiscard]] constexpr matrix<T, N, M> operator*(const T lhs, const matrix<T, N, M>& rhs) noexcept { return rhs * lhs; }
 
     template<typename T, size_t N, size_t M>
-    matrix<T, N, M>& operator*=(matrix<T, N, M>& lhs, const T rhs) noexcept
+    constexpr matrix<T, N, M>& operator*=(matrix<T, N, M>& lhs, const T rhs) noexcept
     {
         for (size_t i = 0; i < N; i++)
             lhs[i] *= rhs;
@@ -196,7 +200,7 @@ namespace math
     ////////////////////////////////////////////////////////////////
     
     template<typename T, size_t N, size_t M>
-    [[nodiscard]] matrix<T, M, N> transpose(const matrix <T, N, M>& lhs) noexcept
+    [[nodiscard]] constexpr matrix<T, M, N> transpose(const matrix <T, N, M>& lhs) noexcept
     {
         matrix<T, M, N> mat;
         for (size_t i = 0; i < N; i++)
@@ -0,0 +1,192 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <immintrin.h>
+#include <iostream>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/vector/simd/vec3fa.h"
+#include "math/vector/simd/vec4fa.h"
+#include "math/matrix/mat3x4.h"
+#include "math/matrix/simd/mat4x4fa.h"
+
+namespace math
+{
+    /**=================================================================================================
+     * Struct: mat3x4fa
+     * =================================================================================================
+     * @struct  mat3x4fa
+     *
+     * @brief   SIMD affine transform. Stores the upper three rows of a 4x4 transform, the last row is implicitly (0, 0, 0, 1).
+    **/
+    struct mat3x4fa
+    {
+        using element_type = float;
+        using row_type = vec4fa;
+        using column_type = vec3fa;
+        static constexpr size_t size = 12;
+
+        row_type r0, r1, r2;
+
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] mat3x4fa() noexcept = default;
+
+        [[nodiscard]] explicit mat3x4fa(uninit_t) noexcept : r0(uninit), r1(uninit), r2(uninit) {}
+
+        [[nodiscard]] explicit mat3x4fa(const float v) noexcept : r0(v), r1(v), r2(v) {}
+
+        [[nodiscard]] mat3x4fa(const row_type& r0, const row_type& r1, const row_type& r2) noexcept : r0(r0), r1(r1), r2(r2) {}
+
+        [[nodiscard]] mat3x4fa(const mat3x4fa& rhs) noexcept = default;
+
+        [[nodiscard]] explicit mat3x4fa(const matrix<float, 3, 4>& rhs) noexcept : r0(rhs.r0), r1(rhs.r1), r2(rhs.r2) {}
+
+        /**
+         * @brief Drop the last row of a 4x4 transform, which must be (0, 0, 0, 1).
+         */
+        [[nodiscard]] explicit mat3x4fa(const mat4x4fa& rhs) noexcept : r0(rhs.r0), r1(rhs.r1), r2(rhs.r2) {}
+
+        ////////////////////////////////////////////////////////////////
+        // Assignment operators.
+        ////////////////////////////////////////////////////////////////
+
+        mat3x4fa& operator=(const mat3x4fa& rhs) noexcept = default;
+
+        mat3x4fa& operator=(const matrix<float, 3, 4>& rhs) noexcept { r0 = row_type(rhs.r0); r1 = row_type(rhs.r1); r2 = row_type(rhs.r2); return *this; }
+
+        ////////////////////////////////////////////////////////////////
+        // Defaulted constructors and operators.
+        ////////////////////////////////////////////////////////////////
+
+        ~mat3x4fa() noexcept = default;
+
+        mat3x4fa(mat3x4fa&& rhs) noexcept = default;
+
+        mat3x4fa& operator=(mat3x4fa&& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Casting operators.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] explicit operator matrix<float, 3, 4>() const noexcept
+        {
+            return matrix<float, 3, 4>(static_cast<vec<float, 4>>(r0), static_cast<vec<float, 4>>(r1), static_cast<vec<float, 4>>(r2));
+        }
+
+        [[nodiscard]] explicit operator mat4x4fa() const noexcept { return mat4x4fa(r0, r1, r2, row_type(0, 0, 0, 1)); }
+
+        ////////////////////////////////////////////////////////////////
+        // Element access.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] const row_type& operator[](const size_t i) const { assert(i < 3); return (&r0)[i]; }
+
+        [[nodiscard]] row_type& operator[](const size_t i) { assert(i < 3); return (&r0)[i]; }
+
+        [[nodiscard]] column_type column(const size_t j) const { assert(j < 4); return column_type(r0[j], r1[j], r2[j]); }
+
+        ////////////////////////////////////////////////////////////////
+        // Construct special values.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] static mat3x4fa identity() noexcept { return mat3x4fa(row_type(1, 0, 0, 0), row_type(0, 1, 0, 0), row_type(0, 0, 1, 0)); }
+    };
+
+    ////////////////////////////////////////////////////////////////
+    // Matrix-Matrix multiplication.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Compose two affine transforms as if they were 4x4 matrices. Applying the result applies rhs first, then lhs.
+     */
+    [[nodiscard]] inline mat3x4fa operator*(const mat3x4fa& lhs, const mat3x4fa& rhs) noexcept
+    {
+        // Same as the 4x4 product, except that the implicit last row of rhs only contributes the translation of lhs.
+        const __m128 wmask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+        mat3x4fa mat;
+        for (size_t i = 0; i < 3; i++)
+        {
+            const vec4fa& r = lhs[i];
+            mat[i] = madd(r.xxxx(), rhs.r0, madd(r.yyyy(), rhs.r1, madd(r.zzzz(), rhs.r2, vec4fa(_mm_and_ps(r, wmask)))));
+        }
+        return mat;
+    }
+
+    inline mat3x4fa& operator*=(mat3x4fa& lhs, const mat3x4fa& rhs) noexcept { return lhs = lhs * rhs; }
+
+    ////////////////////////////////////////////////////////////////
+    // Matrix-Vector multiplication.
+    ////////////////////////////////////////////////////////////////
+
+    namespace detail
+    {
+        /**
+         * @brief Multiply the rows with a 4-component vector and sum each product horizontally.
+         */
+        [[nodiscard]] inline vec3fa transform(const mat3x4fa& lhs, const __m128 rhs) noexcept
+        {
+            const __m128 a = _mm_mul_ps(lhs.r0, rhs);
+            const __m128 b = _mm_mul_ps(lhs.r1, rhs);
+            const __m128 c = _mm_mul_ps(lhs.r2, rhs);
+            return vec3fa(_mm_hadd_ps(_mm_hadd_ps(a, b), _mm_hadd_ps(c, _mm_setzero_ps())));
+        }
+    }
+
+    [[nodiscard]] inline vec3fa transform_point(const mat3x4fa& lhs, const vec3fa& rhs) noexcept
+    {
+        const __m128 xyzmask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+        return detail::transform(lhs, _mm_or_ps(_mm_and_ps(rhs, xyzmask), _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f)));
+    }
+
+    [[nodiscard]] inline vec3fa transform_direction(const mat3x4fa& lhs, const vec3fa& rhs) noexcept
+    {
+        const __m128 xyzmask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+        return detail::transform(lhs, _mm_and_ps(rhs, xyzmask));
+    }
+
+    [[nodiscard]] inline vec3fa operator*(const mat3x4fa& lhs, const vec3fa& rhs) noexcept { return transform_point(lhs, rhs); }
+
+    ////////////////////////////////////////////////////////////////
+    // Transpose, invert.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Invert an affine transform. Returns a zero linear part if the transform is singular.
+     */
+    [[nodiscard]] inline mat3x4fa invert(const mat3x4fa& lhs) noexcept
+    {
+        // Transposing gives the columns of the linear part and the translation.
+        __m128 a0 = lhs.r0, a1 = lhs.r1, a2 = lhs.r2, a3 = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(a0, a1, a2, a3);
+        const vec3fa t(a3);
+
+        // The cofactors of the rows are the columns of the inverse, up to the determinant.
+        const vec3fa x0(lhs.r0.m128), x1(lhs.r1.m128), x2(lhs.r2.m128);
+        const vec3fa c0 = cross(x1, x2), c1 = cross(x2, x0), c2 = cross(x0, x1);
+        const float det = dot(x0, c0);
+        const vec3fa invdet(det != 0.0f ? 1.0f / det : 0.0f);
+        __m128 i0 = c0 * invdet, i1 = c1 * invdet, i2 = c2 * invdet;
+        __m128 i3 = -madd(vec3fa(i0), t.xxx(), madd(vec3fa(i1), t.yyy(), vec3fa(i2) * t.zzz()));
+        _MM_TRANSPOSE4_PS(i0, i1, i2, i3);
+        return mat3x4fa(i0, i1, i2);
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Output.
+    ////////////////////////////////////////////////////////////////
+
+    inline std::ostream& operator<<(std::ostream& out, const mat3x4fa& m)
+    {
+        return out << "[" << m.r0 << "\n " << m.r1 << "\n " << m.r2 << "]";
+    }
+}
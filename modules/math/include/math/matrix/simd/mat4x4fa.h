@@ -1,154 +1,143 @@
 #pragma once
 
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <immintrin.h>
+#include <iostream>
+
 ////////////////////////////////////////////////////////////////
 // Current target includes.
 ////////////////////////////////////////////////////////////////
 
 #include "math/vector/simd/vec4fa.h"
-#include "math/matrix/matrix.h"
+#include "math/matrix/mat4x4.h"
 
-#if 0
 namespace math
 {
     struct mat4x4fa
     {
-        using RowType = vec4fa;
-        using ColumnType = vec4fa;
+        using element_type = float;
+        using row_type = vec4fa;
+        using column_type = vec4fa;
+        static constexpr size_t size = 16;
 
-        RowType r0, r1, r2, r3;
+        row_type r0, r1, r2, r3;
 
         ////////////////////////////////////////////////////////////////
-        // Constructors and assignment operators.
+        // Constructors.
         ////////////////////////////////////////////////////////////////
 
-        inline mat4x4fa() {}
+        [[nodiscard]] mat4x4fa() noexcept = default;
 
-        inline explicit mat4x4fa(const float v)
-        {
-            r0 = RowType(v);
-            r1 = RowType(v);
-            r2 = RowType(v);
-            r3 = RowType(v);
-        }
+        [[nodiscard]] explicit mat4x4fa(uninit_t) noexcept : r0(uninit), r1(uninit), r2(uninit), r3(uninit) {}
 
-        inline mat4x4fa(const RowType& r0, const RowType& r1, const RowType& r2, const RowType& r3) : r0(r0), r1(r1), r2(r2), r3(r3) {}
+        [[nodiscard]] explicit mat4x4fa(const float v) noexcept : r0(v), r1(v), r2(v), r3(v) {}
 
-        inline mat4x4fa(const mat4x4fa& rhs)
-        {
-            r0 = rhs.r0;
-            r1 = rhs.r1;
-            r2 = rhs.r2;
-            r3 = rhs.r3;
-        }
+        [[nodiscard]] mat4x4fa(const row_type& r0, const row_type& r1, const row_type& r2, const row_type& r3) noexcept : r0(r0), r1(r1), r2(r2), r3(r3) {}
 
-        inline mat4x4fa& operator=(const mat4x4fa& rhs)
-        {
-            r0 = rhs.r0;
-            r1 = rhs.r1;
-            r2 = rhs.r2;
-            r3 = rhs.r3;
-            return *this;
-        }
+        [[nodiscard]] mat4x4fa(const mat4x4fa& rhs) noexcept = default;
 
-        template<typename U>
-        inline explicit mat4x4fa(const matrix<U, 4, 4>& rhs)
-        {
-            r0 = static_cast<RowType>(rhs[0]);
-            r1 = static_cast<RowType>(rhs[1]);
-            r2 = static_cast<RowType>(rhs[2]);
-            r3 = static_cast<RowType>(rhs[3]);
-        }
+        [[nodiscard]] explicit mat4x4fa(const matrix<float, 4, 4>& rhs) noexcept : r0(rhs.r0), r1(rhs.r1), r2(rhs.r2), r3(rhs.r3) {}
+
+        ////////////////////////////////////////////////////////////////
+        // Assignment operators.
+        ////////////////////////////////////////////////////////////////
+
+        mat4x4fa& operator=(const mat4x4fa& rhs) noexcept = default;
+
+        mat4x4fa& operator=(const matrix<float, 4, 4>& rhs) noexcept { r0 = row_type(rhs.r0); r1 = row_type(rhs.r1); r2 = row_type(rhs.r2); r3 = row_type(rhs.r3); return *this; }
+
+        ////////////////////////////////////////////////////////////////
+        // Defaulted constructors and operators.
+        ////////////////////////////////////////////////////////////////
+
+        ~mat4x4fa() noexcept = default;
+
+        mat4x4fa(mat4x4fa&& rhs) noexcept = default;
+
+        mat4x4fa& operator=(mat4x4fa&& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Casting operators.
+        ////////////////////////////////////////////////////////////////
 
-        template<typename U>
-        inline mat4x4fa& operator=(const matrix<U, 4, 4>& rhs)
+        [[nodiscard]] explicit operator matrix<float, 4, 4>() const noexcept
         {
-            r0 = static_cast<RowType>(rhs[0]);
-            r1 = static_cast<RowType>(rhs[1]);
-            r2 = static_cast<RowType>(rhs[2]);
-            r3 = static_cast<RowType>(rhs[3]);
-            return *this;
+            return matrix<float, 4, 4>(static_cast<vec<float, 4>>(r0), static_cast<vec<float, 4>>(r1), static_cast<vec<float, 4>>(r2), static_cast<vec<float, 4>>(r3));
         }
 
         ////////////////////////////////////////////////////////////////
         // Element access.
         ////////////////////////////////////////////////////////////////
 
-        inline const RowType& operator[](const size_t i) const { assert(i < 4); return (&r0)[i]; }
+        [[nodiscard]] const row_type& operator[](const size_t i) const { assert(i < 4); return (&r0)[i]; }
 
-        inline RowType& operator[](const size_t i) { assert(i < 4); return (&r0)[i]; }
+        [[nodiscard]] row_type& operator[](const size_t i) { assert(i < 4); return (&r0)[i]; }
 
-        inline ColumnType column(const size_t j) const { assert(j < 4); return ColumnType(r0[j], r1[j], r2[j], r3[j]); }
+        [[nodiscard]] column_type column(const size_t j) const { assert(j < 4); return column_type(r0[j], r1[j], r2[j], r3[j]); }
 
         ////////////////////////////////////////////////////////////////
         // Construct special values.
         ////////////////////////////////////////////////////////////////
 
-        inline static mat4x4fa identity() { return mat4x4fa(RowType(1, 0, 0, 0), RowType(0, 1, 0, 0), RowType(0, 0, 1, 0), RowType(0, 0, 0, 1)); }
-
-        inline static mat4x4fa zeroes() { return mat4x4fa(0.0f); }
+        [[nodiscard]] static mat4x4fa identity() noexcept { return mat4x4fa(row_type(1, 0, 0, 0), row_type(0, 1, 0, 0), row_type(0, 0, 1, 0), row_type(0, 0, 0, 1)); }
 
-        inline static mat4x4fa ones() { return mat4x4fa(1.0f); }
+        [[nodiscard]] static mat4x4fa zeroes() noexcept { return mat4x4fa(0.0f); }
 
-        inline static mat4x4fa highest() { return mat4x4fa(std::numeric_limits<float>::max()); }
+        [[nodiscard]] static mat4x4fa ones() noexcept { return mat4x4fa(1.0f); }
 
-        inline static mat4x4fa lowest() { return mat4x4fa(std::numeric_limits<float>::lowest()); }
+        [[nodiscard]] static mat4x4fa highest() noexcept { return mat4x4fa(std::numeric_limits<float>::max()); }
 
-        inline static mat4x4fa pos_infinity() { static_assert(std::numeric_limits<float>::has_infinity); return mat4x4fa(std::numeric_limits<float>::infinity()); }
+        [[nodiscard]] static mat4x4fa lowest() noexcept { return mat4x4fa(std::numeric_limits<float>::lowest()); }
 
-        inline static mat4x4fa neg_infinity() { static_assert(std::numeric_limits<float>::has_infinity); return mat4x4fa(-std::numeric_limits<float>::infinity()); }
+        [[nodiscard]] static mat4x4fa pos_infinity() noexcept { return mat4x4fa(std::numeric_limits<float>::infinity()); }
 
-        inline static mat4x4fa NaN() { static_assert(std::numeric_limits<float>::has_quiet_NaN); return mat4x4fa(std::numeric_limits<float>::quiet_NaN()); }
+        [[nodiscard]] static mat4x4fa neg_infinity() noexcept { return mat4x4fa(-std::numeric_limits<float>::infinity()); }
 
+        [[nodiscard]] static mat4x4fa NaN() noexcept { return mat4x4fa(std::numeric_limits<float>::quiet_NaN()); }
     };
 
     ////////////////////////////////////////////////////////////////
     // Matrix-Matrix multiplication.
     ////////////////////////////////////////////////////////////////
 
-    inline mat4x4fa operator*(const mat4x4fa& lhs, const mat4x4fa& rhs)
+    [[nodiscard]] inline mat4x4fa operator*(const mat4x4fa& lhs, const mat4x4fa& rhs) noexcept
     {
+        // Every row of the result is a linear combination of the rows of rhs, which avoids extracting columns.
         mat4x4fa mat;
-
-        for (size_t j = 0; j < 4; j++)
+        for (size_t i = 0; i < 4; i++)
         {
-            const vec4fa col = rhs.column(j);
-            for (size_t i = 0; i < 4; i++)
-            {
-                mat[i][j] = dot(lhs[i], col);
-            }
+            const vec4fa& r = lhs[i];
+            mat[i] = madd(r.xxxx(), rhs.r0, madd(r.yyyy(), rhs.r1, madd(r.zzzz(), rhs.r2, r.wwww() * rhs.r3)));
         }
-
         return mat;
     }
 
+    inline mat4x4fa& operator*=(mat4x4fa& lhs, const mat4x4fa& rhs) noexcept { return lhs = lhs * rhs; }
+
     ////////////////////////////////////////////////////////////////
     // Matrix-Vector multiplication.
     ////////////////////////////////////////////////////////////////
 
-    inline vec4fa operator*(const mat4x4fa& lhs, const vec4fa& rhs)
+    [[nodiscard]] inline vec4fa operator*(const mat4x4fa& lhs, const vec4fa& rhs) noexcept
     {
         return vec4fa(dot(lhs.r0, rhs), dot(lhs.r1, rhs), dot(lhs.r2, rhs), dot(lhs.r3, rhs));
     }
 
-    inline vec4fa operator*(const vec4fa& lhs, const mat4x4fa& rhs) { return rhs * lhs; }
+    [[nodiscard]] inline vec4fa operator*(const vec4fa& lhs, const mat4x4fa& rhs) noexcept { return rhs * lhs; }
 
     ////////////////////////////////////////////////////////////////
     // Matrix-Scalar multiplication.
     ////////////////////////////////////////////////////////////////
 
-    inline mat4x4fa operator*(const mat4x4fa& lhs, const float rhs)
-    {
-        mat4x4fa mat;
-        mat.r0 = lhs.r0 * rhs;
-        mat.r1 = lhs.r1 * rhs;
-        mat.r2 = lhs.r2 * rhs;
-        mat.r3 = lhs.r3 * rhs;
-        return mat;
-    }
+    [[nodiscard]] inline mat4x4fa operator*(const mat4x4fa& lhs, const float rhs) noexcept { return mat4x4fa(lhs.r0 * rhs, lhs.r1 * rhs, lhs.r2 * rhs, lhs.r3 * rhs); }
 
-    inline mat4x4fa operator*(const float lhs, const mat4x4fa& rhs) { return rhs * lhs; }
+    [[nodiscard]] inline mat4x4fa operator*(const float lhs, const mat4x4fa& rhs) noexcept { return rhs * lhs; }
 
-    inline mat4x4fa& operator*=(mat4x4fa& lhs, const float rhs)
+    inline mat4x4fa& operator*=(mat4x4fa& lhs, const float rhs) noexcept
     {
         lhs.r0 *= rhs;
         lhs.r1 *= rhs;
@@ -161,6 +150,13 @@ namespace math
     // Transpose, invert.
     ////////////////////////////////////////////////////////////////
 
+    [[nodiscard]] inline mat4x4fa transpose(const mat4x4fa& lhs) noexcept
+    {
+        __m128 r0 = lhs.r0, r1 = lhs.r1, r2 = lhs.r2, r3 = lhs.r3;
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        return mat4x4fa(r0, r1, r2, r3);
+    }
+
     ////////////////////////////////////////////////////////////////
     // Output.
     ////////////////////////////////////////////////////////////////
@@ -169,6 +165,4 @@ namespace math
     {
         return out << "[" << m.r0 << "\n " << m.r1 << "\n " << m.r2 << "\n " << m.r3 << "]";
     }
-
 }
-#endif
\ No newline at end of file
@@ -0,0 +1,163 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+/*
+ * Parallel loops for the batch functions.
+ *
+ * parallel_for and parallel_reduce split a range of indices into chunks and run them on the current executor. By default,
+ * this is a thread pool owned by the library, which is created on first use. Each thread takes chunks from the front of its
+ * own share of the range and steals from the back of the shares of other threads when it runs out. Applications with their
+ * own pool can provide an executor instead, so that the library does not start any threads.
+ */
+
+namespace math
+{
+    /**
+     * @brief Half-open range of indices.
+     */
+    struct index_range
+    {
+        size_t begin = 0;
+        size_t end   = 0;
+
+        [[nodiscard]] constexpr size_t size() const noexcept { return end > begin ? end - begin : 0; }
+    };
+
+    /**
+     * @brief Interface to run tasks on the threads of an application.
+     */
+    class executor
+    {
+    public:
+        virtual ~executor() noexcept = default;
+
+        /**
+         * @brief Number of tasks that can run at the same time, including the calling thread.
+         */
+        [[nodiscard]] virtual size_t concurrency() const noexcept = 0;
+
+        /**
+         * @brief Call task(i) for every i in [0, count) and return when all calls have finished. The calls may run in any order
+         * and on any thread, including the calling one. If a call throws, one of the exceptions must be rethrown after all
+         * calls have finished.
+         */
+        virtual void run(size_t count, const std::function<void(size_t)>& task) = 0;
+    };
+
+    /**
+     * @brief Set the number of threads of the library's thread pool, including the calling thread. The pool is recreated on
+     * the next parallel call. Not thread-safe with respect to concurrent parallel calls.
+     * @param count Number of threads. 0 uses std::thread::hardware_concurrency, 1 runs everything on the calling thread.
+     */
+    void set_thread_count(size_t count);
+
+    /**
+     * @brief Number of tasks the current executor can run at the same time.
+     */
+    [[nodiscard]] size_t thread_count();
+
+    /**
+     * @brief Run all parallel calls on an external executor instead of the library's thread pool. Not thread-safe with
+     * respect to concurrent parallel calls.
+     * @param e Executor, which must stay alive until it is replaced. nullptr restores the thread pool.
+     */
+    void set_executor(executor* e) noexcept;
+
+    /**
+     * @brief The external executor if one was set, otherwise the library's thread pool.
+     */
+    [[nodiscard]] executor& current_executor();
+
+    namespace detail
+    {
+        /**
+         * @brief Number of chunks of at least grain indices to split n indices into. A few chunks per thread, so that threads
+         * that finish early can steal the remaining ones.
+         */
+        [[nodiscard]] inline size_t chunk_count(const size_t n, const size_t grain, const size_t concurrency) noexcept
+        {
+            if (concurrency <= 1) return 1;
+            return std::clamp<size_t>(n / std::max<size_t>(grain, 1), 1, concurrency * 4);
+        }
+
+        /**
+         * @brief Start of chunk i when n indices are split into chunks of equal size.
+         */
+        [[nodiscard]] constexpr size_t chunk_begin(const size_t n, const size_t chunks, const size_t i) noexcept
+        {
+            return i * (n / chunks) + std::min(i, n % chunks);
+        }
+
+        /**
+         * @brief Run the tasks of a parallel loop on an executor. Marks the threads as running a task while they do, so that
+         * parallel calls from within a task run serially on any executor. Called from a task, it runs all tasks serially.
+         */
+        void run_tasks(executor& e, size_t count, const std::function<void(size_t)>& task);
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Parallel loops.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Call f(begin, end) on disjoint subranges that together cover r. Runs on the calling thread if r is smaller than
+     * two grains. Parallel calls from within f run serially on the thread that calls them, both on the thread pool and on an
+     * external executor.
+     * @param r Range.
+     * @param grain Minimum number of indices per call.
+     * @param f Function.
+     */
+    template<typename F>
+    void parallel_for(const index_range r, const size_t grain, F&& f)
+    {
+        const size_t n = r.size();
+        if (n == 0) return;
+
+        executor&    e      = current_executor();
+        const size_t chunks = detail::chunk_count(n, grain, e.concurrency());
+        if (chunks <= 1)
+        {
+            f(r.begin, r.end);
+            return;
+        }
+
+        detail::run_tasks(e, chunks, [&](const size_t i) { f(r.begin + detail::chunk_begin(n, chunks, i), r.begin + detail::chunk_begin(n, chunks, i + 1)); });
+    }
+
+    /**
+     * @brief Reduce r by calling f(begin, end) on disjoint subranges and combining the results pairwise, in the order of the
+     * subranges. The subranges depend on the number of threads, so non-associative reductions such as floating point sums
+     * may differ slightly between thread counts.
+     * @param r Range.
+     * @param grain Minimum number of indices per call.
+     * @param identity Result for an empty range.
+     * @param f Function returning the result of a subrange.
+     * @param combine Function combining the results of two consecutive subranges.
+     * @return Result.
+     */
+    template<typename T, typename F, typename C>
+    [[nodiscard]] T parallel_reduce(const index_range r, const size_t grain, const T& identity, F&& f, C&& combine)
+    {
+        const size_t n = r.size();
+        if (n == 0) return identity;
+
+        executor&    e      = current_executor();
+        const size_t chunks = detail::chunk_count(n, grain, e.concurrency());
+        if (chunks <= 1) return f(r.begin, r.end);
+
+        std::vector<T> partial(chunks, identity);
+        detail::run_tasks(e, chunks, [&](const size_t i) { partial[i] = f(r.begin + detail::chunk_begin(n, chunks, i), r.begin + detail::chunk_begin(n, chunks, i + 1)); });
+
+        for (size_t step = 1; step < chunks; step *= 2)
+            for (size_t i = 0; i + step < chunks; i += 2 * step) partial[i] = combine(partial[i], partial[i + step]);
+        return partial[0];
+    }
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <iostream>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/matrix/mat4x4.h"
+#include "math/quaternion/quat.h"
+#include "math/vector/vec3.h"
+
+namespace math
+{
+    /**=================================================================================================
+     * Struct: dual_quat
+     * =================================================================================================
+     * @struct  dual_quat
+     *
+     * @brief   Dual quaternion real + eps * dual, representing a rigid transform. Default constructs to the identity transform.
+     *
+     * @tparam  T   Component type.
+    **/
+    template<typename T>
+    struct dual_quat
+    {
+        using element_type = T;
+        static constexpr size_t size = 8;
+
+        quat<T> real;
+        quat<T> dual;
+
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] dual_quat() noexcept : real(), dual(0, 0, 0, 0) {}
+
+        [[nodiscard]] dual_quat(const quat<T>& real, const quat<T>& dual) noexcept : real(real), dual(dual) {}
+
+        /**
+         * @brief Rigid transform that first rotates and then translates.
+         */
+        [[nodiscard]] dual_quat(const quat<T>& rotation, const vec<T, 3>& translation) noexcept : real(rotation), dual(quat<T>(translation, T(0)) * rotation * T(0.5)) {}
+
+        [[nodiscard]] dual_quat(const dual_quat<T>& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Assignment operators.
+        ////////////////////////////////////////////////////////////////
+
+        dual_quat<T>& operator=(const dual_quat<T>& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Defaulted constructors and operators.
+        ////////////////////////////////////////////////////////////////
+
+        ~dual_quat() noexcept = default;
+
+        dual_quat(dual_quat<T>&& rhs) noexcept = default;
+
+        dual_quat<T>& operator=(dual_quat<T>&& rhs) noexcept = default;
+    };
+
+    ////////////////////////////////////////////////////////////////
+    // Arithmetic operators.
+    ////////////////////////////////////////////////////////////////
+
+    template<typename T>
+    [[nodiscard]] dual_quat<T> operator+(const dual_quat<T>& lhs, const dual_quat<T>& rhs) noexcept { return dual_quat<T>(lhs.real + rhs.real, lhs.dual + rhs.dual); }
+
+    template<typename T>
+    [[nodiscard]] dual_quat<T> operator*(const dual_quat<T>& lhs, const T rhs) noexcept { return dual_quat<T>(lhs.real * rhs, lhs.dual * rhs); }
+
+    template<typename T>
+    [[nodiscard]] dual_quat<T> operator*(const T lhs, const dual_quat<T>& rhs) noexcept { return rhs * lhs; }
+
+    /**
+     * @brief Compose two transforms. Applying the result applies rhs first, then lhs.
+     */
+    template<typename T>
+    [[nodiscard]] dual_quat<T> operator*(const dual_quat<T>& lhs, const dual_quat<T>& rhs) noexcept
+    {
+        return dual_quat<T>(lhs.real * rhs.real, lhs.real * rhs.dual + lhs.dual * rhs.real);
+    }
+
+    template<typename T>
+    dual_quat<T>& operator*=(dual_quat<T>& lhs, const dual_quat<T>& rhs) noexcept { return lhs = lhs * rhs; }
+
+    ////////////////////////////////////////////////////////////////
+    // Comparison operators.
+    ////////////////////////////////////////////////////////////////
+
+    template<typename T>
+    [[nodiscard]] bool operator==(const dual_quat<T>& lhs, const dual_quat<T>& rhs) noexcept { return lhs.real == rhs.real && lhs.dual == rhs.dual; }
+
+    template<typename T>
+    [[nodiscard]] bool operator!=(const dual_quat<T>& lhs, const dual_quat<T>& rhs) noexcept { return !(lhs == rhs); }
+
+    ////////////////////////////////////////////////////////////////
+    // Normalize, conjugate.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Divide by the length of the real part. The dual part is not made orthogonal to the real part.
+     */
+    template<typename T>
+    [[nodiscard]] dual_quat<T> normalize(const dual_quat<T>& lhs) noexcept { return lhs * rsqrt(dot(lhs.real, lhs.real)); }
+
+    template<typename T>
+    [[nodiscard]] dual_quat<T> conjugate(const dual_quat<T>& lhs) noexcept { return dual_quat<T>(conjugate(lhs.real), conjugate(lhs.dual)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Transform.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Translation of a unit dual quaternion, 2 * dual * conjugate(real).
+     */
+    template<typename T>
+    [[nodiscard]] vec<T, 3> translation(const dual_quat<T>& dq) noexcept
+    {
+        const vec<T, 3> r = dq.real.xyz();
+        const vec<T, 3> d = dq.dual.xyz();
+        return (d * dq.real.w - r * dq.dual.w + cross(r, d)) * T(2);
+    }
+
+    template<typename T>
+    [[nodiscard]] vec<T, 3> transform_point(const dual_quat<T>& dq, const vec<T, 3>& p) noexcept { return rotate(dq.real, p) + translation(dq); }
+
+    template<typename T>
+    [[nodiscard]] vec<T, 3> transform_direction(const dual_quat<T>& dq, const vec<T, 3>& v) noexcept { return rotate(dq.real, v); }
+
+    template<typename T>
+    [[nodiscard]] matrix<T, 4, 4> transform_from_dual_quat(const dual_quat<T>& dq) noexcept
+    {
+        matrix<T, 4, 4> m = rotation_from_quat(dq.real);
+        const vec<T, 3> t = translation(dq);
+        m[0][3] = t.x;
+        m[1][3] = t.y;
+        m[2][3] = t.z;
+        return m;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Output.
+    ////////////////////////////////////////////////////////////////
+
+    template<typename T>
+    std::ostream& operator<<(std::ostream& out, const dual_quat<T>& dq) { return out << "[" << dq.real << ", " << dq.dual << "]"; }
+}
@@ -0,0 +1,230 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <iostream>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/math_functions.h"
+#include "math/matrix/mat4x4.h"
+#include "math/vector/vec3.h"
+#include "math/vector/vec4.h"
+
+namespace math
+{
+    /**=================================================================================================
+     * Struct: quat
+     * =================================================================================================
+     * @struct  quat
+     *
+     * @brief   Quaternion x * i + y * j + z * k + w. Default constructs to the identity rotation.
+     *
+     * @tparam  T   Component type.
+    **/
+    template<typename T>
+    struct quat
+    {
+        static constexpr size_t size = 4;
+        using element_type = T;
+
+        T x, y, z, w;
+
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] quat() noexcept : x(0), y(0), z(0), w(1) {}
+
+        [[nodiscard]] quat(const T x, const T y, const T z, const T w) noexcept : x(x), y(y), z(z), w(w) {}
+
+        [[nodiscard]] quat(const vec<T, 3>& v, const T w) noexcept : x(v.x), y(v.y), z(v.z), w(w) {}
+
+        [[nodiscard]] explicit quat(const vec<T, 4>& v) noexcept : x(v.x), y(v.y), z(v.z), w(v.w) {}
+
+        [[nodiscard]] quat(const quat<T>& rhs) noexcept = default;
+
+        template<typename U>
+        [[nodiscard]] explicit quat(const quat<U>& rhs) : x(static_cast<T>(rhs.x)), y(static_cast<T>(rhs.y)), z(static_cast<T>(rhs.z)), w(static_cast<T>(rhs.w)) {}
+
+        ////////////////////////////////////////////////////////////////
+        // Assignment operators.
+        ////////////////////////////////////////////////////////////////
+
+        quat<T>& operator=(const quat<T>& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Defaulted constructors and operators.
+        ////////////////////////////////////////////////////////////////
+
+        ~quat() noexcept = default;
+
+        quat(quat<T>&& rhs) noexcept = default;
+
+        quat<T>& operator=(quat<T>&& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Casting operators.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] explicit operator vec<T, 4>() const noexcept { return vec<T, 4>(x, y, z, w); }
+
+        ////////////////////////////////////////////////////////////////
+        // Element access.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] const T& operator[](const size_t i) const { assert(i < 4); return (&x)[i]; }
+
+        [[nodiscard]] T& operator[](const size_t i) { assert(i < 4); return (&x)[i]; }
+
+        [[nodiscard]] vec<T, 3> xyz() const noexcept { return vec<T, 3>(x, y, z); }
+    };
+
+    ////////////////////////////////////////////////////////////////
+    // Construct special values.
+    ////////////////////////////////////////////////////////////////
+
+    template<typename T>
+    [[nodiscard]] quat<T> quat_from_axis_angle(const vec<T, 3>& axis, const T angle) noexcept
+    {
+        const T half = angle * T(0.5);
+        return quat<T>(normalize(axis) * sin(half), cos(half));
+    }
+
+    template<typename T>
+    [[nodiscard]] quat<T> quat_from_rotation(const matrix<T, 3, 3>& r) noexcept { return quat<T>(rotation_to_quat(r)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Arithmetic operators.
+    ////////////////////////////////////////////////////////////////
+
+    template<typename T>
+    [[nodiscard]] quat<T> operator+(const quat<T>& lhs, const quat<T>& rhs) noexcept { return quat<T>(lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z, lhs.w + rhs.w); }
+
+    template<typename T>
+    [[nodiscard]] quat<T> operator-(const quat<T>& lhs, const quat<T>& rhs) noexcept { return quat<T>(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z, lhs.w - rhs.w); }
+
+    template<typename T>
+    [[nodiscard]] quat<T> operator-(const quat<T>& lhs) noexcept { return quat<T>(-lhs.x, -lhs.y, -lhs.z, -lhs.w); }
+
+    template<typename T>
+    [[nodiscard]] quat<T> operator*(const quat<T>& lhs, const T rhs) noexcept { return quat<T>(lhs.x * rhs, lhs.y * rhs, lhs.z * rhs, lhs.w * rhs); }
+
+    template<typename T>
+    [[nodiscard]] quat<T> operator*(const T lhs, const quat<T>& rhs) noexcept { return rhs * lhs; }
+
+    /**
+     * @brief Hamilton product. Applying the result rotates by rhs first, then by lhs.
+     */
+    template<typename T>
+    [[nodiscard]] quat<T> operator*(const quat<T>& lhs, const quat<T>& rhs) noexcept
+    {
+        return quat<T>(
+            lhs.w * rhs.x + lhs.x * rhs.w + lhs.y * rhs.z - lhs.z * rhs.y,
+            lhs.w * rhs.y + lhs.y * rhs.w + lhs.z * rhs.x - lhs.x * rhs.z,
+            lhs.w * rhs.z + lhs.z * rhs.w + lhs.x * rhs.y - lhs.y * rhs.x,
+            lhs.w * rhs.w - lhs.x * rhs.x - lhs.y * rhs.y - lhs.z * rhs.z
+            );
+    }
+
+    template<typename T>
+    quat<T>& operator*=(quat<T>& lhs, const quat<T>& rhs) noexcept { return lhs = lhs * rhs; }
+
+    template<typename T>
+    quat<T>& operator*=(quat<T>& lhs, const T rhs) noexcept { return lhs = lhs * rhs; }
+
+    ////////////////////////////////////////////////////////////////
+    // Comparison operators.
+    ////////////////////////////////////////////////////////////////
+
+    template<typename T>
+    [[nodiscard]] bool operator==(const quat<T>& lhs, const quat<T>& rhs) noexcept { return lhs.x == rhs.x && lhs.y == rhs.y && lhs.z == rhs.z && lhs.w == rhs.w; }
+
+    template<typename T>
+    [[nodiscard]] bool operator!=(const quat<T>& lhs, const quat<T>& rhs) noexcept { return !(lhs == rhs); }
+
+    ////////////////////////////////////////////////////////////////
+    // Dot product etc.
+    ////////////////////////////////////////////////////////////////
+
+    template<typename T>
+    [[nodiscard]] T dot(const quat<T>& lhs, const quat<T>& rhs) noexcept { return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z + lhs.w * rhs.w; }
+
+    template<typename T>
+    [[nodiscard]] T length(const quat<T>& lhs) noexcept { return sqrt(dot(lhs, lhs)); }
+
+    template<typename T>
+    [[nodiscard]] T sqr_length(const quat<T>& lhs) noexcept { return dot(lhs, lhs); }
+
+    template<typename T>
+    [[nodiscard]] quat<T> normalize(const quat<T>& lhs) noexcept { return lhs * rsqrt(dot(lhs, lhs)); }
+
+    template<typename T>
+    [[nodiscard]] quat<T> conjugate(const quat<T>& lhs) noexcept { return quat<T>(-lhs.x, -lhs.y, -lhs.z, lhs.w); }
+
+    template<typename T>
+    [[nodiscard]] quat<T> inverse(const quat<T>& lhs) noexcept { return conjugate(lhs) * rcp(dot(lhs, lhs)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Rotation.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Rotate a vector by a unit quaternion, using v' = v + w * t + cross(q.xyz, t) with t = 2 * cross(q.xyz, v).
+     */
+    template<typename T>
+    [[nodiscard]] vec<T, 3> rotate(const quat<T>& q, const vec<T, 3>& v) noexcept
+    {
+        const vec<T, 3> u = q.xyz();
+        const vec<T, 3> t = cross(u, v) * T(2);
+        return v + t * q.w + cross(u, t);
+    }
+
+    template<typename T>
+    [[nodiscard]] vec<T, 3> operator*(const quat<T>& lhs, const vec<T, 3>& rhs) noexcept { return rotate(lhs, rhs); }
+
+    template<typename T>
+    [[nodiscard]] matrix<T, 4, 4> rotation_from_quat(const quat<T>& q) noexcept { return rotation_from_quat(static_cast<vec<T, 4>>(q)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Interpolation.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Normalized linear interpolation along the shortest arc.
+     */
+    template<typename T>
+    [[nodiscard]] quat<T> nlerp(const quat<T>& a, const quat<T>& b, const T t) noexcept
+    {
+        const quat<T> b2 = dot(a, b) < T(0) ? -b : b;
+        return normalize(a + (b2 - a) * t);
+    }
+
+    /**
+     * @brief Spherical linear interpolation along the shortest arc. Falls back to nlerp for nearly identical rotations.
+     */
+    template<typename T>
+    [[nodiscard]] quat<T> slerp(const quat<T>& a, const quat<T>& b, const T t) noexcept
+    {
+        T d = dot(a, b);
+        const quat<T> b2 = d < T(0) ? -b : b;
+        d = abs(d);
+        if (d > T(0.9995)) return normalize(a + (b2 - a) * t);
+
+        const T theta = acos(d);
+        const T rs = rcp(sin(theta));
+        return a * (sin((T(1) - t) * theta) * rs) + b2 * (sin(t * theta) * rs);
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Output.
+    ////////////////////////////////////////////////////////////////
+
+    template<typename T>
+    std::ostream& operator<<(std::ostream& out, const quat<T>& q) { return out << "(" << q.x << ", " << q.y << ", " << q.z << ", " << q.w << ")"; }
+}
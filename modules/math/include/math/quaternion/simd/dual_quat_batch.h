@@ -0,0 +1,121 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cstdint>
+#include <immintrin.h>
+#include <span>
+#include <utility>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/quaternion/dual_quat.h"
+#include "math/quaternion/simd/quatfa.h"
+#include "math/vector/simd/vec3fa.h"
+#include "math/vector/simd/vec8fa.h"
+
+namespace math
+{
+    static_assert(sizeof(dual_quat<float>) == 8 * sizeof(float), "dual_quat<float> must be 8 packed floats so it can be loaded as a vec8fa.");
+
+    namespace detail
+    {
+        /**
+         * @brief Blend up to four bones and return the normalized rotation and translation of the result.
+         */
+        inline void blend_bones(const std::span<const dual_quat<float>> bones, const vec<uint32_t, 4>& indices, const vec<float, 4>& weights, quatfa& rotation, vec3fa& translation) noexcept
+        {
+            assert(indices.x < bones.size() && indices.y < bones.size() && indices.z < bones.size() && indices.w < bones.size());
+
+#ifdef __AVX__
+            // A dual quaternion is exactly one vec8fa: real part in the low half, dual part in the high half.
+            const vec8fa b0 = vec8fa::loadu(&bones[indices.x]);
+            const vec8fa b1 = vec8fa::loadu(&bones[indices.y]);
+            const vec8fa b2 = vec8fa::loadu(&bones[indices.z]);
+            const vec8fa b3 = vec8fa::loadu(&bones[indices.w]);
+
+            // Flip the weights of bones that are in the opposite hemisphere of the first bone.
+            const vec4fa r0 = _mm256_castps256_ps128(b0);
+            const vec4fa d = vec4fa(dot(r0, vec4fa(_mm256_castps256_ps128(b1))), dot(r0, vec4fa(_mm256_castps256_ps128(b2))), dot(r0, vec4fa(_mm256_castps256_ps128(b3))), 0.0f);
+            const vec4fa w = _mm_xor_ps(vec4fa(weights), _mm_and_ps(d.wxyz(), _mm_setr_ps(0.0f, -0.0f, -0.0f, -0.0f)));
+
+            const vec8fa dq = madd(vec8fa(w.x), b0, madd(vec8fa(w.y), b1, madd(vec8fa(w.z), b2, vec8fa(w.w) * b3)));
+            const vec4fa real = _mm256_castps256_ps128(dq);
+            const vec4fa dual = _mm256_extractf128_ps(dq, 1);
+#else
+            const auto load = [&](const uint32_t i) { return std::pair(vec4fa(static_cast<vec<float, 4>>(bones[i].real)), vec4fa(static_cast<vec<float, 4>>(bones[i].dual))); };
+            const auto [r0, d0] = load(indices.x);
+            const auto [r1, d1] = load(indices.y);
+            const auto [r2, d2] = load(indices.z);
+            const auto [r3, d3] = load(indices.w);
+            const float w1 = dot(r0, r1) < 0.0f ? -weights.y : weights.y;
+            const float w2 = dot(r0, r2) < 0.0f ? -weights.z : weights.z;
+            const float w3 = dot(r0, r3) < 0.0f ? -weights.w : weights.w;
+            const vec4fa real = madd(vec4fa(weights.x), r0, madd(vec4fa(w1), r1, madd(vec4fa(w2), r2, vec4fa(w3) * r3)));
+            const vec4fa dual = madd(vec4fa(weights.x), d0, madd(vec4fa(w1), d1, madd(vec4fa(w2), d2, vec4fa(w3) * d3)));
+#endif
+
+            // Normalize. The translation 2 * (w_r * d - w_d * r + cross(r, d)) is quadratic in the blend, so it is divided by the squared length.
+            const float sqr_len = dot(real, real);
+            const float rcp_len = 1.0f / sqrt(sqr_len);
+            rotation = quatfa(real * rcp_len);
+            const vec3fa r(real.m128), dl(dual.m128);
+            const vec3fa t = msub(dl, vec3fa(real.wwww().m128), r * vec3fa(dual.wwww().m128)) + cross(r, dl);
+            translation = t * (2.0f / sqr_len);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Skinning.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Dual quaternion linear blend skinning. Every vertex blends up to four bones, unused influences must have a weight of 0.
+     * Blending is done on full dual quaternions in a single 256-bit register per bone. Weights of bones in the opposite hemisphere of
+     * the first influence are negated, so the first influence should be the one with the largest weight.
+     * @param bones Bone transforms, must be unit dual quaternions.
+     * @param indices Per-vertex bone indices.
+     * @param weights Per-vertex bone weights, summing to 1.
+     * @param positions Vertex positions.
+     * @param normals Vertex normals. May be empty.
+     * @param outPositions Skinned positions. May alias positions.
+     * @param outNormals Skinned normals. May alias normals. Must be empty if normals is.
+     */
+    inline void skin(const std::span<const dual_quat<float>> bones,
+                     const std::span<const vec<uint32_t, 4>> indices,
+                     const std::span<const vec<float, 4>> weights,
+                     const std::span<const vec<float, 3>> positions,
+                     const std::span<const vec<float, 3>> normals,
+                     const std::span<vec<float, 3>> outPositions,
+                     const std::span<vec<float, 3>> outNormals) noexcept
+    {
+        assert(indices.size() >= positions.size() && weights.size() >= positions.size() && outPositions.size() >= positions.size());
+        assert(normals.empty() || (normals.size() >= positions.size() && outNormals.size() >= positions.size()));
+
+        quatfa rotation;
+        vec3fa translation;
+        for (size_t i = 0; i < positions.size(); i++)
+        {
+            detail::blend_bones(bones, indices[i], weights[i], rotation, translation);
+            outPositions[i] = static_cast<vec<float, 3>>(rotate(rotation, vec3fa(positions[i])) + translation);
+            if (!normals.empty()) outNormals[i] = static_cast<vec<float, 3>>(rotate(rotation, vec3fa(normals[i])));
+        }
+    }
+
+    /**
+     * @brief Dual quaternion linear blend skinning of positions only. See the overload that also takes normals.
+     */
+    inline void skin(const std::span<const dual_quat<float>> bones,
+                     const std::span<const vec<uint32_t, 4>> indices,
+                     const std::span<const vec<float, 4>> weights,
+                     const std::span<const vec<float, 3>> positions,
+                     const std::span<vec<float, 3>> outPositions) noexcept
+    {
+        skin(bones, indices, weights, positions, {}, outPositions, {});
+    }
+}
@@ -0,0 +1,215 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <immintrin.h>
+#include <iostream>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/matrix/simd/mat4x4fa.h"
+#include "math/quaternion/quat.h"
+#include "math/vector/simd/vec3fa.h"
+#include "math/vector/simd/vec4fa.h"
+
+namespace math
+{
+    /**=================================================================================================
+     * Struct: quatfa
+     * =================================================================================================
+     * @struct  quatfa
+     *
+     * @brief   SIMD quaternion stored as (x, y, z, w) in a vec4fa. Default constructs to the identity rotation.
+    **/
+    struct alignas(16) quatfa
+    {
+        static constexpr size_t size = 4;
+        using element_type = float;
+
+        vec4fa v;
+
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] quatfa() noexcept : v(0, 0, 0, 1) {}
+
+        [[nodiscard]] quatfa(const float x, const float y, const float z, const float w) noexcept : v(x, y, z, w) {}
+
+        [[nodiscard]] explicit quatfa(const vec4fa& v) noexcept : v(v) {}
+
+        [[nodiscard]] explicit quatfa(const __m128 m128) noexcept : v(m128) {}
+
+        [[nodiscard]] explicit quatfa(const quat<float>& rhs) noexcept : v(rhs.x, rhs.y, rhs.z, rhs.w) {}
+
+        [[nodiscard]] quatfa(const quatfa& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Assignment operators.
+        ////////////////////////////////////////////////////////////////
+
+        quatfa& operator=(const quatfa& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Defaulted constructors and operators.
+        ////////////////////////////////////////////////////////////////
+
+        ~quatfa() noexcept = default;
+
+        quatfa(quatfa&& rhs) noexcept = default;
+
+        quatfa& operator=(quatfa&& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Casting operators.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] operator const __m128& () const noexcept { return v.m128; }
+
+        [[nodiscard]] explicit operator vec4fa() const noexcept { return v; }
+
+        [[nodiscard]] explicit operator quat<float>() const noexcept { return quat<float>(v.x, v.y, v.z, v.w); }
+
+        ////////////////////////////////////////////////////////////////
+        // Element access.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] const float& operator[](const size_t i) const { assert(i < 4); return v[i]; }
+
+        [[nodiscard]] float& operator[](const size_t i) { assert(i < 4); return v[i]; }
+    };
+
+    ////////////////////////////////////////////////////////////////
+    // Arithmetic operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline quatfa operator+(const quatfa& lhs, const quatfa& rhs) noexcept { return quatfa(lhs.v + rhs.v); }
+
+    [[nodiscard]] inline quatfa operator-(const quatfa& lhs, const quatfa& rhs) noexcept { return quatfa(lhs.v - rhs.v); }
+
+    [[nodiscard]] inline quatfa operator-(const quatfa& lhs) noexcept { return quatfa(-lhs.v); }
+
+    [[nodiscard]] inline quatfa operator*(const quatfa& lhs, const float rhs) noexcept { return quatfa(lhs.v * rhs); }
+
+    [[nodiscard]] inline quatfa operator*(const float lhs, const quatfa& rhs) noexcept { return quatfa(rhs.v * lhs); }
+
+    /**
+     * @brief Hamilton product. Applying the result rotates by rhs first, then by lhs.
+     */
+    [[nodiscard]] inline quatfa operator*(const quatfa& lhs, const quatfa& rhs) noexcept
+    {
+        // x = w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2
+        // y = w1 * y2 + y1 * w2 + z1 * x2 - x1 * z2
+        // z = w1 * z2 + z1 * w2 + x1 * y2 - y1 * x2
+        // w = w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2
+        const vec4fa& a = lhs.v;
+        const vec4fa& b = rhs.v;
+        const __m128 wsign = _mm_setr_ps(0.0f, 0.0f, 0.0f, -0.0f);
+        const vec4fa t = _mm_xor_ps(madd(a.xyzx(), b.wwwx(), a.yzxy() * b.zxyy()), wsign);
+        return quatfa(madd(a.wwww(), b, nmadd(a.zxyz(), b.yzxz(), t)));
+    }
+
+    inline quatfa& operator*=(quatfa& lhs, const quatfa& rhs) noexcept { return lhs = lhs * rhs; }
+
+    inline quatfa& operator*=(quatfa& lhs, const float rhs) noexcept { return lhs = lhs * rhs; }
+
+    ////////////////////////////////////////////////////////////////
+    // Comparison operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline bool operator==(const quatfa& lhs, const quatfa& rhs) noexcept { return _mm_movemask_ps(_mm_cmpeq_ps(lhs, rhs)) == 0xF; }
+
+    [[nodiscard]] inline bool operator!=(const quatfa& lhs, const quatfa& rhs) noexcept { return !(lhs == rhs); }
+
+    ////////////////////////////////////////////////////////////////
+    // Dot product etc.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline float dot(const quatfa& lhs, const quatfa& rhs) noexcept { return dot(lhs.v, rhs.v); }
+
+    [[nodiscard]] inline float length(const quatfa& lhs) noexcept { return length(lhs.v); }
+
+    [[nodiscard]] inline float sqr_length(const quatfa& lhs) noexcept { return sqr_length(lhs.v); }
+
+    [[nodiscard]] inline quatfa normalize(const quatfa& lhs) noexcept { return quatfa(lhs.v * (1.0f / length(lhs.v))); }
+
+    [[nodiscard]] inline quatfa conjugate(const quatfa& lhs) noexcept { return quatfa(_mm_xor_ps(lhs, _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f))); }
+
+    [[nodiscard]] inline quatfa inverse(const quatfa& lhs) noexcept { return conjugate(lhs) * (1.0f / dot(lhs, lhs)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Rotation.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Rotate a vector by a unit quaternion, using v' = v + w * t + cross(q.xyz, t) with t = 2 * cross(q.xyz, v).
+     */
+    [[nodiscard]] inline vec3fa rotate(const quatfa& q, const vec3fa& v) noexcept
+    {
+        // The w lane of u is ignored by cross, which only reads the xyz lanes.
+        const vec3fa u(q.v.m128);
+        const vec3fa t = cross(u, v) * 2.0f;
+        return madd(vec3fa(q.v.wwww().m128), t, v + cross(u, t));
+    }
+
+    [[nodiscard]] inline vec3fa operator*(const quatfa& lhs, const vec3fa& rhs) noexcept { return rotate(lhs, rhs); }
+
+    [[nodiscard]] inline mat4x4fa rotation_from_quat(const quatfa& q) noexcept
+    {
+        const vec4fa& v = q.v;
+        const vec4fa v2 = v + v;
+        // (2xx, 2yy, 2zz), (2xy, 2yz, 2zx) and (2wx, 2wy, 2wz) in the xyz lanes.
+        const vec4fa sq = v * v2;
+        const vec4fa cr = v.xyzw() * v2.yzxw();
+        const vec4fa wv = v.wwww() * v2;
+        const float xx = sq.x, yy = sq.y, zz = sq.z;
+        const float xy = cr.x, yz = cr.y, zx = cr.z;
+        const float wx = wv.x, wy = wv.y, wz = wv.z;
+        return mat4x4fa(
+            vec4fa(1.0f - yy - zz, xy - wz, zx + wy, 0.0f),
+            vec4fa(xy + wz, 1.0f - xx - zz, yz - wx, 0.0f),
+            vec4fa(zx - wy, yz + wx, 1.0f - xx - yy, 0.0f),
+            vec4fa(0.0f, 0.0f, 0.0f, 1.0f)
+        );
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Interpolation.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Normalized linear interpolation along the shortest arc.
+     */
+    [[nodiscard]] inline quatfa nlerp(const quatfa& a, const quatfa& b, const float t) noexcept
+    {
+        const float d = dot(a, b);
+        const vec4fa b2 = _mm_xor_ps(b, _mm_set1_ps(d < 0.0f ? -0.0f : 0.0f));
+        return normalize(quatfa(lerp(a.v, b2, t)));
+    }
+
+    /**
+     * @brief Spherical linear interpolation along the shortest arc. Falls back to nlerp for nearly identical rotations.
+     */
+    [[nodiscard]] inline quatfa slerp(const quatfa& a, const quatfa& b, const float t) noexcept
+    {
+        const float d = dot(a, b);
+        const vec4fa b2 = _mm_xor_ps(b, _mm_set1_ps(d < 0.0f ? -0.0f : 0.0f));
+        const float ad = abs(d);
+        if (ad > 0.9995f) return normalize(quatfa(lerp(a.v, b2, t)));
+
+        const float theta = acos(ad);
+        const float rs = 1.0f / sin(theta);
+        return quatfa(madd(a.v, vec4fa(sin((1.0f - t) * theta) * rs), b2 * (sin(t * theta) * rs)));
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Output.
+    ////////////////////////////////////////////////////////////////
+
+    inline std::ostream& operator<<(std::ostream& out, const quatfa& q) { return out << q.v; }
+}
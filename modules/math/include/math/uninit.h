@@ -0,0 +1,65 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace math
+{
+    /**
+     * @brief Tag type to select the constructor that leaves all components uninitialized.
+     */
+    struct uninit_t
+    {
+        explicit uninit_t() = default;
+    };
+
+    inline constexpr uninit_t uninit{};
+
+    /**=================================================================================================
+     * Class: default_init_allocator
+     * =================================================================================================
+     * @class   default_init_allocator
+     *
+     * @brief   Allocator adaptor that default-initializes instead of value-initializes. Types that have an uninit_t constructor
+     * are constructed with it, so e.g. std::vector<float3, default_init_allocator<float3>>(n) leaves its elements uninitialized.
+     * Construction with arguments is forwarded to the underlying allocator.
+     *
+     * @tparam  T   Element type.
+     * @tparam  A   Underlying allocator.
+    **/
+    template<typename T, typename A = std::allocator<T>>
+    class default_init_allocator : public A
+    {
+        using traits = std::allocator_traits<A>;
+
+    public:
+        template<typename U>
+        struct rebind
+        {
+            using other = default_init_allocator<U, typename traits::template rebind_alloc<U>>;
+        };
+
+        using A::A;
+
+        template<typename U>
+        void construct(U* ptr) noexcept(std::is_nothrow_default_constructible_v<U>)
+        {
+            if constexpr (std::is_constructible_v<U, uninit_t>)
+                ::new(static_cast<void*>(ptr)) U(uninit);
+            else
+                ::new(static_cast<void*>(ptr)) U;
+        }
+
+        template<typename U, typename... Args>
+        void construct(U* ptr, Args&&... args)
+        {
+            traits::construct(static_cast<A&>(*this), ptr, std::forward<Args>(args)...);
+        }
+    };
+}
@@ -0,0 +1,255 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/math_functions.h"
+#include "math/vector/vector.h"
+#include "math/vector/vec2.h"
+#include "math/vector/vec3.h"
+#include "math/vector/vec4.h"
+
+/*
+ * Packed formats for GPU buffers.
+ *
+ * The conversions follow the D3D and Vulkan rules: floats are clamped to [0, 1] (unorm) or [-1, 1] (snorm), scaled by the
+ * largest integer and rounded to nearest even. NaN becomes 0. Unpacking divides by the largest integer, and snorm clamps the
+ * smallest integer to -1. The span versions in math/vector/simd/pack_batch.h give the same results.
+ *
+ * Unit vectors can be stored as 2 snorm integers in octahedral coordinates (Cigolle et al., "A Survey of Efficient
+ * Representations for Independent Unit Vectors", 2014): the direction is projected onto the octahedron |x| + |y| + |z| = 1,
+ * whose lower half is folded over the upper half to fill the square [-1, 1]^2.
+ */
+
+namespace math
+{
+    namespace detail
+    {
+        template<typename I>
+        inline constexpr float norm_scale = static_cast<float>(std::numeric_limits<I>::max());
+
+        template<std::unsigned_integral I>
+        [[nodiscard]] I pack_unorm(const float x) noexcept
+        {
+            const float c = x > 0.0f ? (x < 1.0f ? x : 1.0f) : 0.0f;
+            return static_cast<I>(round(c * norm_scale<I>));
+        }
+
+        template<std::signed_integral I>
+        [[nodiscard]] I pack_snorm(const float x) noexcept
+        {
+            const float c = x > -1.0f ? (x < 1.0f ? x : 1.0f) : (x == x ? -1.0f : 0.0f);
+            return static_cast<I>(round(c * norm_scale<I>));
+        }
+
+        /**
+         * @brief Convert a float to an unsigned float with 5 exponent bits and M mantissa bits, ties to even. Negative values
+         * become 0 and values larger than the largest finite value become that value. Infinity and NaN are kept.
+         */
+        template<uint32_t M>
+        [[nodiscard]] constexpr uint32_t float_to_unsigned_small_float(const float f) noexcept
+        {
+            constexpr uint32_t shift = 23 - M;
+            constexpr uint32_t inf   = 0x1fu << M;
+            constexpr uint32_t max   = inf - 1;
+
+            const uint32_t u = std::bit_cast<uint32_t>(f);
+            if ((u & 0x7fffffff) > 0x7f800000) return inf | (1u << (M - 1));
+            if (u >> 31) return 0;
+            if (u == 0x7f800000) return inf;
+            if (u >= 0x47800000) return max;
+
+            // Smaller than 2^-14. Adding 2^(9 - M) aligns the denormal mantissa with the lowest bits of the float mantissa.
+            constexpr float magic = static_cast<float>(uint32_t(1) << (9 - M));
+            if (u < 0x38800000) return std::bit_cast<uint32_t>(f + magic) - std::bit_cast<uint32_t>(magic);
+
+            const uint32_t r = (u + 0xc8000000 + (1u << (shift - 1)) - 1 + ((u >> shift) & 1)) >> shift;
+            return r < max ? r : max;
+        }
+
+        template<uint32_t M>
+        [[nodiscard]] constexpr float unsigned_small_float_to_float(const uint32_t v) noexcept
+        {
+            const uint32_t exp  = (v >> M) & 0x1f;
+            const uint32_t mant = v & ((1u << M) - 1);
+            if (exp == 0x1f) return std::bit_cast<float>(0x7f800000 | (mant << (23 - M)));
+            if (exp == 0) return static_cast<float>(mant) * std::bit_cast<float>((127 - 14 - M) << 23);
+            return std::bit_cast<float>(((exp + 112) << 23) | (mant << (23 - M)));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Normalized integers.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Pack floats in [0, 1] into unsigned normalized integers, e.g. pack_unorm<uint8_t>(color).
+     */
+    template<std::unsigned_integral I, size_t N>
+    [[nodiscard]] vec<I, N> pack_unorm(const vec<float, N>& v) noexcept
+    {
+        vec<I, N> r(uninit);
+        for (size_t i = 0; i < N; i++) r[i] = detail::pack_unorm<I>(v[i]);
+        return r;
+    }
+
+    /**
+     * @brief Pack floats in [-1, 1] into signed normalized integers, e.g. pack_snorm<int8_t>(normal).
+     */
+    template<std::signed_integral I, size_t N>
+    [[nodiscard]] vec<I, N> pack_snorm(const vec<float, N>& v) noexcept
+    {
+        vec<I, N> r(uninit);
+        for (size_t i = 0; i < N; i++) r[i] = detail::pack_snorm<I>(v[i]);
+        return r;
+    }
+
+    template<std::unsigned_integral I, size_t N>
+    [[nodiscard]] vec<float, N> unpack_unorm(const vec<I, N>& v) noexcept
+    {
+        vec<float, N> r(uninit);
+        for (size_t i = 0; i < N; i++) r[i] = static_cast<float>(v[i]) / detail::norm_scale<I>;
+        return r;
+    }
+
+    template<std::signed_integral I, size_t N>
+    [[nodiscard]] vec<float, N> unpack_snorm(const vec<I, N>& v) noexcept
+    {
+        vec<float, N> r(uninit);
+        for (size_t i = 0; i < N; i++) r[i] = std::max(static_cast<float>(v[i]) / detail::norm_scale<I>, -1.0f);
+        return r;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // RGB10A2.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Pack a color into 10-bit unorm red, green and blue and 2-bit unorm alpha, red in the lowest bits.
+     */
+    [[nodiscard]] inline uint32_t pack_rgb10a2(const vec<float, 4>& v) noexcept
+    {
+        const auto q = [](const float x, const float scale) {
+            const float c = x > 0.0f ? (x < 1.0f ? x : 1.0f) : 0.0f;
+            return static_cast<uint32_t>(round(c * scale));
+        };
+        return q(v.x, 1023.0f) | q(v.y, 1023.0f) << 10 | q(v.z, 1023.0f) << 20 | q(v.w, 3.0f) << 30;
+    }
+
+    [[nodiscard]] inline vec<float, 4> unpack_rgb10a2(const uint32_t v) noexcept
+    {
+        return vec<float, 4>(static_cast<float>(v & 0x3ff) / 1023.0f,
+                             static_cast<float>((v >> 10) & 0x3ff) / 1023.0f,
+                             static_cast<float>((v >> 20) & 0x3ff) / 1023.0f,
+                             static_cast<float>(v >> 30) / 3.0f);
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // R11G11B10F.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Pack a color into unsigned floats with 5 exponent bits and 6 (red, green) or 5 (blue) mantissa bits, red in the
+     * lowest bits. Negative values become 0 and values above 65024 (red, green) or 64512 (blue) are clamped.
+     */
+    [[nodiscard]] constexpr uint32_t pack_r11g11b10f(const vec<float, 3>& v) noexcept
+    {
+        return detail::float_to_unsigned_small_float<6>(v.x) | detail::float_to_unsigned_small_float<6>(v.y) << 11 |
+               detail::float_to_unsigned_small_float<5>(v.z) << 22;
+    }
+
+    [[nodiscard]] constexpr vec<float, 3> unpack_r11g11b10f(const uint32_t v) noexcept
+    {
+        return vec<float, 3>(detail::unsigned_small_float_to_float<6>(v & 0x7ff),
+                             detail::unsigned_small_float_to_float<6>((v >> 11) & 0x7ff),
+                             detail::unsigned_small_float_to_float<5>(v >> 22));
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Octahedral unit vectors.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Map a direction to octahedral coordinates in [-1, 1]^2. The vector does not have to be normalized, but must not
+     * be zero.
+     */
+    [[nodiscard]] inline vec<float, 2> encode_octahedral(const vec<float, 3>& v) noexcept
+    {
+        const float l = abs(v.x) + abs(v.y) + abs(v.z);
+        const float x = v.x / l;
+        const float y = v.y / l;
+        if (v.z >= 0.0f) return vec<float, 2>(x, y);
+        return vec<float, 2>((1.0f - abs(y)) * (x >= 0.0f ? 1.0f : -1.0f), (1.0f - abs(x)) * (y >= 0.0f ? 1.0f : -1.0f));
+    }
+
+    /**
+     * @brief Map octahedral coordinates back to a normalized direction.
+     */
+    [[nodiscard]] inline vec<float, 3> decode_octahedral(const vec<float, 2>& p) noexcept
+    {
+        // Unfolding the lower half moves both coordinates towards the axes by the distance below the equator.
+        const float z = 1.0f - abs(p.x) - abs(p.y);
+        const float t = z < 0.0f ? -z : 0.0f;
+        return normalize(vec<float, 3>(p.x >= 0.0f ? p.x - t : p.x + t, p.y >= 0.0f ? p.y - t : p.y + t, z));
+    }
+
+    /**
+     * @brief Pack a direction into octahedral coordinates, e.g. pack_octahedral<int16_t>(normal) stores it in 4 bytes.
+     */
+    template<std::signed_integral I>
+    [[nodiscard]] vec<I, 2> pack_octahedral(const vec<float, 3>& v) noexcept
+    {
+        return pack_snorm<I>(encode_octahedral(v));
+    }
+
+    /**
+     * @brief Like pack_octahedral, but rounds each coordinate down or up depending on which of the 4 combinations decodes
+     * closest to the direction, rather than to the nearest integer. This lowers the largest error by about a third.
+     */
+    template<std::signed_integral I>
+    [[nodiscard]] vec<I, 2> pack_octahedral_precise(const vec<float, 3>& v) noexcept
+    {
+        constexpr float     scale = detail::norm_scale<I>;
+        const vec<float, 3> n     = normalize(v);
+        const vec<float, 2> p     = encode_octahedral(v) * scale;
+        const float         xs[2] = {floor(p.x), ceil(p.x)};
+        const float         ys[2] = {floor(p.y), ceil(p.y)};
+
+        // The squared distance rather than the cosine of the angle, which is too close to 1 to tell the candidates apart.
+        // A zero vector gives NaN, which is never closer and leaves the result at 0 like pack_octahedral.
+        float best = std::numeric_limits<float>::infinity();
+        float bx = 0.0f, by = 0.0f;
+        for (size_t i = 0; i < 4; i++)
+        {
+            const float         x = xs[i & 1], y = ys[i >> 1];
+            const vec<float, 3> d = decode_octahedral(vec<float, 2>(x, y) / scale) - n;
+            const float         e = dot(d, d);
+            if (e < best)
+            {
+                best = e;
+                bx   = x;
+                by   = y;
+            }
+        }
+        return vec<I, 2>(static_cast<I>(bx), static_cast<I>(by));
+    }
+
+    /**
+     * @brief Unpack octahedral coordinates into a normalized direction.
+     */
+    template<std::signed_integral I>
+    [[nodiscard]] vec<float, 3> unpack_octahedral(const vec<I, 2>& p) noexcept
+    {
+        return decode_octahedral(unpack_snorm(p));
+    }
+}
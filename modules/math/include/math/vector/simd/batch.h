@@ -0,0 +1,65 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/vector/simd/simd_type.h"
+
+/*
+ * Width-agnostic SIMD batches.
+ *
+ * batch<T> is the widest SIMD type with element type T that the target ISA supports: vec16fa and vec16ia on AVX-512, vec8fa
+ * and vec8ia on AVX(2), vec4fa and vec4ia otherwise. batch<double> is vec4da on AVX and vec2da otherwise. Kernels that only
+ * use the operations all widths implement (arithmetic, madd, min, max, cmp*, select, reduce_*, load/store, and the masked
+ * loadu/storeu for loop tails) are written once against batch<T> and batch_width_v<T>:
+ *
+ *     for (; i + batch_width_v<float> <= n; i += batch_width_v<float>)
+ *         batch<float>::storeu(out + i, madd(batch<float>::loadu(a + i), s, batch<float>::loadu(b + i)));
+ */
+
+namespace math
+{
+    ////////////////////////////////////////////////////////////////
+    // batch
+    ////////////////////////////////////////////////////////////////
+
+    template<typename T>
+    inline constexpr size_t batch_width_v = has_simd_v<T, 16> ? 16 : has_simd_v<T, 8> ? 8 : has_simd_v<T, 4> ? 4 : has_simd_v<T, 2> ? 2 : 1;
+
+    template<typename T> requires (batch_width_v<T> > 1)
+    using batch = simd_t<T, batch_width_v<T>>;
+
+    /**
+     * @brief Mask type returned by the comparisons on batch<T>, e.g. vec8ba for batch<float> on AVX.
+     */
+    template<typename T>
+    using batch_mask = decltype(cmplt(std::declval<const batch<T>&>(), std::declval<const batch<T>&>()));
+
+    /**
+     * @brief Load at most batch_width_v<T> elements, filling the remaining lanes with fill. Memory past ptr + count is not accessed.
+     */
+    template<typename T>
+    [[nodiscard]] batch<T> batch_load_partial(const T* ptr, const size_t count, const T fill = T(0)) noexcept
+    {
+        const auto mask = batch_mask<T>::first(std::min(count, batch_width_v<T>));
+        return select(batch<T>::loadu(ptr, mask), batch<T>(fill), mask);
+    }
+
+    /**
+     * @brief Store the first count lanes of v.
+     */
+    template<typename T>
+    void batch_store_partial(T* ptr, const batch<T>& v, const size_t count) noexcept
+    {
+        batch<T>::storeu(ptr, v, std::min(count, batch_width_v<T>));
+    }
+}
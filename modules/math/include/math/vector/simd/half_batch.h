@@ -0,0 +1,106 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <immintrin.h>
+#include <span>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/float16.h"
+#include "math/vector/vec2.h"
+#include "math/vector/vec3.h"
+#include "math/vector/vec4.h"
+
+namespace math
+{
+    ////////////////////////////////////////////////////////////////
+    // Conversion between half and float spans.
+    ////////////////////////////////////////////////////////////////
+
+    // With F16C (or AVX-512), 8 (or 16) values are converted per instruction. Otherwise this falls back to the scalar
+    // conversion, which gives the same results.
+
+    /**
+     * @brief Convert halfs to floats. Exact.
+     * @param in Halfs.
+     * @param out Floats.
+     */
+    inline void convert(const std::span<const float16> in, const std::span<float> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        const size_t n = in.size();
+        size_t       i = 0;
+#ifdef __AVX512F__
+        for (; i + 16 <= n; i += 16) _mm512_storeu_ps(&out[i], _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[i]))));
+#endif
+#ifdef __F16C__
+        for (; i + 8 <= n; i += 8) _mm256_storeu_ps(&out[i], _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&in[i]))));
+#endif
+        for (; i < n; i++) out[i] = in[i];
+    }
+
+    /**
+     * @brief Convert floats to the nearest halfs, ties to even. Values outside the range of half become infinity.
+     * @param in Floats.
+     * @param out Halfs.
+     */
+    inline void convert(const std::span<const float> in, const std::span<float16> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        const size_t n = in.size();
+        size_t       i = 0;
+#ifdef __AVX512F__
+        for (; i + 16 <= n; i += 16)
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[i]), _mm512_cvtps_ph(_mm512_loadu_ps(&in[i]), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+#endif
+#ifdef __F16C__
+        for (; i + 8 <= n; i += 8) _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[i]), _mm256_cvtps_ph(_mm256_loadu_ps(&in[i]), _MM_FROUND_TO_NEAREST_INT));
+#endif
+        for (; i < n; i++) out[i] = in[i];
+    }
+
+    namespace detail
+    {
+        template<size_t N>
+        void convert_vectors(const std::span<const vec<float16, N>> in, const std::span<vec<float, N>> out) noexcept
+        {
+            static_assert(sizeof(vec<float16, N>) == N * sizeof(float16) && sizeof(vec<float, N>) == N * sizeof(float));
+            assert(out.size() >= in.size());
+            if (in.empty()) return;
+            convert(std::span<const float16>(&in.data()->x, in.size() * N), std::span<float>(&out.data()->x, in.size() * N));
+        }
+
+        template<size_t N>
+        void convert_vectors(const std::span<const vec<float, N>> in, const std::span<vec<float16, N>> out) noexcept
+        {
+            static_assert(sizeof(vec<float16, N>) == N * sizeof(float16) && sizeof(vec<float, N>) == N * sizeof(float));
+            assert(out.size() >= in.size());
+            if (in.empty()) return;
+            convert(std::span<const float>(&in.data()->x, in.size() * N), std::span<float16>(&out.data()->x, in.size() * N));
+        }
+    }
+
+    /**
+     * @brief Convert vectors of halfs to vectors of floats, e.g. vertex attributes.
+     */
+    inline void convert(const std::span<const vec<float16, 2>> in, const std::span<vec<float, 2>> out) noexcept { detail::convert_vectors(in, out); }
+
+    inline void convert(const std::span<const vec<float16, 3>> in, const std::span<vec<float, 3>> out) noexcept { detail::convert_vectors(in, out); }
+
+    inline void convert(const std::span<const vec<float16, 4>> in, const std::span<vec<float, 4>> out) noexcept { detail::convert_vectors(in, out); }
+
+    /**
+     * @brief Convert vectors of floats to vectors of halfs.
+     */
+    inline void convert(const std::span<const vec<float, 2>> in, const std::span<vec<float16, 2>> out) noexcept { detail::convert_vectors(in, out); }
+
+    inline void convert(const std::span<const vec<float, 3>> in, const std::span<vec<float16, 3>> out) noexcept { detail::convert_vectors(in, out); }
+
+    inline void convert(const std::span<const vec<float, 4>> in, const std::span<vec<float16, 4>> out) noexcept { detail::convert_vectors(in, out); }
+}
@@ -0,0 +1,534 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <cstring>
+#include <immintrin.h>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/vector/pack.h"
+#include "math/vector/simd/vec3_batch.h"
+
+namespace math
+{
+    namespace detail
+    {
+        // The span functions treat the vectors as contiguous arrays of components.
+        static_assert(sizeof(vec<float, 4>) == 16 && sizeof(vec<uint8_t, 4>) == 4 && sizeof(vec<int8_t, 4>) == 4);
+        static_assert(sizeof(vec<uint16_t, 4>) == 8 && sizeof(vec<int16_t, 4>) == 8);
+        static_assert(sizeof(vec<int8_t, 2>) == 2 && sizeof(vec<int16_t, 2>) == 4);
+
+        /**
+         * @brief Pack n floats into normalized integers.
+         */
+        template<typename I>
+        void pack_norm(const float* in, I* out, const size_t n) noexcept
+        {
+            constexpr bool is_signed = std::is_signed_v<I>;
+            size_t         i         = 0;
+#ifdef __SSE4_1__
+            // 16 floats per iteration, so that the saturating packs fill whole registers.
+            const __m128 lo    = _mm_set1_ps(is_signed ? -1.0f : 0.0f);
+            const __m128 hi    = _mm_set1_ps(1.0f);
+            const __m128 scale = _mm_set1_ps(norm_scale<I>);
+            const auto   cvt   = [&](const float* p) {
+                __m128 x = _mm_loadu_ps(p);
+                // maxps returns its second operand if either is NaN. Unorm ends up at 0, snorm needs the NaN cleared first.
+                if constexpr (is_signed) x = _mm_and_ps(x, _mm_cmpord_ps(x, x));
+                return _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(x, lo), hi), scale));
+            };
+
+            for (; i + 16 <= n; i += 16)
+            {
+                const __m128i a = cvt(in + i), b = cvt(in + i + 4), c = cvt(in + i + 8), d = cvt(in + i + 12);
+                const __m128i ab = is_signed ? _mm_packs_epi32(a, b) : _mm_packus_epi32(a, b);
+                const __m128i cd = is_signed ? _mm_packs_epi32(c, d) : _mm_packus_epi32(c, d);
+                if constexpr (sizeof(I) == 1)
+                {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), is_signed ? _mm_packs_epi16(ab, cd) : _mm_packus_epi16(ab, cd));
+                }
+                else
+                {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), ab);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8), cd);
+                }
+            }
+#endif
+            for (; i < n; i++)
+            {
+                if constexpr (is_signed)
+                    out[i] = detail::pack_snorm<I>(in[i]);
+                else
+                    out[i] = detail::pack_unorm<I>(in[i]);
+            }
+        }
+
+        /**
+         * @brief Unpack n normalized integers into floats.
+         */
+        template<typename I>
+        void unpack_norm(const I* in, float* out, const size_t n) noexcept
+        {
+            constexpr bool is_signed = std::is_signed_v<I>;
+            size_t         i         = 0;
+#ifdef __SSE4_1__
+            const __m128 scale = _mm_set1_ps(norm_scale<I>);
+            for (; i + 4 <= n; i += 4)
+            {
+                __m128i v;
+                if constexpr (sizeof(I) == 1)
+                {
+                    int32_t b;
+                    std::memcpy(&b, in + i, 4);
+                    v = is_signed ? _mm_cvtepi8_epi32(_mm_cvtsi32_si128(b)) : _mm_cvtepu8_epi32(_mm_cvtsi32_si128(b));
+                }
+                else
+                {
+                    const __m128i h = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i));
+                    v               = is_signed ? _mm_cvtepi16_epi32(h) : _mm_cvtepu16_epi32(h);
+                }
+
+                // Division rather than multiplication with the reciprocal, so that the largest integer becomes exactly 1.
+                __m128 f = _mm_div_ps(_mm_cvtepi32_ps(v), scale);
+                if constexpr (is_signed) f = _mm_max_ps(f, _mm_set1_ps(-1.0f));
+                _mm_storeu_ps(out + i, f);
+            }
+#endif
+            for (; i < n; i++)
+            {
+                const float f = static_cast<float>(in[i]) / norm_scale<I>;
+                out[i]        = is_signed ? std::max(f, -1.0f) : f;
+            }
+        }
+
+#ifdef __AVX2__
+        /**
+         * @brief Branchless float_to_unsigned_small_float on 8 values.
+         */
+        template<uint32_t M>
+        [[nodiscard]] __m256i float_to_unsigned_small_float(const vec8fa& f) noexcept
+        {
+            constexpr uint32_t shift = 23 - M;
+            constexpr uint32_t inf   = 0x1fu << M;
+            constexpr float    magic = static_cast<float>(uint32_t(1) << (9 - M));
+
+            // Negative values become 0. maxps returns its second operand for NaN, which keeps it.
+            const __m256  c = _mm256_max_ps(_mm256_setzero_ps(), f);
+            const __m256i u = _mm256_and_si256(_mm256_castps_si256(c), _mm256_set1_epi32(0x7fffffff));
+
+            const __m256i denormal = _mm256_sub_epi32(_mm256_castps_si256(_mm256_add_ps(c, _mm256_set1_ps(magic))), _mm256_castps_si256(_mm256_set1_ps(magic)));
+            __m256i       normal   = _mm256_add_epi32(u, _mm256_set1_epi32(static_cast<int32_t>(0xc8000000 + (1u << (shift - 1)) - 1)));
+            normal                 = _mm256_srli_epi32(_mm256_add_epi32(normal, _mm256_and_si256(_mm256_srli_epi32(u, shift), _mm256_set1_epi32(1))), shift);
+            normal                 = _mm256_min_epu32(normal, _mm256_set1_epi32(inf - 1));
+
+            __m256i r = _mm256_blendv_epi8(normal, denormal, _mm256_cmpgt_epi32(_mm256_set1_epi32(0x38800000), u));
+            r         = _mm256_blendv_epi8(r, _mm256_set1_epi32(inf - 1), _mm256_cmpgt_epi32(u, _mm256_set1_epi32(0x477fffff)));
+            r         = _mm256_blendv_epi8(r, _mm256_set1_epi32(inf), _mm256_cmpeq_epi32(u, _mm256_set1_epi32(0x7f800000)));
+            return _mm256_blendv_epi8(r, _mm256_set1_epi32(inf | (1u << (M - 1))), _mm256_cmpgt_epi32(u, _mm256_set1_epi32(0x7f800000)));
+        }
+
+        /**
+         * @brief unsigned_small_float_to_float on 8 values.
+         */
+        template<uint32_t M>
+        [[nodiscard]] vec8fa unsigned_small_float_to_float(const __m256i v) noexcept
+        {
+            const __m256i exp  = _mm256_and_si256(_mm256_srli_epi32(v, M), _mm256_set1_epi32(0x1f));
+            const __m256i mant = _mm256_and_si256(v, _mm256_set1_epi32((1 << M) - 1));
+
+            const __m256i normal   = _mm256_or_si256(_mm256_slli_epi32(_mm256_add_epi32(exp, _mm256_set1_epi32(112)), 23), _mm256_slli_epi32(mant, 23 - M));
+            const __m256i special  = _mm256_or_si256(_mm256_set1_epi32(0x7f800000), _mm256_slli_epi32(mant, 23 - M));
+            const __m256  denormal = _mm256_mul_ps(_mm256_cvtepi32_ps(mant), _mm256_castsi256_ps(_mm256_set1_epi32((127 - 14 - M) << 23)));
+
+            __m256i r = _mm256_blendv_epi8(normal, special, _mm256_cmpeq_epi32(exp, _mm256_set1_epi32(0x1f)));
+            r         = _mm256_blendv_epi8(r, _mm256_castps_si256(denormal), _mm256_cmpeq_epi32(exp, _mm256_setzero_si256()));
+            return _mm256_castsi256_ps(r);
+        }
+#endif
+
+#ifdef __AVX__
+        /**
+         * @brief encode_octahedral on 8 directions.
+         */
+        inline void encode_octahedral(const vec8fa& vx, const vec8fa& vy, const vec8fa& vz, vec8fa& x, vec8fa& y) noexcept
+        {
+            const vec8fa l  = abs(vx) + abs(vy) + abs(vz);
+            const vec8fa px = vx / l;
+            const vec8fa py = vy / l;
+            const vec8fa fx = (1.0f - abs(py)) * select(vec8fa(1.0f), vec8fa(-1.0f), cmpge(px, 0.0f));
+            const vec8fa fy = (1.0f - abs(px)) * select(vec8fa(1.0f), vec8fa(-1.0f), cmpge(py, 0.0f));
+            const vec8ba upper = cmpge(vz, 0.0f);
+            x                  = select(px, fx, upper);
+            y                  = select(py, fy, upper);
+        }
+
+        /**
+         * @brief decode_octahedral on 8 coordinates, without the normalization.
+         */
+        inline void decode_octahedral(vec8fa& x, vec8fa& y, vec8fa& z) noexcept
+        {
+            z              = 1.0f - abs(x) - abs(y);
+            const vec8fa t = max(-z, vec8fa(0.0f));
+            x              = select(x - t, x + t, cmpge(x, 0.0f));
+            y              = select(y - t, y + t, cmpge(y, 0.0f));
+        }
+
+        /**
+         * @brief Pack 8 pairs of coordinates into interleaved snorm pairs, with the same clamping and rounding as pack_norm.
+         */
+        template<typename I>
+        void store_octahedral(vec<I, 2>* out, const vec8fa& x, const vec8fa& y) noexcept
+        {
+            const auto cvt = [](const vec8fa& v) {
+                const __m256 c = _mm256_and_ps(v, _mm256_cmp_ps(v, v, _CMP_ORD_Q));
+                return _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(c, _mm256_set1_ps(-1.0f)), _mm256_set1_ps(1.0f)), _mm256_set1_ps(norm_scale<I>)));
+            };
+            const __m256i xi = cvt(x), yi = cvt(y);
+            const __m128i xl = _mm256_castsi256_si128(xi), xh = _mm256_extractf128_si256(xi, 1);
+            const __m128i yl = _mm256_castsi256_si128(yi), yh = _mm256_extractf128_si256(yi, 1);
+
+            // The integers fit in I, so each pair is combined into one lane with x in the lowest bits.
+            auto* dst = reinterpret_cast<__m128i*>(out);
+            if constexpr (sizeof(I) == 1)
+            {
+                const __m128i xs = _mm_packs_epi32(xl, xh), ys = _mm_packs_epi32(yl, yh);
+                _mm_storeu_si128(dst, _mm_or_si128(_mm_and_si128(xs, _mm_set1_epi16(0xff)), _mm_slli_epi16(ys, 8)));
+            }
+            else
+            {
+                const __m128i mask = _mm_set1_epi32(0xffff);
+                _mm_storeu_si128(dst, _mm_or_si128(_mm_and_si128(xl, mask), _mm_slli_epi32(yl, 16)));
+                _mm_storeu_si128(dst + 1, _mm_or_si128(_mm_and_si128(xh, mask), _mm_slli_epi32(yh, 16)));
+            }
+        }
+
+        /**
+         * @brief Inverse of store_octahedral, with the same division and clamping as unpack_norm.
+         */
+        template<typename I>
+        void load_octahedral(const vec<I, 2>* in, vec8fa& x, vec8fa& y) noexcept
+        {
+            const auto* src = reinterpret_cast<const __m128i*>(in);
+            __m128i     xl, xh, yl, yh;
+            if constexpr (sizeof(I) == 1)
+            {
+                // Shifting sign extends x from the low and y from the high byte of each 16-bit lane.
+                const __m128i v  = _mm_loadu_si128(src);
+                const __m128i xs = _mm_srai_epi16(_mm_slli_epi16(v, 8), 8), ys = _mm_srai_epi16(v, 8);
+                xl               = _mm_cvtepi16_epi32(xs);
+                xh               = _mm_cvtepi16_epi32(_mm_unpackhi_epi64(xs, xs));
+                yl               = _mm_cvtepi16_epi32(ys);
+                yh               = _mm_cvtepi16_epi32(_mm_unpackhi_epi64(ys, ys));
+            }
+            else
+            {
+                const __m128i a = _mm_loadu_si128(src), b = _mm_loadu_si128(src + 1);
+                xl              = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+                xh              = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+                yl              = _mm_srai_epi32(a, 16);
+                yh              = _mm_srai_epi32(b, 16);
+            }
+
+            const auto cvt = [](const __m128i l, const __m128i h) {
+                return _mm256_max_ps(_mm256_div_ps(_mm256_cvtepi32_ps(_mm256_set_m128i(h, l)), _mm256_set1_ps(norm_scale<I>)), _mm256_set1_ps(-1.0f));
+            };
+            x = cvt(xl, xh);
+            y = cvt(yl, yh);
+        }
+#endif
+
+        template<typename I>
+        void pack_octahedral(const std::span<const vec<float, 3>> in, const std::span<vec<I, 2>> out) noexcept
+        {
+            assert(out.size() >= in.size());
+            size_t i = 0;
+#ifdef __AVX__
+            for (; i + 8 <= in.size(); i += 8)
+            {
+                vec8fa vx(uninit), vy(uninit), vz(uninit), x(uninit), y(uninit);
+                load_soa(&in[i], vx, vy, vz);
+                encode_octahedral(vx, vy, vz, x, y);
+                store_octahedral(&out[i], x, y);
+            }
+#endif
+            for (; i < in.size(); i++) out[i] = math::pack_octahedral<I>(in[i]);
+        }
+
+        template<typename I>
+        void pack_octahedral_precise(const std::span<const vec<float, 3>> in, const std::span<vec<I, 2>> out) noexcept
+        {
+            assert(out.size() >= in.size());
+            size_t i = 0;
+#ifdef __AVX__
+            constexpr float scale = norm_scale<I>;
+            for (; i + 8 <= in.size(); i += 8)
+            {
+                vec8fa vx(uninit), vy(uninit), vz(uninit), px(uninit), py(uninit);
+                load_soa(&in[i], vx, vy, vz);
+                encode_octahedral(vx, vy, vz, px, py);
+                px = px * scale;
+                py = py * scale;
+
+                // Same candidates, order and distance as the scalar version.
+                const vec8fa r  = rsqrt_nr(madd(vx, vx, madd(vy, vy, vz * vz)));
+                const vec8fa nx = vx * r, ny = vy * r, nz = vz * r;
+                vec8fa       best(std::numeric_limits<float>::infinity()), bx(0.0f), by(0.0f);
+                const auto   test = [&](const vec8fa& qx, const vec8fa& qy) {
+                    vec8fa x = qx / scale, y = qy / scale, z(uninit);
+                    decode_octahedral(x, y, z);
+                    const vec8fa s      = rsqrt_nr(madd(x, x, madd(y, y, z * z)));
+                    const vec8fa dx     = x * s - nx, dy = y * s - ny, dz = z * s - nz;
+                    const vec8fa e      = madd(dx, dx, madd(dy, dy, dz * dz));
+                    const vec8ba better = cmplt(e, best);
+                    best                = select(e, best, better);
+                    bx                  = select(qx, bx, better);
+                    by                  = select(qy, by, better);
+                };
+                const vec8fa fx = floor(px), fy = floor(py), cx = ceil(px), cy = ceil(py);
+                test(fx, fy);
+                test(cx, fy);
+                test(fx, cy);
+                test(cx, cy);
+
+                // (q / scale) * scale rounds back to q exactly, so the conversion is lossless.
+                store_octahedral(&out[i], bx / scale, by / scale);
+            }
+#endif
+            for (; i < in.size(); i++) out[i] = math::pack_octahedral_precise<I>(in[i]);
+        }
+
+        template<typename I>
+        void unpack_octahedral(const std::span<const vec<I, 2>> in, const std::span<vec<float, 3>> out) noexcept
+        {
+            assert(out.size() >= in.size());
+            size_t i = 0;
+#ifdef __AVX__
+            for (; i + 8 <= in.size(); i += 8)
+            {
+                vec8fa x(uninit), y(uninit), z(uninit);
+                load_octahedral(&in[i], x, y);
+                decode_octahedral(x, y, z);
+                const vec8fa r = rsqrt_nr(madd(x, x, madd(y, y, z * z)));
+                store_soa(&out[i], x * r, y * r, z * r);
+            }
+#endif
+            for (; i < in.size(); i++) out[i] = math::unpack_octahedral(in[i]);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Normalized integers.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Pack colors into 8-bit unsigned normalized integers.
+     * @param in Colors.
+     * @param out Packed colors.
+     */
+    inline void pack_unorm(const std::span<const vec<float, 4>> in, const std::span<vec<uint8_t, 4>> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        if (!in.empty()) detail::pack_norm(&in.data()->x, &out.data()->x, in.size() * 4);
+    }
+
+    /**
+     * @brief Pack colors into 16-bit unsigned normalized integers.
+     */
+    inline void pack_unorm(const std::span<const vec<float, 4>> in, const std::span<vec<uint16_t, 4>> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        if (!in.empty()) detail::pack_norm(&in.data()->x, &out.data()->x, in.size() * 4);
+    }
+
+    /**
+     * @brief Pack vectors into 8-bit signed normalized integers.
+     */
+    inline void pack_snorm(const std::span<const vec<float, 4>> in, const std::span<vec<int8_t, 4>> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        if (!in.empty()) detail::pack_norm(&in.data()->x, &out.data()->x, in.size() * 4);
+    }
+
+    /**
+     * @brief Pack vectors into 16-bit signed normalized integers.
+     */
+    inline void pack_snorm(const std::span<const vec<float, 4>> in, const std::span<vec<int16_t, 4>> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        if (!in.empty()) detail::pack_norm(&in.data()->x, &out.data()->x, in.size() * 4);
+    }
+
+    inline void unpack_unorm(const std::span<const vec<uint8_t, 4>> in, const std::span<vec<float, 4>> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        if (!in.empty()) detail::unpack_norm(&in.data()->x, &out.data()->x, in.size() * 4);
+    }
+
+    inline void unpack_unorm(const std::span<const vec<uint16_t, 4>> in, const std::span<vec<float, 4>> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        if (!in.empty()) detail::unpack_norm(&in.data()->x, &out.data()->x, in.size() * 4);
+    }
+
+    inline void unpack_snorm(const std::span<const vec<int8_t, 4>> in, const std::span<vec<float, 4>> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        if (!in.empty()) detail::unpack_norm(&in.data()->x, &out.data()->x, in.size() * 4);
+    }
+
+    inline void unpack_snorm(const std::span<const vec<int16_t, 4>> in, const std::span<vec<float, 4>> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        if (!in.empty()) detail::unpack_norm(&in.data()->x, &out.data()->x, in.size() * 4);
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // RGB10A2.
+    ////////////////////////////////////////////////////////////////
+
+    inline void pack_rgb10a2(const std::span<const vec<float, 4>> in, const std::span<uint32_t> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        size_t i = 0;
+#ifdef __SSE4_1__
+        // The components of each color are shifted into place by a multiplication. Two horizontal additions then combine
+        // them, since their bits do not overlap.
+        const __m128  scale = _mm_setr_ps(1023.0f, 1023.0f, 1023.0f, 3.0f);
+        const __m128i shift = _mm_setr_epi32(1, 1 << 10, 1 << 20, 1 << 30);
+        const auto    cvt   = [&](const vec<float, 4>& v) {
+            const __m128 c = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(&v.x), _mm_setzero_ps()), _mm_set1_ps(1.0f));
+            return _mm_mullo_epi32(_mm_cvtps_epi32(_mm_mul_ps(c, scale)), shift);
+        };
+        for (; i + 4 <= in.size(); i += 4)
+        {
+            const __m128i ab = _mm_hadd_epi32(cvt(in[i]), cvt(in[i + 1]));
+            const __m128i cd = _mm_hadd_epi32(cvt(in[i + 2]), cvt(in[i + 3]));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[i]), _mm_hadd_epi32(ab, cd));
+        }
+#endif
+        for (; i < in.size(); i++) out[i] = pack_rgb10a2(in[i]);
+    }
+
+    inline void unpack_rgb10a2(const std::span<const uint32_t> in, const std::span<vec<float, 4>> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        size_t i = 0;
+#ifdef __SSE4_1__
+        // Extract the components of 4 colors at once and transpose.
+        const __m128i mask = _mm_set1_epi32(0x3ff);
+        for (; i + 4 <= in.size(); i += 4)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&in[i]));
+            __m128        r = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(v, mask)), _mm_set1_ps(1023.0f));
+            __m128        g = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(v, 10), mask)), _mm_set1_ps(1023.0f));
+            __m128        b = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(v, 20), mask)), _mm_set1_ps(1023.0f));
+            __m128        a = _mm_div_ps(_mm_cvtepi32_ps(_mm_srli_epi32(v, 30)), _mm_set1_ps(3.0f));
+            _MM_TRANSPOSE4_PS(r, g, b, a);
+            _mm_storeu_ps(&out[i].x, r);
+            _mm_storeu_ps(&out[i + 1].x, g);
+            _mm_storeu_ps(&out[i + 2].x, b);
+            _mm_storeu_ps(&out[i + 3].x, a);
+        }
+#endif
+        for (; i < in.size(); i++) out[i] = unpack_rgb10a2(in[i]);
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // R11G11B10F.
+    ////////////////////////////////////////////////////////////////
+
+    inline void pack_r11g11b10f(const std::span<const vec<float, 3>> in, const std::span<uint32_t> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        size_t i = 0;
+#ifdef __AVX2__
+        for (; i + 8 <= in.size(); i += 8)
+        {
+            vec8fa x(uninit), y(uninit), z(uninit);
+            detail::load_soa(&in[i], x, y, z);
+            const __m256i r = _mm256_or_si256(_mm256_or_si256(detail::float_to_unsigned_small_float<6>(x), _mm256_slli_epi32(detail::float_to_unsigned_small_float<6>(y), 11)),
+                                              _mm256_slli_epi32(detail::float_to_unsigned_small_float<5>(z), 22));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[i]), r);
+        }
+#endif
+        for (; i < in.size(); i++) out[i] = pack_r11g11b10f(in[i]);
+    }
+
+    inline void unpack_r11g11b10f(const std::span<const uint32_t> in, const std::span<vec<float, 3>> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        size_t i = 0;
+#ifdef __AVX2__
+        for (; i + 8 <= in.size(); i += 8)
+        {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[i]));
+            detail::store_soa(&out[i],
+                              detail::unsigned_small_float_to_float<6>(_mm256_and_si256(v, _mm256_set1_epi32(0x7ff))),
+                              detail::unsigned_small_float_to_float<6>(_mm256_and_si256(_mm256_srli_epi32(v, 11), _mm256_set1_epi32(0x7ff))),
+                              detail::unsigned_small_float_to_float<5>(_mm256_srli_epi32(v, 22)));
+        }
+#endif
+        for (; i < in.size(); i++) out[i] = unpack_r11g11b10f(in[i]);
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Octahedral unit vectors.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Pack directions into octahedral coordinates, 2 bytes each.
+     * @param in Directions. They do not have to be normalized, but must not be zero.
+     * @param out Packed directions.
+     */
+    inline void pack_octahedral(const std::span<const vec<float, 3>> in, const std::span<vec<int8_t, 2>> out) noexcept
+    {
+        detail::pack_octahedral(in, out);
+    }
+
+    /**
+     * @brief Pack directions into octahedral coordinates, 4 bytes each.
+     */
+    inline void pack_octahedral(const std::span<const vec<float, 3>> in, const std::span<vec<int16_t, 2>> out) noexcept
+    {
+        detail::pack_octahedral(in, out);
+    }
+
+    /**
+     * @brief Pack directions into octahedral coordinates, 2 bytes each, choosing the rounding with the smallest error.
+     */
+    inline void pack_octahedral_precise(const std::span<const vec<float, 3>> in, const std::span<vec<int8_t, 2>> out) noexcept
+    {
+        detail::pack_octahedral_precise(in, out);
+    }
+
+    /**
+     * @brief Pack directions into octahedral coordinates, 4 bytes each, choosing the rounding with the smallest error.
+     */
+    inline void pack_octahedral_precise(const std::span<const vec<float, 3>> in, const std::span<vec<int16_t, 2>> out) noexcept
+    {
+        detail::pack_octahedral_precise(in, out);
+    }
+
+    /**
+     * @brief Unpack octahedral coordinates into normalized directions. The result can differ from the scalar version in the
+     * last bits, because the normalization uses the same approximation as normalize_all.
+     */
+    inline void unpack_octahedral(const std::span<const vec<int8_t, 2>> in, const std::span<vec<float, 3>> out) noexcept
+    {
+        detail::unpack_octahedral(in, out);
+    }
+
+    inline void unpack_octahedral(const std::span<const vec<int16_t, 2>> in, const std::span<vec<float, 3>> out) noexcept
+    {
+        detail::unpack_octahedral(in, out);
+    }
+}
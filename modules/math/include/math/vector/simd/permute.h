@@ -0,0 +1,42 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <immintrin.h>
+
+namespace math::detail
+{
+    /**
+     * @brief Shuffle the elements of a single register. Uses vpermilps on AVX and shufps otherwise, so that the swizzles of the
+     * 128-bit types are also available without AVX.
+     */
+    template<int imm>
+    [[nodiscard]] inline __m128 permute(const __m128 v) noexcept
+    {
+#ifdef __AVX__
+        return _mm_permute_ps(v, imm);
+#else
+        return _mm_shuffle_ps(v, v, imm);
+#endif
+    }
+
+#ifdef __AVX__
+    /**
+     * @brief Shuffle the 64-bit elements of a single register across both 128-bit halves. Uses vpermpd on AVX2 and goes through
+     * memory otherwise.
+     */
+    template<int imm>
+    [[nodiscard]] inline __m256d permute(const __m256d v) noexcept
+    {
+#ifdef __AVX2__
+        return _mm256_permute4x64_pd(v, imm);
+#else
+        alignas(32) double d[4];
+        _mm256_store_pd(d, v);
+        return _mm256_setr_pd(d[imm & 0x3], d[(imm >> 2) & 0x3], d[(imm >> 4) & 0x3], d[(imm >> 6) & 0x3]);
+#endif
+    }
+#endif
+}
@@ -0,0 +1,303 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/parallel.h"
+#include "math/aabb/aabb.h"
+#include "math/vector/vec3.h"
+#include "math/vector/simd/batch.h"
+
+namespace math
+{
+    /**
+     * @brief Summation algorithm of reduce_add over spans.
+     */
+    enum class summation
+    {
+        /** @brief SIMD accumulators only. Fastest, but the error grows linearly with the number of elements. */
+        naive,
+        /** @brief Blocks of 2048 elements are summed with SIMD accumulators and the block sums are added pairwise. The
+         * error grows with the logarithm of the number of elements, at almost the speed of naive summation. */
+        pairwise,
+        /** @brief Kahan summation per SIMD lane. The error does not depend on the number of elements. About 4 times
+         * slower than naive summation. */
+        kahan
+    };
+
+    namespace detail
+    {
+        static_assert(sizeof(vec<float, 3>) == 3 * sizeof(float));
+
+        // Number of elements summed with SIMD accumulators before the sums are combined pairwise.
+        inline constexpr size_t pairwise_block = 2048;
+
+        // Minimum number of elements per thread. Below that, waking a thread costs more than it saves.
+        inline constexpr size_t parallel_grain = size_t(1) << 18;
+
+        /**
+         * @brief Compensated sum that tolerates terms larger than the running sum (Neumaier's variant of Kahan summation).
+         */
+        struct compensated_sum
+        {
+            float sum = 0;
+            float c   = 0;
+
+            void add(const float x) noexcept
+            {
+                const float t = sum + x;
+                c += std::abs(sum) >= std::abs(x) ? (sum - t) + x : (x - t) + sum;
+                sum = t;
+            }
+
+            [[nodiscard]] float value() const noexcept { return sum + c; }
+        };
+
+        [[nodiscard]] inline float sum_naive(const float* ptr, const size_t n) noexcept
+        {
+            using B          = batch<float>;
+            constexpr size_t W = batch_width_v<float>;
+
+            // Independent accumulators hide the latency of the additions.
+            B      a0(0.0f), a1(0.0f), a2(0.0f), a3(0.0f);
+            size_t i = 0;
+            for (; i + 4 * W <= n; i += 4 * W)
+            {
+                a0 += B::loadu(ptr + i);
+                a1 += B::loadu(ptr + i + W);
+                a2 += B::loadu(ptr + i + 2 * W);
+                a3 += B::loadu(ptr + i + 3 * W);
+            }
+            for (; i + W <= n; i += W) a0 += B::loadu(ptr + i);
+            if (i < n) a1 += batch_load_partial(ptr + i, n - i);
+            return reduce_add((a0 + a1) + (a2 + a3));
+        }
+
+        [[nodiscard]] inline float sum_pairwise(const float* ptr, const size_t n) noexcept
+        {
+            if (n <= pairwise_block) return sum_naive(ptr, n);
+            const size_t half = (n / 2 + pairwise_block - 1) / pairwise_block * pairwise_block;
+            return sum_pairwise(ptr, half) + sum_pairwise(ptr + half, n - half);
+        }
+
+        [[nodiscard]] inline compensated_sum sum_kahan(const float* ptr, const size_t n) noexcept
+        {
+            using B          = batch<float>;
+            constexpr size_t W = batch_width_v<float>;
+
+            B      s(0.0f), c(0.0f);
+            size_t i         = 0;
+            const auto step = [&](const B& x) {
+                const B y = x - c;
+                const B t = s + y;
+                c         = (t - s) - y;
+                s         = t;
+            };
+            for (; i + W <= n; i += W) step(B::loadu(ptr + i));
+            if (i < n) step(batch_load_partial(ptr + i, n - i));
+
+            float ls[W], lc[W];
+            B::storeu(ls, s);
+            B::storeu(lc, c);
+            compensated_sum sum;
+            for (size_t j = 0; j < W; j++)
+            {
+                sum.add(ls[j]);
+                sum.add(-lc[j]);
+            }
+            return sum;
+        }
+
+        template<bool Max>
+        [[nodiscard]] float min_max(const float* ptr, const size_t n) noexcept
+        {
+            using B            = batch<float>;
+            constexpr size_t W = batch_width_v<float>;
+            constexpr float  identity = Max ? -std::numeric_limits<float>::infinity() : std::numeric_limits<float>::infinity();
+
+            // The accumulator is the second operand, which minps and maxps return if either is NaN. NaN elements are skipped.
+            const auto op = [](const auto& x, const auto& acc) {
+                if constexpr (Max)
+                    return max(x, acc);
+                else
+                    return min(x, acc);
+            };
+
+            B      a0(identity), a1(identity);
+            size_t i = 0;
+            for (; i + 2 * W <= n; i += 2 * W)
+            {
+                a0 = op(B::loadu(ptr + i), a0);
+                a1 = op(B::loadu(ptr + i + W), a1);
+            }
+            for (; i + W <= n; i += W) a0 = op(B::loadu(ptr + i), a0);
+            if (i < n) a1 = op(batch_load_partial(ptr + i, n - i, identity), a1);
+
+            a0 = op(a0, a1);
+            if constexpr (Max)
+                return reduce_max(a0);
+            else
+                return reduce_min(a0);
+        }
+
+        /**
+         * @brief Component-wise minimum (if Min) and maximum (if Max) of n vectors. W consecutive vectors are 3 batches of
+         * floats. Every lane of these batches always holds the same component, so the batches are accumulated separately
+         * and only split into components at the end.
+         */
+        template<bool Min, bool Max>
+        [[nodiscard]] AABB<vec<float, 3>> bounds(const vec<float, 3>* ptr, const size_t n) noexcept
+        {
+            using B            = batch<float>;
+            constexpr size_t W = batch_width_v<float>;
+            constexpr float  inf = std::numeric_limits<float>::infinity();
+
+            const float* f = &ptr->x;
+            B            lo0(inf), lo1(inf), lo2(inf), hi0(-inf), hi1(-inf), hi2(-inf);
+            size_t       i = 0;
+            for (; i + W <= n; i += W)
+            {
+                const B v0 = B::loadu(f + 3 * i), v1 = B::loadu(f + 3 * i + W), v2 = B::loadu(f + 3 * i + 2 * W);
+                if constexpr (Min)
+                {
+                    lo0 = min(v0, lo0);
+                    lo1 = min(v1, lo1);
+                    lo2 = min(v2, lo2);
+                }
+                if constexpr (Max)
+                {
+                    hi0 = max(v0, hi0);
+                    hi1 = max(v1, hi1);
+                    hi2 = max(v2, hi2);
+                }
+            }
+
+            float lo[3 * W], hi[3 * W];
+            B::storeu(lo, lo0);
+            B::storeu(lo + W, lo1);
+            B::storeu(lo + 2 * W, lo2);
+            B::storeu(hi, hi0);
+            B::storeu(hi + W, hi1);
+            B::storeu(hi + 2 * W, hi2);
+
+            AABB<vec<float, 3>> box(vec<float, 3>(inf), vec<float, 3>(-inf));
+            for (size_t j = 0; j < 3 * W; j++)
+            {
+                box.lower[j % 3] = min(box.lower[j % 3], lo[j]);
+                box.upper[j % 3] = max(box.upper[j % 3], hi[j]);
+            }
+
+            for (; i < n; i++)
+            {
+                if constexpr (Min) box.lower = min(box.lower, ptr[i]);
+                if constexpr (Max) box.upper = max(box.upper, ptr[i]);
+            }
+            return box;
+        }
+
+        template<bool Min, bool Max>
+        [[nodiscard]] AABB<vec<float, 3>> parallel_bounds(const std::span<const vec<float, 3>> v)
+        {
+            return parallel_reduce(
+              index_range{0, v.size()},
+              parallel_grain,
+              AABB<vec<float, 3>>(vec<float, 3>(std::numeric_limits<float>::infinity()), vec<float, 3>(-std::numeric_limits<float>::infinity())),
+              [&](const size_t begin, const size_t end) { return bounds<Min, Max>(v.data() + begin, end - begin); },
+              [](const AABB<vec<float, 3>>& a, const AABB<vec<float, 3>>& b) { return a + b; });
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Reductions over spans.
+    ////////////////////////////////////////////////////////////////
+
+    // Large spans are split over the threads of the current executor, see math/parallel.h. All reductions skip NaN elements
+    // except reduce_add.
+
+    /**
+     * @brief Sum of all elements.
+     * @param v Elements.
+     * @param s Summation algorithm.
+     * @return Sum, 0 if v is empty.
+     */
+    [[nodiscard]] inline float reduce_add(const std::span<const float> v, const summation s = summation::pairwise)
+    {
+        const auto sum = [&](const size_t begin, const size_t end) {
+            detail::compensated_sum r;
+            if (s == summation::naive)
+                r.sum = detail::sum_naive(v.data() + begin, end - begin);
+            else if (s == summation::pairwise)
+                r.sum = detail::sum_pairwise(v.data() + begin, end - begin);
+            else
+                r = detail::sum_kahan(v.data() + begin, end - begin);
+            return r;
+        };
+
+        // Split at block boundaries, so that the threads sum the same blocks as a single thread would.
+        constexpr size_t block = detail::pairwise_block;
+        return parallel_reduce(
+                 index_range{0, (v.size() + block - 1) / block},
+                 detail::parallel_grain / block,
+                 detail::compensated_sum{},
+                 [&](const size_t begin, const size_t end) { return sum(begin * block, std::min(end * block, v.size())); },
+                 [](detail::compensated_sum a, const detail::compensated_sum& b) {
+                     a.add(b.sum);
+                     a.c += b.c;
+                     return a;
+                 })
+          .value();
+    }
+
+    /**
+     * @brief Smallest element, +infinity if v is empty.
+     */
+    [[nodiscard]] inline float reduce_min(const std::span<const float> v)
+    {
+        return parallel_reduce(
+          index_range{0, v.size()},
+          detail::parallel_grain,
+          std::numeric_limits<float>::infinity(),
+          [&](const size_t begin, const size_t end) { return detail::min_max<false>(v.data() + begin, end - begin); },
+          [](const float a, const float b) { return min(a, b); });
+    }
+
+    /**
+     * @brief Largest element, -infinity if v is empty.
+     */
+    [[nodiscard]] inline float reduce_max(const std::span<const float> v)
+    {
+        return parallel_reduce(
+          index_range{0, v.size()},
+          detail::parallel_grain,
+          -std::numeric_limits<float>::infinity(),
+          [&](const size_t begin, const size_t end) { return detail::min_max<true>(v.data() + begin, end - begin); },
+          [](const float a, const float b) { return max(a, b); });
+    }
+
+    /**
+     * @brief Component-wise minimum, +infinity if v is empty.
+     */
+    [[nodiscard]] inline vec<float, 3> reduce_min(const std::span<const vec<float, 3>> v) { return detail::parallel_bounds<true, false>(v).lower; }
+
+    /**
+     * @brief Component-wise maximum, -infinity if v is empty.
+     */
+    [[nodiscard]] inline vec<float, 3> reduce_max(const std::span<const vec<float, 3>> v) { return detail::parallel_bounds<false, true>(v).upper; }
+
+    /**
+     * @brief Smallest box containing all points. If v is empty, lower is +infinity and upper is -infinity, which is the
+     * identity of the union of boxes.
+     */
+    [[nodiscard]] inline AABB<vec<float, 3>> bounds(const std::span<const vec<float, 3>> v) { return detail::parallel_bounds<true, true>(v); }
+}
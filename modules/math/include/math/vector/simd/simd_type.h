@@ -0,0 +1,138 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <type_traits>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/vector/vector.h"
+#include "math/vector/vec2.h"
+#include "math/vector/vec4.h"
+#include "math/vector/vec8.h"
+#include "math/vector/simd/vec2da.h"
+#include "math/vector/simd/vec4da.h"
+#include "math/vector/simd/vec4fa.h"
+#include "math/vector/simd/vec4ia.h"
+#include "math/vector/simd/vec8fa.h"
+#include "math/vector/simd/vec8ia.h"
+#include "math/vector/simd/vec16fa.h"
+#include "math/vector/simd/vec16ia.h"
+
+namespace math
+{
+    ////////////////////////////////////////////////////////////////
+    // simd_type
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Maps vec<T, N> onto the SIMD type with the same element type and size, if the target ISA has one.
+     * Falls back to vec<T, N> itself otherwise.
+     */
+    template<typename T, size_t N>
+    struct simd_type
+    {
+        using type = vec<T, N>;
+    };
+
+    template<>
+    struct simd_type<double, 2>
+    {
+        using type = vec2da;
+    };
+
+    template<>
+    struct simd_type<float, 4>
+    {
+        using type = vec4fa;
+    };
+
+    template<>
+    struct simd_type<int32_t, 4>
+    {
+        using type = vec4ia;
+    };
+
+#ifdef __AVX__
+    template<>
+    struct simd_type<double, 4>
+    {
+        using type = vec4da;
+    };
+
+    template<>
+    struct simd_type<float, 8>
+    {
+        using type = vec8fa;
+    };
+#endif
+
+    // The integer arithmetic of vec8ia needs AVX2.
+#ifdef __AVX2__
+    template<>
+    struct simd_type<int32_t, 8>
+    {
+        using type = vec8ia;
+    };
+#endif
+
+#ifdef __AVX512F__
+    template<>
+    struct simd_type<float, 16>
+    {
+        using type = vec16fa;
+    };
+
+    template<>
+    struct simd_type<int32_t, 16>
+    {
+        using type = vec16ia;
+    };
+#endif
+
+    template<typename T, size_t N>
+    using simd_t = typename simd_type<T, N>::type;
+
+    template<typename T, size_t N>
+    inline constexpr bool has_simd_v = !std::is_same_v<simd_t<T, N>, vec<T, N>>;
+
+    ////////////////////////////////////////////////////////////////
+    // Conversion.
+    ////////////////////////////////////////////////////////////////
+
+    // Both representations store the elements contiguously and in the same order, so conversion is a single unaligned load or store.
+    static_assert(sizeof(vec<double, 2>) == sizeof(vec2da));
+    static_assert(sizeof(vec<float, 4>) == sizeof(vec4fa) && sizeof(vec<int32_t, 4>) == sizeof(vec4ia));
+#ifdef __AVX__
+    static_assert(sizeof(vec<double, 4>) == sizeof(vec4da));
+    static_assert(sizeof(vec<float, 8>) == sizeof(vec8fa) && sizeof(vec<int32_t, 8>) == sizeof(vec8ia));
+#endif
+#ifdef __AVX512F__
+    static_assert(sizeof(vec<float, 16>) == sizeof(vec16fa) && sizeof(vec<int32_t, 16>) == sizeof(vec16ia));
+#endif
+
+    /**
+     * @brief Convert to the SIMD type selected by simd_t. Returns the vector unchanged if there is none.
+     */
+    template<typename T, size_t N>
+    [[nodiscard]] simd_t<T, N> to_simd(const vec<T, N>& v) noexcept
+    {
+        if constexpr (has_simd_v<T, N>)
+            return simd_t<T, N>(v);
+        else
+            return v;
+    }
+
+    /**
+     * @brief Convert a SIMD type back to vec<T, N>. Returns generic vectors unchanged.
+     */
+    template<typename S>
+    [[nodiscard]] vec<typename S::element_type, S::size> from_simd(const S& v) noexcept
+    {
+        return static_cast<vec<typename S::element_type, S::size>>(v);
+    }
+}
@@ -0,0 +1,165 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <immintrin.h>
+#include <iostream>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/vector/vector.h"
+
+namespace math
+{
+#ifdef __AVX512F__
+    /**=================================================================================================
+     * Struct: vec16ba
+     * =================================================================================================
+     * @struct  vec16ba
+     *
+     * @brief   Mask of 16 booleans, stored in an AVX-512 mask register instead of a full vector register. Bit i is lane i.
+    **/
+    struct vec16ba
+    {
+        static constexpr size_t size = 16;
+        using element_type = bool;
+
+        __mmask16 k;
+
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] vec16ba() noexcept : k(0) {}
+
+        [[nodiscard]] explicit vec16ba(uninit_t) noexcept {}
+
+        [[nodiscard]] explicit vec16ba(const bool b) noexcept : k(b ? 0xffff : 0) {}
+
+        [[nodiscard]] vec16ba(const __mmask16 k) noexcept : k(k) {}
+
+        [[nodiscard]] vec16ba(const vec16ba& rhs) noexcept = default;
+
+        [[nodiscard]] explicit vec16ba(const vec<bool, 16>& rhs) noexcept : k(0)
+        {
+            for (size_t i = 0; i < 16; i++) k |= static_cast<__mmask16>(rhs[i]) << i;
+        }
+
+        ////////////////////////////////////////////////////////////////
+        // Assignment operators.
+        ////////////////////////////////////////////////////////////////
+
+        vec16ba& operator=(const vec16ba& rhs) noexcept = default;
+
+        vec16ba& operator=(const bool rhs) noexcept { k = rhs ? 0xffff : 0; return *this; }
+
+        ////////////////////////////////////////////////////////////////
+        // Defaulted constructors and operators.
+        ////////////////////////////////////////////////////////////////
+
+        ~vec16ba() noexcept = default;
+
+        vec16ba(vec16ba&& rhs) noexcept = default;
+
+        vec16ba& operator=(vec16ba&& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Casting operators.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] operator __mmask16() const noexcept { return k; }
+
+        [[nodiscard]] explicit operator vec<bool, 16>() const noexcept
+        {
+            vec<bool, 16> v;
+            for (size_t i = 0; i < 16; i++) v[i] = (*this)[i];
+            return v;
+        }
+
+        ////////////////////////////////////////////////////////////////
+        // Element access.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] bool operator[](const size_t i) const { assert(i < 16); return static_cast<bool>((k >> i) & 0x1); }
+
+        ////////////////////////////////////////////////////////////////
+        // Construct special values.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * @brief Mask with the first n lanes set, for loads and stores of loop tails.
+         */
+        [[nodiscard]] static vec16ba first(const size_t n) noexcept
+        {
+            assert(n <= 16);
+            return static_cast<__mmask16>((1u << n) - 1);
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////
+    // Bitwise operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec16ba operator!(const vec16ba& lhs) noexcept { return _mm512_knot(lhs); }
+
+    [[nodiscard]] inline vec16ba operator&(const vec16ba& lhs, const vec16ba& rhs) noexcept { return _mm512_kand(lhs, rhs); }
+
+    [[nodiscard]] inline vec16ba operator|(const vec16ba& lhs, const vec16ba& rhs) noexcept { return _mm512_kor(lhs, rhs); }
+
+    [[nodiscard]] inline vec16ba operator^(const vec16ba& lhs, const vec16ba& rhs) noexcept { return _mm512_kxor(lhs, rhs); }
+
+    inline vec16ba& operator&=(vec16ba& lhs, const vec16ba& rhs) noexcept { return lhs = lhs & rhs; }
+
+    inline vec16ba& operator|=(vec16ba& lhs, const vec16ba& rhs) noexcept { return lhs = lhs | rhs; }
+
+    inline vec16ba& operator^=(vec16ba& lhs, const vec16ba& rhs) noexcept { return lhs = lhs ^ rhs; }
+
+    ////////////////////////////////////////////////////////////////
+    // Comparison operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline bool operator==(const vec16ba& lhs, const vec16ba& rhs) noexcept { return lhs.k == rhs.k; }
+
+    [[nodiscard]] inline bool operator!=(const vec16ba& lhs, const vec16ba& rhs) noexcept { return lhs.k != rhs.k; }
+
+    ////////////////////////////////////////////////////////////////
+    // Per-element comparisons.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec16ba cmpeq(const vec16ba& lhs, const vec16ba& rhs) noexcept { return _mm512_kxnor(lhs, rhs); }
+
+    [[nodiscard]] inline vec16ba cmpneq(const vec16ba& lhs, const vec16ba& rhs) noexcept { return _mm512_kxor(lhs, rhs); }
+
+    ////////////////////////////////////////////////////////////////
+    // Select.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec16ba select(const vec16ba& t, const vec16ba& f, const vec16ba& b) noexcept { return _mm512_kor(_mm512_kand(b, t), _mm512_kandn(b, f)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Boolean vector reduction.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline bool all(const vec16ba& lhs) noexcept { return lhs.k == 0xffff; }
+
+    [[nodiscard]] inline bool any(const vec16ba& lhs) noexcept { return lhs.k != 0; }
+
+    [[nodiscard]] inline bool none(const vec16ba& lhs) noexcept { return lhs.k == 0; }
+
+    ////////////////////////////////////////////////////////////////
+    // Output.
+    ////////////////////////////////////////////////////////////////
+
+    inline std::ostream& operator<<(std::ostream& out, const vec16ba& v)
+    {
+        out << "(" << v[0];
+        for (size_t i = 1; i < 16; i++) out << ", " << v[i];
+        return out << ")";
+    }
+#endif
+}
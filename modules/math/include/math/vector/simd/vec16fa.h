@@ -0,0 +1,473 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <immintrin.h>
+#include <iostream>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/vector/simd/vec8fa.h"
+#include "math/vector/simd/vec16ba.h"
+#include "math/vector/simd/vec16ia.h"
+
+namespace math
+{
+#ifdef __AVX512F__
+    struct alignas(64) vec16fa
+    {
+        static constexpr size_t size = 16;
+        using element_type = float;
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4201)
+#endif
+        union
+        {
+            __m512 m512;
+            float data[16];
+        };
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] vec16fa() noexcept : m512(_mm512_setzero_ps()) {}
+
+        [[nodiscard]] explicit vec16fa(uninit_t) noexcept {}
+
+        [[nodiscard]] explicit vec16fa(const float v) noexcept : m512(_mm512_set1_ps(v)) {}
+
+        [[nodiscard]] vec16fa(const __m512 m512) noexcept : m512(m512) {}
+
+        [[nodiscard]] explicit vec16fa(const __m512i m512) noexcept : m512(_mm512_castsi512_ps(m512)) {}
+
+        [[nodiscard]] vec16fa(const vec16fa& rhs) noexcept = default;
+
+        [[nodiscard]] vec16fa(const vec8fa& low, const vec8fa& high) noexcept :
+            m512(_mm512_castpd_ps(_mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512(low)), _mm256_castps_pd(high), 1)))
+        {
+        }
+
+        [[nodiscard]] explicit vec16fa(const vec<float, 16>& rhs) noexcept : m512(_mm512_loadu_ps(&rhs[0])) {}
+
+        ////////////////////////////////////////////////////////////////
+        // Assignment operators.
+        ////////////////////////////////////////////////////////////////
+
+        vec16fa& operator=(const vec16fa& rhs) noexcept = default;
+
+        vec16fa& operator=(const float rhs) noexcept { m512 = _mm512_set1_ps(rhs); return *this; }
+
+        ////////////////////////////////////////////////////////////////
+        // Load/store.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] static vec16fa load(const void* const ptr) { return _mm512_load_ps(ptr); }
+
+        [[nodiscard]] static vec16fa loadu(const void* const ptr) { return _mm512_loadu_ps(ptr); }
+
+        static void store(void* ptr, const vec16fa& v) { _mm512_store_ps(ptr, v.m512); }
+
+        static void storeu(void* ptr, const vec16fa& v) { _mm512_storeu_ps(ptr, v.m512); }
+
+        /**
+         * @brief Load the lanes that are set in mask, the other lanes are 0. Memory of lanes that are not set is not accessed.
+         */
+        [[nodiscard]] static vec16fa loadu(const void* const ptr, const vec16ba& mask) { return _mm512_maskz_loadu_ps(mask, ptr); }
+
+        /**
+         * @brief Load the first count elements, e.g. for the tail of a loop.
+         */
+        [[nodiscard]] static vec16fa loadu(const void* const ptr, const size_t count) { return loadu(ptr, vec16ba::first(count)); }
+
+        /**
+         * @brief Store the lanes that are set in mask. Memory of lanes that are not set is not accessed.
+         */
+        static void storeu(void* ptr, const vec16fa& v, const vec16ba& mask) { _mm512_mask_storeu_ps(ptr, mask, v.m512); }
+
+        /**
+         * @brief Store the first count elements, e.g. for the tail of a loop.
+         */
+        static void storeu(void* ptr, const vec16fa& v, const size_t count) { storeu(ptr, v, vec16ba::first(count)); }
+
+        /**
+         * @brief Load base[indices[i]] into lane i.
+         */
+        [[nodiscard]] static vec16fa gather(const float* base, const vec16ia& indices) { return _mm512_i32gather_ps(indices, base, 4); }
+
+        /**
+         * @brief Store lane i to base[indices[i]]. Lanes are written in order, so for duplicate indices the highest lane wins.
+         */
+        static void scatter(float* base, const vec16ia& indices, const vec16fa& v) { _mm512_i32scatter_ps(base, indices, v, 4); }
+
+        /**
+         * @brief Non-temporal store to aligned memory, bypassing the caches. Use for large outputs that are not read again soon.
+         * Other threads are only guaranteed to see the data after an _mm_sfence().
+         */
+        static void stream(void* ptr, const vec16fa& v) { _mm512_stream_ps(static_cast<float*>(ptr), v.m512); }
+
+        ////////////////////////////////////////////////////////////////
+        // Defaulted constructors and operators.
+        ////////////////////////////////////////////////////////////////
+
+        ~vec16fa() noexcept = default;
+
+        vec16fa(vec16fa&& rhs) noexcept = default;
+
+        vec16fa& operator=(vec16fa&& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Casting operators.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] operator const __m512& () const noexcept { return m512; }
+
+        [[nodiscard]] operator __m512& () noexcept { return m512; }
+
+        [[nodiscard]] explicit operator __m512i () const noexcept { return _mm512_castps_si512(m512); }
+
+        [[nodiscard]] explicit operator vec<float, 16>() const noexcept { vec<float, 16> v(uninit); _mm512_storeu_ps(&v[0], m512); return v; }
+
+        ////////////////////////////////////////////////////////////////
+        // Element access.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] const float& operator[](const size_t i) const { assert(i < 16); return data[i]; }
+
+        [[nodiscard]] float& operator[](const size_t i) { assert(i < 16); return data[i]; }
+
+        [[nodiscard]] vec8fa low() const noexcept { return _mm512_castps512_ps256(m512); }
+
+        [[nodiscard]] vec8fa high() const noexcept { return _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(m512), 1)); }
+    };
+
+    ////////////////////////////////////////////////////////////////
+    // Arithmetic operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec16fa operator+(const vec16fa& lhs, const vec16fa& rhs) noexcept { return _mm512_add_ps(lhs, rhs); }
+
+    [[nodiscard]] inline vec16fa operator+(const vec16fa& lhs, const float rhs) noexcept { return lhs + vec16fa(rhs); }
+
+    [[nodiscard]] inline vec16fa operator+(const float lhs, const vec16fa& rhs) noexcept { return vec16fa(lhs) + rhs; }
+
+    [[nodiscard]] inline vec16fa operator-(const vec16fa& lhs, const vec16fa& rhs) noexcept { return _mm512_sub_ps(lhs, rhs); }
+
+    [[nodiscard]] inline vec16fa operator-(const vec16fa& lhs, const float rhs) noexcept { return lhs - vec16fa(rhs); }
+
+    [[nodiscard]] inline vec16fa operator-(const float lhs, const vec16fa& rhs) noexcept { return vec16fa(lhs) - rhs; }
+
+    [[nodiscard]] inline vec16fa operator-(const vec16fa& lhs) noexcept { return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(lhs), _mm512_set1_epi32(0x80000000))); }
+
+    [[nodiscard]] inline vec16fa operator*(const vec16fa& lhs, const vec16fa& rhs) noexcept { return _mm512_mul_ps(lhs, rhs); }
+
+    [[nodiscard]] inline vec16fa operator*(const vec16fa& lhs, const float rhs) noexcept { return lhs * vec16fa(rhs); }
+
+    [[nodiscard]] inline vec16fa operator*(const float lhs, const vec16fa& rhs) noexcept { return vec16fa(lhs) * rhs; }
+
+    [[nodiscard]] inline vec16fa operator/(const vec16fa& lhs, const vec16fa& rhs) noexcept { return _mm512_div_ps(lhs, rhs); }
+
+    [[nodiscard]] inline vec16fa operator/(const vec16fa& lhs, const float rhs) noexcept { return lhs / vec16fa(rhs); }
+
+    [[nodiscard]] inline vec16fa operator/(const float lhs, const vec16fa& rhs) noexcept { return vec16fa(lhs) / rhs; }
+
+    inline vec16fa& operator+=(vec16fa& lhs, const vec16fa& rhs) noexcept { return lhs = lhs + rhs; }
+
+    inline vec16fa& operator+=(vec16fa& lhs, const float rhs) noexcept { return lhs = lhs + rhs; }
+
+    inline vec16fa& operator-=(vec16fa& lhs, const vec16fa& rhs) noexcept { return lhs = lhs - rhs; }
+
+    inline vec16fa& operator-=(vec16fa& lhs, const float rhs) noexcept { return lhs = lhs - rhs; }
+
+    inline vec16fa& operator*=(vec16fa& lhs, const vec16fa& rhs) noexcept { return lhs = lhs * rhs; }
+
+    inline vec16fa& operator*=(vec16fa& lhs, const float rhs) noexcept { return lhs = lhs * rhs; }
+
+    inline vec16fa& operator/=(vec16fa& lhs, const vec16fa& rhs) noexcept { return lhs = lhs / rhs; }
+
+    inline vec16fa& operator/=(vec16fa& lhs, const float rhs) noexcept { return lhs = lhs / rhs; }
+
+    ////////////////////////////////////////////////////////////////
+    // Comparison operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline bool operator==(const vec16fa& lhs, const vec16fa& rhs) noexcept { return _mm512_cmp_ps_mask(lhs, rhs, _CMP_EQ_UQ) == 0xffff; }
+
+    [[nodiscard]] inline bool operator!=(const vec16fa& lhs, const vec16fa& rhs) noexcept { return _mm512_cmp_ps_mask(lhs, rhs, _CMP_EQ_UQ) != 0xffff; }
+
+    ////////////////////////////////////////////////////////////////
+    // Per-element comparisons.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec16ba cmpeq(const vec16fa& lhs, const vec16fa& rhs) noexcept { return _mm512_cmp_ps_mask(lhs, rhs, _CMP_EQ_UQ); }
+
+    [[nodiscard]] inline vec16ba cmpeq(const vec16fa& lhs, const float rhs) noexcept { return cmpeq(lhs, vec16fa(rhs)); }
+
+    [[nodiscard]] inline vec16ba cmpeq(const float lhs, const vec16fa& rhs) noexcept { return cmpeq(vec16fa(lhs), rhs); }
+
+    [[nodiscard]] inline vec16ba cmpneq(const vec16fa& lhs, const vec16fa& rhs) noexcept { return _mm512_cmp_ps_mask(lhs, rhs, _CMP_NEQ_UQ); }
+
+    [[nodiscard]] inline vec16ba cmpneq(const vec16fa& lhs, const float rhs) noexcept { return cmpneq(lhs, vec16fa(rhs)); }
+
+    [[nodiscard]] inline vec16ba cmpneq(const float lhs, const vec16fa& rhs) noexcept { return cmpneq(vec16fa(lhs), rhs); }
+
+    [[nodiscard]] inline vec16ba cmplt(const vec16fa& lhs, const vec16fa& rhs) noexcept { return _mm512_cmp_ps_mask(lhs, rhs, _CMP_LT_OQ); }
+
+    [[nodiscard]] inline vec16ba cmplt(const vec16fa& lhs, const float rhs) noexcept { return cmplt(lhs, vec16fa(rhs)); }
+
+    [[nodiscard]] inline vec16ba cmplt(const float lhs, const vec16fa& rhs) noexcept { return cmplt(vec16fa(lhs), rhs); }
+
+    [[nodiscard]] inline vec16ba cmpgt(const vec16fa& lhs, const vec16fa& rhs) noexcept { return _mm512_cmp_ps_mask(lhs, rhs, _CMP_GT_OQ); }
+
+    [[nodiscard]] inline vec16ba cmpgt(const vec16fa& lhs, const float rhs) noexcept { return cmpgt(lhs, vec16fa(rhs)); }
+
+    [[nodiscard]] inline vec16ba cmpgt(const float lhs, const vec16fa& rhs) noexcept { return cmpgt(vec16fa(lhs), rhs); }
+
+    [[nodiscard]] inline vec16ba cmple(const vec16fa& lhs, const vec16fa& rhs) noexcept { return _mm512_cmp_ps_mask(lhs, rhs, _CMP_LE_OQ); }
+
+    [[nodiscard]] inline vec16ba cmple(const vec16fa& lhs, const float rhs) noexcept { return cmple(lhs, vec16fa(rhs)); }
+
+    [[nodiscard]] inline vec16ba cmple(const float lhs, const vec16fa& rhs) noexcept { return cmple(vec16fa(lhs), rhs); }
+
+    [[nodiscard]] inline vec16ba cmpge(const vec16fa& lhs, const vec16fa& rhs) noexcept { return _mm512_cmp_ps_mask(lhs, rhs, _CMP_GE_OQ); }
+
+    [[nodiscard]] inline vec16ba cmpge(const vec16fa& lhs, const float rhs) noexcept { return cmpge(lhs, vec16fa(rhs)); }
+
+    [[nodiscard]] inline vec16ba cmpge(const float lhs, const vec16fa& rhs) noexcept { return cmpge(vec16fa(lhs), rhs); }
+
+    ////////////////////////////////////////////////////////////////
+    // Min/max, abs and clamp.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec16fa min(const vec16fa& lhs, const vec16fa& rhs) noexcept { return _mm512_min_ps(lhs, rhs); }
+
+    [[nodiscard]] inline vec16fa min(const vec16fa& lhs, const float rhs) noexcept { return min(lhs, vec16fa(rhs)); }
+
+    [[nodiscard]] inline vec16fa min(const float lhs, const vec16fa& rhs) noexcept { return min(vec16fa(lhs), rhs); }
+
+    [[nodiscard]] inline vec16fa max(const vec16fa& lhs, const vec16fa& rhs) noexcept { return _mm512_max_ps(lhs, rhs); }
+
+    [[nodiscard]] inline vec16fa max(const vec16fa& lhs, const float rhs) noexcept { return max(lhs, vec16fa(rhs)); }
+
+    [[nodiscard]] inline vec16fa max(const float lhs, const vec16fa& rhs) noexcept { return max(vec16fa(lhs), rhs); }
+
+    [[nodiscard]] inline vec16fa clamp(const vec16fa& a, const vec16fa& min, const vec16fa& max) noexcept { return math::max(min, math::min(a, max)); }
+
+    [[nodiscard]] inline vec16fa clamp(const vec16fa& a, const vec16fa& min, const float max) noexcept { return clamp(a, min, vec16fa(max)); }
+
+    [[nodiscard]] inline vec16fa clamp(const vec16fa& a, const float min, const vec16fa& max) noexcept { return clamp(a, vec16fa(min), max); }
+
+    [[nodiscard]] inline vec16fa clamp(const vec16fa& a, const float min, const float max) noexcept { return clamp(a, vec16fa(min), vec16fa(max)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Reduction.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline float reduce_add(const vec16fa& lhs) noexcept { return _mm512_reduce_add_ps(lhs); }
+
+    [[nodiscard]] inline float reduce_mul(const vec16fa& lhs) noexcept { return _mm512_reduce_mul_ps(lhs); }
+
+    [[nodiscard]] inline float reduce_min(const vec16fa& lhs) noexcept { return _mm512_reduce_min_ps(lhs); }
+
+    [[nodiscard]] inline float reduce_max(const vec16fa& lhs) noexcept { return _mm512_reduce_max_ps(lhs); }
+
+    ////////////////////////////////////////////////////////////////
+    // Multiply and add.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec16fa madd(const vec16fa& a, const vec16fa& b, const vec16fa& c) noexcept { return _mm512_fmadd_ps(a, b, c); }
+
+    [[nodiscard]] inline vec16fa nmadd(const vec16fa& a, const vec16fa& b, const vec16fa& c) noexcept { return _mm512_fnmadd_ps(a, b, c); }
+
+    [[nodiscard]] inline vec16fa msub(const vec16fa& a, const vec16fa& b, const vec16fa& c) noexcept { return _mm512_fmsub_ps(a, b, c); }
+
+    [[nodiscard]] inline vec16fa nmsub(const vec16fa& a, const vec16fa& b, const vec16fa& c) noexcept { return _mm512_fnmsub_ps(a, b, c); }
+
+    ////////////////////////////////////////////////////////////////
+    // Dot product etc.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline float dot(const vec16fa& lhs, const vec16fa& rhs) noexcept { return reduce_add(lhs * rhs); }
+
+    [[nodiscard]] inline float length(const vec16fa& lhs) noexcept { return sqrt(dot(lhs, lhs)); }
+
+    [[nodiscard]] inline float sqr_length(const vec16fa& lhs) noexcept { return dot(lhs, lhs); }
+
+    [[nodiscard]] inline float rcp_length(const vec16fa& lhs) noexcept { return rsqrt(dot(lhs, lhs)); }
+
+    [[nodiscard]] inline vec16fa normalize(const vec16fa& lhs) noexcept { return lhs * rcp_length(lhs); }
+
+    [[nodiscard]] inline vec16fa normalize(const vec16fa& lhs, float& length) noexcept { length = math::length(lhs); return lhs / length; }
+
+    [[nodiscard]] inline float distance(const vec16fa& lhs, const vec16fa& rhs) noexcept { return length(lhs - rhs); }
+
+    [[nodiscard]] inline vec16fa lerp(const vec16fa& a, const vec16fa& b, const vec16fa& t) noexcept { return madd(t, b - a, a); }
+
+    [[nodiscard]] inline vec16fa lerp(const vec16fa& a, const vec16fa& b, const float t) noexcept { return madd(vec16fa(t), b - a, a); }
+
+    ////////////////////////////////////////////////////////////////
+    // Trigonometry.
+    ////////////////////////////////////////////////////////////////
+
+    namespace detail
+    {
+        template<typename F>
+        [[nodiscard]] vec16fa per_element(const vec16fa& lhs, F&& f) noexcept
+        {
+            vec16fa r(uninit);
+            for (size_t i = 0; i < 16; i++) r[i] = f(lhs[i]);
+            return r;
+        }
+    }
+
+    [[nodiscard]] inline vec16fa acos(const vec16fa& lhs) noexcept { return detail::per_element(lhs, [](const float v) { return acos(v); }); }
+
+    [[nodiscard]] inline vec16fa asin(const vec16fa& lhs) noexcept { return detail::per_element(lhs, [](const float v) { return asin(v); }); }
+
+    [[nodiscard]] inline vec16fa atan(const vec16fa& lhs) noexcept { return detail::per_element(lhs, [](const float v) { return atan(v); }); }
+
+    [[nodiscard]] inline vec16fa atan2(const vec16fa& lhs, const vec16fa& rhs) noexcept
+    {
+        vec16fa r(uninit);
+        for (size_t i = 0; i < 16; i++) r[i] = atan2(lhs[i], rhs[i]);
+        return r;
+    }
+
+    [[nodiscard]] inline vec16fa cos(const vec16fa& lhs) noexcept { return detail::per_element(lhs, [](const float v) { return cos(v); }); }
+
+    [[nodiscard]] inline vec16fa cosh(const vec16fa& lhs) noexcept { return detail::per_element(lhs, [](const float v) { return cosh(v); }); }
+
+    [[nodiscard]] inline vec16fa sin(const vec16fa& lhs) noexcept { return detail::per_element(lhs, [](const float v) { return sin(v); }); }
+
+    [[nodiscard]] inline vec16fa sinh(const vec16fa& lhs) noexcept { return detail::per_element(lhs, [](const float v) { return sinh(v); }); }
+
+    [[nodiscard]] inline vec16fa tan(const vec16fa& lhs) noexcept { return detail::per_element(lhs, [](const float v) { return tan(v); }); }
+
+    [[nodiscard]] inline vec16fa tanh(const vec16fa& lhs) noexcept { return detail::per_element(lhs, [](const float v) { return tanh(v); }); }
+
+    ////////////////////////////////////////////////////////////////
+    // Exponential / Logarithmic.
+    ////////////////////////////////////////////////////////////////
+
+    template<size_t Precision = 5>
+    [[nodiscard]] vec16fa exp2(const vec16fa& lhs) noexcept
+    {
+        static_assert(Precision >= 2 && Precision <= 5, "Provided precision is outside of supported range.");
+
+        const vec16fa x = clamp(lhs, -126.99999f, 129.00000f);
+        const __m512i ipart = _mm512_cvtps_epi32(x - 0.5f);
+        const vec16fa fpart = x - _mm512_cvtepi32_ps(ipart);
+        const vec16fa expipart = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_add_epi32(ipart, _mm512_set1_epi32(127)), 23));
+
+        vec16fa expfpart;
+        if constexpr (Precision == 5)
+            expfpart = foldpoly(fpart, 9.9999994e-1f, 6.9315308e-1f, 2.4015361e-1f, 5.5826318e-2f, 8.9893397e-3f, 1.8775767e-3f);
+        else if constexpr (Precision == 4)
+            expfpart = foldpoly(fpart, 1.0000026f, 6.9300383e-1f, 2.4144275e-1f, 5.2011464e-2f, 1.3534167e-2f);
+        else if constexpr (Precision == 3)
+            expfpart = foldpoly(fpart, 9.9992520e-1f, 6.9583356e-1f, 2.2606716e-1f, 7.8024521e-2f);
+        else if constexpr (Precision == 2)
+            expfpart = foldpoly(fpart, 1.0017247f, 6.5763628e-1f, 3.3718944e-1f);
+
+        return expipart * expfpart;
+    }
+
+    template<size_t Precision = 5>
+    [[nodiscard]] vec16fa log2(const vec16fa& lhs) noexcept
+    {
+        static_assert(Precision >= 2 && Precision <= 5, "Provided precision is outside of supported range.");
+
+        const __m512i expmask = _mm512_set1_epi32(0x7F800000);
+        const __m512i mantmask = _mm512_set1_epi32(0x007FFFFF);
+        const vec16fa one(1.0f);
+
+        const __m512i i = _mm512_castps_si512(lhs);
+        const vec16fa exp = _mm512_cvtepi32_ps(_mm512_sub_epi32(_mm512_srli_epi32(_mm512_and_si512(i, expmask), 23), _mm512_set1_epi32(127)));
+
+        const vec16fa mant = _mm512_castsi512_ps(_mm512_or_si512(_mm512_and_si512(i, mantmask), _mm512_castps_si512(one)));
+
+        vec16fa p;
+        if constexpr (Precision == 5)
+            p = foldpoly(mant, 3.1157899f, -3.3241990f, 2.5988452f, -1.2315303f, 3.1821337e-1f, -3.4436006e-2f);
+        else if constexpr (Precision == 4)
+            p = foldpoly(mant, 2.8882704548164776201f, -2.52074962577807006663f, 1.48116647521213171641f, -0.465725644288844778798f, 0.0596515482674574969533f);
+        else if constexpr (Precision == 3)
+            p = foldpoly(mant, 2.61761038894603480148f, -1.75647175389045657003f, 0.688243882994381274313f, -0.107254423828329604454f);
+        else if constexpr (Precision == 2)
+            p = foldpoly(mant, 2.28330284476918490682f, -1.04913055217340124191f, 0.204446009836232697516f);
+
+        return p * (mant - one) + exp;
+    }
+
+    template<size_t Precision = 5>
+    [[nodiscard]] vec16fa exp(const vec16fa& lhs) noexcept { return exp2<Precision>(lhs * log2<Precision>(vec16fa(m_e))); }
+
+    template<size_t Precision = 5>
+    [[nodiscard]] vec16fa log(const vec16fa& lhs) noexcept { return log2<Precision>(lhs) / log2<Precision>(vec16fa(m_e)); }
+
+    template<size_t Precision = 5>
+    [[nodiscard]] vec16fa log10(const vec16fa& lhs) noexcept { return log2<Precision>(lhs) / log2<Precision>(vec16fa(10.0f)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Power.
+    ////////////////////////////////////////////////////////////////
+
+    template<size_t Precision = 5>
+    [[nodiscard]] vec16fa pow(const vec16fa& lhs, const vec16fa& rhs) noexcept { return exp2<Precision>(rhs * log2<Precision>(lhs)); }
+
+    template<size_t Precision = 5>
+    [[nodiscard]] vec16fa pow(const vec16fa& lhs, const float rhs) noexcept { return exp2<Precision>(vec16fa(rhs) * log2<Precision>(lhs)); }
+
+    template<size_t Precision = 5>
+    [[nodiscard]] vec16fa pow(const float lhs, const vec16fa& rhs) noexcept { return exp2<Precision>(rhs * log2<Precision>(vec16fa(lhs))); }
+
+    [[nodiscard]] inline vec16fa sqr(const vec16fa& lhs) noexcept { return lhs * lhs; }
+
+    [[nodiscard]] inline vec16fa sqrt(const vec16fa& lhs) noexcept { return _mm512_sqrt_ps(lhs); }
+
+    [[nodiscard]] inline vec16fa rsqrt(const vec16fa& lhs) noexcept { return _mm512_rsqrt14_ps(lhs); }
+
+    ////////////////////////////////////////////////////////////////
+    // Rounding, abs, etc.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec16fa abs(const vec16fa& lhs) noexcept { return _mm512_abs_ps(lhs); }
+
+    [[nodiscard]] inline vec16fa round(const vec16fa& lhs) noexcept { return _mm512_roundscale_ps(lhs, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+    [[nodiscard]] inline vec16fa ceil(const vec16fa& lhs) noexcept { return _mm512_roundscale_ps(lhs, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC); }
+
+    [[nodiscard]] inline vec16fa floor(const vec16fa& lhs) noexcept { return _mm512_roundscale_ps(lhs, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+
+    [[nodiscard]] inline vec16fa trunc(const vec16fa& lhs) noexcept { return _mm512_roundscale_ps(lhs, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+
+    [[nodiscard]] inline vec16fa frac(const vec16fa& lhs) noexcept { return lhs - trunc(lhs); }
+
+    ////////////////////////////////////////////////////////////////
+    // Select.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec16fa select(const vec16fa& t, const vec16fa& f, const vec16ba& b) noexcept { return _mm512_mask_blend_ps(b, f, t); }
+
+    ////////////////////////////////////////////////////////////////
+    // Output.
+    ////////////////////////////////////////////////////////////////
+
+    inline std::ostream& operator<<(std::ostream& out, const vec16fa& v)
+    {
+        out << "(" << v[0];
+        for (size_t i = 1; i < 16; i++) out << ", " << v[i];
+        return out << ")";
+    }
+#endif
+}
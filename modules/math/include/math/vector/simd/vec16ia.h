@@ -0,0 +1,379 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <immintrin.h>
+#include <iostream>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/vector/simd/vec8ia.h"
+#include "math/vector/simd/vec16ba.h"
+
+namespace math
+{
+#ifdef __AVX512F__
+    struct alignas(64) vec16ia
+    {
+        static constexpr size_t size = 16;
+        using element_type = int32_t;
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4201)
+#endif
+        union
+        {
+            __m512i m512;
+            int32_t data[16];
+        };
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] vec16ia() noexcept : m512(_mm512_setzero_si512()) {}
+
+        [[nodiscard]] explicit vec16ia(uninit_t) noexcept {}
+
+        [[nodiscard]] explicit vec16ia(const int32_t v) noexcept : m512(_mm512_set1_epi32(v)) {}
+
+        [[nodiscard]] vec16ia(const __m512i m512) noexcept : m512(m512) {}
+
+        [[nodiscard]] explicit vec16ia(const __m512 m512) noexcept : m512(_mm512_castps_si512(m512)) {}
+
+        [[nodiscard]] vec16ia(const vec16ia& rhs) noexcept = default;
+
+        [[nodiscard]] vec16ia(const vec8ia& low, const vec8ia& high) noexcept : m512(_mm512_inserti64x4(_mm512_castsi256_si512(low), high, 1)) {}
+
+        [[nodiscard]] explicit vec16ia(const vec<int32_t, 16>& rhs) noexcept : m512(_mm512_loadu_si512(&rhs[0])) {}
+
+        ////////////////////////////////////////////////////////////////
+        // Assignment operators.
+        ////////////////////////////////////////////////////////////////
+
+        vec16ia& operator=(const vec16ia& rhs) noexcept = default;
+
+        vec16ia& operator=(const int32_t rhs) noexcept { m512 = _mm512_set1_epi32(rhs); return *this; }
+
+        ////////////////////////////////////////////////////////////////
+        // Load/store.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] static vec16ia load(const void* const ptr) { return _mm512_load_si512(ptr); }
+
+        [[nodiscard]] static vec16ia loadu(const void* const ptr) { return _mm512_loadu_si512(ptr); }
+
+        static void store(void* ptr, const vec16ia& v) { _mm512_store_si512(ptr, v.m512); }
+
+        static void storeu(void* ptr, const vec16ia& v) { _mm512_storeu_si512(ptr, v.m512); }
+
+        /**
+         * @brief Load the lanes that are set in mask, the other lanes are 0. Memory of lanes that are not set is not accessed.
+         */
+        [[nodiscard]] static vec16ia loadu(const void* const ptr, const vec16ba& mask) { return _mm512_maskz_loadu_epi32(mask, ptr); }
+
+        /**
+         * @brief Load the first count elements, e.g. for the tail of a loop.
+         */
+        [[nodiscard]] static vec16ia loadu(const void* const ptr, const size_t count) { return loadu(ptr, vec16ba::first(count)); }
+
+        /**
+         * @brief Store the lanes that are set in mask. Memory of lanes that are not set is not accessed.
+         */
+        static void storeu(void* ptr, const vec16ia& v, const vec16ba& mask) { _mm512_mask_storeu_epi32(ptr, mask, v.m512); }
+
+        /**
+         * @brief Store the first count elements, e.g. for the tail of a loop.
+         */
+        static void storeu(void* ptr, const vec16ia& v, const size_t count) { storeu(ptr, v, vec16ba::first(count)); }
+
+        /**
+         * @brief Load base[indices[i]] into lane i.
+         */
+        [[nodiscard]] static vec16ia gather(const int32_t* base, const vec16ia& indices) { return vec16ia(_mm512_i32gather_epi32(indices, base, 4)); }
+
+        /**
+         * @brief Store lane i to base[indices[i]]. Lanes are written in order, so for duplicate indices the highest lane wins.
+         */
+        static void scatter(int32_t* base, const vec16ia& indices, const vec16ia& v) { _mm512_i32scatter_epi32(base, indices, v, 4); }
+
+        /**
+         * @brief Non-temporal store to aligned memory, bypassing the caches. Use for large outputs that are not read again soon.
+         * Other threads are only guaranteed to see the data after an _mm_sfence().
+         */
+        static void stream(void* ptr, const vec16ia& v) { _mm512_stream_si512(static_cast<__m512i*>(ptr), v.m512); }
+
+        ////////////////////////////////////////////////////////////////
+        // Defaulted constructors and operators.
+        ////////////////////////////////////////////////////////////////
+
+        ~vec16ia() noexcept = default;
+
+        vec16ia(vec16ia&& rhs) noexcept = default;
+
+        vec16ia& operator=(vec16ia&& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Casting operators.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] operator const __m512i& () const noexcept { return m512; }
+
+        [[nodiscard]] operator __m512i& () noexcept { return m512; }
+
+        [[nodiscard]] explicit operator __m512 () const noexcept { return _mm512_castsi512_ps(m512); }
+
+        [[nodiscard]] explicit operator vec<int32_t, 16>() const noexcept { vec<int32_t, 16> v(uninit); _mm512_storeu_si512(&v[0], m512); return v; }
+
+        ////////////////////////////////////////////////////////////////
+        // Element access.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] const int32_t& operator[](const size_t i) const { assert(i < 16); return data[i]; }
+
+        [[nodiscard]] int32_t& operator[](const size_t i) { assert(i < 16); return data[i]; }
+
+        [[nodiscard]] vec8ia low() const noexcept { return _mm512_castsi512_si256(m512); }
+
+        [[nodiscard]] vec8ia high() const noexcept { return _mm512_extracti64x4_epi64(m512, 1); }
+    };
+
+    ////////////////////////////////////////////////////////////////
+    // Arithmetic operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec16ia operator+(const vec16ia& lhs, const vec16ia& rhs) noexcept { return _mm512_add_epi32(lhs, rhs); }
+
+    [[nodiscard]] inline vec16ia operator+(const vec16ia& lhs, const int32_t rhs) noexcept { return lhs + vec16ia(rhs); }
+
+    [[nodiscard]] inline vec16ia operator+(const int32_t lhs, const vec16ia& rhs) noexcept { return vec16ia(lhs) + rhs; }
+
+    [[nodiscard]] inline vec16ia operator-(const vec16ia& lhs, const vec16ia& rhs) noexcept { return _mm512_sub_epi32(lhs, rhs); }
+
+    [[nodiscard]] inline vec16ia operator-(const vec16ia& lhs, const int32_t rhs) noexcept { return lhs - vec16ia(rhs); }
+
+    [[nodiscard]] inline vec16ia operator-(const int32_t lhs, const vec16ia& rhs) noexcept { return vec16ia(lhs) - rhs; }
+
+    [[nodiscard]] inline vec16ia operator-(const vec16ia& lhs) noexcept { return _mm512_sub_epi32(_mm512_setzero_si512(), lhs); }
+
+    [[nodiscard]] inline vec16ia operator*(const vec16ia& lhs, const vec16ia& rhs) noexcept { return _mm512_mullo_epi32(lhs, rhs); }
+
+    [[nodiscard]] inline vec16ia operator*(const vec16ia& lhs, const int32_t rhs) noexcept { return lhs * vec16ia(rhs); }
+
+    [[nodiscard]] inline vec16ia operator*(const int32_t lhs, const vec16ia& rhs) noexcept { return vec16ia(lhs) * rhs; }
+
+    [[nodiscard]] inline vec16ia operator/(const vec16ia& lhs, const vec16ia& rhs) noexcept
+    {
+        // Cast to float and round with truncation.
+        return _mm512_cvttps_epi32(_mm512_div_ps(_mm512_cvtepi32_ps(lhs), _mm512_cvtepi32_ps(rhs)));
+    }
+
+    [[nodiscard]] inline vec16ia operator/(const vec16ia& lhs, const int32_t rhs) noexcept { return lhs / vec16ia(rhs); }
+
+    [[nodiscard]] inline vec16ia operator/(const int32_t lhs, const vec16ia& rhs) noexcept { return vec16ia(lhs) / rhs; }
+
+    inline vec16ia& operator+=(vec16ia& lhs, const vec16ia& rhs) noexcept { return lhs = lhs + rhs; }
+
+    inline vec16ia& operator+=(vec16ia& lhs, const int32_t rhs) noexcept { return lhs = lhs + rhs; }
+
+    inline vec16ia& operator-=(vec16ia& lhs, const vec16ia& rhs) noexcept { return lhs = lhs - rhs; }
+
+    inline vec16ia& operator-=(vec16ia& lhs, const int32_t rhs) noexcept { return lhs = lhs - rhs; }
+
+    inline vec16ia& operator*=(vec16ia& lhs, const vec16ia& rhs) noexcept { return lhs = lhs * rhs; }
+
+    inline vec16ia& operator*=(vec16ia& lhs, const int32_t rhs) noexcept { return lhs = lhs * rhs; }
+
+    inline vec16ia& operator/=(vec16ia& lhs, const vec16ia& rhs) noexcept { return lhs = lhs / rhs; }
+
+    inline vec16ia& operator/=(vec16ia& lhs, const int32_t rhs) noexcept { return lhs = lhs / rhs; }
+
+    ////////////////////////////////////////////////////////////////
+    // Comparison operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline bool operator==(const vec16ia& lhs, const vec16ia& rhs) noexcept { return _mm512_cmpeq_epi32_mask(lhs, rhs) == 0xffff; }
+
+    [[nodiscard]] inline bool operator!=(const vec16ia& lhs, const vec16ia& rhs) noexcept { return _mm512_cmpeq_epi32_mask(lhs, rhs) != 0xffff; }
+
+    ////////////////////////////////////////////////////////////////
+    // Per-element comparisons.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec16ba cmpeq(const vec16ia& lhs, const vec16ia& rhs) noexcept { return _mm512_cmpeq_epi32_mask(lhs, rhs); }
+
+    [[nodiscard]] inline vec16ba cmpeq(const vec16ia& lhs, const int32_t rhs) noexcept { return cmpeq(lhs, vec16ia(rhs)); }
+
+    [[nodiscard]] inline vec16ba cmpeq(const int32_t lhs, const vec16ia& rhs) noexcept { return cmpeq(vec16ia(lhs), rhs); }
+
+    [[nodiscard]] inline vec16ba cmpneq(const vec16ia& lhs, const vec16ia& rhs) noexcept { return _mm512_cmpneq_epi32_mask(lhs, rhs); }
+
+    [[nodiscard]] inline vec16ba cmpneq(const vec16ia& lhs, const int32_t rhs) noexcept { return cmpneq(lhs, vec16ia(rhs)); }
+
+    [[nodiscard]] inline vec16ba cmpneq(const int32_t lhs, const vec16ia& rhs) noexcept { return cmpneq(vec16ia(lhs), rhs); }
+
+    [[nodiscard]] inline vec16ba cmplt(const vec16ia& lhs, const vec16ia& rhs) noexcept { return _mm512_cmplt_epi32_mask(lhs, rhs); }
+
+    [[nodiscard]] inline vec16ba cmplt(const vec16ia& lhs, const int32_t rhs) noexcept { return cmplt(lhs, vec16ia(rhs)); }
+
+    [[nodiscard]] inline vec16ba cmplt(const int32_t lhs, const vec16ia& rhs) noexcept { return cmplt(vec16ia(lhs), rhs); }
+
+    [[nodiscard]] inline vec16ba cmpgt(const vec16ia& lhs, const vec16ia& rhs) noexcept { return _mm512_cmpgt_epi32_mask(lhs, rhs); }
+
+    [[nodiscard]] inline vec16ba cmpgt(const vec16ia& lhs, const int32_t rhs) noexcept { return cmpgt(lhs, vec16ia(rhs)); }
+
+    [[nodiscard]] inline vec16ba cmpgt(const int32_t lhs, const vec16ia& rhs) noexcept { return cmpgt(vec16ia(lhs), rhs); }
+
+    [[nodiscard]] inline vec16ba cmple(const vec16ia& lhs, const vec16ia& rhs) noexcept { return _mm512_cmple_epi32_mask(lhs, rhs); }
+
+    [[nodiscard]] inline vec16ba cmple(const vec16ia& lhs, const int32_t rhs) noexcept { return cmple(lhs, vec16ia(rhs)); }
+
+    [[nodiscard]] inline vec16ba cmple(const int32_t lhs, const vec16ia& rhs) noexcept { return cmple(vec16ia(lhs), rhs); }
+
+    [[nodiscard]] inline vec16ba cmpge(const vec16ia& lhs, const vec16ia& rhs) noexcept { return _mm512_cmpge_epi32_mask(lhs, rhs); }
+
+    [[nodiscard]] inline vec16ba cmpge(const vec16ia& lhs, const int32_t rhs) noexcept { return cmpge(lhs, vec16ia(rhs)); }
+
+    [[nodiscard]] inline vec16ba cmpge(const int32_t lhs, const vec16ia& rhs) noexcept { return cmpge(vec16ia(lhs), rhs); }
+
+    ////////////////////////////////////////////////////////////////
+    // Min/max, abs and clamp.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec16ia min(const vec16ia& lhs, const vec16ia& rhs) noexcept { return _mm512_min_epi32(lhs, rhs); }
+
+    [[nodiscard]] inline vec16ia min(const vec16ia& lhs, const int32_t rhs) noexcept { return min(lhs, vec16ia(rhs)); }
+
+    [[nodiscard]] inline vec16ia min(const int32_t lhs, const vec16ia& rhs) noexcept { return min(vec16ia(lhs), rhs); }
+
+    [[nodiscard]] inline vec16ia max(const vec16ia& lhs, const vec16ia& rhs) noexcept { return _mm512_max_epi32(lhs, rhs); }
+
+    [[nodiscard]] inline vec16ia max(const vec16ia& lhs, const int32_t rhs) noexcept { return max(lhs, vec16ia(rhs)); }
+
+    [[nodiscard]] inline vec16ia max(const int32_t lhs, const vec16ia& rhs) noexcept { return max(vec16ia(lhs), rhs); }
+
+    [[nodiscard]] inline vec16ia clamp(const vec16ia& a, const vec16ia& min, const vec16ia& max) noexcept { return math::max(min, math::min(a, max)); }
+
+    [[nodiscard]] inline vec16ia clamp(const vec16ia& a, const vec16ia& min, const int32_t max) noexcept { return clamp(a, min, vec16ia(max)); }
+
+    [[nodiscard]] inline vec16ia clamp(const vec16ia& a, const int32_t min, const vec16ia& max) noexcept { return clamp(a, vec16ia(min), max); }
+
+    [[nodiscard]] inline vec16ia clamp(const vec16ia& a, const int32_t min, const int32_t max) noexcept { return clamp(a, vec16ia(min), vec16ia(max)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Reduction.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline int32_t reduce_add(const vec16ia& lhs) noexcept { return _mm512_reduce_add_epi32(lhs); }
+
+    [[nodiscard]] inline int32_t reduce_mul(const vec16ia& lhs) noexcept { return _mm512_reduce_mul_epi32(lhs); }
+
+    [[nodiscard]] inline int32_t reduce_min(const vec16ia& lhs) noexcept { return _mm512_reduce_min_epi32(lhs); }
+
+    [[nodiscard]] inline int32_t reduce_max(const vec16ia& lhs) noexcept { return _mm512_reduce_max_epi32(lhs); }
+
+    ////////////////////////////////////////////////////////////////
+    // Rounding, abs, etc.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec16ia abs(const vec16ia& lhs) noexcept { return _mm512_abs_epi32(lhs); }
+
+    ////////////////////////////////////////////////////////////////
+    // Select.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec16ia select(const vec16ia& t, const vec16ia& f, const vec16ba& b) noexcept { return _mm512_mask_blend_epi32(b, f, t); }
+
+    ////////////////////////////////////////////////////////////////
+    // Multiply and add.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec16ia madd(const vec16ia& a, const vec16ia& b, const vec16ia& c) noexcept { return a * b + c; }
+
+    [[nodiscard]] inline vec16ia nmadd(const vec16ia& a, const vec16ia& b, const vec16ia& c) noexcept { return -a * b + c; }
+
+    [[nodiscard]] inline vec16ia msub(const vec16ia& a, const vec16ia& b, const vec16ia& c) noexcept { return a * b - c; }
+
+    [[nodiscard]] inline vec16ia nmsub(const vec16ia& a, const vec16ia& b, const vec16ia& c) noexcept { return -a * b - c; }
+
+    ////////////////////////////////////////////////////////////////
+    // Shift operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec16ia operator<<(const vec16ia& lhs, const vec16ia& rhs) noexcept { return _mm512_sllv_epi32(lhs, rhs); }
+
+    [[nodiscard]] inline vec16ia operator<<(const vec16ia& lhs, const int32_t rhs) noexcept { return _mm512_slli_epi32(lhs, static_cast<unsigned int>(rhs)); }
+
+    [[nodiscard]] inline vec16ia operator<<(const int32_t lhs, const vec16ia& rhs) noexcept { return _mm512_sllv_epi32(_mm512_set1_epi32(lhs), rhs); }
+
+    [[nodiscard]] inline vec16ia operator>>(const vec16ia& lhs, const vec16ia& rhs) noexcept { return _mm512_srlv_epi32(lhs, rhs); }
+
+    [[nodiscard]] inline vec16ia operator>>(const vec16ia& lhs, const int32_t rhs) noexcept { return _mm512_srli_epi32(lhs, static_cast<unsigned int>(rhs)); }
+
+    [[nodiscard]] inline vec16ia operator>>(const int32_t lhs, const vec16ia& rhs) noexcept { return _mm512_srlv_epi32(_mm512_set1_epi32(lhs), rhs); }
+
+    inline vec16ia& operator<<=(vec16ia& lhs, const vec16ia& rhs) noexcept { return lhs = lhs << rhs; }
+
+    inline vec16ia& operator<<=(vec16ia& lhs, const int32_t rhs) noexcept { return lhs = lhs << rhs; }
+
+    inline vec16ia& operator>>=(vec16ia& lhs, const vec16ia& rhs) noexcept { return lhs = lhs >> rhs; }
+
+    inline vec16ia& operator>>=(vec16ia& lhs, const int32_t rhs) noexcept { return lhs = lhs >> rhs; }
+
+    ////////////////////////////////////////////////////////////////
+    // Bitwise operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec16ia operator|(const vec16ia& lhs, const vec16ia& rhs) noexcept { return _mm512_or_si512(lhs, rhs); }
+
+    [[nodiscard]] inline vec16ia operator|(const vec16ia& lhs, const int32_t rhs) noexcept { return _mm512_or_si512(lhs, vec16ia(rhs)); }
+
+    [[nodiscard]] inline vec16ia operator|(const int32_t lhs, const vec16ia& rhs) noexcept { return _mm512_or_si512(vec16ia(lhs), rhs); }
+
+    [[nodiscard]] inline vec16ia operator&(const vec16ia& lhs, const vec16ia& rhs) noexcept { return _mm512_and_si512(lhs, rhs); }
+
+    [[nodiscard]] inline vec16ia operator&(const vec16ia& lhs, const int32_t rhs) noexcept { return _mm512_and_si512(lhs, vec16ia(rhs)); }
+
+    [[nodiscard]] inline vec16ia operator&(const int32_t lhs, const vec16ia& rhs) noexcept { return _mm512_and_si512(vec16ia(lhs), rhs); }
+
+    [[nodiscard]] inline vec16ia operator^(const vec16ia& lhs, const vec16ia& rhs) noexcept { return _mm512_xor_si512(lhs, rhs); }
+
+    [[nodiscard]] inline vec16ia operator^(const vec16ia& lhs, const int32_t rhs) noexcept { return _mm512_xor_si512(lhs, vec16ia(rhs)); }
+
+    [[nodiscard]] inline vec16ia operator^(const int32_t lhs, const vec16ia& rhs) noexcept { return _mm512_xor_si512(vec16ia(lhs), rhs); }
+
+    [[nodiscard]] inline vec16ia operator~(const vec16ia& lhs) noexcept { return _mm512_xor_si512(lhs, _mm512_set1_epi32(-1)); }
+
+    inline vec16ia& operator|=(vec16ia& lhs, const vec16ia& rhs) noexcept { return lhs = lhs | rhs; }
+
+    inline vec16ia& operator|=(vec16ia& lhs, const int32_t rhs) noexcept { return lhs = lhs | rhs; }
+
+    inline vec16ia& operator&=(vec16ia& lhs, const vec16ia& rhs) noexcept { return lhs = lhs & rhs; }
+
+    inline vec16ia& operator&=(vec16ia& lhs, const int32_t rhs) noexcept { return lhs = lhs & rhs; }
+
+    inline vec16ia& operator^=(vec16ia& lhs, const vec16ia& rhs) noexcept { return lhs = lhs ^ rhs; }
+
+    inline vec16ia& operator^=(vec16ia& lhs, const int32_t rhs) noexcept { return lhs = lhs ^ rhs; }
+
+    ////////////////////////////////////////////////////////////////
+    // Output.
+    ////////////////////////////////////////////////////////////////
+
+    inline std::ostream& operator<<(std::ostream& out, const vec16ia& v)
+    {
+        out << "(" << v[0];
+        for (size_t i = 1; i < 16; i++) out << ", " << v[i];
+        return out << ")";
+    }
+#endif
+}
@@ -0,0 +1,465 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <immintrin.h>
+#include <iostream>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/math_functions.h"
+#include "math/vector/vec2.h"
+#include "math/vector/simd/vec2dba.h"
+
+namespace math
+{
+    /**=================================================================================================
+     * Struct: vec2da
+     * =================================================================================================
+     * @struct  vec2da
+     *
+     * @brief   Two doubles in a single SSE2 register.
+    **/
+    struct alignas(16) vec2da
+    {
+        static constexpr size_t size = 2;
+        using element_type = double;
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4201)
+#endif
+        union
+        {
+            __m128d m128;
+            struct
+            {
+                double x, y;
+            };
+        };
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] vec2da() noexcept : m128(_mm_setzero_pd()) {}
+
+        [[nodiscard]] explicit vec2da(uninit_t) noexcept {}
+
+        [[nodiscard]] explicit vec2da(const double v) noexcept : m128(_mm_set1_pd(v)) {}
+
+        [[nodiscard]] vec2da(const double x, const double y) noexcept : m128(_mm_setr_pd(x, y)) {}
+
+        [[nodiscard]] vec2da(const __m128d m128) noexcept : m128(m128) {}
+
+        [[nodiscard]] vec2da(const vec2da& rhs) noexcept = default;
+
+        [[nodiscard]] explicit vec2da(const vec<double, 2>& rhs) noexcept : m128(_mm_loadu_pd(&rhs.x)) {}
+
+        ////////////////////////////////////////////////////////////////
+        // Assignment operators.
+        ////////////////////////////////////////////////////////////////
+
+        vec2da& operator=(const vec2da& rhs) noexcept = default;
+
+        vec2da& operator=(const double rhs) noexcept { m128 = _mm_set1_pd(rhs); return *this; }
+
+        ////////////////////////////////////////////////////////////////
+        // Load/store.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] static vec2da load(const void* const ptr) { return vec2da(_mm_load_pd(static_cast<const double*>(ptr))); }
+
+        [[nodiscard]] static vec2da loadu(const void* const ptr) { return vec2da(_mm_loadu_pd(static_cast<const double*>(ptr))); }
+
+        static void store(void* ptr, const vec2da& v) { _mm_store_pd(static_cast<double*>(ptr), v.m128); }
+
+        static void storeu(void* ptr, const vec2da& v) { _mm_storeu_pd(static_cast<double*>(ptr), v.m128); }
+
+        /**
+         * @brief Load the lanes that are set in mask and zero the others. Memory of lanes that are not set is not accessed.
+         */
+        [[nodiscard]] static vec2da loadu(const void* const ptr, const vec2dba& mask)
+        {
+#ifdef __AVX__
+            return _mm_maskload_pd(static_cast<const double*>(ptr), mask);
+#else
+            const double* src = static_cast<const double*>(ptr);
+            vec2da v;
+            for (size_t i = 0; i < 2; i++)
+                if (mask[i]) v[i] = src[i];
+            return v;
+#endif
+        }
+
+        /**
+         * @brief Load the first count elements, e.g. for the tail of a loop.
+         */
+        [[nodiscard]] static vec2da loadu(const void* const ptr, const size_t count) { return loadu(ptr, vec2dba::first(count)); }
+
+        /**
+         * @brief Store the lanes that are set in mask. Memory of lanes that are not set is not accessed.
+         */
+        static void storeu(void* ptr, const vec2da& v, const vec2dba& mask)
+        {
+#ifdef __AVX__
+            _mm_maskstore_pd(static_cast<double*>(ptr), mask, v.m128);
+#else
+            double* dst = static_cast<double*>(ptr);
+            for (size_t i = 0; i < 2; i++)
+                if (mask[i]) dst[i] = v[i];
+#endif
+        }
+
+        /**
+         * @brief Store the first count elements, e.g. for the tail of a loop.
+         */
+        static void storeu(void* ptr, const vec2da& v, const size_t count) { storeu(ptr, v, vec2dba::first(count)); }
+
+        ////////////////////////////////////////////////////////////////
+        // Defaulted constructors and operators.
+        ////////////////////////////////////////////////////////////////
+
+        ~vec2da() noexcept = default;
+
+        vec2da(vec2da&& rhs) noexcept = default;
+
+        vec2da& operator=(vec2da&& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Casting operators.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] operator const __m128d&() const noexcept { return m128; }
+
+        [[nodiscard]] operator __m128d&() noexcept { return m128; }
+
+        [[nodiscard]] explicit operator vec<double, 2>() const noexcept { vec<double, 2> v(uninit); _mm_storeu_pd(&v.x, m128); return v; }
+
+        ////////////////////////////////////////////////////////////////
+        // Element access.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] const double& operator[](const size_t i) const { assert(i < 2); return (&x)[i]; }
+
+        [[nodiscard]] double& operator[](const size_t i) { assert(i < 2); return (&x)[i]; }
+
+        ////////////////////////////////////////////////////////////////
+        // Swizzling.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] vec2da xx() const noexcept { return _mm_unpacklo_pd(m128, m128); }
+        [[nodiscard]] vec2da xy() const noexcept { return m128; }
+        [[nodiscard]] vec2da yx() const noexcept { return _mm_shuffle_pd(m128, m128, 0b01); }
+        [[nodiscard]] vec2da yy() const noexcept { return _mm_unpackhi_pd(m128, m128); }
+    };
+
+    ////////////////////////////////////////////////////////////////
+    // Shuffle.
+    ////////////////////////////////////////////////////////////////
+
+    template<int32_t i0, int32_t i1>
+    [[nodiscard]] vec2da shuffle(const vec2da& v) noexcept { return _mm_shuffle_pd(v, v, i0 | (i1 << 1)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Arithmetic operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec2da operator+(const vec2da& lhs, const vec2da& rhs) noexcept { return _mm_add_pd(lhs, rhs); }
+
+    [[nodiscard]] inline vec2da operator+(const vec2da& lhs, const double rhs) noexcept { return lhs + vec2da(rhs); }
+
+    [[nodiscard]] inline vec2da operator+(const double lhs, const vec2da& rhs) noexcept { return vec2da(lhs) + rhs; }
+
+    [[nodiscard]] inline vec2da operator-(const vec2da& lhs, const vec2da& rhs) noexcept { return _mm_sub_pd(lhs, rhs); }
+
+    [[nodiscard]] inline vec2da operator-(const vec2da& lhs, const double rhs) noexcept { return lhs - vec2da(rhs); }
+
+    [[nodiscard]] inline vec2da operator-(const double lhs, const vec2da& rhs) noexcept { return vec2da(lhs) - rhs; }
+
+    [[nodiscard]] inline vec2da operator-(const vec2da& lhs) noexcept { return _mm_xor_pd(lhs, _mm_set1_pd(-0.0)); }
+
+    [[nodiscard]] inline vec2da operator*(const vec2da& lhs, const vec2da& rhs) noexcept { return _mm_mul_pd(lhs, rhs); }
+
+    [[nodiscard]] inline vec2da operator*(const vec2da& lhs, const double rhs) noexcept { return lhs * vec2da(rhs); }
+
+    [[nodiscard]] inline vec2da operator*(const double lhs, const vec2da& rhs) noexcept { return vec2da(lhs) * rhs; }
+
+    [[nodiscard]] inline vec2da operator/(const vec2da& lhs, const vec2da& rhs) noexcept { return _mm_div_pd(lhs, rhs); }
+
+    [[nodiscard]] inline vec2da operator/(const vec2da& lhs, const double rhs) noexcept { return lhs / vec2da(rhs); }
+
+    [[nodiscard]] inline vec2da operator/(const double lhs, const vec2da& rhs) noexcept { return vec2da(lhs) / rhs; }
+
+    inline vec2da& operator+=(vec2da& lhs, const vec2da& rhs) noexcept { return lhs = lhs + rhs; }
+
+    inline vec2da& operator+=(vec2da& lhs, const double rhs) noexcept { return lhs = lhs + rhs; }
+
+    inline vec2da& operator-=(vec2da& lhs, const vec2da& rhs) noexcept { return lhs = lhs - rhs; }
+
+    inline vec2da& operator-=(vec2da& lhs, const double rhs) noexcept { return lhs = lhs - rhs; }
+
+    inline vec2da& operator*=(vec2da& lhs, const vec2da& rhs) noexcept { return lhs = lhs * rhs; }
+
+    inline vec2da& operator*=(vec2da& lhs, const double rhs) noexcept { return lhs = lhs * rhs; }
+
+    inline vec2da& operator/=(vec2da& lhs, const vec2da& rhs) noexcept { return lhs = lhs / rhs; }
+
+    inline vec2da& operator/=(vec2da& lhs, const double rhs) noexcept { return lhs = lhs / rhs; }
+
+    ////////////////////////////////////////////////////////////////
+    // Comparison operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline bool operator==(const vec2da& lhs, const vec2da& rhs) noexcept { return (_mm_movemask_pd(_mm_cmpeq_pd(lhs, rhs)) & 0x3) == 0x3; }
+
+    [[nodiscard]] inline bool operator!=(const vec2da& lhs, const vec2da& rhs) noexcept { return (_mm_movemask_pd(_mm_cmpeq_pd(lhs, rhs)) & 0x3) != 0x3; }
+
+    ////////////////////////////////////////////////////////////////
+    // Per-element comparisons.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec2dba cmpeq(const vec2da& lhs, const vec2da& rhs) noexcept { return vec2dba(_mm_cmpeq_pd(lhs, rhs)); }
+
+    [[nodiscard]] inline vec2dba cmpeq(const vec2da& lhs, const double rhs) noexcept { return cmpeq(lhs, vec2da(rhs)); }
+
+    [[nodiscard]] inline vec2dba cmpeq(const double lhs, const vec2da& rhs) noexcept { return cmpeq(vec2da(lhs), rhs); }
+
+    [[nodiscard]] inline vec2dba cmpneq(const vec2da& lhs, const vec2da& rhs) noexcept { return vec2dba(_mm_cmpneq_pd(lhs, rhs)); }
+
+    [[nodiscard]] inline vec2dba cmpneq(const vec2da& lhs, const double rhs) noexcept { return cmpneq(lhs, vec2da(rhs)); }
+
+    [[nodiscard]] inline vec2dba cmpneq(const double lhs, const vec2da& rhs) noexcept { return cmpneq(vec2da(lhs), rhs); }
+
+    [[nodiscard]] inline vec2dba cmplt(const vec2da& lhs, const vec2da& rhs) noexcept { return vec2dba(_mm_cmplt_pd(lhs, rhs)); }
+
+    [[nodiscard]] inline vec2dba cmplt(const vec2da& lhs, const double rhs) noexcept { return cmplt(lhs, vec2da(rhs)); }
+
+    [[nodiscard]] inline vec2dba cmplt(const double lhs, const vec2da& rhs) noexcept { return cmplt(vec2da(lhs), rhs); }
+
+    [[nodiscard]] inline vec2dba cmpgt(const vec2da& lhs, const vec2da& rhs) noexcept { return vec2dba(_mm_cmpgt_pd(lhs, rhs)); }
+
+    [[nodiscard]] inline vec2dba cmpgt(const vec2da& lhs, const double rhs) noexcept { return cmpgt(lhs, vec2da(rhs)); }
+
+    [[nodiscard]] inline vec2dba cmpgt(const double lhs, const vec2da& rhs) noexcept { return cmpgt(vec2da(lhs), rhs); }
+
+    [[nodiscard]] inline vec2dba cmple(const vec2da& lhs, const vec2da& rhs) noexcept { return vec2dba(_mm_cmple_pd(lhs, rhs)); }
+
+    [[nodiscard]] inline vec2dba cmple(const vec2da& lhs, const double rhs) noexcept { return cmple(lhs, vec2da(rhs)); }
+
+    [[nodiscard]] inline vec2dba cmple(const double lhs, const vec2da& rhs) noexcept { return cmple(vec2da(lhs), rhs); }
+
+    [[nodiscard]] inline vec2dba cmpge(const vec2da& lhs, const vec2da& rhs) noexcept { return vec2dba(_mm_cmpge_pd(lhs, rhs)); }
+
+    [[nodiscard]] inline vec2dba cmpge(const vec2da& lhs, const double rhs) noexcept { return cmpge(lhs, vec2da(rhs)); }
+
+    [[nodiscard]] inline vec2dba cmpge(const double lhs, const vec2da& rhs) noexcept { return cmpge(vec2da(lhs), rhs); }
+
+    ////////////////////////////////////////////////////////////////
+    // Min/max, abs and clamp.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec2da min(const vec2da& lhs, const vec2da& rhs) noexcept { return _mm_min_pd(lhs, rhs); }
+
+    [[nodiscard]] inline vec2da min(const vec2da& lhs, const double rhs) noexcept { return min(lhs, vec2da(rhs)); }
+
+    [[nodiscard]] inline vec2da min(const double lhs, const vec2da& rhs) noexcept { return min(vec2da(lhs), rhs); }
+
+    [[nodiscard]] inline vec2da max(const vec2da& lhs, const vec2da& rhs) noexcept { return _mm_max_pd(lhs, rhs); }
+
+    [[nodiscard]] inline vec2da max(const vec2da& lhs, const double rhs) noexcept { return max(lhs, vec2da(rhs)); }
+
+    [[nodiscard]] inline vec2da max(const double lhs, const vec2da& rhs) noexcept { return max(vec2da(lhs), rhs); }
+
+    [[nodiscard]] inline vec2da clamp(const vec2da& a, const vec2da& min, const vec2da& max) noexcept { return math::max(min, math::min(a, max)); }
+
+    [[nodiscard]] inline vec2da clamp(const vec2da& a, const vec2da& min, const double max) noexcept { return clamp(a, min, vec2da(max)); }
+
+    [[nodiscard]] inline vec2da clamp(const vec2da& a, const double min, const vec2da& max) noexcept { return clamp(a, vec2da(min), max); }
+
+    [[nodiscard]] inline vec2da clamp(const vec2da& a, const double min, const double max) noexcept { return clamp(a, vec2da(min), vec2da(max)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Reduction.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline double reduce_add(const vec2da& lhs) noexcept { return _mm_cvtsd_f64(_mm_add_sd(lhs, lhs.yy())); }
+
+    [[nodiscard]] inline double reduce_mul(const vec2da& lhs) noexcept { return _mm_cvtsd_f64(_mm_mul_sd(lhs, lhs.yy())); }
+
+    [[nodiscard]] inline double reduce_min(const vec2da& lhs) noexcept { return _mm_cvtsd_f64(_mm_min_sd(lhs, lhs.yy())); }
+
+    [[nodiscard]] inline double reduce_max(const vec2da& lhs) noexcept { return _mm_cvtsd_f64(_mm_max_sd(lhs, lhs.yy())); }
+
+    ////////////////////////////////////////////////////////////////
+    // Multiply and add.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec2da madd(const vec2da& a, const vec2da& b, const vec2da& c) noexcept
+    {
+#ifdef __FMA__
+        return _mm_fmadd_pd(a, b, c);
+#else
+        return a * b + c;
+#endif
+    }
+
+    [[nodiscard]] inline vec2da nmadd(const vec2da& a, const vec2da& b, const vec2da& c) noexcept
+    {
+#ifdef __FMA__
+        return _mm_fnmadd_pd(a, b, c);
+#else
+        return -a * b + c;
+#endif
+    }
+
+    [[nodiscard]] inline vec2da msub(const vec2da& a, const vec2da& b, const vec2da& c) noexcept
+    {
+#ifdef __FMA__
+        return _mm_fmsub_pd(a, b, c);
+#else
+        return a * b - c;
+#endif
+    }
+
+    [[nodiscard]] inline vec2da nmsub(const vec2da& a, const vec2da& b, const vec2da& c) noexcept
+    {
+#ifdef __FMA__
+        return _mm_fnmsub_pd(a, b, c);
+#else
+        return -a * b - c;
+#endif
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Dot product etc.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline double dot(const vec2da& lhs, const vec2da& rhs) noexcept
+    {
+#ifdef __SSE4_1__
+        return _mm_cvtsd_f64(_mm_dp_pd(lhs, rhs, 0x31));
+#else
+        return reduce_add(lhs * rhs);
+#endif
+    }
+
+    [[nodiscard]] inline double length(const vec2da& lhs) noexcept { return sqrt(dot(lhs, lhs)); }
+
+    [[nodiscard]] inline double sqr_length(const vec2da& lhs) noexcept { return dot(lhs, lhs); }
+
+    [[nodiscard]] inline double rcp_length(const vec2da& lhs) noexcept { return rsqrt(dot(lhs, lhs)); }
+
+    [[nodiscard]] inline vec2da normalize(const vec2da& lhs) noexcept { return lhs * rcp_length(lhs); }
+
+    [[nodiscard]] inline vec2da normalize(const vec2da& lhs, double& length) noexcept { length = math::length(lhs); return lhs / length; }
+
+    [[nodiscard]] inline double distance(const vec2da& lhs, const vec2da& rhs) noexcept { return length(lhs - rhs); }
+
+    [[nodiscard]] inline vec2da lerp(const vec2da& a, const vec2da& b, const vec2da& t) noexcept { return madd(t, b - a, a); }
+
+    [[nodiscard]] inline vec2da lerp(const vec2da& a, const vec2da& b, const double t) noexcept { return madd(vec2da(t), b - a, a); }
+
+    ////////////////////////////////////////////////////////////////
+    // Trigonometry.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec2da acos(const vec2da& lhs) noexcept { return vec2da(acos(lhs.x), acos(lhs.y)); }
+
+    [[nodiscard]] inline vec2da asin(const vec2da& lhs) noexcept { return vec2da(asin(lhs.x), asin(lhs.y)); }
+
+    [[nodiscard]] inline vec2da atan(const vec2da& lhs) noexcept { return vec2da(atan(lhs.x), atan(lhs.y)); }
+
+    [[nodiscard]] inline vec2da atan2(const vec2da& lhs, const vec2da& rhs) noexcept { return vec2da(atan2(lhs.x, rhs.x), atan2(lhs.y, rhs.y)); }
+
+    [[nodiscard]] inline vec2da cos(const vec2da& lhs) noexcept { return vec2da(cos(lhs.x), cos(lhs.y)); }
+
+    [[nodiscard]] inline vec2da cosh(const vec2da& lhs) noexcept { return vec2da(cosh(lhs.x), cosh(lhs.y)); }
+
+    [[nodiscard]] inline vec2da sin(const vec2da& lhs) noexcept { return vec2da(sin(lhs.x), sin(lhs.y)); }
+
+    [[nodiscard]] inline vec2da sinh(const vec2da& lhs) noexcept { return vec2da(sinh(lhs.x), sinh(lhs.y)); }
+
+    [[nodiscard]] inline vec2da tan(const vec2da& lhs) noexcept { return vec2da(tan(lhs.x), tan(lhs.y)); }
+
+    [[nodiscard]] inline vec2da tanh(const vec2da& lhs) noexcept { return vec2da(tanh(lhs.x), tanh(lhs.y)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Exponential / Logarithmic.
+    ////////////////////////////////////////////////////////////////
+
+    // There are no double precision polynomial approximations (yet), so these are evaluated per element.
+
+    [[nodiscard]] inline vec2da exp(const vec2da& lhs) noexcept { return vec2da(exp(lhs.x), exp(lhs.y)); }
+
+    [[nodiscard]] inline vec2da exp2(const vec2da& lhs) noexcept { return vec2da(exp2(lhs.x), exp2(lhs.y)); }
+
+    [[nodiscard]] inline vec2da log(const vec2da& lhs) noexcept { return vec2da(log(lhs.x), log(lhs.y)); }
+
+    [[nodiscard]] inline vec2da log2(const vec2da& lhs) noexcept { return vec2da(log2(lhs.x), log2(lhs.y)); }
+
+    [[nodiscard]] inline vec2da log10(const vec2da& lhs) noexcept { return vec2da(log10(lhs.x), log10(lhs.y)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Power.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec2da pow(const vec2da& lhs, const vec2da& rhs) noexcept { return vec2da(pow(lhs.x, rhs.x), pow(lhs.y, rhs.y)); }
+
+    [[nodiscard]] inline vec2da pow(const vec2da& lhs, const double rhs) noexcept { return pow(lhs, vec2da(rhs)); }
+
+    [[nodiscard]] inline vec2da pow(const double lhs, const vec2da& rhs) noexcept { return pow(vec2da(lhs), rhs); }
+
+    [[nodiscard]] inline vec2da sqr(const vec2da& lhs) noexcept { return lhs * lhs; }
+
+    [[nodiscard]] inline vec2da sqrt(const vec2da& lhs) noexcept { return _mm_sqrt_pd(lhs); }
+
+    // There is no approximate reciprocal square root for doubles before AVX-512, so this is exact.
+    [[nodiscard]] inline vec2da rsqrt(const vec2da& lhs) noexcept { return _mm_div_pd(_mm_set1_pd(1.0), _mm_sqrt_pd(lhs)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Rounding, abs, etc.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec2da abs(const vec2da& lhs) noexcept { return _mm_andnot_pd(_mm_set1_pd(-0.0), lhs); }
+
+#ifdef __SSE4_1__
+    [[nodiscard]] inline vec2da round(const vec2da& lhs) noexcept { return _mm_round_pd(lhs, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+    [[nodiscard]] inline vec2da ceil(const vec2da& lhs) noexcept { return _mm_round_pd(lhs, _MM_FROUND_CEIL); }
+
+    [[nodiscard]] inline vec2da floor(const vec2da& lhs) noexcept { return _mm_round_pd(lhs, _MM_FROUND_FLOOR); }
+
+    [[nodiscard]] inline vec2da frac(const vec2da& lhs) noexcept { return _mm_sub_pd(lhs, _mm_round_pd(lhs, _MM_FROUND_TRUNC)); }
+
+    [[nodiscard]] inline vec2da trunc(const vec2da& lhs) noexcept { return _mm_round_pd(lhs, _MM_FROUND_TRUNC); }
+#endif
+
+    ////////////////////////////////////////////////////////////////
+    // Select.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec2da select(const vec2da& t, const vec2da& f, const vec2dba& b) noexcept
+    {
+#ifdef __SSE4_1__
+        return _mm_blendv_pd(f, t, _mm_castsi128_pd(b));
+#else
+        const __m128d mask = _mm_castsi128_pd(b);
+        return _mm_or_pd(_mm_and_pd(mask, t), _mm_andnot_pd(mask, f));
+#endif
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Output.
+    ////////////////////////////////////////////////////////////////
+
+    inline std::ostream& operator<<(std::ostream& out, const vec2da& v) { return out << "(" << v.x << ", " << v.y << ")"; }
+}
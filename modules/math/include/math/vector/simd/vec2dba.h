@@ -0,0 +1,173 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <immintrin.h>
+#include <iostream>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/vector/vec2.h"
+
+namespace math
+{
+    /**=================================================================================================
+     * Struct: vec2dba
+     * =================================================================================================
+     * @struct  vec2dba
+     *
+     * @brief   Mask of 2 booleans with 64-bit lanes, as returned by the comparisons of vec2da.
+    **/
+    struct alignas(16) vec2dba
+    {
+        static constexpr size_t size = 2;
+        using element_type = int64_t;
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4201)
+#endif
+        union
+        {
+            __m128i m128;
+            struct
+            {
+                int64_t x, y;
+            };
+        };
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] vec2dba() noexcept : m128(_mm_set1_epi32(0)) {}
+
+        [[nodiscard]] explicit vec2dba(uninit_t) noexcept {}
+
+        [[nodiscard]] explicit vec2dba(const bool b) noexcept : m128(_mm_set1_epi64x(0 - static_cast<int64_t>(b))) {}
+
+        [[nodiscard]] vec2dba(const bool x, const bool y) noexcept : m128(_mm_set_epi64x(0 - static_cast<int64_t>(y), 0 - static_cast<int64_t>(x))) {}
+
+        [[nodiscard]] vec2dba(const __m128i m128) noexcept : m128(m128) {}
+
+        [[nodiscard]] explicit vec2dba(const __m128d m128) noexcept : m128(_mm_castpd_si128(m128)) {}
+
+        [[nodiscard]] vec2dba(const vec2dba& rhs) noexcept = default;
+
+        [[nodiscard]] explicit vec2dba(const vec<bool, 2>& rhs) noexcept : vec2dba(rhs.x, rhs.y) {}
+
+        ////////////////////////////////////////////////////////////////
+        // Assignment operators.
+        ////////////////////////////////////////////////////////////////
+
+        vec2dba& operator=(const vec2dba& rhs) noexcept = default;
+
+        vec2dba& operator=(const bool rhs) noexcept { m128 = _mm_set1_epi64x(0 - static_cast<int64_t>(rhs)); return *this; }
+
+        ////////////////////////////////////////////////////////////////
+        // Defaulted constructors and operators.
+        ////////////////////////////////////////////////////////////////
+
+        ~vec2dba() noexcept = default;
+
+        vec2dba(vec2dba&& rhs) noexcept = default;
+
+        vec2dba& operator=(vec2dba&& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Casting operators.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] operator const __m128i&() const noexcept { return m128; }
+
+        [[nodiscard]] operator __m128i&() noexcept { return m128; }
+
+        [[nodiscard]] explicit operator __m128d() const noexcept { return _mm_castsi128_pd(m128); }
+
+        [[nodiscard]] explicit operator vec<bool, 2>() const noexcept { return vec<bool, 2>((*this)[0], (*this)[1]); }
+
+        ////////////////////////////////////////////////////////////////
+        // Element access.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] bool operator[](const size_t i) const { assert(i < 2); return static_cast<bool>((_mm_movemask_pd(_mm_castsi128_pd(m128)) >> i) & 0x1); }
+
+        ////////////////////////////////////////////////////////////////
+        // Construct special values.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * @brief Mask with the first n lanes set, for loads and stores of loop tails.
+         */
+        [[nodiscard]] static vec2dba first(const size_t n) noexcept
+        {
+            assert(n <= 2);
+            return _mm_set_epi64x(n > 1 ? -1 : 0, n > 0 ? -1 : 0);
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////
+    // Bitwise operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec2dba operator!(const vec2dba& lhs) noexcept { return _mm_xor_si128(lhs, _mm_set1_epi32(-1)); }
+
+    [[nodiscard]] inline vec2dba operator&(const vec2dba& lhs, const vec2dba& rhs) noexcept { return _mm_and_si128(lhs, rhs); }
+
+    [[nodiscard]] inline vec2dba operator|(const vec2dba& lhs, const vec2dba& rhs) noexcept { return _mm_or_si128(lhs, rhs); }
+
+    [[nodiscard]] inline vec2dba operator^(const vec2dba& lhs, const vec2dba& rhs) noexcept { return _mm_xor_si128(lhs, rhs); }
+
+    inline vec2dba& operator&=(vec2dba& lhs, const vec2dba& rhs) noexcept { return lhs = lhs & rhs; }
+
+    inline vec2dba& operator|=(vec2dba& lhs, const vec2dba& rhs) noexcept { return lhs = lhs | rhs; }
+
+    inline vec2dba& operator^=(vec2dba& lhs, const vec2dba& rhs) noexcept { return lhs = lhs ^ rhs; }
+
+    ////////////////////////////////////////////////////////////////
+    // Comparison operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline bool operator==(const vec2dba& lhs, const vec2dba& rhs) noexcept { return (_mm_movemask_pd(_mm_castsi128_pd(lhs ^ rhs)) & 0x3) == 0x0; }
+
+    [[nodiscard]] inline bool operator!=(const vec2dba& lhs, const vec2dba& rhs) noexcept { return (_mm_movemask_pd(_mm_castsi128_pd(lhs ^ rhs)) & 0x3) != 0x0; }
+
+    ////////////////////////////////////////////////////////////////
+    // Per-element comparisons.
+    ////////////////////////////////////////////////////////////////
+
+    // Lanes are either all ones or all zeros, so equality is the complement of xor. Avoids pcmpeqq, which needs SSE4.1.
+    [[nodiscard]] inline vec2dba cmpeq(const vec2dba& lhs, const vec2dba& rhs) noexcept { return !(lhs ^ rhs); }
+
+    [[nodiscard]] inline vec2dba cmpneq(const vec2dba& lhs, const vec2dba& rhs) noexcept { return lhs ^ rhs; }
+
+    ////////////////////////////////////////////////////////////////
+    // Select.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec2dba select(const vec2dba& t, const vec2dba& f, const vec2dba& b) noexcept { return _mm_or_si128(_mm_and_si128(b, t), _mm_andnot_si128(b, f)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Boolean vector reduction.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline bool all(const vec2dba& lhs) noexcept { return (_mm_movemask_pd(_mm_castsi128_pd(lhs)) & 0x3) == 0x3; }
+
+    [[nodiscard]] inline bool any(const vec2dba& lhs) noexcept { return (_mm_movemask_pd(_mm_castsi128_pd(lhs)) & 0x3) != 0x0; }
+
+    [[nodiscard]] inline bool none(const vec2dba& lhs) noexcept { return (_mm_movemask_pd(_mm_castsi128_pd(lhs)) & 0x3) == 0x0; }
+
+    ////////////////////////////////////////////////////////////////
+    // Output.
+    ////////////////////////////////////////////////////////////////
+
+    inline std::ostream& operator<<(std::ostream& out, const vec2dba& v) { return out << "(" << v[0] << ", " << v[1] << ")"; }
+}
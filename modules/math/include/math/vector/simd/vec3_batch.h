@@ -0,0 +1,170 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <immintrin.h>
+#include <span>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/vector/vec3.h"
+#include "math/vector/simd/vec8fa.h"
+
+namespace math
+{
+    namespace detail
+    {
+        // The transposes treat a span of vectors as a contiguous array of floats.
+        static_assert(sizeof(vec<float, 3>) == 3 * sizeof(float));
+
+#ifdef __AVX__
+        /**
+         * @brief Load 8 consecutive vec<float, 3> and transpose them to one register per component.
+         */
+        inline void load_soa(const vec<float, 3>* ptr, vec8fa& x, vec8fa& y, vec8fa& z) noexcept
+        {
+            const float* f = &ptr->x;
+            const __m256 m03 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(f + 0)), _mm_loadu_ps(f + 12), 1);  // x0 y0 z0 x1 | x4 y4 z4 x5
+            const __m256 m14 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(f + 4)), _mm_loadu_ps(f + 16), 1);  // y1 z1 x2 y2 | y5 z5 x6 y6
+            const __m256 m25 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(f + 8)), _mm_loadu_ps(f + 20), 1);  // z2 x3 y3 z3 | z6 x7 y7 z7
+
+            const __m256 xy = _mm256_shuffle_ps(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));  // x2 y2 x3 y3
+            const __m256 yz = _mm256_shuffle_ps(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));  // y0 z0 y1 z1
+            x = _mm256_shuffle_ps(m03, xy, _MM_SHUFFLE(2, 0, 3, 0));
+            y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+            z = _mm256_shuffle_ps(yz, m25, _MM_SHUFFLE(3, 0, 3, 1));
+        }
+
+        /**
+         * @brief Inverse of load_soa.
+         */
+        inline void store_soa(vec<float, 3>* ptr, const vec8fa& x, const vec8fa& y, const vec8fa& z) noexcept
+        {
+            const __m256 xy = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));  // x0 x2 y0 y2
+            const __m256 yz = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));  // y1 y3 z1 z3
+            const __m256 zx = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));  // z0 z2 x1 x3
+            const __m256 m03 = _mm256_shuffle_ps(xy, zx, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m256 m14 = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+            const __m256 m25 = _mm256_shuffle_ps(zx, yz, _MM_SHUFFLE(3, 1, 3, 1));
+
+            float* f = &ptr->x;
+            _mm_storeu_ps(f + 0, _mm256_castps256_ps128(m03));
+            _mm_storeu_ps(f + 4, _mm256_castps256_ps128(m14));
+            _mm_storeu_ps(f + 8, _mm256_castps256_ps128(m25));
+            _mm_storeu_ps(f + 12, _mm256_extractf128_ps(m03, 1));
+            _mm_storeu_ps(f + 16, _mm256_extractf128_ps(m14, 1));
+            _mm_storeu_ps(f + 20, _mm256_extractf128_ps(m25, 1));
+        }
+
+        /**
+         * @brief Approximate reciprocal square root refined with one Newton-Raphson step, which brings it to about 1.5 ulp.
+         */
+        [[nodiscard]] inline vec8fa rsqrt_nr(const vec8fa& l) noexcept
+        {
+            const vec8fa r = rsqrt(l);
+            return r * nmadd(l * 0.5f, r * r, vec8fa(1.5f));
+        }
+#endif
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Batched length, dot, distance and normalize.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Normalize each vector. Zero vectors result in NaN, as with normalize.
+     * @param in Vectors.
+     * @param out Normalized vectors. May alias in.
+     */
+    inline void normalize_all(const std::span<const vec<float, 3>> in, const std::span<vec<float, 3>> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        size_t i = 0;
+#ifdef __AVX__
+        for (; i + 8 <= in.size(); i += 8)
+        {
+            vec8fa x(uninit), y(uninit), z(uninit);
+            detail::load_soa(&in[i], x, y, z);
+            const vec8fa r = detail::rsqrt_nr(madd(x, x, madd(y, y, z * z)));
+            detail::store_soa(&out[i], x * r, y * r, z * r);
+        }
+#endif
+        for (; i < in.size(); i++) out[i] = normalize(in[i]);
+    }
+
+    /**
+     * @brief Normalize each vector in place.
+     */
+    inline void normalize_all(const std::span<vec<float, 3>> v) noexcept { normalize_all(std::span<const vec<float, 3>>(v), v); }
+
+    /**
+     * @brief Compute the length of each vector.
+     * @param in Vectors.
+     * @param out Lengths.
+     */
+    inline void length_all(const std::span<const vec<float, 3>> in, const std::span<float> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        size_t i = 0;
+#ifdef __AVX__
+        // sqrt instead of the reciprocal estimate, which is exact and returns 0 rather than NaN for zero vectors.
+        for (; i + 8 <= in.size(); i += 8)
+        {
+            vec8fa x(uninit), y(uninit), z(uninit);
+            detail::load_soa(&in[i], x, y, z);
+            vec8fa::storeu(&out[i], sqrt(madd(x, x, madd(y, y, z * z))));
+        }
+#endif
+        for (; i < in.size(); i++) out[i] = length(in[i]);
+    }
+
+    /**
+     * @brief Compute the dot product of each pair of vectors.
+     * @param a First vectors.
+     * @param b Second vectors.
+     * @param out Dot products.
+     */
+    inline void dot_all(const std::span<const vec<float, 3>> a, const std::span<const vec<float, 3>> b, const std::span<float> out) noexcept
+    {
+        assert(b.size() >= a.size() && out.size() >= a.size());
+        size_t i = 0;
+#ifdef __AVX__
+        for (; i + 8 <= a.size(); i += 8)
+        {
+            vec8fa ax(uninit), ay(uninit), az(uninit), bx(uninit), by(uninit), bz(uninit);
+            detail::load_soa(&a[i], ax, ay, az);
+            detail::load_soa(&b[i], bx, by, bz);
+            vec8fa::storeu(&out[i], madd(ax, bx, madd(ay, by, az * bz)));
+        }
+#endif
+        for (; i < a.size(); i++) out[i] = dot(a[i], b[i]);
+    }
+
+    /**
+     * @brief Compute the distance between each pair of points.
+     * @param a First points.
+     * @param b Second points.
+     * @param out Distances.
+     */
+    inline void distance_all(const std::span<const vec<float, 3>> a, const std::span<const vec<float, 3>> b, const std::span<float> out) noexcept
+    {
+        assert(b.size() >= a.size() && out.size() >= a.size());
+        size_t i = 0;
+#ifdef __AVX__
+        for (; i + 8 <= a.size(); i += 8)
+        {
+            vec8fa ax(uninit), ay(uninit), az(uninit), bx(uninit), by(uninit), bz(uninit);
+            detail::load_soa(&a[i], ax, ay, az);
+            detail::load_soa(&b[i], bx, by, bz);
+            const vec8fa dx = ax - bx, dy = ay - by, dz = az - bz;
+            vec8fa::storeu(&out[i], sqrt(madd(dx, dx, madd(dy, dy, dz * dz))));
+        }
+#endif
+        for (; i < a.size(); i++) out[i] = distance(a[i], b[i]);
+    }
+}
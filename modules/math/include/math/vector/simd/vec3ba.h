@@ -13,6 +13,7 @@
 ////////////////////////////////////////////////////////////////
 
 #include "math/vector/vec3.h"
+#include "math/vector/simd/permute.h"
 
 namespace math
 {
@@ -43,6 +44,8 @@ namespace math
 
         [[nodiscard]] vec3ba() noexcept : m128(_mm_set1_epi32(0)) {}
 
+        [[nodiscard]] explicit vec3ba(uninit_t) noexcept {}
+
         [[nodiscard]] explicit vec3ba(const bool b) noexcept : m128(_mm_set1_epi32(0 - static_cast<int32_t>(b))) {}
 
         [[nodiscard]] vec3ba(const bool x, const bool y, const bool z) noexcept : m128(_mm_setr_epi32(0 - static_cast<int32_t>(x), 0 - static_cast<int32_t>(y), 0 - static_cast<int32_t>(z), 0)) {}
@@ -53,7 +56,7 @@ namespace math
 
         [[nodiscard]] explicit vec3ba(const __m128 m128) noexcept : m128(_mm_castps_si128(m128)) {}
 
-        [[nodiscard]] vec3ba(const vec3ba& rhs) noexcept : m128(rhs.m128) {}
+        [[nodiscard]] vec3ba(const vec3ba& rhs) noexcept = default;
 
         [[nodiscard]] explicit vec3ba(const vec<bool, 3>& rhs) noexcept : m128(_mm_setr_epi32(0 - static_cast<int32_t>(rhs.x), 0 - static_cast<int32_t>(rhs.y), 0 - static_cast<int32_t>(rhs.z), 0)) {}
 
@@ -61,7 +64,7 @@ namespace math
         // Assignment operators.
         ////////////////////////////////////////////////////////////////
 
-        vec3ba& operator=(const vec3ba& rhs) noexcept { m128 = rhs.m128; return *this; }
+        vec3ba& operator=(const vec3ba& rhs) noexcept = default;
 
         vec3ba& operator=(const bool rhs) noexcept { m128 = _mm_set1_epi32(0 - static_cast<int32_t>(rhs)); return *this; }
 
@@ -101,45 +104,41 @@ namespace math
         // Swizzling.
         ////////////////////////////////////////////////////////////////
 
-#ifdef __AVX__
-        [[nodiscard]] vec3ba xxx() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 0, 0))); }
-        [[nodiscard]] vec3ba xxy() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 0, 0))); }
-        [[nodiscard]] vec3ba xxz() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 0, 0))); }
-        [[nodiscard]] vec3ba xyx() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 1, 0))); }
-        [[nodiscard]] vec3ba xyy() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 1, 0))); }
-        [[nodiscard]] vec3ba xyz() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 1, 0))); }
-        [[nodiscard]] vec3ba xzx() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 2, 0))); }
-        [[nodiscard]] vec3ba xzy() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 2, 0))); }
-        [[nodiscard]] vec3ba xzz() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 2, 0))); }
-        [[nodiscard]] vec3ba yxx() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 0, 1))); }
-        [[nodiscard]] vec3ba yxy() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 0, 1))); }
-        [[nodiscard]] vec3ba yxz() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 0, 1))); }
-        [[nodiscard]] vec3ba yyx() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 1, 1))); }
-        [[nodiscard]] vec3ba yyy() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 1, 1))); }
-        [[nodiscard]] vec3ba yyz() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 1, 1))); }
-        [[nodiscard]] vec3ba yzx() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 2, 1))); }
-        [[nodiscard]] vec3ba yzy() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 2, 1))); }
-        [[nodiscard]] vec3ba yzz() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 2, 1))); }
-        [[nodiscard]] vec3ba zxx() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 0, 2))); }
-        [[nodiscard]] vec3ba zxy() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 0, 2))); }
-        [[nodiscard]] vec3ba zxz() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 0, 2))); }
-        [[nodiscard]] vec3ba zyx() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 1, 2))); }
-        [[nodiscard]] vec3ba zyy() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 1, 2))); }
-        [[nodiscard]] vec3ba zyz() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 1, 2))); }
-        [[nodiscard]] vec3ba zzx() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 2, 2))); }
-        [[nodiscard]] vec3ba zzy() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 2, 2))); }
-        [[nodiscard]] vec3ba zzz() const noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 2, 2))); }
-#endif
+        [[nodiscard]] vec3ba xxx() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 0, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba xxy() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 1, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba xxz() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 2, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba xyx() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 0, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba xyy() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 1, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba xyz() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 2, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba xzx() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 0, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba xzy() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 1, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba xzz() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 2, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba yxx() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 0, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba yxy() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 1, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba yxz() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 2, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba yyx() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 0, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba yyy() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 1, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba yyz() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 2, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba yzx() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 0, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba yzy() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 1, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba yzz() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 2, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba zxx() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 0, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba zxy() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 1, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba zxz() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 2, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba zyx() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 0, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba zyy() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 1, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba zyz() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 2, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba zzx() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 0, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba zzy() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 1, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ba zzz() const noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, 2, 2, 2)>(_mm_castsi128_ps(m128))); }
     };
 
     ////////////////////////////////////////////////////////////////
     // Shuffle.
     ////////////////////////////////////////////////////////////////
 
-#ifdef __AVX__
     template<int32_t i0, int32_t i1, int32_t i2>
-    [[nodiscard]] vec3ba shuffle(const vec3ba& v) noexcept { return vec3ba(_mm_permute_ps(_mm_castsi128_ps(v), _MM_SHUFFLE(0, i2, i1, i0))); }
-#endif
+    [[nodiscard]] vec3ba shuffle(const vec3ba& v) noexcept { return vec3ba(detail::permute<_MM_SHUFFLE(0, i2, i1, i0)>(_mm_castsi128_ps(v))); }
 
     ////////////////////////////////////////////////////////////////
     // Bitwise operators.
@@ -0,0 +1,469 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <immintrin.h>
+#include <iostream>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/math_functions.h"
+#include "math/vector/simd/permute.h"
+#include "math/vector/vec3.h"
+#include "math/vector/simd/vec3dba.h"
+#include "math/vector/simd/vec4da.h"
+
+namespace math
+{
+#ifdef __AVX__
+    /**=================================================================================================
+     * Struct: vec3da
+     * =================================================================================================
+     * @struct  vec3da
+     *
+     * @brief   Three doubles in a single AVX register, padded with a fourth lane. Mirrors vec3fa.
+    **/
+    struct alignas(32) vec3da
+    {
+        static constexpr size_t size = 3;
+        using element_type = double;
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4201)
+#endif
+        union
+        {
+            __m256d m256;
+            struct
+            {
+                double x, y, z, w;
+            };
+        };
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] vec3da() noexcept : m256(_mm256_setzero_pd()) {}
+
+        [[nodiscard]] explicit vec3da(uninit_t) noexcept {}
+
+        [[nodiscard]] explicit vec3da(const double v) noexcept : m256(_mm256_set1_pd(v)) {}
+
+        [[nodiscard]] vec3da(const double x, const double y, const double z) noexcept : m256(_mm256_setr_pd(x, y, z, 0.0)) {}
+
+        [[nodiscard]] vec3da(const double x, const double y, const double z, const double w) noexcept : m256(_mm256_setr_pd(x, y, z, w)) {}
+
+        [[nodiscard]] explicit vec3da(const __m256d m256) noexcept : m256(m256) {}
+
+        [[nodiscard]] vec3da(const vec3da& rhs) noexcept = default;
+
+        [[nodiscard]] explicit vec3da(const vec<double, 3>& rhs) noexcept : m256(_mm256_setr_pd(rhs.x, rhs.y, rhs.z, 0.0)) {}
+
+        ////////////////////////////////////////////////////////////////
+        // Assignment operators.
+        ////////////////////////////////////////////////////////////////
+
+        vec3da& operator=(const vec3da& rhs) noexcept = default;
+
+        vec3da& operator=(const vec4da& rhs) noexcept { m256 = rhs.m256; return *this; }
+
+        vec3da& operator=(const double rhs) noexcept { m256 = _mm256_set1_pd(rhs); return *this; }
+
+        ////////////////////////////////////////////////////////////////
+        // Load/store.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] static vec3da load(const void* const ptr) { return vec3da(_mm256_load_pd(static_cast<const double*>(ptr))); }
+
+        [[nodiscard]] static vec3da loadu(const void* const ptr) { return vec3da(_mm256_loadu_pd(static_cast<const double*>(ptr))); }
+
+        static void store(void* ptr, const vec3da& v) { _mm256_store_pd(static_cast<double*>(ptr), v.m256); }
+
+        static void storeu(void* ptr, const vec3da& v) { _mm256_storeu_pd(static_cast<double*>(ptr), v.m256); }
+
+        ////////////////////////////////////////////////////////////////
+        // Defaulted constructors and operators.
+        ////////////////////////////////////////////////////////////////
+
+        ~vec3da() noexcept = default;
+
+        vec3da(vec3da&& rhs) noexcept = default;
+
+        vec3da& operator=(vec3da&& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Casting operators.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] operator const __m256d&() const noexcept { return m256; }
+
+        [[nodiscard]] operator __m256d&() noexcept { return m256; }
+
+        [[nodiscard]] explicit operator vec<double, 3>() const noexcept { return vec<double, 3>(x, y, z); }
+
+        ////////////////////////////////////////////////////////////////
+        // Element access.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] const double& operator[](const size_t i) const { assert(i < 3); return (&x)[i]; }
+
+        [[nodiscard]] double& operator[](const size_t i) { assert(i < 3); return (&x)[i]; }
+
+        ////////////////////////////////////////////////////////////////
+        // Swizzling.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] vec3da xxx() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 0, 0, 0)>(m256)); }
+        [[nodiscard]] vec3da xxy() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 1, 0, 0)>(m256)); }
+        [[nodiscard]] vec3da xxz() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 2, 0, 0)>(m256)); }
+        [[nodiscard]] vec3da xyx() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 0, 1, 0)>(m256)); }
+        [[nodiscard]] vec3da xyy() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 1, 1, 0)>(m256)); }
+        [[nodiscard]] vec3da xyz() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 2, 1, 0)>(m256)); }
+        [[nodiscard]] vec3da xzx() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 0, 2, 0)>(m256)); }
+        [[nodiscard]] vec3da xzy() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 1, 2, 0)>(m256)); }
+        [[nodiscard]] vec3da xzz() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 2, 2, 0)>(m256)); }
+        [[nodiscard]] vec3da yxx() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 0, 0, 1)>(m256)); }
+        [[nodiscard]] vec3da yxy() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 1, 0, 1)>(m256)); }
+        [[nodiscard]] vec3da yxz() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 2, 0, 1)>(m256)); }
+        [[nodiscard]] vec3da yyx() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 0, 1, 1)>(m256)); }
+        [[nodiscard]] vec3da yyy() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 1, 1, 1)>(m256)); }
+        [[nodiscard]] vec3da yyz() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 2, 1, 1)>(m256)); }
+        [[nodiscard]] vec3da yzx() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 0, 2, 1)>(m256)); }
+        [[nodiscard]] vec3da yzy() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 1, 2, 1)>(m256)); }
+        [[nodiscard]] vec3da yzz() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 2, 2, 1)>(m256)); }
+        [[nodiscard]] vec3da zxx() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 0, 0, 2)>(m256)); }
+        [[nodiscard]] vec3da zxy() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 1, 0, 2)>(m256)); }
+        [[nodiscard]] vec3da zxz() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 2, 0, 2)>(m256)); }
+        [[nodiscard]] vec3da zyx() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 0, 1, 2)>(m256)); }
+        [[nodiscard]] vec3da zyy() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 1, 1, 2)>(m256)); }
+        [[nodiscard]] vec3da zyz() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 2, 1, 2)>(m256)); }
+        [[nodiscard]] vec3da zzx() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 0, 2, 2)>(m256)); }
+        [[nodiscard]] vec3da zzy() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 1, 2, 2)>(m256)); }
+        [[nodiscard]] vec3da zzz() const noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, 2, 2, 2)>(m256)); }
+    };
+
+    ////////////////////////////////////////////////////////////////
+    // Shuffle.
+    ////////////////////////////////////////////////////////////////
+
+    template<int32_t i0, int32_t i1, int32_t i2>
+    [[nodiscard]] vec3da shuffle(const vec3da& v) noexcept { return vec3da(detail::permute<_MM_SHUFFLE(3, i2, i1, i0)>(v.m256)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Arithmetic operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec3da operator+(const vec3da& lhs, const vec3da& rhs) noexcept { return vec3da(_mm256_add_pd(lhs, rhs)); }
+
+    [[nodiscard]] inline vec3da operator+(const vec3da& lhs, const double rhs) noexcept { return lhs + vec3da(rhs); }
+
+    [[nodiscard]] inline vec3da operator+(const double lhs, const vec3da& rhs) noexcept { return vec3da(lhs) + rhs; }
+
+    [[nodiscard]] inline vec3da operator-(const vec3da& lhs, const vec3da& rhs) noexcept { return vec3da(_mm256_sub_pd(lhs, rhs)); }
+
+    [[nodiscard]] inline vec3da operator-(const vec3da& lhs, const double rhs) noexcept { return lhs - vec3da(rhs); }
+
+    [[nodiscard]] inline vec3da operator-(const double lhs, const vec3da& rhs) noexcept { return vec3da(lhs) - rhs; }
+
+    [[nodiscard]] inline vec3da operator-(const vec3da& lhs) noexcept { return vec3da(_mm256_xor_pd(lhs, _mm256_set1_pd(-0.0))); }
+
+    [[nodiscard]] inline vec3da operator*(const vec3da& lhs, const vec3da& rhs) noexcept { return vec3da(_mm256_mul_pd(lhs, rhs)); }
+
+    [[nodiscard]] inline vec3da operator*(const vec3da& lhs, const double rhs) noexcept { return lhs * vec3da(rhs); }
+
+    [[nodiscard]] inline vec3da operator*(const double lhs, const vec3da& rhs) noexcept { return vec3da(lhs) * rhs; }
+
+    [[nodiscard]] inline vec3da operator/(const vec3da& lhs, const vec3da& rhs) noexcept { return vec3da(_mm256_div_pd(lhs, rhs)); }
+
+    [[nodiscard]] inline vec3da operator/(const vec3da& lhs, const double rhs) noexcept { return lhs / vec3da(rhs); }
+
+    [[nodiscard]] inline vec3da operator/(const double lhs, const vec3da& rhs) noexcept { return vec3da(lhs) / rhs; }
+
+    inline vec3da& operator+=(vec3da& lhs, const vec3da& rhs) noexcept { return lhs = lhs + rhs; }
+
+    inline vec3da& operator+=(vec3da& lhs, const double rhs) noexcept { return lhs = lhs + rhs; }
+
+    inline vec3da& operator-=(vec3da& lhs, const vec3da& rhs) noexcept { return lhs = lhs - rhs; }
+
+    inline vec3da& operator-=(vec3da& lhs, const double rhs) noexcept { return lhs = lhs - rhs; }
+
+    inline vec3da& operator*=(vec3da& lhs, const vec3da& rhs) noexcept { return lhs = lhs * rhs; }
+
+    inline vec3da& operator*=(vec3da& lhs, const double rhs) noexcept { return lhs = lhs * rhs; }
+
+    inline vec3da& operator/=(vec3da& lhs, const vec3da& rhs) noexcept { return lhs = lhs / rhs; }
+
+    inline vec3da& operator/=(vec3da& lhs, const double rhs) noexcept { return lhs = lhs / rhs; }
+
+    ////////////////////////////////////////////////////////////////
+    // Comparison operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline bool operator==(const vec3da& lhs, const vec3da& rhs) noexcept { return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ)) & 0x7) == 0x7; }
+
+    [[nodiscard]] inline bool operator!=(const vec3da& lhs, const vec3da& rhs) noexcept { return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ)) & 0x7) != 0x7; }
+
+    ////////////////////////////////////////////////////////////////
+    // Per-element comparisons.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec3dba cmpeq(const vec3da& lhs, const vec3da& rhs) noexcept { return vec3dba(_mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ)); }
+
+    [[nodiscard]] inline vec3dba cmpeq(const vec3da& lhs, const double rhs) noexcept { return cmpeq(lhs, vec3da(rhs)); }
+
+    [[nodiscard]] inline vec3dba cmpeq(const double lhs, const vec3da& rhs) noexcept { return cmpeq(vec3da(lhs), rhs); }
+
+    [[nodiscard]] inline vec3dba cmpneq(const vec3da& lhs, const vec3da& rhs) noexcept { return vec3dba(_mm256_cmp_pd(lhs, rhs, _CMP_NEQ_UQ)); }
+
+    [[nodiscard]] inline vec3dba cmpneq(const vec3da& lhs, const double rhs) noexcept { return cmpneq(lhs, vec3da(rhs)); }
+
+    [[nodiscard]] inline vec3dba cmpneq(const double lhs, const vec3da& rhs) noexcept { return cmpneq(vec3da(lhs), rhs); }
+
+    [[nodiscard]] inline vec3dba cmplt(const vec3da& lhs, const vec3da& rhs) noexcept { return vec3dba(_mm256_cmp_pd(lhs, rhs, _CMP_LT_OS)); }
+
+    [[nodiscard]] inline vec3dba cmplt(const vec3da& lhs, const double rhs) noexcept { return cmplt(lhs, vec3da(rhs)); }
+
+    [[nodiscard]] inline vec3dba cmplt(const double lhs, const vec3da& rhs) noexcept { return cmplt(vec3da(lhs), rhs); }
+
+    [[nodiscard]] inline vec3dba cmpgt(const vec3da& lhs, const vec3da& rhs) noexcept { return vec3dba(_mm256_cmp_pd(lhs, rhs, _CMP_GT_OS)); }
+
+    [[nodiscard]] inline vec3dba cmpgt(const vec3da& lhs, const double rhs) noexcept { return cmpgt(lhs, vec3da(rhs)); }
+
+    [[nodiscard]] inline vec3dba cmpgt(const double lhs, const vec3da& rhs) noexcept { return cmpgt(vec3da(lhs), rhs); }
+
+    [[nodiscard]] inline vec3dba cmple(const vec3da& lhs, const vec3da& rhs) noexcept { return vec3dba(_mm256_cmp_pd(lhs, rhs, _CMP_LE_OS)); }
+
+    [[nodiscard]] inline vec3dba cmple(const vec3da& lhs, const double rhs) noexcept { return cmple(lhs, vec3da(rhs)); }
+
+    [[nodiscard]] inline vec3dba cmple(const double lhs, const vec3da& rhs) noexcept { return cmple(vec3da(lhs), rhs); }
+
+    [[nodiscard]] inline vec3dba cmpge(const vec3da& lhs, const vec3da& rhs) noexcept { return vec3dba(_mm256_cmp_pd(lhs, rhs, _CMP_GE_OS)); }
+
+    [[nodiscard]] inline vec3dba cmpge(const vec3da& lhs, const double rhs) noexcept { return cmpge(lhs, vec3da(rhs)); }
+
+    [[nodiscard]] inline vec3dba cmpge(const double lhs, const vec3da& rhs) noexcept { return cmpge(vec3da(lhs), rhs); }
+
+    ////////////////////////////////////////////////////////////////
+    // Min/max, abs and clamp.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec3da min(const vec3da& lhs, const vec3da& rhs) noexcept { return vec3da(_mm256_min_pd(lhs, rhs)); }
+
+    [[nodiscard]] inline vec3da min(const vec3da& lhs, const double rhs) noexcept { return min(lhs, vec3da(rhs)); }
+
+    [[nodiscard]] inline vec3da min(const double lhs, const vec3da& rhs) noexcept { return min(vec3da(lhs), rhs); }
+
+    [[nodiscard]] inline vec3da max(const vec3da& lhs, const vec3da& rhs) noexcept { return vec3da(_mm256_max_pd(lhs, rhs)); }
+
+    [[nodiscard]] inline vec3da max(const vec3da& lhs, const double rhs) noexcept { return max(lhs, vec3da(rhs)); }
+
+    [[nodiscard]] inline vec3da max(const double lhs, const vec3da& rhs) noexcept { return max(vec3da(lhs), rhs); }
+
+    [[nodiscard]] inline vec3da clamp(const vec3da& a, const vec3da& min, const vec3da& max) noexcept { return math::max(min, math::min(a, max)); }
+
+    [[nodiscard]] inline vec3da clamp(const vec3da& a, const vec3da& min, const double max) noexcept { return clamp(a, min, vec3da(max)); }
+
+    [[nodiscard]] inline vec3da clamp(const vec3da& a, const double min, const vec3da& max) noexcept { return clamp(a, vec3da(min), max); }
+
+    [[nodiscard]] inline vec3da clamp(const vec3da& a, const double min, const double max) noexcept { return clamp(a, vec3da(min), vec3da(max)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Reduction.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline double reduce_add(const vec3da& lhs) noexcept
+    {
+        const __m128d xy = _mm256_castpd256_pd128(lhs);
+        const __m128d zw = _mm256_extractf128_pd(lhs, 1);
+        const __m128d r1 = _mm_add_sd(xy, zw);
+        const __m128d r2 = _mm_add_sd(r1, _mm_unpackhi_pd(xy, xy));
+        return _mm_cvtsd_f64(r2);
+    }
+
+    [[nodiscard]] inline double reduce_mul(const vec3da& lhs) noexcept
+    {
+        const __m128d xy = _mm256_castpd256_pd128(lhs);
+        const __m128d zw = _mm256_extractf128_pd(lhs, 1);
+        const __m128d r1 = _mm_mul_sd(xy, zw);
+        const __m128d r2 = _mm_mul_sd(r1, _mm_unpackhi_pd(xy, xy));
+        return _mm_cvtsd_f64(r2);
+    }
+
+    [[nodiscard]] inline double reduce_min(const vec3da& lhs) noexcept
+    {
+        const __m128d xy = _mm256_castpd256_pd128(lhs);
+        const __m128d zw = _mm256_extractf128_pd(lhs, 1);
+        const __m128d r1 = _mm_min_sd(xy, zw);
+        const __m128d r2 = _mm_min_sd(r1, _mm_unpackhi_pd(xy, xy));
+        return _mm_cvtsd_f64(r2);
+    }
+
+    [[nodiscard]] inline double reduce_max(const vec3da& lhs) noexcept
+    {
+        const __m128d xy = _mm256_castpd256_pd128(lhs);
+        const __m128d zw = _mm256_extractf128_pd(lhs, 1);
+        const __m128d r1 = _mm_max_sd(xy, zw);
+        const __m128d r2 = _mm_max_sd(r1, _mm_unpackhi_pd(xy, xy));
+        return _mm_cvtsd_f64(r2);
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Multiply and add.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec3da madd(const vec3da& a, const vec3da& b, const vec3da& c) noexcept
+    {
+#ifdef __FMA__
+        return vec3da(_mm256_fmadd_pd(a, b, c));
+#else
+        return a * b + c;
+#endif
+    }
+
+    [[nodiscard]] inline vec3da nmadd(const vec3da& a, const vec3da& b, const vec3da& c) noexcept
+    {
+#ifdef __FMA__
+        return vec3da(_mm256_fnmadd_pd(a, b, c));
+#else
+        return -a * b + c;
+#endif
+    }
+
+    [[nodiscard]] inline vec3da msub(const vec3da& a, const vec3da& b, const vec3da& c) noexcept
+    {
+#ifdef __FMA__
+        return vec3da(_mm256_fmsub_pd(a, b, c));
+#else
+        return a * b - c;
+#endif
+    }
+
+    [[nodiscard]] inline vec3da nmsub(const vec3da& a, const vec3da& b, const vec3da& c) noexcept
+    {
+#ifdef __FMA__
+        return vec3da(_mm256_fnmsub_pd(a, b, c));
+#else
+        return -a * b - c;
+#endif
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Dot product etc.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline double dot(const vec3da& lhs, const vec3da& rhs) noexcept { return reduce_add(lhs * rhs); }
+
+    [[nodiscard]] inline vec3da cross(const vec3da& lhs, const vec3da& rhs) noexcept { return msub(lhs.yzx(), rhs.zxy(), lhs.zxy() * rhs.yzx()); }
+
+    [[nodiscard]] inline double length(const vec3da& lhs) noexcept { return sqrt(dot(lhs, lhs)); }
+
+    [[nodiscard]] inline double sqr_length(const vec3da& lhs) noexcept { return dot(lhs, lhs); }
+
+    [[nodiscard]] inline double rcp_length(const vec3da& lhs) noexcept { return rsqrt(dot(lhs, lhs)); }
+
+    [[nodiscard]] inline vec3da normalize(const vec3da& lhs) noexcept { return lhs * rcp_length(lhs); }
+
+    [[nodiscard]] inline vec3da normalize(const vec3da& lhs, double& length) noexcept { length = math::length(lhs); return lhs / length; }
+
+    [[nodiscard]] inline double distance(const vec3da& lhs, const vec3da& rhs) noexcept { return length(lhs - rhs); }
+
+    [[nodiscard]] inline vec3da lerp(const vec3da& a, const vec3da& b, const vec3da& t) noexcept { return madd(t, b - a, a); }
+
+    [[nodiscard]] inline vec3da lerp(const vec3da& a, const vec3da& b, const double t) noexcept { return madd(vec3da(t), b - a, a); }
+
+    ////////////////////////////////////////////////////////////////
+    // Trigonometry.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec3da acos(const vec3da& lhs) noexcept { return vec3da(acos(lhs.x), acos(lhs.y), acos(lhs.z)); }
+
+    [[nodiscard]] inline vec3da asin(const vec3da& lhs) noexcept { return vec3da(asin(lhs.x), asin(lhs.y), asin(lhs.z)); }
+
+    [[nodiscard]] inline vec3da atan(const vec3da& lhs) noexcept { return vec3da(atan(lhs.x), atan(lhs.y), atan(lhs.z)); }
+
+    [[nodiscard]] inline vec3da atan2(const vec3da& lhs, const vec3da& rhs) noexcept { return vec3da(atan2(lhs.x, rhs.x), atan2(lhs.y, rhs.y), atan2(lhs.z, rhs.z)); }
+
+    [[nodiscard]] inline vec3da cos(const vec3da& lhs) noexcept { return vec3da(cos(lhs.x), cos(lhs.y), cos(lhs.z)); }
+
+    [[nodiscard]] inline vec3da cosh(const vec3da& lhs) noexcept { return vec3da(cosh(lhs.x), cosh(lhs.y), cosh(lhs.z)); }
+
+    [[nodiscard]] inline vec3da sin(const vec3da& lhs) noexcept { return vec3da(sin(lhs.x), sin(lhs.y), sin(lhs.z)); }
+
+    [[nodiscard]] inline vec3da sinh(const vec3da& lhs) noexcept { return vec3da(sinh(lhs.x), sinh(lhs.y), sinh(lhs.z)); }
+
+    [[nodiscard]] inline vec3da tan(const vec3da& lhs) noexcept { return vec3da(tan(lhs.x), tan(lhs.y), tan(lhs.z)); }
+
+    [[nodiscard]] inline vec3da tanh(const vec3da& lhs) noexcept { return vec3da(tanh(lhs.x), tanh(lhs.y), tanh(lhs.z)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Exponential / Logarithmic.
+    ////////////////////////////////////////////////////////////////
+
+    // There are no double precision polynomial approximations (yet), so these are evaluated per element.
+
+    [[nodiscard]] inline vec3da exp(const vec3da& lhs) noexcept { return vec3da(exp(lhs.x), exp(lhs.y), exp(lhs.z)); }
+
+    [[nodiscard]] inline vec3da exp2(const vec3da& lhs) noexcept { return vec3da(exp2(lhs.x), exp2(lhs.y), exp2(lhs.z)); }
+
+    [[nodiscard]] inline vec3da log(const vec3da& lhs) noexcept { return vec3da(log(lhs.x), log(lhs.y), log(lhs.z)); }
+
+    [[nodiscard]] inline vec3da log2(const vec3da& lhs) noexcept { return vec3da(log2(lhs.x), log2(lhs.y), log2(lhs.z)); }
+
+    [[nodiscard]] inline vec3da log10(const vec3da& lhs) noexcept { return vec3da(log10(lhs.x), log10(lhs.y), log10(lhs.z)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Power.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec3da pow(const vec3da& lhs, const vec3da& rhs) noexcept { return vec3da(pow(lhs.x, rhs.x), pow(lhs.y, rhs.y), pow(lhs.z, rhs.z)); }
+
+    [[nodiscard]] inline vec3da pow(const vec3da& lhs, const double rhs) noexcept { return pow(lhs, vec3da(rhs)); }
+
+    [[nodiscard]] inline vec3da pow(const double lhs, const vec3da& rhs) noexcept { return pow(vec3da(lhs), rhs); }
+
+    [[nodiscard]] inline vec3da sqr(const vec3da& lhs) noexcept { return lhs * lhs; }
+
+    [[nodiscard]] inline vec3da sqrt(const vec3da& lhs) noexcept { return vec3da(_mm256_sqrt_pd(lhs)); }
+
+    // There is no approximate reciprocal square root for doubles before AVX-512, so this is exact.
+    [[nodiscard]] inline vec3da rsqrt(const vec3da& lhs) noexcept { return vec3da(_mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(lhs))); }
+
+    ////////////////////////////////////////////////////////////////
+    // Rounding, abs, etc.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec3da abs(const vec3da& lhs) noexcept { return vec3da(_mm256_andnot_pd(_mm256_set1_pd(-0.0), lhs)); }
+
+    [[nodiscard]] inline vec3da round(const vec3da& lhs) noexcept { return vec3da(_mm256_round_pd(lhs, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)); }
+
+    [[nodiscard]] inline vec3da ceil(const vec3da& lhs) noexcept { return vec3da(_mm256_round_pd(lhs, _MM_FROUND_CEIL)); }
+
+    [[nodiscard]] inline vec3da floor(const vec3da& lhs) noexcept { return vec3da(_mm256_round_pd(lhs, _MM_FROUND_FLOOR)); }
+
+    [[nodiscard]] inline vec3da frac(const vec3da& lhs) noexcept { return vec3da(_mm256_sub_pd(lhs, _mm256_round_pd(lhs, _MM_FROUND_TRUNC))); }
+
+    [[nodiscard]] inline vec3da trunc(const vec3da& lhs) noexcept { return vec3da(_mm256_round_pd(lhs, _MM_FROUND_TRUNC)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Select.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec3da select(const vec3da& t, const vec3da& f, const vec3dba& b) noexcept { return vec3da(_mm256_blendv_pd(f, t, _mm256_castsi256_pd(b))); }
+
+    ////////////////////////////////////////////////////////////////
+    // Output.
+    ////////////////////////////////////////////////////////////////
+
+    inline std::ostream& operator<<(std::ostream& out, const vec3da& v) { return out << "(" << v.x << ", " << v.y << ", " << v.z << ")"; }
+#endif
+}
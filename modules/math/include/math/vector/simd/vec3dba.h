@@ -0,0 +1,164 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <immintrin.h>
+#include <iostream>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/vector/vec3.h"
+
+namespace math
+{
+#ifdef __AVX__
+    /**=================================================================================================
+     * Struct: vec3dba
+     * =================================================================================================
+     * @struct  vec3dba
+     *
+     * @brief   Mask of 3 booleans with 64-bit lanes, as returned by the comparisons of vec3da. The fourth lane is
+     *          padding and ignored by the reductions.
+    **/
+    struct alignas(32) vec3dba
+    {
+        static constexpr size_t size = 3;
+        using element_type = int64_t;
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4201)
+#endif
+        union
+        {
+            __m256i m256;
+            struct
+            {
+                int64_t x, y, z, w;
+            };
+        };
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] vec3dba() noexcept : m256(_mm256_setzero_si256()) {}
+
+        [[nodiscard]] explicit vec3dba(uninit_t) noexcept {}
+
+        [[nodiscard]] explicit vec3dba(const bool b) noexcept : m256(_mm256_set1_epi64x(0 - static_cast<int64_t>(b))) {}
+
+        [[nodiscard]] vec3dba(const bool x, const bool y, const bool z) noexcept : m256(_mm256_setr_epi64x(0 - static_cast<int64_t>(x), 0 - static_cast<int64_t>(y), 0 - static_cast<int64_t>(z), 0)) {}
+
+        [[nodiscard]] vec3dba(const __m256i m256) noexcept : m256(m256) {}
+
+        [[nodiscard]] explicit vec3dba(const __m256d m256) noexcept : m256(_mm256_castpd_si256(m256)) {}
+
+        [[nodiscard]] vec3dba(const vec3dba& rhs) noexcept = default;
+
+        [[nodiscard]] explicit vec3dba(const vec<bool, 3>& rhs) noexcept : vec3dba(rhs.x, rhs.y, rhs.z) {}
+
+        ////////////////////////////////////////////////////////////////
+        // Assignment operators.
+        ////////////////////////////////////////////////////////////////
+
+        vec3dba& operator=(const vec3dba& rhs) noexcept = default;
+
+        vec3dba& operator=(const bool rhs) noexcept { m256 = _mm256_set1_epi64x(0 - static_cast<int64_t>(rhs)); return *this; }
+
+        ////////////////////////////////////////////////////////////////
+        // Defaulted constructors and operators.
+        ////////////////////////////////////////////////////////////////
+
+        ~vec3dba() noexcept = default;
+
+        vec3dba(vec3dba&& rhs) noexcept = default;
+
+        vec3dba& operator=(vec3dba&& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Casting operators.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] operator const __m256i&() const noexcept { return m256; }
+
+        [[nodiscard]] operator __m256i&() noexcept { return m256; }
+
+        [[nodiscard]] explicit operator __m256d() const noexcept { return _mm256_castsi256_pd(m256); }
+
+        [[nodiscard]] explicit operator vec<bool, 3>() const noexcept { return vec<bool, 3>((*this)[0], (*this)[1], (*this)[2]); }
+
+        ////////////////////////////////////////////////////////////////
+        // Element access.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] bool operator[](const size_t i) const { assert(i < 3); return static_cast<bool>((_mm256_movemask_pd(_mm256_castsi256_pd(m256)) >> i) & 0x1); }
+    };
+
+    ////////////////////////////////////////////////////////////////
+    // Bitwise operators.
+    ////////////////////////////////////////////////////////////////
+
+    // Implemented with the floating point instructions, so that they are also available without AVX2.
+
+    [[nodiscard]] inline vec3dba operator!(const vec3dba& lhs) noexcept { return vec3dba(_mm256_xor_pd(_mm256_castsi256_pd(lhs), _mm256_castsi256_pd(_mm256_set1_epi32(-1)))); }
+
+    [[nodiscard]] inline vec3dba operator&(const vec3dba& lhs, const vec3dba& rhs) noexcept { return vec3dba(_mm256_and_pd(_mm256_castsi256_pd(lhs), _mm256_castsi256_pd(rhs))); }
+
+    [[nodiscard]] inline vec3dba operator|(const vec3dba& lhs, const vec3dba& rhs) noexcept { return vec3dba(_mm256_or_pd(_mm256_castsi256_pd(lhs), _mm256_castsi256_pd(rhs))); }
+
+    [[nodiscard]] inline vec3dba operator^(const vec3dba& lhs, const vec3dba& rhs) noexcept { return vec3dba(_mm256_xor_pd(_mm256_castsi256_pd(lhs), _mm256_castsi256_pd(rhs))); }
+
+    inline vec3dba& operator&=(vec3dba& lhs, const vec3dba& rhs) noexcept { return lhs = lhs & rhs; }
+
+    inline vec3dba& operator|=(vec3dba& lhs, const vec3dba& rhs) noexcept { return lhs = lhs | rhs; }
+
+    inline vec3dba& operator^=(vec3dba& lhs, const vec3dba& rhs) noexcept { return lhs = lhs ^ rhs; }
+
+    ////////////////////////////////////////////////////////////////
+    // Comparison operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline bool operator==(const vec3dba& lhs, const vec3dba& rhs) noexcept { return (_mm256_movemask_pd(_mm256_castsi256_pd(lhs ^ rhs)) & 0x7) == 0x0; }
+
+    [[nodiscard]] inline bool operator!=(const vec3dba& lhs, const vec3dba& rhs) noexcept { return (_mm256_movemask_pd(_mm256_castsi256_pd(lhs ^ rhs)) & 0x7) != 0x0; }
+
+    ////////////////////////////////////////////////////////////////
+    // Per-element comparisons.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec3dba cmpeq(const vec3dba& lhs, const vec3dba& rhs) noexcept { return !(lhs ^ rhs); }
+
+    [[nodiscard]] inline vec3dba cmpneq(const vec3dba& lhs, const vec3dba& rhs) noexcept { return lhs ^ rhs; }
+
+    ////////////////////////////////////////////////////////////////
+    // Select.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec3dba select(const vec3dba& t, const vec3dba& f, const vec3dba& b) noexcept { return vec3dba(_mm256_blendv_pd(_mm256_castsi256_pd(f), _mm256_castsi256_pd(t), _mm256_castsi256_pd(b))); }
+
+    ////////////////////////////////////////////////////////////////
+    // Boolean vector reduction.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline bool all(const vec3dba& lhs) noexcept { return (_mm256_movemask_pd(_mm256_castsi256_pd(lhs)) & 0x7) == 0x7; }
+
+    [[nodiscard]] inline bool any(const vec3dba& lhs) noexcept { return (_mm256_movemask_pd(_mm256_castsi256_pd(lhs)) & 0x7) != 0x0; }
+
+    [[nodiscard]] inline bool none(const vec3dba& lhs) noexcept { return (_mm256_movemask_pd(_mm256_castsi256_pd(lhs)) & 0x7) == 0x0; }
+
+    ////////////////////////////////////////////////////////////////
+    // Output.
+    ////////////////////////////////////////////////////////////////
+
+    inline std::ostream& operator<<(std::ostream& out, const vec3dba& v) { return out << "(" << v[0] << ", " << v[1] << ", " << v[2] << ")"; }
+#endif
+}
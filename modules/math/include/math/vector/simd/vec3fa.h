@@ -45,6 +45,8 @@ namespace math
 
         [[nodiscard]] vec3fa() noexcept : m128(_mm_set1_ps(0)) {}
 
+        [[nodiscard]] explicit vec3fa(uninit_t) noexcept {}
+
         [[nodiscard]] explicit vec3fa(const float v) noexcept : m128(_mm_set1_ps(v)) {}
 
         [[nodiscard]] vec3fa(const float x, const float y, const float z) noexcept : m128(_mm_setr_ps(x, y, z, 0.0f)) {}
@@ -55,7 +57,7 @@ namespace math
 
         [[nodiscard]] explicit vec3fa(const __m128i m128) noexcept : m128(_mm_castsi128_ps(m128)) {}
 
-        [[nodiscard]] vec3fa(const vec3fa & rhs) noexcept : m128(rhs.m128) {}
+        [[nodiscard]] vec3fa(const vec3fa& rhs) noexcept = default;
 
         [[nodiscard]] explicit vec3fa(const vec<float, 3> & rhs) noexcept : m128(_mm_setr_ps(rhs.x, rhs.y, rhs.z, 0.0f)) {}
 
@@ -63,7 +65,7 @@ namespace math
         // Assignment operators.
         ////////////////////////////////////////////////////////////////
 
-        vec3fa& operator=(const vec3fa& rhs) noexcept { m128 = rhs.m128; return *this; }
+        vec3fa& operator=(const vec3fa& rhs) noexcept = default;
 
         vec3fa& operator=(const vec4fa& rhs) noexcept { m128 = rhs.m128; return *this; }
 
@@ -115,45 +117,41 @@ namespace math
         // Swizzling.
         ////////////////////////////////////////////////////////////////
 
-#ifdef __AVX__
-        [[nodiscard]] vec3fa xxx() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 0, 0))); }
-        [[nodiscard]] vec3fa xxy() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 0, 0))); }
-        [[nodiscard]] vec3fa xxz() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 0, 0))); }
-        [[nodiscard]] vec3fa xyx() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 1, 0))); }
-        [[nodiscard]] vec3fa xyy() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 1, 0))); }
-        [[nodiscard]] vec3fa xyz() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 1, 0))); }
-        [[nodiscard]] vec3fa xzx() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 2, 0))); }
-        [[nodiscard]] vec3fa xzy() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 2, 0))); }
-        [[nodiscard]] vec3fa xzz() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 2, 0))); }
-        [[nodiscard]] vec3fa yxx() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 0, 1))); }
-        [[nodiscard]] vec3fa yxy() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 0, 1))); }
-        [[nodiscard]] vec3fa yxz() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 0, 1))); }
-        [[nodiscard]] vec3fa yyx() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 1, 1))); }
-        [[nodiscard]] vec3fa yyy() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 1, 1))); }
-        [[nodiscard]] vec3fa yyz() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 1, 1))); }
-        [[nodiscard]] vec3fa yzx() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 2, 1))); }
-        [[nodiscard]] vec3fa yzy() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 2, 1))); }
-        [[nodiscard]] vec3fa yzz() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 2, 1))); }
-        [[nodiscard]] vec3fa zxx() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 0, 2))); }
-        [[nodiscard]] vec3fa zxy() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 0, 2))); }
-        [[nodiscard]] vec3fa zxz() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 0, 2))); }
-        [[nodiscard]] vec3fa zyx() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 1, 2))); }
-        [[nodiscard]] vec3fa zyy() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 1, 2))); }
-        [[nodiscard]] vec3fa zyz() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 1, 2))); }
-        [[nodiscard]] vec3fa zzx() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 2, 2))); }
-        [[nodiscard]] vec3fa zzy() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 2, 2))); }
-        [[nodiscard]] vec3fa zzz() const noexcept { return vec3fa(_mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 2, 2))); }
-#endif
+        [[nodiscard]] vec3fa xxx() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 0, 0, 0)>(m128)); }
+        [[nodiscard]] vec3fa xxy() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 1, 0, 0)>(m128)); }
+        [[nodiscard]] vec3fa xxz() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 2, 0, 0)>(m128)); }
+        [[nodiscard]] vec3fa xyx() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 0, 1, 0)>(m128)); }
+        [[nodiscard]] vec3fa xyy() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 1, 1, 0)>(m128)); }
+        [[nodiscard]] vec3fa xyz() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 2, 1, 0)>(m128)); }
+        [[nodiscard]] vec3fa xzx() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 0, 2, 0)>(m128)); }
+        [[nodiscard]] vec3fa xzy() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 1, 2, 0)>(m128)); }
+        [[nodiscard]] vec3fa xzz() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 2, 2, 0)>(m128)); }
+        [[nodiscard]] vec3fa yxx() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 0, 0, 1)>(m128)); }
+        [[nodiscard]] vec3fa yxy() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 1, 0, 1)>(m128)); }
+        [[nodiscard]] vec3fa yxz() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 2, 0, 1)>(m128)); }
+        [[nodiscard]] vec3fa yyx() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 0, 1, 1)>(m128)); }
+        [[nodiscard]] vec3fa yyy() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 1, 1, 1)>(m128)); }
+        [[nodiscard]] vec3fa yyz() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 2, 1, 1)>(m128)); }
+        [[nodiscard]] vec3fa yzx() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 0, 2, 1)>(m128)); }
+        [[nodiscard]] vec3fa yzy() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 1, 2, 1)>(m128)); }
+        [[nodiscard]] vec3fa yzz() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 2, 2, 1)>(m128)); }
+        [[nodiscard]] vec3fa zxx() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 0, 0, 2)>(m128)); }
+        [[nodiscard]] vec3fa zxy() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 1, 0, 2)>(m128)); }
+        [[nodiscard]] vec3fa zxz() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 2, 0, 2)>(m128)); }
+        [[nodiscard]] vec3fa zyx() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 0, 1, 2)>(m128)); }
+        [[nodiscard]] vec3fa zyy() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 1, 1, 2)>(m128)); }
+        [[nodiscard]] vec3fa zyz() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 2, 1, 2)>(m128)); }
+        [[nodiscard]] vec3fa zzx() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 0, 2, 2)>(m128)); }
+        [[nodiscard]] vec3fa zzy() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 1, 2, 2)>(m128)); }
+        [[nodiscard]] vec3fa zzz() const noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, 2, 2, 2)>(m128)); }
     };
 
     ////////////////////////////////////////////////////////////////
     // Shuffle.
     ////////////////////////////////////////////////////////////////
 
-#ifdef __AVX__
     template<int32_t i0, int32_t i1, int32_t i2>
-    [[nodiscard]] vec3fa shuffle(const vec3fa& v) noexcept { return vec3fa(_mm_permute_ps(v, _MM_SHUFFLE(0, i2, i1, i0))); }
-#endif
+    [[nodiscard]] vec3fa shuffle(const vec3fa& v) noexcept { return vec3fa(detail::permute<_MM_SHUFFLE(0, i2, i1, i0)>(v)); }
 
     ////////////////////////////////////////////////////////////////
     // Arithmetic operators.
@@ -44,6 +44,8 @@ namespace math
 
         [[nodiscard]] vec3ia() noexcept : m128(_mm_set1_epi32(0)) {}
 
+        [[nodiscard]] explicit vec3ia(uninit_t) noexcept {}
+
         [[nodiscard]] explicit vec3ia(const int32_t v) noexcept : m128(_mm_set1_epi32(v)) {}
 
         [[nodiscard]] vec3ia(const int32_t x, const int32_t y, const int32_t z) noexcept : m128(_mm_setr_epi32(x, y, z, 0)) {}
@@ -54,7 +56,7 @@ namespace math
 
         [[nodiscard]] explicit vec3ia(const __m128 m128) noexcept : m128(_mm_castps_si128(m128)) {}
 
-        [[nodiscard]] vec3ia(const vec3ia& rhs) noexcept : m128(rhs.m128) {}
+        [[nodiscard]] vec3ia(const vec3ia& rhs) noexcept = default;
 
         [[nodiscard]] explicit vec3ia(const vec<int32_t, 3>& rhs) noexcept : m128(_mm_setr_epi32(rhs.x, rhs.y, rhs.z, 0)) {}
 
@@ -62,7 +64,7 @@ namespace math
         // Assignment operators.
         ////////////////////////////////////////////////////////////////
 
-        vec3ia& operator=(const vec3ia& rhs) noexcept { m128 = rhs.m128; return *this; }
+        vec3ia& operator=(const vec3ia& rhs) noexcept = default;
 
         vec3ia& operator=(const vec4ia& rhs) noexcept { m128 = rhs.m128; return *this; }
 
@@ -114,45 +116,41 @@ namespace math
         // Swizzling.
         ////////////////////////////////////////////////////////////////
 
-#ifdef __AVX__
-        [[nodiscard]] vec3ia xxx() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 0, 0))); }
-        [[nodiscard]] vec3ia xxy() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 0, 0))); }
-        [[nodiscard]] vec3ia xxz() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 0, 0))); }
-        [[nodiscard]] vec3ia xyx() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 1, 0))); }
-        [[nodiscard]] vec3ia xyy() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 1, 0))); }
-        [[nodiscard]] vec3ia xyz() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 1, 0))); }
-        [[nodiscard]] vec3ia xzx() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 2, 0))); }
-        [[nodiscard]] vec3ia xzy() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 2, 0))); }
-        [[nodiscard]] vec3ia xzz() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 2, 0))); }
-        [[nodiscard]] vec3ia yxx() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 0, 1))); }
-        [[nodiscard]] vec3ia yxy() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 0, 1))); }
-        [[nodiscard]] vec3ia yxz() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 0, 1))); }
-        [[nodiscard]] vec3ia yyx() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 1, 1))); }
-        [[nodiscard]] vec3ia yyy() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 1, 1))); }
-        [[nodiscard]] vec3ia yyz() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 1, 1))); }
-        [[nodiscard]] vec3ia yzx() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 2, 1))); }
-        [[nodiscard]] vec3ia yzy() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 2, 1))); }
-        [[nodiscard]] vec3ia yzz() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 2, 1))); }
-        [[nodiscard]] vec3ia zxx() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 0, 2))); }
-        [[nodiscard]] vec3ia zxy() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 0, 2))); }
-        [[nodiscard]] vec3ia zxz() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 0, 2))); }
-        [[nodiscard]] vec3ia zyx() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 1, 2))); }
-        [[nodiscard]] vec3ia zyy() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 1, 2))); }
-        [[nodiscard]] vec3ia zyz() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 1, 2))); }
-        [[nodiscard]] vec3ia zzx() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 2, 2))); }
-        [[nodiscard]] vec3ia zzy() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 2, 2))); }
-        [[nodiscard]] vec3ia zzz() const noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 2, 2))); }
-#endif
+        [[nodiscard]] vec3ia xxx() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 0, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia xxy() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 1, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia xxz() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 2, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia xyx() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 0, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia xyy() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 1, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia xyz() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 2, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia xzx() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 0, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia xzy() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 1, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia xzz() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 2, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia yxx() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 0, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia yxy() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 1, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia yxz() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 2, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia yyx() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 0, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia yyy() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 1, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia yyz() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 2, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia yzx() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 0, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia yzy() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 1, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia yzz() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 2, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia zxx() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 0, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia zxy() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 1, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia zxz() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 2, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia zyx() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 0, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia zyy() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 1, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia zyz() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 2, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia zzx() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 0, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia zzy() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 1, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec3ia zzz() const noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, 2, 2, 2)>(_mm_castsi128_ps(m128))); }
     };
     
     ////////////////////////////////////////////////////////////////
     // Shuffle.
     ////////////////////////////////////////////////////////////////
 
-#ifdef __AVX__
     template<int32_t i0, int32_t i1, int32_t i2>
-    [[nodiscard]] vec3ia shuffle(const vec3ia& v) noexcept { return vec3ia(_mm_permute_ps(_mm_castsi128_ps(v), _MM_SHUFFLE(0, i2, i1, i0))); }
-#endif
+    [[nodiscard]] vec3ia shuffle(const vec3ia& v) noexcept { return vec3ia(detail::permute<_MM_SHUFFLE(0, i2, i1, i0)>(_mm_castsi128_ps(v))); }
 
     ////////////////////////////////////////////////////////////////
     // Arithmetic operators.
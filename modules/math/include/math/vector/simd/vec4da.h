@@ -0,0 +1,738 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <immintrin.h>
+#include <iostream>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/math_functions.h"
+#include "math/vector/simd/permute.h"
+#include "math/vector/vec4.h"
+#include "math/vector/simd/vec4dba.h"
+
+namespace math
+{
+#ifdef __AVX__
+    /**=================================================================================================
+     * Struct: vec4da
+     * =================================================================================================
+     * @struct  vec4da
+     *
+     * @brief   Four doubles in a single AVX register.
+    **/
+    struct alignas(32) vec4da
+    {
+        static constexpr size_t size = 4;
+        using element_type = double;
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4201)
+#endif
+        union
+        {
+            __m256d m256;
+            struct
+            {
+                double x, y, z, w;
+            };
+        };
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] vec4da() noexcept : m256(_mm256_setzero_pd()) {}
+
+        [[nodiscard]] explicit vec4da(uninit_t) noexcept {}
+
+        [[nodiscard]] explicit vec4da(const double v) noexcept : m256(_mm256_set1_pd(v)) {}
+
+        [[nodiscard]] vec4da(const double x, const double y, const double z, const double w) noexcept : m256(_mm256_setr_pd(x, y, z, w)) {}
+
+        [[nodiscard]] vec4da(const __m256d m256) noexcept : m256(m256) {}
+
+        [[nodiscard]] vec4da(const vec4da& rhs) noexcept = default;
+
+        [[nodiscard]] explicit vec4da(const vec<double, 4>& rhs) noexcept : m256(_mm256_loadu_pd(&rhs.x)) {}
+
+        ////////////////////////////////////////////////////////////////
+        // Assignment operators.
+        ////////////////////////////////////////////////////////////////
+
+        vec4da& operator=(const vec4da& rhs) noexcept = default;
+
+        vec4da& operator=(const double rhs) noexcept { m256 = _mm256_set1_pd(rhs); return *this; }
+
+        ////////////////////////////////////////////////////////////////
+        // Load/store.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] static vec4da load(const void* const ptr) { return vec4da(_mm256_load_pd(static_cast<const double*>(ptr))); }
+
+        [[nodiscard]] static vec4da loadu(const void* const ptr) { return vec4da(_mm256_loadu_pd(static_cast<const double*>(ptr))); }
+
+        static void store(void* ptr, const vec4da& v) { _mm256_store_pd(static_cast<double*>(ptr), v.m256); }
+
+        static void storeu(void* ptr, const vec4da& v) { _mm256_storeu_pd(static_cast<double*>(ptr), v.m256); }
+
+        /**
+         * @brief Load the lanes that are set in mask and zero the others. Memory of lanes that are not set is not accessed.
+         */
+        [[nodiscard]] static vec4da loadu(const void* const ptr, const vec4dba& mask) { return vec4da(_mm256_maskload_pd(static_cast<const double*>(ptr), mask)); }
+
+        /**
+         * @brief Load the first count elements, e.g. for the tail of a loop.
+         */
+        [[nodiscard]] static vec4da loadu(const void* const ptr, const size_t count) { return loadu(ptr, vec4dba::first(count)); }
+
+        /**
+         * @brief Store the lanes that are set in mask. Memory of lanes that are not set is not accessed.
+         */
+        static void storeu(void* ptr, const vec4da& v, const vec4dba& mask) { _mm256_maskstore_pd(static_cast<double*>(ptr), mask, v.m256); }
+
+        /**
+         * @brief Store the first count elements, e.g. for the tail of a loop.
+         */
+        static void storeu(void* ptr, const vec4da& v, const size_t count) { storeu(ptr, v, vec4dba::first(count)); }
+
+        ////////////////////////////////////////////////////////////////
+        // Defaulted constructors and operators.
+        ////////////////////////////////////////////////////////////////
+
+        ~vec4da() noexcept = default;
+
+        vec4da(vec4da&& rhs) noexcept = default;
+
+        vec4da& operator=(vec4da&& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Casting operators.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] operator const __m256d&() const noexcept { return m256; }
+
+        [[nodiscard]] operator __m256d&() noexcept { return m256; }
+
+        [[nodiscard]] explicit operator vec<double, 4>() const noexcept { vec<double, 4> v(uninit); _mm256_storeu_pd(&v.x, m256); return v; }
+
+        ////////////////////////////////////////////////////////////////
+        // Element access.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] const double& operator[](const size_t i) const { assert(i < 4); return (&x)[i]; }
+
+        [[nodiscard]] double& operator[](const size_t i) { assert(i < 4); return (&x)[i]; }
+
+        ////////////////////////////////////////////////////////////////
+        // Swizzling.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] vec4da xxx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 0, 0)>(m256)); }
+        [[nodiscard]] vec4da xxy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 0, 0)>(m256)); }
+        [[nodiscard]] vec4da xxz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 0, 0)>(m256)); }
+        [[nodiscard]] vec4da xyx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 1, 0)>(m256)); }
+        [[nodiscard]] vec4da xyy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 1, 0)>(m256)); }
+        [[nodiscard]] vec4da xyz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 1, 0)>(m256)); }
+        [[nodiscard]] vec4da xzx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 2, 0)>(m256)); }
+        [[nodiscard]] vec4da xzy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 2, 0)>(m256)); }
+        [[nodiscard]] vec4da xzz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 2, 0)>(m256)); }
+        [[nodiscard]] vec4da yxx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 0, 1)>(m256)); }
+        [[nodiscard]] vec4da yxy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 0, 1)>(m256)); }
+        [[nodiscard]] vec4da yxz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 0, 1)>(m256)); }
+        [[nodiscard]] vec4da yyx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 1, 1)>(m256)); }
+        [[nodiscard]] vec4da yyy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 1, 1)>(m256)); }
+        [[nodiscard]] vec4da yyz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 1, 1)>(m256)); }
+        [[nodiscard]] vec4da yzx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 2, 1)>(m256)); }
+        [[nodiscard]] vec4da yzy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 2, 1)>(m256)); }
+        [[nodiscard]] vec4da yzz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 2, 1)>(m256)); }
+        [[nodiscard]] vec4da zxx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 0, 2)>(m256)); }
+        [[nodiscard]] vec4da zxy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 0, 2)>(m256)); }
+        [[nodiscard]] vec4da zxz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 0, 2)>(m256)); }
+        [[nodiscard]] vec4da zyx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 1, 2)>(m256)); }
+        [[nodiscard]] vec4da zyy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 1, 2)>(m256)); }
+        [[nodiscard]] vec4da zyz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 1, 2)>(m256)); }
+        [[nodiscard]] vec4da zzx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 2, 2)>(m256)); }
+        [[nodiscard]] vec4da zzy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 2, 2)>(m256)); }
+        [[nodiscard]] vec4da zzz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 2, 2)>(m256)); }
+        [[nodiscard]] vec4da xxxx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 0, 0)>(m256)); }
+        [[nodiscard]] vec4da xxxy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 0, 0, 0)>(m256)); }
+        [[nodiscard]] vec4da xxxz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 0, 0, 0)>(m256)); }
+        [[nodiscard]] vec4da xxxw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 0, 0, 0)>(m256)); }
+        [[nodiscard]] vec4da xxyx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 0, 0)>(m256)); }
+        [[nodiscard]] vec4da xxyy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 1, 0, 0)>(m256)); }
+        [[nodiscard]] vec4da xxyz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 1, 0, 0)>(m256)); }
+        [[nodiscard]] vec4da xxyw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 1, 0, 0)>(m256)); }
+        [[nodiscard]] vec4da xxzx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 0, 0)>(m256)); }
+        [[nodiscard]] vec4da xxzy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 2, 0, 0)>(m256)); }
+        [[nodiscard]] vec4da xxzz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 2, 0, 0)>(m256)); }
+        [[nodiscard]] vec4da xxzw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 2, 0, 0)>(m256)); }
+        [[nodiscard]] vec4da xxwx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 3, 0, 0)>(m256)); }
+        [[nodiscard]] vec4da xxwy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 3, 0, 0)>(m256)); }
+        [[nodiscard]] vec4da xxwz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 3, 0, 0)>(m256)); }
+        [[nodiscard]] vec4da xxww() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 3, 0, 0)>(m256)); }
+        [[nodiscard]] vec4da xyxx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 1, 0)>(m256)); }
+        [[nodiscard]] vec4da xyxy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 0, 1, 0)>(m256)); }
+        [[nodiscard]] vec4da xyxz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 0, 1, 0)>(m256)); }
+        [[nodiscard]] vec4da xyxw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 0, 1, 0)>(m256)); }
+        [[nodiscard]] vec4da xyyx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 1, 0)>(m256)); }
+        [[nodiscard]] vec4da xyyy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 1, 1, 0)>(m256)); }
+        [[nodiscard]] vec4da xyyz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 1, 1, 0)>(m256)); }
+        [[nodiscard]] vec4da xyyw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 1, 1, 0)>(m256)); }
+        [[nodiscard]] vec4da xyzx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 1, 0)>(m256)); }
+        [[nodiscard]] vec4da xyzy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 2, 1, 0)>(m256)); }
+        [[nodiscard]] vec4da xyzz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 2, 1, 0)>(m256)); }
+        [[nodiscard]] vec4da xyzw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 2, 1, 0)>(m256)); }
+        [[nodiscard]] vec4da xywx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 3, 1, 0)>(m256)); }
+        [[nodiscard]] vec4da xywy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 3, 1, 0)>(m256)); }
+        [[nodiscard]] vec4da xywz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 3, 1, 0)>(m256)); }
+        [[nodiscard]] vec4da xyww() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 3, 1, 0)>(m256)); }
+        [[nodiscard]] vec4da xzxx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 2, 0)>(m256)); }
+        [[nodiscard]] vec4da xzxy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 0, 2, 0)>(m256)); }
+        [[nodiscard]] vec4da xzxz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 0, 2, 0)>(m256)); }
+        [[nodiscard]] vec4da xzxw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 0, 2, 0)>(m256)); }
+        [[nodiscard]] vec4da xzyx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 2, 0)>(m256)); }
+        [[nodiscard]] vec4da xzyy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 1, 2, 0)>(m256)); }
+        [[nodiscard]] vec4da xzyz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 1, 2, 0)>(m256)); }
+        [[nodiscard]] vec4da xzyw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 1, 2, 0)>(m256)); }
+        [[nodiscard]] vec4da xzzx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 2, 0)>(m256)); }
+        [[nodiscard]] vec4da xzzy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 2, 2, 0)>(m256)); }
+        [[nodiscard]] vec4da xzzz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 2, 2, 0)>(m256)); }
+        [[nodiscard]] vec4da xzzw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 2, 2, 0)>(m256)); }
+        [[nodiscard]] vec4da xzwx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 3, 2, 0)>(m256)); }
+        [[nodiscard]] vec4da xzwy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 3, 2, 0)>(m256)); }
+        [[nodiscard]] vec4da xzwz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 3, 2, 0)>(m256)); }
+        [[nodiscard]] vec4da xzww() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 3, 2, 0)>(m256)); }
+        [[nodiscard]] vec4da xwxx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 3, 0)>(m256)); }
+        [[nodiscard]] vec4da xwxy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 0, 3, 0)>(m256)); }
+        [[nodiscard]] vec4da xwxz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 0, 3, 0)>(m256)); }
+        [[nodiscard]] vec4da xwxw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 0, 3, 0)>(m256)); }
+        [[nodiscard]] vec4da xwyx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 3, 0)>(m256)); }
+        [[nodiscard]] vec4da xwyy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 1, 3, 0)>(m256)); }
+        [[nodiscard]] vec4da xwyz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 1, 3, 0)>(m256)); }
+        [[nodiscard]] vec4da xwyw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 1, 3, 0)>(m256)); }
+        [[nodiscard]] vec4da xwzx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 3, 0)>(m256)); }
+        [[nodiscard]] vec4da xwzy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 2, 3, 0)>(m256)); }
+        [[nodiscard]] vec4da xwzz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 2, 3, 0)>(m256)); }
+        [[nodiscard]] vec4da xwzw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 2, 3, 0)>(m256)); }
+        [[nodiscard]] vec4da xwwx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 3, 3, 0)>(m256)); }
+        [[nodiscard]] vec4da xwwy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 3, 3, 0)>(m256)); }
+        [[nodiscard]] vec4da xwwz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 3, 3, 0)>(m256)); }
+        [[nodiscard]] vec4da xwww() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 3, 3, 0)>(m256)); }
+        [[nodiscard]] vec4da yxxx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 0, 1)>(m256)); }
+        [[nodiscard]] vec4da yxxy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 0, 0, 1)>(m256)); }
+        [[nodiscard]] vec4da yxxz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 0, 0, 1)>(m256)); }
+        [[nodiscard]] vec4da yxxw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 0, 0, 1)>(m256)); }
+        [[nodiscard]] vec4da yxyx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 0, 1)>(m256)); }
+        [[nodiscard]] vec4da yxyy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 1, 0, 1)>(m256)); }
+        [[nodiscard]] vec4da yxyz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 1, 0, 1)>(m256)); }
+        [[nodiscard]] vec4da yxyw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 1, 0, 1)>(m256)); }
+        [[nodiscard]] vec4da yxzx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 0, 1)>(m256)); }
+        [[nodiscard]] vec4da yxzy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 2, 0, 1)>(m256)); }
+        [[nodiscard]] vec4da yxzz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 2, 0, 1)>(m256)); }
+        [[nodiscard]] vec4da yxzw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 2, 0, 1)>(m256)); }
+        [[nodiscard]] vec4da yxwx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 3, 0, 1)>(m256)); }
+        [[nodiscard]] vec4da yxwy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 3, 0, 1)>(m256)); }
+        [[nodiscard]] vec4da yxwz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 3, 0, 1)>(m256)); }
+        [[nodiscard]] vec4da yxww() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 3, 0, 1)>(m256)); }
+        [[nodiscard]] vec4da yyxx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 1, 1)>(m256)); }
+        [[nodiscard]] vec4da yyxy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 0, 1, 1)>(m256)); }
+        [[nodiscard]] vec4da yyxz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 0, 1, 1)>(m256)); }
+        [[nodiscard]] vec4da yyxw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 0, 1, 1)>(m256)); }
+        [[nodiscard]] vec4da yyyx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 1, 1)>(m256)); }
+        [[nodiscard]] vec4da yyyy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 1, 1, 1)>(m256)); }
+        [[nodiscard]] vec4da yyyz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 1, 1, 1)>(m256)); }
+        [[nodiscard]] vec4da yyyw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 1, 1, 1)>(m256)); }
+        [[nodiscard]] vec4da yyzx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 1, 1)>(m256)); }
+        [[nodiscard]] vec4da yyzy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 2, 1, 1)>(m256)); }
+        [[nodiscard]] vec4da yyzz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 2, 1, 1)>(m256)); }
+        [[nodiscard]] vec4da yyzw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 2, 1, 1)>(m256)); }
+        [[nodiscard]] vec4da yywx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 3, 1, 1)>(m256)); }
+        [[nodiscard]] vec4da yywy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 3, 1, 1)>(m256)); }
+        [[nodiscard]] vec4da yywz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 3, 1, 1)>(m256)); }
+        [[nodiscard]] vec4da yyww() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 3, 1, 1)>(m256)); }
+        [[nodiscard]] vec4da yzxx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 2, 1)>(m256)); }
+        [[nodiscard]] vec4da yzxy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 0, 2, 1)>(m256)); }
+        [[nodiscard]] vec4da yzxz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 0, 2, 1)>(m256)); }
+        [[nodiscard]] vec4da yzxw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 0, 2, 1)>(m256)); }
+        [[nodiscard]] vec4da yzyx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 2, 1)>(m256)); }
+        [[nodiscard]] vec4da yzyy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 1, 2, 1)>(m256)); }
+        [[nodiscard]] vec4da yzyz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 1, 2, 1)>(m256)); }
+        [[nodiscard]] vec4da yzyw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 1, 2, 1)>(m256)); }
+        [[nodiscard]] vec4da yzzx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 2, 1)>(m256)); }
+        [[nodiscard]] vec4da yzzy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 2, 2, 1)>(m256)); }
+        [[nodiscard]] vec4da yzzz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 2, 2, 1)>(m256)); }
+        [[nodiscard]] vec4da yzzw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 2, 2, 1)>(m256)); }
+        [[nodiscard]] vec4da yzwx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 3, 2, 1)>(m256)); }
+        [[nodiscard]] vec4da yzwy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 3, 2, 1)>(m256)); }
+        [[nodiscard]] vec4da yzwz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 3, 2, 1)>(m256)); }
+        [[nodiscard]] vec4da yzww() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 3, 2, 1)>(m256)); }
+        [[nodiscard]] vec4da ywxx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 3, 1)>(m256)); }
+        [[nodiscard]] vec4da ywxy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 0, 3, 1)>(m256)); }
+        [[nodiscard]] vec4da ywxz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 0, 3, 1)>(m256)); }
+        [[nodiscard]] vec4da ywxw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 0, 3, 1)>(m256)); }
+        [[nodiscard]] vec4da ywyx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 3, 1)>(m256)); }
+        [[nodiscard]] vec4da ywyy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 1, 3, 1)>(m256)); }
+        [[nodiscard]] vec4da ywyz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 1, 3, 1)>(m256)); }
+        [[nodiscard]] vec4da ywyw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 1, 3, 1)>(m256)); }
+        [[nodiscard]] vec4da ywzx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 3, 1)>(m256)); }
+        [[nodiscard]] vec4da ywzy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 2, 3, 1)>(m256)); }
+        [[nodiscard]] vec4da ywzz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 2, 3, 1)>(m256)); }
+        [[nodiscard]] vec4da ywzw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 2, 3, 1)>(m256)); }
+        [[nodiscard]] vec4da ywwx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 3, 3, 1)>(m256)); }
+        [[nodiscard]] vec4da ywwy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 3, 3, 1)>(m256)); }
+        [[nodiscard]] vec4da ywwz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 3, 3, 1)>(m256)); }
+        [[nodiscard]] vec4da ywww() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 3, 3, 1)>(m256)); }
+        [[nodiscard]] vec4da zxxx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 0, 2)>(m256)); }
+        [[nodiscard]] vec4da zxxy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 0, 0, 2)>(m256)); }
+        [[nodiscard]] vec4da zxxz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 0, 0, 2)>(m256)); }
+        [[nodiscard]] vec4da zxxw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 0, 0, 2)>(m256)); }
+        [[nodiscard]] vec4da zxyx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 0, 2)>(m256)); }
+        [[nodiscard]] vec4da zxyy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 1, 0, 2)>(m256)); }
+        [[nodiscard]] vec4da zxyz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 1, 0, 2)>(m256)); }
+        [[nodiscard]] vec4da zxyw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 1, 0, 2)>(m256)); }
+        [[nodiscard]] vec4da zxzx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 0, 2)>(m256)); }
+        [[nodiscard]] vec4da zxzy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 2, 0, 2)>(m256)); }
+        [[nodiscard]] vec4da zxzz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 2, 0, 2)>(m256)); }
+        [[nodiscard]] vec4da zxzw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 2, 0, 2)>(m256)); }
+        [[nodiscard]] vec4da zxwx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 3, 0, 2)>(m256)); }
+        [[nodiscard]] vec4da zxwy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 3, 0, 2)>(m256)); }
+        [[nodiscard]] vec4da zxwz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 3, 0, 2)>(m256)); }
+        [[nodiscard]] vec4da zxww() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 3, 0, 2)>(m256)); }
+        [[nodiscard]] vec4da zyxx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 1, 2)>(m256)); }
+        [[nodiscard]] vec4da zyxy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 0, 1, 2)>(m256)); }
+        [[nodiscard]] vec4da zyxz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 0, 1, 2)>(m256)); }
+        [[nodiscard]] vec4da zyxw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 0, 1, 2)>(m256)); }
+        [[nodiscard]] vec4da zyyx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 1, 2)>(m256)); }
+        [[nodiscard]] vec4da zyyy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 1, 1, 2)>(m256)); }
+        [[nodiscard]] vec4da zyyz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 1, 1, 2)>(m256)); }
+        [[nodiscard]] vec4da zyyw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 1, 1, 2)>(m256)); }
+        [[nodiscard]] vec4da zyzx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 1, 2)>(m256)); }
+        [[nodiscard]] vec4da zyzy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 2, 1, 2)>(m256)); }
+        [[nodiscard]] vec4da zyzz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 2, 1, 2)>(m256)); }
+        [[nodiscard]] vec4da zyzw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 2, 1, 2)>(m256)); }
+        [[nodiscard]] vec4da zywx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 3, 1, 2)>(m256)); }
+        [[nodiscard]] vec4da zywy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 3, 1, 2)>(m256)); }
+        [[nodiscard]] vec4da zywz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 3, 1, 2)>(m256)); }
+        [[nodiscard]] vec4da zyww() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 3, 1, 2)>(m256)); }
+        [[nodiscard]] vec4da zzxx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 2, 2)>(m256)); }
+        [[nodiscard]] vec4da zzxy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 0, 2, 2)>(m256)); }
+        [[nodiscard]] vec4da zzxz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 0, 2, 2)>(m256)); }
+        [[nodiscard]] vec4da zzxw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 0, 2, 2)>(m256)); }
+        [[nodiscard]] vec4da zzyx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 2, 2)>(m256)); }
+        [[nodiscard]] vec4da zzyy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 1, 2, 2)>(m256)); }
+        [[nodiscard]] vec4da zzyz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 1, 2, 2)>(m256)); }
+        [[nodiscard]] vec4da zzyw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 1, 2, 2)>(m256)); }
+        [[nodiscard]] vec4da zzzx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 2, 2)>(m256)); }
+        [[nodiscard]] vec4da zzzy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 2, 2, 2)>(m256)); }
+        [[nodiscard]] vec4da zzzz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 2, 2, 2)>(m256)); }
+        [[nodiscard]] vec4da zzzw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 2, 2, 2)>(m256)); }
+        [[nodiscard]] vec4da zzwx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 3, 2, 2)>(m256)); }
+        [[nodiscard]] vec4da zzwy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 3, 2, 2)>(m256)); }
+        [[nodiscard]] vec4da zzwz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 3, 2, 2)>(m256)); }
+        [[nodiscard]] vec4da zzww() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 3, 2, 2)>(m256)); }
+        [[nodiscard]] vec4da zwxx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 3, 2)>(m256)); }
+        [[nodiscard]] vec4da zwxy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 0, 3, 2)>(m256)); }
+        [[nodiscard]] vec4da zwxz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 0, 3, 2)>(m256)); }
+        [[nodiscard]] vec4da zwxw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 0, 3, 2)>(m256)); }
+        [[nodiscard]] vec4da zwyx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 3, 2)>(m256)); }
+        [[nodiscard]] vec4da zwyy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 1, 3, 2)>(m256)); }
+        [[nodiscard]] vec4da zwyz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 1, 3, 2)>(m256)); }
+        [[nodiscard]] vec4da zwyw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 1, 3, 2)>(m256)); }
+        [[nodiscard]] vec4da zwzx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 3, 2)>(m256)); }
+        [[nodiscard]] vec4da zwzy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 2, 3, 2)>(m256)); }
+        [[nodiscard]] vec4da zwzz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 2, 3, 2)>(m256)); }
+        [[nodiscard]] vec4da zwzw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 2, 3, 2)>(m256)); }
+        [[nodiscard]] vec4da zwwx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 3, 3, 2)>(m256)); }
+        [[nodiscard]] vec4da zwwy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 3, 3, 2)>(m256)); }
+        [[nodiscard]] vec4da zwwz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 3, 3, 2)>(m256)); }
+        [[nodiscard]] vec4da zwww() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 3, 3, 2)>(m256)); }
+        [[nodiscard]] vec4da wxxx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 0, 3)>(m256)); }
+        [[nodiscard]] vec4da wxxy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 0, 0, 3)>(m256)); }
+        [[nodiscard]] vec4da wxxz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 0, 0, 3)>(m256)); }
+        [[nodiscard]] vec4da wxxw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 0, 0, 3)>(m256)); }
+        [[nodiscard]] vec4da wxyx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 0, 3)>(m256)); }
+        [[nodiscard]] vec4da wxyy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 1, 0, 3)>(m256)); }
+        [[nodiscard]] vec4da wxyz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 1, 0, 3)>(m256)); }
+        [[nodiscard]] vec4da wxyw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 1, 0, 3)>(m256)); }
+        [[nodiscard]] vec4da wxzx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 0, 3)>(m256)); }
+        [[nodiscard]] vec4da wxzy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 2, 0, 3)>(m256)); }
+        [[nodiscard]] vec4da wxzz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 2, 0, 3)>(m256)); }
+        [[nodiscard]] vec4da wxzw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 2, 0, 3)>(m256)); }
+        [[nodiscard]] vec4da wxwx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 3, 0, 3)>(m256)); }
+        [[nodiscard]] vec4da wxwy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 3, 0, 3)>(m256)); }
+        [[nodiscard]] vec4da wxwz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 3, 0, 3)>(m256)); }
+        [[nodiscard]] vec4da wxww() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 3, 0, 3)>(m256)); }
+        [[nodiscard]] vec4da wyxx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 1, 3)>(m256)); }
+        [[nodiscard]] vec4da wyxy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 0, 1, 3)>(m256)); }
+        [[nodiscard]] vec4da wyxz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 0, 1, 3)>(m256)); }
+        [[nodiscard]] vec4da wyxw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 0, 1, 3)>(m256)); }
+        [[nodiscard]] vec4da wyyx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 1, 3)>(m256)); }
+        [[nodiscard]] vec4da wyyy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 1, 1, 3)>(m256)); }
+        [[nodiscard]] vec4da wyyz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 1, 1, 3)>(m256)); }
+        [[nodiscard]] vec4da wyyw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 1, 1, 3)>(m256)); }
+        [[nodiscard]] vec4da wyzx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 1, 3)>(m256)); }
+        [[nodiscard]] vec4da wyzy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 2, 1, 3)>(m256)); }
+        [[nodiscard]] vec4da wyzz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 2, 1, 3)>(m256)); }
+        [[nodiscard]] vec4da wyzw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 2, 1, 3)>(m256)); }
+        [[nodiscard]] vec4da wywx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 3, 1, 3)>(m256)); }
+        [[nodiscard]] vec4da wywy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 3, 1, 3)>(m256)); }
+        [[nodiscard]] vec4da wywz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 3, 1, 3)>(m256)); }
+        [[nodiscard]] vec4da wyww() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 3, 1, 3)>(m256)); }
+        [[nodiscard]] vec4da wzxx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 2, 3)>(m256)); }
+        [[nodiscard]] vec4da wzxy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 0, 2, 3)>(m256)); }
+        [[nodiscard]] vec4da wzxz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 0, 2, 3)>(m256)); }
+        [[nodiscard]] vec4da wzxw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 0, 2, 3)>(m256)); }
+        [[nodiscard]] vec4da wzyx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 2, 3)>(m256)); }
+        [[nodiscard]] vec4da wzyy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 1, 2, 3)>(m256)); }
+        [[nodiscard]] vec4da wzyz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 1, 2, 3)>(m256)); }
+        [[nodiscard]] vec4da wzyw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 1, 2, 3)>(m256)); }
+        [[nodiscard]] vec4da wzzx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 2, 3)>(m256)); }
+        [[nodiscard]] vec4da wzzy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 2, 2, 3)>(m256)); }
+        [[nodiscard]] vec4da wzzz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 2, 2, 3)>(m256)); }
+        [[nodiscard]] vec4da wzzw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 2, 2, 3)>(m256)); }
+        [[nodiscard]] vec4da wzwx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 3, 2, 3)>(m256)); }
+        [[nodiscard]] vec4da wzwy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 3, 2, 3)>(m256)); }
+        [[nodiscard]] vec4da wzwz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 3, 2, 3)>(m256)); }
+        [[nodiscard]] vec4da wzww() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 3, 2, 3)>(m256)); }
+        [[nodiscard]] vec4da wwxx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 0, 3, 3)>(m256)); }
+        [[nodiscard]] vec4da wwxy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 0, 3, 3)>(m256)); }
+        [[nodiscard]] vec4da wwxz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 0, 3, 3)>(m256)); }
+        [[nodiscard]] vec4da wwxw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 0, 3, 3)>(m256)); }
+        [[nodiscard]] vec4da wwyx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 1, 3, 3)>(m256)); }
+        [[nodiscard]] vec4da wwyy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 1, 3, 3)>(m256)); }
+        [[nodiscard]] vec4da wwyz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 1, 3, 3)>(m256)); }
+        [[nodiscard]] vec4da wwyw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 1, 3, 3)>(m256)); }
+        [[nodiscard]] vec4da wwzx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 2, 3, 3)>(m256)); }
+        [[nodiscard]] vec4da wwzy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 2, 3, 3)>(m256)); }
+        [[nodiscard]] vec4da wwzz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 2, 3, 3)>(m256)); }
+        [[nodiscard]] vec4da wwzw() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 2, 3, 3)>(m256)); }
+        [[nodiscard]] vec4da wwwx() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(0, 3, 3, 3)>(m256)); }
+        [[nodiscard]] vec4da wwwy() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(1, 3, 3, 3)>(m256)); }
+        [[nodiscard]] vec4da wwwz() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(2, 3, 3, 3)>(m256)); }
+        [[nodiscard]] vec4da wwww() const noexcept { return vec4da(detail::permute<_MM_SHUFFLE(3, 3, 3, 3)>(m256)); }
+    };
+
+    ////////////////////////////////////////////////////////////////
+    // Shuffle.
+    ////////////////////////////////////////////////////////////////
+
+    template<int32_t i0, int32_t i1, int32_t i2, int32_t i3>
+    [[nodiscard]] vec4da shuffle(const vec4da& v) noexcept { return vec4da(detail::permute<_MM_SHUFFLE(i3, i2, i1, i0)>(v.m256)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Arithmetic operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec4da operator+(const vec4da& lhs, const vec4da& rhs) noexcept { return vec4da(_mm256_add_pd(lhs, rhs)); }
+
+    [[nodiscard]] inline vec4da operator+(const vec4da& lhs, const double rhs) noexcept { return lhs + vec4da(rhs); }
+
+    [[nodiscard]] inline vec4da operator+(const double lhs, const vec4da& rhs) noexcept { return vec4da(lhs) + rhs; }
+
+    [[nodiscard]] inline vec4da operator-(const vec4da& lhs, const vec4da& rhs) noexcept { return vec4da(_mm256_sub_pd(lhs, rhs)); }
+
+    [[nodiscard]] inline vec4da operator-(const vec4da& lhs, const double rhs) noexcept { return lhs - vec4da(rhs); }
+
+    [[nodiscard]] inline vec4da operator-(const double lhs, const vec4da& rhs) noexcept { return vec4da(lhs) - rhs; }
+
+    [[nodiscard]] inline vec4da operator-(const vec4da& lhs) noexcept { return vec4da(_mm256_xor_pd(lhs, _mm256_set1_pd(-0.0))); }
+
+    [[nodiscard]] inline vec4da operator*(const vec4da& lhs, const vec4da& rhs) noexcept { return vec4da(_mm256_mul_pd(lhs, rhs)); }
+
+    [[nodiscard]] inline vec4da operator*(const vec4da& lhs, const double rhs) noexcept { return lhs * vec4da(rhs); }
+
+    [[nodiscard]] inline vec4da operator*(const double lhs, const vec4da& rhs) noexcept { return vec4da(lhs) * rhs; }
+
+    [[nodiscard]] inline vec4da operator/(const vec4da& lhs, const vec4da& rhs) noexcept { return vec4da(_mm256_div_pd(lhs, rhs)); }
+
+    [[nodiscard]] inline vec4da operator/(const vec4da& lhs, const double rhs) noexcept { return lhs / vec4da(rhs); }
+
+    [[nodiscard]] inline vec4da operator/(const double lhs, const vec4da& rhs) noexcept { return vec4da(lhs) / rhs; }
+
+    inline vec4da& operator+=(vec4da& lhs, const vec4da& rhs) noexcept { return lhs = lhs + rhs; }
+
+    inline vec4da& operator+=(vec4da& lhs, const double rhs) noexcept { return lhs = lhs + rhs; }
+
+    inline vec4da& operator-=(vec4da& lhs, const vec4da& rhs) noexcept { return lhs = lhs - rhs; }
+
+    inline vec4da& operator-=(vec4da& lhs, const double rhs) noexcept { return lhs = lhs - rhs; }
+
+    inline vec4da& operator*=(vec4da& lhs, const vec4da& rhs) noexcept { return lhs = lhs * rhs; }
+
+    inline vec4da& operator*=(vec4da& lhs, const double rhs) noexcept { return lhs = lhs * rhs; }
+
+    inline vec4da& operator/=(vec4da& lhs, const vec4da& rhs) noexcept { return lhs = lhs / rhs; }
+
+    inline vec4da& operator/=(vec4da& lhs, const double rhs) noexcept { return lhs = lhs / rhs; }
+
+    ////////////////////////////////////////////////////////////////
+    // Comparison operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline bool operator==(const vec4da& lhs, const vec4da& rhs) noexcept { return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ)) & 0xf) == 0xf; }
+
+    [[nodiscard]] inline bool operator!=(const vec4da& lhs, const vec4da& rhs) noexcept { return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ)) & 0xf) != 0xf; }
+
+    ////////////////////////////////////////////////////////////////
+    // Per-element comparisons.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec4dba cmpeq(const vec4da& lhs, const vec4da& rhs) noexcept { return vec4dba(_mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ)); }
+
+    [[nodiscard]] inline vec4dba cmpeq(const vec4da& lhs, const double rhs) noexcept { return cmpeq(lhs, vec4da(rhs)); }
+
+    [[nodiscard]] inline vec4dba cmpeq(const double lhs, const vec4da& rhs) noexcept { return cmpeq(vec4da(lhs), rhs); }
+
+    [[nodiscard]] inline vec4dba cmpneq(const vec4da& lhs, const vec4da& rhs) noexcept { return vec4dba(_mm256_cmp_pd(lhs, rhs, _CMP_NEQ_UQ)); }
+
+    [[nodiscard]] inline vec4dba cmpneq(const vec4da& lhs, const double rhs) noexcept { return cmpneq(lhs, vec4da(rhs)); }
+
+    [[nodiscard]] inline vec4dba cmpneq(const double lhs, const vec4da& rhs) noexcept { return cmpneq(vec4da(lhs), rhs); }
+
+    [[nodiscard]] inline vec4dba cmplt(const vec4da& lhs, const vec4da& rhs) noexcept { return vec4dba(_mm256_cmp_pd(lhs, rhs, _CMP_LT_OS)); }
+
+    [[nodiscard]] inline vec4dba cmplt(const vec4da& lhs, const double rhs) noexcept { return cmplt(lhs, vec4da(rhs)); }
+
+    [[nodiscard]] inline vec4dba cmplt(const double lhs, const vec4da& rhs) noexcept { return cmplt(vec4da(lhs), rhs); }
+
+    [[nodiscard]] inline vec4dba cmpgt(const vec4da& lhs, const vec4da& rhs) noexcept { return vec4dba(_mm256_cmp_pd(lhs, rhs, _CMP_GT_OS)); }
+
+    [[nodiscard]] inline vec4dba cmpgt(const vec4da& lhs, const double rhs) noexcept { return cmpgt(lhs, vec4da(rhs)); }
+
+    [[nodiscard]] inline vec4dba cmpgt(const double lhs, const vec4da& rhs) noexcept { return cmpgt(vec4da(lhs), rhs); }
+
+    [[nodiscard]] inline vec4dba cmple(const vec4da& lhs, const vec4da& rhs) noexcept { return vec4dba(_mm256_cmp_pd(lhs, rhs, _CMP_LE_OS)); }
+
+    [[nodiscard]] inline vec4dba cmple(const vec4da& lhs, const double rhs) noexcept { return cmple(lhs, vec4da(rhs)); }
+
+    [[nodiscard]] inline vec4dba cmple(const double lhs, const vec4da& rhs) noexcept { return cmple(vec4da(lhs), rhs); }
+
+    [[nodiscard]] inline vec4dba cmpge(const vec4da& lhs, const vec4da& rhs) noexcept { return vec4dba(_mm256_cmp_pd(lhs, rhs, _CMP_GE_OS)); }
+
+    [[nodiscard]] inline vec4dba cmpge(const vec4da& lhs, const double rhs) noexcept { return cmpge(lhs, vec4da(rhs)); }
+
+    [[nodiscard]] inline vec4dba cmpge(const double lhs, const vec4da& rhs) noexcept { return cmpge(vec4da(lhs), rhs); }
+
+    ////////////////////////////////////////////////////////////////
+    // Min/max, abs and clamp.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec4da min(const vec4da& lhs, const vec4da& rhs) noexcept { return vec4da(_mm256_min_pd(lhs, rhs)); }
+
+    [[nodiscard]] inline vec4da min(const vec4da& lhs, const double rhs) noexcept { return min(lhs, vec4da(rhs)); }
+
+    [[nodiscard]] inline vec4da min(const double lhs, const vec4da& rhs) noexcept { return min(vec4da(lhs), rhs); }
+
+    [[nodiscard]] inline vec4da max(const vec4da& lhs, const vec4da& rhs) noexcept { return vec4da(_mm256_max_pd(lhs, rhs)); }
+
+    [[nodiscard]] inline vec4da max(const vec4da& lhs, const double rhs) noexcept { return max(lhs, vec4da(rhs)); }
+
+    [[nodiscard]] inline vec4da max(const double lhs, const vec4da& rhs) noexcept { return max(vec4da(lhs), rhs); }
+
+    [[nodiscard]] inline vec4da clamp(const vec4da& a, const vec4da& min, const vec4da& max) noexcept { return math::max(min, math::min(a, max)); }
+
+    [[nodiscard]] inline vec4da clamp(const vec4da& a, const vec4da& min, const double max) noexcept { return clamp(a, min, vec4da(max)); }
+
+    [[nodiscard]] inline vec4da clamp(const vec4da& a, const double min, const vec4da& max) noexcept { return clamp(a, vec4da(min), max); }
+
+    [[nodiscard]] inline vec4da clamp(const vec4da& a, const double min, const double max) noexcept { return clamp(a, vec4da(min), vec4da(max)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Reduction.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline double reduce_add(const vec4da& lhs) noexcept
+    {
+        const __m128d low = _mm256_castpd256_pd128(lhs);
+        const __m128d high = _mm256_extractf128_pd(lhs, 1);
+        const __m128d r1 = _mm_add_pd(low, high);
+        const __m128d r2 = _mm_add_sd(r1, _mm_unpackhi_pd(r1, r1));
+        return _mm_cvtsd_f64(r2);
+    }
+
+    [[nodiscard]] inline double reduce_mul(const vec4da& lhs) noexcept
+    {
+        const __m128d low = _mm256_castpd256_pd128(lhs);
+        const __m128d high = _mm256_extractf128_pd(lhs, 1);
+        const __m128d r1 = _mm_mul_pd(low, high);
+        const __m128d r2 = _mm_mul_sd(r1, _mm_unpackhi_pd(r1, r1));
+        return _mm_cvtsd_f64(r2);
+    }
+
+    [[nodiscard]] inline double reduce_min(const vec4da& lhs) noexcept
+    {
+        const __m128d low = _mm256_castpd256_pd128(lhs);
+        const __m128d high = _mm256_extractf128_pd(lhs, 1);
+        const __m128d r1 = _mm_min_pd(low, high);
+        const __m128d r2 = _mm_min_sd(r1, _mm_unpackhi_pd(r1, r1));
+        return _mm_cvtsd_f64(r2);
+    }
+
+    [[nodiscard]] inline double reduce_max(const vec4da& lhs) noexcept
+    {
+        const __m128d low = _mm256_castpd256_pd128(lhs);
+        const __m128d high = _mm256_extractf128_pd(lhs, 1);
+        const __m128d r1 = _mm_max_pd(low, high);
+        const __m128d r2 = _mm_max_sd(r1, _mm_unpackhi_pd(r1, r1));
+        return _mm_cvtsd_f64(r2);
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Multiply and add.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec4da madd(const vec4da& a, const vec4da& b, const vec4da& c) noexcept
+    {
+#ifdef __FMA__
+        return vec4da(_mm256_fmadd_pd(a, b, c));
+#else
+        return a * b + c;
+#endif
+    }
+
+    [[nodiscard]] inline vec4da nmadd(const vec4da& a, const vec4da& b, const vec4da& c) noexcept
+    {
+#ifdef __FMA__
+        return vec4da(_mm256_fnmadd_pd(a, b, c));
+#else
+        return -a * b + c;
+#endif
+    }
+
+    [[nodiscard]] inline vec4da msub(const vec4da& a, const vec4da& b, const vec4da& c) noexcept
+    {
+#ifdef __FMA__
+        return vec4da(_mm256_fmsub_pd(a, b, c));
+#else
+        return a * b - c;
+#endif
+    }
+
+    [[nodiscard]] inline vec4da nmsub(const vec4da& a, const vec4da& b, const vec4da& c) noexcept
+    {
+#ifdef __FMA__
+        return vec4da(_mm256_fnmsub_pd(a, b, c));
+#else
+        return -a * b - c;
+#endif
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Dot product etc.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline double dot(const vec4da& lhs, const vec4da& rhs) noexcept { return reduce_add(lhs * rhs); }
+
+    [[nodiscard]] inline double length(const vec4da& lhs) noexcept { return sqrt(dot(lhs, lhs)); }
+
+    [[nodiscard]] inline double sqr_length(const vec4da& lhs) noexcept { return dot(lhs, lhs); }
+
+    [[nodiscard]] inline double rcp_length(const vec4da& lhs) noexcept { return rsqrt(dot(lhs, lhs)); }
+
+    [[nodiscard]] inline vec4da normalize(const vec4da& lhs) noexcept { return lhs * rcp_length(lhs); }
+
+    [[nodiscard]] inline vec4da normalize(const vec4da& lhs, double& length) noexcept { length = math::length(lhs); return lhs / length; }
+
+    [[nodiscard]] inline double distance(const vec4da& lhs, const vec4da& rhs) noexcept { return length(lhs - rhs); }
+
+    [[nodiscard]] inline vec4da lerp(const vec4da& a, const vec4da& b, const vec4da& t) noexcept { return madd(t, b - a, a); }
+
+    [[nodiscard]] inline vec4da lerp(const vec4da& a, const vec4da& b, const double t) noexcept { return madd(vec4da(t), b - a, a); }
+
+    ////////////////////////////////////////////////////////////////
+    // Trigonometry.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec4da acos(const vec4da& lhs) noexcept { return vec4da(acos(lhs.x), acos(lhs.y), acos(lhs.z), acos(lhs.w)); }
+
+    [[nodiscard]] inline vec4da asin(const vec4da& lhs) noexcept { return vec4da(asin(lhs.x), asin(lhs.y), asin(lhs.z), asin(lhs.w)); }
+
+    [[nodiscard]] inline vec4da atan(const vec4da& lhs) noexcept { return vec4da(atan(lhs.x), atan(lhs.y), atan(lhs.z), atan(lhs.w)); }
+
+    [[nodiscard]] inline vec4da atan2(const vec4da& lhs, const vec4da& rhs) noexcept { return vec4da(atan2(lhs.x, rhs.x), atan2(lhs.y, rhs.y), atan2(lhs.z, rhs.z), atan2(lhs.w, rhs.w)); }
+
+    [[nodiscard]] inline vec4da cos(const vec4da& lhs) noexcept { return vec4da(cos(lhs.x), cos(lhs.y), cos(lhs.z), cos(lhs.w)); }
+
+    [[nodiscard]] inline vec4da cosh(const vec4da& lhs) noexcept { return vec4da(cosh(lhs.x), cosh(lhs.y), cosh(lhs.z), cosh(lhs.w)); }
+
+    [[nodiscard]] inline vec4da sin(const vec4da& lhs) noexcept { return vec4da(sin(lhs.x), sin(lhs.y), sin(lhs.z), sin(lhs.w)); }
+
+    [[nodiscard]] inline vec4da sinh(const vec4da& lhs) noexcept { return vec4da(sinh(lhs.x), sinh(lhs.y), sinh(lhs.z), sinh(lhs.w)); }
+
+    [[nodiscard]] inline vec4da tan(const vec4da& lhs) noexcept { return vec4da(tan(lhs.x), tan(lhs.y), tan(lhs.z), tan(lhs.w)); }
+
+    [[nodiscard]] inline vec4da tanh(const vec4da& lhs) noexcept { return vec4da(tanh(lhs.x), tanh(lhs.y), tanh(lhs.z), tanh(lhs.w)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Exponential / Logarithmic.
+    ////////////////////////////////////////////////////////////////
+
+    // There are no double precision polynomial approximations (yet), so these are evaluated per element.
+
+    [[nodiscard]] inline vec4da exp(const vec4da& lhs) noexcept { return vec4da(exp(lhs.x), exp(lhs.y), exp(lhs.z), exp(lhs.w)); }
+
+    [[nodiscard]] inline vec4da exp2(const vec4da& lhs) noexcept { return vec4da(exp2(lhs.x), exp2(lhs.y), exp2(lhs.z), exp2(lhs.w)); }
+
+    [[nodiscard]] inline vec4da log(const vec4da& lhs) noexcept { return vec4da(log(lhs.x), log(lhs.y), log(lhs.z), log(lhs.w)); }
+
+    [[nodiscard]] inline vec4da log2(const vec4da& lhs) noexcept { return vec4da(log2(lhs.x), log2(lhs.y), log2(lhs.z), log2(lhs.w)); }
+
+    [[nodiscard]] inline vec4da log10(const vec4da& lhs) noexcept { return vec4da(log10(lhs.x), log10(lhs.y), log10(lhs.z), log10(lhs.w)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Power.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec4da pow(const vec4da& lhs, const vec4da& rhs) noexcept { return vec4da(pow(lhs.x, rhs.x), pow(lhs.y, rhs.y), pow(lhs.z, rhs.z), pow(lhs.w, rhs.w)); }
+
+    [[nodiscard]] inline vec4da pow(const vec4da& lhs, const double rhs) noexcept { return pow(lhs, vec4da(rhs)); }
+
+    [[nodiscard]] inline vec4da pow(const double lhs, const vec4da& rhs) noexcept { return pow(vec4da(lhs), rhs); }
+
+    [[nodiscard]] inline vec4da sqr(const vec4da& lhs) noexcept { return lhs * lhs; }
+
+    [[nodiscard]] inline vec4da sqrt(const vec4da& lhs) noexcept { return vec4da(_mm256_sqrt_pd(lhs)); }
+
+    // There is no approximate reciprocal square root for doubles before AVX-512, so this is exact.
+    [[nodiscard]] inline vec4da rsqrt(const vec4da& lhs) noexcept { return vec4da(_mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(lhs))); }
+
+    ////////////////////////////////////////////////////////////////
+    // Rounding, abs, etc.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec4da abs(const vec4da& lhs) noexcept { return vec4da(_mm256_andnot_pd(_mm256_set1_pd(-0.0), lhs)); }
+
+    [[nodiscard]] inline vec4da round(const vec4da& lhs) noexcept { return vec4da(_mm256_round_pd(lhs, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)); }
+
+    [[nodiscard]] inline vec4da ceil(const vec4da& lhs) noexcept { return vec4da(_mm256_round_pd(lhs, _MM_FROUND_CEIL)); }
+
+    [[nodiscard]] inline vec4da floor(const vec4da& lhs) noexcept { return vec4da(_mm256_round_pd(lhs, _MM_FROUND_FLOOR)); }
+
+    [[nodiscard]] inline vec4da frac(const vec4da& lhs) noexcept { return vec4da(_mm256_sub_pd(lhs, _mm256_round_pd(lhs, _MM_FROUND_TRUNC))); }
+
+    [[nodiscard]] inline vec4da trunc(const vec4da& lhs) noexcept { return vec4da(_mm256_round_pd(lhs, _MM_FROUND_TRUNC)); }
+
+    ////////////////////////////////////////////////////////////////
+    // Select.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec4da select(const vec4da& t, const vec4da& f, const vec4dba& b) noexcept { return vec4da(_mm256_blendv_pd(f, t, _mm256_castsi256_pd(b))); }
+
+    ////////////////////////////////////////////////////////////////
+    // Output.
+    ////////////////////////////////////////////////////////////////
+
+    inline std::ostream& operator<<(std::ostream& out, const vec4da& v) { return out << "(" << v.x << ", " << v.y << ", " << v.z << ", " << v.w << ")"; }
+#endif
+}
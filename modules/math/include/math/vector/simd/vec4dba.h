@@ -0,0 +1,177 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cassert>
+#include <immintrin.h>
+#include <iostream>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/vector/vec4.h"
+
+namespace math
+{
+#ifdef __AVX__
+    /**=================================================================================================
+     * Struct: vec4dba
+     * =================================================================================================
+     * @struct  vec4dba
+     *
+     * @brief   Mask of 4 booleans with 64-bit lanes, as returned by the comparisons of vec4da.
+    **/
+    struct alignas(32) vec4dba
+    {
+        static constexpr size_t size = 4;
+        using element_type = int64_t;
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4201)
+#endif
+        union
+        {
+            __m256i m256;
+            struct
+            {
+                int64_t x, y, z, w;
+            };
+        };
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] vec4dba() noexcept : m256(_mm256_setzero_si256()) {}
+
+        [[nodiscard]] explicit vec4dba(uninit_t) noexcept {}
+
+        [[nodiscard]] explicit vec4dba(const bool b) noexcept : m256(_mm256_set1_epi64x(0 - static_cast<int64_t>(b))) {}
+
+        [[nodiscard]] vec4dba(const bool x, const bool y, const bool z, const bool w) noexcept : m256(_mm256_setr_epi64x(0 - static_cast<int64_t>(x), 0 - static_cast<int64_t>(y), 0 - static_cast<int64_t>(z), 0 - static_cast<int64_t>(w))) {}
+
+        [[nodiscard]] vec4dba(const __m256i m256) noexcept : m256(m256) {}
+
+        [[nodiscard]] explicit vec4dba(const __m256d m256) noexcept : m256(_mm256_castpd_si256(m256)) {}
+
+        [[nodiscard]] vec4dba(const vec4dba& rhs) noexcept = default;
+
+        [[nodiscard]] explicit vec4dba(const vec<bool, 4>& rhs) noexcept : vec4dba(rhs.x, rhs.y, rhs.z, rhs.w) {}
+
+        ////////////////////////////////////////////////////////////////
+        // Assignment operators.
+        ////////////////////////////////////////////////////////////////
+
+        vec4dba& operator=(const vec4dba& rhs) noexcept = default;
+
+        vec4dba& operator=(const bool rhs) noexcept { m256 = _mm256_set1_epi64x(0 - static_cast<int64_t>(rhs)); return *this; }
+
+        ////////////////////////////////////////////////////////////////
+        // Defaulted constructors and operators.
+        ////////////////////////////////////////////////////////////////
+
+        ~vec4dba() noexcept = default;
+
+        vec4dba(vec4dba&& rhs) noexcept = default;
+
+        vec4dba& operator=(vec4dba&& rhs) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // Casting operators.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] operator const __m256i&() const noexcept { return m256; }
+
+        [[nodiscard]] operator __m256i&() noexcept { return m256; }
+
+        [[nodiscard]] explicit operator __m256d() const noexcept { return _mm256_castsi256_pd(m256); }
+
+        [[nodiscard]] explicit operator vec<bool, 4>() const noexcept { return vec<bool, 4>((*this)[0], (*this)[1], (*this)[2], (*this)[3]); }
+
+        ////////////////////////////////////////////////////////////////
+        // Element access.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] bool operator[](const size_t i) const { assert(i < 4); return static_cast<bool>((_mm256_movemask_pd(_mm256_castsi256_pd(m256)) >> i) & 0x1); }
+
+        ////////////////////////////////////////////////////////////////
+        // Construct special values.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * @brief Mask with the first n lanes set, for loads and stores of loop tails.
+         */
+        [[nodiscard]] static vec4dba first(const size_t n) noexcept
+        {
+            assert(n <= 4);
+            static constexpr int64_t table[8] = {-1, -1, -1, -1, 0, 0, 0, 0};
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(table + 4 - n));
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////
+    // Bitwise operators.
+    ////////////////////////////////////////////////////////////////
+
+    // Implemented with the floating point instructions, so that they are also available without AVX2.
+
+    [[nodiscard]] inline vec4dba operator!(const vec4dba& lhs) noexcept { return vec4dba(_mm256_xor_pd(_mm256_castsi256_pd(lhs), _mm256_castsi256_pd(_mm256_set1_epi32(-1)))); }
+
+    [[nodiscard]] inline vec4dba operator&(const vec4dba& lhs, const vec4dba& rhs) noexcept { return vec4dba(_mm256_and_pd(_mm256_castsi256_pd(lhs), _mm256_castsi256_pd(rhs))); }
+
+    [[nodiscard]] inline vec4dba operator|(const vec4dba& lhs, const vec4dba& rhs) noexcept { return vec4dba(_mm256_or_pd(_mm256_castsi256_pd(lhs), _mm256_castsi256_pd(rhs))); }
+
+    [[nodiscard]] inline vec4dba operator^(const vec4dba& lhs, const vec4dba& rhs) noexcept { return vec4dba(_mm256_xor_pd(_mm256_castsi256_pd(lhs), _mm256_castsi256_pd(rhs))); }
+
+    inline vec4dba& operator&=(vec4dba& lhs, const vec4dba& rhs) noexcept { return lhs = lhs & rhs; }
+
+    inline vec4dba& operator|=(vec4dba& lhs, const vec4dba& rhs) noexcept { return lhs = lhs | rhs; }
+
+    inline vec4dba& operator^=(vec4dba& lhs, const vec4dba& rhs) noexcept { return lhs = lhs ^ rhs; }
+
+    ////////////////////////////////////////////////////////////////
+    // Comparison operators.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline bool operator==(const vec4dba& lhs, const vec4dba& rhs) noexcept { return (_mm256_movemask_pd(_mm256_castsi256_pd(lhs ^ rhs)) & 0xf) == 0x0; }
+
+    [[nodiscard]] inline bool operator!=(const vec4dba& lhs, const vec4dba& rhs) noexcept { return (_mm256_movemask_pd(_mm256_castsi256_pd(lhs ^ rhs)) & 0xf) != 0x0; }
+
+    ////////////////////////////////////////////////////////////////
+    // Per-element comparisons.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec4dba cmpeq(const vec4dba& lhs, const vec4dba& rhs) noexcept { return !(lhs ^ rhs); }
+
+    [[nodiscard]] inline vec4dba cmpneq(const vec4dba& lhs, const vec4dba& rhs) noexcept { return lhs ^ rhs; }
+
+    ////////////////////////////////////////////////////////////////
+    // Select.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline vec4dba select(const vec4dba& t, const vec4dba& f, const vec4dba& b) noexcept { return vec4dba(_mm256_blendv_pd(_mm256_castsi256_pd(f), _mm256_castsi256_pd(t), _mm256_castsi256_pd(b))); }
+
+    ////////////////////////////////////////////////////////////////
+    // Boolean vector reduction.
+    ////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] inline bool all(const vec4dba& lhs) noexcept { return (_mm256_movemask_pd(_mm256_castsi256_pd(lhs)) & 0xf) == 0xf; }
+
+    [[nodiscard]] inline bool any(const vec4dba& lhs) noexcept { return (_mm256_movemask_pd(_mm256_castsi256_pd(lhs)) & 0xf) != 0x0; }
+
+    [[nodiscard]] inline bool none(const vec4dba& lhs) noexcept { return (_mm256_movemask_pd(_mm256_castsi256_pd(lhs)) & 0xf) == 0x0; }
+
+    ////////////////////////////////////////////////////////////////
+    // Output.
+    ////////////////////////////////////////////////////////////////
+
+    inline std::ostream& operator<<(std::ostream& out, const vec4dba& v) { return out << "(" << v[0] << ", " << v[1] << ", " << v[2] << ", " << v[3] << ")"; }
+#endif
+}
@@ -12,7 +12,9 @@
 // Current target includes.
 ////////////////////////////////////////////////////////////////
 
+#include "math/foldpoly.h"
 #include "math/vector/simd/vec4ba.h"
+#include "math/vector/simd/vec4ia.h"
 
 namespace math
 {
@@ -43,6 +45,8 @@ namespace math
 
         [[nodiscard]] vec4fa() noexcept : m128(_mm_set1_ps(0)) {}
 
+        [[nodiscard]] explicit vec4fa(uninit_t) noexcept {}
+
         [[nodiscard]] explicit vec4fa(const float v) noexcept : m128(_mm_set1_ps(v)) {}
 
         [[nodiscard]] vec4fa(const float x, const float y, const float z, const float w) noexcept : m128(_mm_setr_ps(x, y, z, w)) {}
@@ -51,15 +55,15 @@ namespace math
 
         [[nodiscard]] explicit vec4fa(const __m128i m128) noexcept : m128(_mm_castsi128_ps(m128)) {}
 
-        [[nodiscard]] vec4fa(const vec4fa& rhs) noexcept : m128(rhs.m128) {}
+        [[nodiscard]] vec4fa(const vec4fa& rhs) noexcept = default;
 
-        [[nodiscard]] explicit vec4fa(const vec<float, 4>& rhs) noexcept : m128(_mm_setr_ps(rhs.x, rhs.y, rhs.z, rhs.w)) {}
+        [[nodiscard]] explicit vec4fa(const vec<float, 4>& rhs) noexcept : m128(_mm_loadu_ps(&rhs.x)) {}
 
         ////////////////////////////////////////////////////////////////
         // Assignment operators.
         ////////////////////////////////////////////////////////////////
 
-        vec4fa& operator=(const vec4fa& rhs) noexcept { m128 = rhs.m128; return *this; }
+        vec4fa& operator=(const vec4fa& rhs) noexcept = default;
 
         vec4fa& operator=(const float rhs) noexcept { m128 = _mm_set1_ps(rhs); return *this; }
 
@@ -75,6 +79,78 @@ namespace math
 
         static void storeu(void* ptr, const vec4fa & v) { _mm_storeu_ps(static_cast<float*>(ptr), v.m128); }
 
+        /**
+         * @brief Load the lanes that are set in mask and zero the others. Memory of lanes that are not set is not accessed.
+         */
+        [[nodiscard]] static vec4fa loadu(const void* const ptr, const vec4ba& mask)
+        {
+#ifdef __AVX__
+            return _mm_maskload_ps(static_cast<const float*>(ptr), mask);
+#else
+            const float* src = static_cast<const float*>(ptr);
+            vec4fa v;
+            for (size_t i = 0; i < 4; i++)
+                if (mask[i]) v[i] = src[i];
+            return v;
+#endif
+        }
+
+        /**
+         * @brief Load the first count elements, e.g. for the tail of a loop.
+         */
+        [[nodiscard]] static vec4fa loadu(const void* const ptr, const size_t count) { return loadu(ptr, vec4ba::first(count)); }
+
+        /**
+         * @brief Store the lanes that are set in mask. Memory of lanes that are not set is not accessed.
+         */
+        static void storeu(void* ptr, const vec4fa& v, const vec4ba& mask)
+        {
+#ifdef __AVX__
+            _mm_maskstore_ps(static_cast<float*>(ptr), mask, v.m128);
+#else
+            float* dst = static_cast<float*>(ptr);
+            for (size_t i = 0; i < 4; i++)
+                if (mask[i]) dst[i] = v[i];
+#endif
+        }
+
+        /**
+         * @brief Store the first count elements, e.g. for the tail of a loop.
+         */
+        static void storeu(void* ptr, const vec4fa& v, const size_t count) { storeu(ptr, v, vec4ba::first(count)); }
+
+        /**
+         * @brief Load base[indices[i]] into lane i.
+         */
+        [[nodiscard]] static vec4fa gather(const float* base, const vec4ia& indices)
+        {
+#ifdef __AVX2__
+            return _mm_i32gather_ps(base, indices, 4);
+#else
+            vec4fa v(uninit);
+            for (size_t i = 0; i < 4; i++) v[i] = base[indices[i]];
+            return v;
+#endif
+        }
+
+        /**
+         * @brief Store lane i to base[indices[i]]. Lanes are written in order, so for duplicate indices the highest lane wins.
+         */
+        static void scatter(float* base, const vec4ia& indices, const vec4fa& v)
+        {
+#if defined(__AVX512F__) && defined(__AVX512VL__)
+            _mm_i32scatter_ps(base, indices, v, 4);
+#else
+            for (size_t i = 0; i < 4; i++) base[indices[i]] = v[i];
+#endif
+        }
+
+        /**
+         * @brief Non-temporal store to aligned memory, bypassing the caches. Use for large outputs that are not read again soon.
+         * Other threads are only guaranteed to see the data after an _mm_sfence().
+         */
+        static void stream(void* ptr, const vec4fa& v) { _mm_stream_ps(static_cast<float*>(ptr), v.m128); }
+
         ////////////////////////////////////////////////////////////////
         // Defaulted constructors and operators.
         ////////////////////////////////////////////////////////////////
@@ -95,7 +171,7 @@ namespace math
 
         [[nodiscard]] explicit operator __m128i () const noexcept { return _mm_castps_si128(m128); }
 
-        [[nodiscard]] explicit operator vec<float, 4>() const noexcept { return vec<float, 4>(x, y, z, w); }
+        [[nodiscard]] explicit operator vec<float, 4>() const noexcept { vec<float, 4> v(uninit); _mm_storeu_ps(&v.x, m128); return v; }
 
         ////////////////////////////////////////////////////////////////
         // Element access.
@@ -109,302 +185,298 @@ namespace math
         // Swizzling.
         ////////////////////////////////////////////////////////////////
 
-#ifdef __AVX__
-        [[nodiscard]] vec4fa xxx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 0, 0)); }
-        [[nodiscard]] vec4fa xxy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 0, 0)); }
-        [[nodiscard]] vec4fa xxz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 0, 0)); }
-        [[nodiscard]] vec4fa xyx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 1, 0)); }
-        [[nodiscard]] vec4fa xyy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 1, 0)); }
-        [[nodiscard]] vec4fa xyz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 1, 0)); }
-        [[nodiscard]] vec4fa xzx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 2, 0)); }
-        [[nodiscard]] vec4fa xzy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 2, 0)); }
-        [[nodiscard]] vec4fa xzz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 2, 0)); }
-        [[nodiscard]] vec4fa yxx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 0, 1)); }
-        [[nodiscard]] vec4fa yxy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 0, 1)); }
-        [[nodiscard]] vec4fa yxz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 0, 1)); }
-        [[nodiscard]] vec4fa yyx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 1, 1)); }
-        [[nodiscard]] vec4fa yyy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 1, 1)); }
-        [[nodiscard]] vec4fa yyz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 1, 1)); }
-        [[nodiscard]] vec4fa yzx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 2, 1)); }
-        [[nodiscard]] vec4fa yzy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 2, 1)); }
-        [[nodiscard]] vec4fa yzz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 2, 1)); }
-        [[nodiscard]] vec4fa zxx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 0, 2)); }
-        [[nodiscard]] vec4fa zxy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 0, 2)); }
-        [[nodiscard]] vec4fa zxz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 0, 2)); }
-        [[nodiscard]] vec4fa zyx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 1, 2)); }
-        [[nodiscard]] vec4fa zyy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 1, 2)); }
-        [[nodiscard]] vec4fa zyz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 1, 2)); }
-        [[nodiscard]] vec4fa zzx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 2, 2)); }
-        [[nodiscard]] vec4fa zzy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 2, 2)); }
-        [[nodiscard]] vec4fa zzz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 2, 2)); }
-
-        [[nodiscard]] vec4fa xxxx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 0, 0)); }
-        [[nodiscard]] vec4fa xxxy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 0, 0, 0)); }
-        [[nodiscard]] vec4fa xxxz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 0, 0, 0)); }
-        [[nodiscard]] vec4fa xxxw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 0, 0, 0)); }
-        [[nodiscard]] vec4fa xxyx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 0, 0)); }
-        [[nodiscard]] vec4fa xxyy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 1, 0, 0)); }
-        [[nodiscard]] vec4fa xxyz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 1, 0, 0)); }
-        [[nodiscard]] vec4fa xxyw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 1, 0, 0)); }
-        [[nodiscard]] vec4fa xxzx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 0, 0)); }
-        [[nodiscard]] vec4fa xxzy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 2, 0, 0)); }
-        [[nodiscard]] vec4fa xxzz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 2, 0, 0)); }
-        [[nodiscard]] vec4fa xxzw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 2, 0, 0)); }
-        [[nodiscard]] vec4fa xxwx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 3, 0, 0)); }
-        [[nodiscard]] vec4fa xxwy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 3, 0, 0)); }
-        [[nodiscard]] vec4fa xxwz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 3, 0, 0)); }
-        [[nodiscard]] vec4fa xxww() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 3, 0, 0)); }
-        [[nodiscard]] vec4fa xyxx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 1, 0)); }
-        [[nodiscard]] vec4fa xyxy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 0, 1, 0)); }
-        [[nodiscard]] vec4fa xyxz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 0, 1, 0)); }
-        [[nodiscard]] vec4fa xyxw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 0, 1, 0)); }
-        [[nodiscard]] vec4fa xyyx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 1, 0)); }
-        [[nodiscard]] vec4fa xyyy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 1, 1, 0)); }
-        [[nodiscard]] vec4fa xyyz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 1, 1, 0)); }
-        [[nodiscard]] vec4fa xyyw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 1, 1, 0)); }
-        [[nodiscard]] vec4fa xyzx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 1, 0)); }
-        [[nodiscard]] vec4fa xyzy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 2, 1, 0)); }
-        [[nodiscard]] vec4fa xyzz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 2, 1, 0)); }
-        [[nodiscard]] vec4fa xyzw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 2, 1, 0)); }
-        [[nodiscard]] vec4fa xywx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 3, 1, 0)); }
-        [[nodiscard]] vec4fa xywy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 3, 1, 0)); }
-        [[nodiscard]] vec4fa xywz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 3, 1, 0)); }
-        [[nodiscard]] vec4fa xyww() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 3, 1, 0)); }
-        [[nodiscard]] vec4fa xzxx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 2, 0)); }
-        [[nodiscard]] vec4fa xzxy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 0, 2, 0)); }
-        [[nodiscard]] vec4fa xzxz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 0, 2, 0)); }
-        [[nodiscard]] vec4fa xzxw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 0, 2, 0)); }
-        [[nodiscard]] vec4fa xzyx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 2, 0)); }
-        [[nodiscard]] vec4fa xzyy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 1, 2, 0)); }
-        [[nodiscard]] vec4fa xzyz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 1, 2, 0)); }
-        [[nodiscard]] vec4fa xzyw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 1, 2, 0)); }
-        [[nodiscard]] vec4fa xzzx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 2, 0)); }
-        [[nodiscard]] vec4fa xzzy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 2, 2, 0)); }
-        [[nodiscard]] vec4fa xzzz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 2, 2, 0)); }
-        [[nodiscard]] vec4fa xzzw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 2, 2, 0)); }
-        [[nodiscard]] vec4fa xzwx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 3, 2, 0)); }
-        [[nodiscard]] vec4fa xzwy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 3, 2, 0)); }
-        [[nodiscard]] vec4fa xzwz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 3, 2, 0)); }
-        [[nodiscard]] vec4fa xzww() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 3, 2, 0)); }
-        [[nodiscard]] vec4fa xwxx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 3, 0)); }
-        [[nodiscard]] vec4fa xwxy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 0, 3, 0)); }
-        [[nodiscard]] vec4fa xwxz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 0, 3, 0)); }
-        [[nodiscard]] vec4fa xwxw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 0, 3, 0)); }
-        [[nodiscard]] vec4fa xwyx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 3, 0)); }
-        [[nodiscard]] vec4fa xwyy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 1, 3, 0)); }
-        [[nodiscard]] vec4fa xwyz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 1, 3, 0)); }
-        [[nodiscard]] vec4fa xwyw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 1, 3, 0)); }
-        [[nodiscard]] vec4fa xwzx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 3, 0)); }
-        [[nodiscard]] vec4fa xwzy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 2, 3, 0)); }
-        [[nodiscard]] vec4fa xwzz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 2, 3, 0)); }
-        [[nodiscard]] vec4fa xwzw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 2, 3, 0)); }
-        [[nodiscard]] vec4fa xwwx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 3, 3, 0)); }
-        [[nodiscard]] vec4fa xwwy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 3, 3, 0)); }
-        [[nodiscard]] vec4fa xwwz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 3, 3, 0)); }
-        [[nodiscard]] vec4fa xwww() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 3, 3, 0)); }
-        [[nodiscard]] vec4fa yxxx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 0, 1)); }
-        [[nodiscard]] vec4fa yxxy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 0, 0, 1)); }
-        [[nodiscard]] vec4fa yxxz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 0, 0, 1)); }
-        [[nodiscard]] vec4fa yxxw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 0, 0, 1)); }
-        [[nodiscard]] vec4fa yxyx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 0, 1)); }
-        [[nodiscard]] vec4fa yxyy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 1, 0, 1)); }
-        [[nodiscard]] vec4fa yxyz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 1, 0, 1)); }
-        [[nodiscard]] vec4fa yxyw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 1, 0, 1)); }
-        [[nodiscard]] vec4fa yxzx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 0, 1)); }
-        [[nodiscard]] vec4fa yxzy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 2, 0, 1)); }
-        [[nodiscard]] vec4fa yxzz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 2, 0, 1)); }
-        [[nodiscard]] vec4fa yxzw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 2, 0, 1)); }
-        [[nodiscard]] vec4fa yxwx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 3, 0, 1)); }
-        [[nodiscard]] vec4fa yxwy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 3, 0, 1)); }
-        [[nodiscard]] vec4fa yxwz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 3, 0, 1)); }
-        [[nodiscard]] vec4fa yxww() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 3, 0, 1)); }
-        [[nodiscard]] vec4fa yyxx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 1, 1)); }
-        [[nodiscard]] vec4fa yyxy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 0, 1, 1)); }
-        [[nodiscard]] vec4fa yyxz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 0, 1, 1)); }
-        [[nodiscard]] vec4fa yyxw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 0, 1, 1)); }
-        [[nodiscard]] vec4fa yyyx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 1, 1)); }
-        [[nodiscard]] vec4fa yyyy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 1, 1, 1)); }
-        [[nodiscard]] vec4fa yyyz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 1, 1, 1)); }
-        [[nodiscard]] vec4fa yyyw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 1, 1, 1)); }
-        [[nodiscard]] vec4fa yyzx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 1, 1)); }
-        [[nodiscard]] vec4fa yyzy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 2, 1, 1)); }
-        [[nodiscard]] vec4fa yyzz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 2, 1, 1)); }
-        [[nodiscard]] vec4fa yyzw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 2, 1, 1)); }
-        [[nodiscard]] vec4fa yywx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 3, 1, 1)); }
-        [[nodiscard]] vec4fa yywy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 3, 1, 1)); }
-        [[nodiscard]] vec4fa yywz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 3, 1, 1)); }
-        [[nodiscard]] vec4fa yyww() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 3, 1, 1)); }
-        [[nodiscard]] vec4fa yzxx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 2, 1)); }
-        [[nodiscard]] vec4fa yzxy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 0, 2, 1)); }
-        [[nodiscard]] vec4fa yzxz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 0, 2, 1)); }
-        [[nodiscard]] vec4fa yzxw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 0, 2, 1)); }
-        [[nodiscard]] vec4fa yzyx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 2, 1)); }
-        [[nodiscard]] vec4fa yzyy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 1, 2, 1)); }
-        [[nodiscard]] vec4fa yzyz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 1, 2, 1)); }
-        [[nodiscard]] vec4fa yzyw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 1, 2, 1)); }
-        [[nodiscard]] vec4fa yzzx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 2, 1)); }
-        [[nodiscard]] vec4fa yzzy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 2, 2, 1)); }
-        [[nodiscard]] vec4fa yzzz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 2, 2, 1)); }
-        [[nodiscard]] vec4fa yzzw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 2, 2, 1)); }
-        [[nodiscard]] vec4fa yzwx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 3, 2, 1)); }
-        [[nodiscard]] vec4fa yzwy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 3, 2, 1)); }
-        [[nodiscard]] vec4fa yzwz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 3, 2, 1)); }
-        [[nodiscard]] vec4fa yzww() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 3, 2, 1)); }
-        [[nodiscard]] vec4fa ywxx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 3, 1)); }
-        [[nodiscard]] vec4fa ywxy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 0, 3, 1)); }
-        [[nodiscard]] vec4fa ywxz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 0, 3, 1)); }
-        [[nodiscard]] vec4fa ywxw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 0, 3, 1)); }
-        [[nodiscard]] vec4fa ywyx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 3, 1)); }
-        [[nodiscard]] vec4fa ywyy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 1, 3, 1)); }
-        [[nodiscard]] vec4fa ywyz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 1, 3, 1)); }
-        [[nodiscard]] vec4fa ywyw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 1, 3, 1)); }
-        [[nodiscard]] vec4fa ywzx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 3, 1)); }
-        [[nodiscard]] vec4fa ywzy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 2, 3, 1)); }
-        [[nodiscard]] vec4fa ywzz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 2, 3, 1)); }
-        [[nodiscard]] vec4fa ywzw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 2, 3, 1)); }
-        [[nodiscard]] vec4fa ywwx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 3, 3, 1)); }
-        [[nodiscard]] vec4fa ywwy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 3, 3, 1)); }
-        [[nodiscard]] vec4fa ywwz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 3, 3, 1)); }
-        [[nodiscard]] vec4fa ywww() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 3, 3, 1)); }
-        [[nodiscard]] vec4fa zxxx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 0, 2)); }
-        [[nodiscard]] vec4fa zxxy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 0, 0, 2)); }
-        [[nodiscard]] vec4fa zxxz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 0, 0, 2)); }
-        [[nodiscard]] vec4fa zxxw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 0, 0, 2)); }
-        [[nodiscard]] vec4fa zxyx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 0, 2)); }
-        [[nodiscard]] vec4fa zxyy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 1, 0, 2)); }
-        [[nodiscard]] vec4fa zxyz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 1, 0, 2)); }
-        [[nodiscard]] vec4fa zxyw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 1, 0, 2)); }
-        [[nodiscard]] vec4fa zxzx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 0, 2)); }
-        [[nodiscard]] vec4fa zxzy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 2, 0, 2)); }
-        [[nodiscard]] vec4fa zxzz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 2, 0, 2)); }
-        [[nodiscard]] vec4fa zxzw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 2, 0, 2)); }
-        [[nodiscard]] vec4fa zxwx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 3, 0, 2)); }
-        [[nodiscard]] vec4fa zxwy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 3, 0, 2)); }
-        [[nodiscard]] vec4fa zxwz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 3, 0, 2)); }
-        [[nodiscard]] vec4fa zxww() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 3, 0, 2)); }
-        [[nodiscard]] vec4fa zyxx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 1, 2)); }
-        [[nodiscard]] vec4fa zyxy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 0, 1, 2)); }
-        [[nodiscard]] vec4fa zyxz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 0, 1, 2)); }
-        [[nodiscard]] vec4fa zyxw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 0, 1, 2)); }
-        [[nodiscard]] vec4fa zyyx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 1, 2)); }
-        [[nodiscard]] vec4fa zyyy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 1, 1, 2)); }
-        [[nodiscard]] vec4fa zyyz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 1, 1, 2)); }
-        [[nodiscard]] vec4fa zyyw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 1, 1, 2)); }
-        [[nodiscard]] vec4fa zyzx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 1, 2)); }
-        [[nodiscard]] vec4fa zyzy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 2, 1, 2)); }
-        [[nodiscard]] vec4fa zyzz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 2, 1, 2)); }
-        [[nodiscard]] vec4fa zyzw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 2, 1, 2)); }
-        [[nodiscard]] vec4fa zywx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 3, 1, 2)); }
-        [[nodiscard]] vec4fa zywy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 3, 1, 2)); }
-        [[nodiscard]] vec4fa zywz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 3, 1, 2)); }
-        [[nodiscard]] vec4fa zyww() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 3, 1, 2)); }
-        [[nodiscard]] vec4fa zzxx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 2, 2)); }
-        [[nodiscard]] vec4fa zzxy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 0, 2, 2)); }
-        [[nodiscard]] vec4fa zzxz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 0, 2, 2)); }
-        [[nodiscard]] vec4fa zzxw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 0, 2, 2)); }
-        [[nodiscard]] vec4fa zzyx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 2, 2)); }
-        [[nodiscard]] vec4fa zzyy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 1, 2, 2)); }
-        [[nodiscard]] vec4fa zzyz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 1, 2, 2)); }
-        [[nodiscard]] vec4fa zzyw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 1, 2, 2)); }
-        [[nodiscard]] vec4fa zzzx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 2, 2)); }
-        [[nodiscard]] vec4fa zzzy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 2, 2, 2)); }
-        [[nodiscard]] vec4fa zzzz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 2, 2, 2)); }
-        [[nodiscard]] vec4fa zzzw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 2, 2, 2)); }
-        [[nodiscard]] vec4fa zzwx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 3, 2, 2)); }
-        [[nodiscard]] vec4fa zzwy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 3, 2, 2)); }
-        [[nodiscard]] vec4fa zzwz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 3, 2, 2)); }
-        [[nodiscard]] vec4fa zzww() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 3, 2, 2)); }
-        [[nodiscard]] vec4fa zwxx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 3, 2)); }
-        [[nodiscard]] vec4fa zwxy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 0, 3, 2)); }
-        [[nodiscard]] vec4fa zwxz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 0, 3, 2)); }
-        [[nodiscard]] vec4fa zwxw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 0, 3, 2)); }
-        [[nodiscard]] vec4fa zwyx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 3, 2)); }
-        [[nodiscard]] vec4fa zwyy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 1, 3, 2)); }
-        [[nodiscard]] vec4fa zwyz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 1, 3, 2)); }
-        [[nodiscard]] vec4fa zwyw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 1, 3, 2)); }
-        [[nodiscard]] vec4fa zwzx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 3, 2)); }
-        [[nodiscard]] vec4fa zwzy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 2, 3, 2)); }
-        [[nodiscard]] vec4fa zwzz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 2, 3, 2)); }
-        [[nodiscard]] vec4fa zwzw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 2, 3, 2)); }
-        [[nodiscard]] vec4fa zwwx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 3, 3, 2)); }
-        [[nodiscard]] vec4fa zwwy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 3, 3, 2)); }
-        [[nodiscard]] vec4fa zwwz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 3, 3, 2)); }
-        [[nodiscard]] vec4fa zwww() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 3, 3, 2)); }
-        [[nodiscard]] vec4fa wxxx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 0, 3)); }
-        [[nodiscard]] vec4fa wxxy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 0, 0, 3)); }
-        [[nodiscard]] vec4fa wxxz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 0, 0, 3)); }
-        [[nodiscard]] vec4fa wxxw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 0, 0, 3)); }
-        [[nodiscard]] vec4fa wxyx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 0, 3)); }
-        [[nodiscard]] vec4fa wxyy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 1, 0, 3)); }
-        [[nodiscard]] vec4fa wxyz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 1, 0, 3)); }
-        [[nodiscard]] vec4fa wxyw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 1, 0, 3)); }
-        [[nodiscard]] vec4fa wxzx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 0, 3)); }
-        [[nodiscard]] vec4fa wxzy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 2, 0, 3)); }
-        [[nodiscard]] vec4fa wxzz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 2, 0, 3)); }
-        [[nodiscard]] vec4fa wxzw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 2, 0, 3)); }
-        [[nodiscard]] vec4fa wxwx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 3, 0, 3)); }
-        [[nodiscard]] vec4fa wxwy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 3, 0, 3)); }
-        [[nodiscard]] vec4fa wxwz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 3, 0, 3)); }
-        [[nodiscard]] vec4fa wxww() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 3, 0, 3)); }
-        [[nodiscard]] vec4fa wyxx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 1, 3)); }
-        [[nodiscard]] vec4fa wyxy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 0, 1, 3)); }
-        [[nodiscard]] vec4fa wyxz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 0, 1, 3)); }
-        [[nodiscard]] vec4fa wyxw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 0, 1, 3)); }
-        [[nodiscard]] vec4fa wyyx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 1, 3)); }
-        [[nodiscard]] vec4fa wyyy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 1, 1, 3)); }
-        [[nodiscard]] vec4fa wyyz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 1, 1, 3)); }
-        [[nodiscard]] vec4fa wyyw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 1, 1, 3)); }
-        [[nodiscard]] vec4fa wyzx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 1, 3)); }
-        [[nodiscard]] vec4fa wyzy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 2, 1, 3)); }
-        [[nodiscard]] vec4fa wyzz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 2, 1, 3)); }
-        [[nodiscard]] vec4fa wyzw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 2, 1, 3)); }
-        [[nodiscard]] vec4fa wywx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 3, 1, 3)); }
-        [[nodiscard]] vec4fa wywy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 3, 1, 3)); }
-        [[nodiscard]] vec4fa wywz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 3, 1, 3)); }
-        [[nodiscard]] vec4fa wyww() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 3, 1, 3)); }
-        [[nodiscard]] vec4fa wzxx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 2, 3)); }
-        [[nodiscard]] vec4fa wzxy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 0, 2, 3)); }
-        [[nodiscard]] vec4fa wzxz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 0, 2, 3)); }
-        [[nodiscard]] vec4fa wzxw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 0, 2, 3)); }
-        [[nodiscard]] vec4fa wzyx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 2, 3)); }
-        [[nodiscard]] vec4fa wzyy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 1, 2, 3)); }
-        [[nodiscard]] vec4fa wzyz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 1, 2, 3)); }
-        [[nodiscard]] vec4fa wzyw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 1, 2, 3)); }
-        [[nodiscard]] vec4fa wzzx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 2, 3)); }
-        [[nodiscard]] vec4fa wzzy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 2, 2, 3)); }
-        [[nodiscard]] vec4fa wzzz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 2, 2, 3)); }
-        [[nodiscard]] vec4fa wzzw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 2, 2, 3)); }
-        [[nodiscard]] vec4fa wzwx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 3, 2, 3)); }
-        [[nodiscard]] vec4fa wzwy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 3, 2, 3)); }
-        [[nodiscard]] vec4fa wzwz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 3, 2, 3)); }
-        [[nodiscard]] vec4fa wzww() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 3, 2, 3)); }
-        [[nodiscard]] vec4fa wwxx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 0, 3, 3)); }
-        [[nodiscard]] vec4fa wwxy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 0, 3, 3)); }
-        [[nodiscard]] vec4fa wwxz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 0, 3, 3)); }
-        [[nodiscard]] vec4fa wwxw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 0, 3, 3)); }
-        [[nodiscard]] vec4fa wwyx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 1, 3, 3)); }
-        [[nodiscard]] vec4fa wwyy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 1, 3, 3)); }
-        [[nodiscard]] vec4fa wwyz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 1, 3, 3)); }
-        [[nodiscard]] vec4fa wwyw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 1, 3, 3)); }
-        [[nodiscard]] vec4fa wwzx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 2, 3, 3)); }
-        [[nodiscard]] vec4fa wwzy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 2, 3, 3)); }
-        [[nodiscard]] vec4fa wwzz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 2, 3, 3)); }
-        [[nodiscard]] vec4fa wwzw() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 2, 3, 3)); }
-        [[nodiscard]] vec4fa wwwx() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(0, 3, 3, 3)); }
-        [[nodiscard]] vec4fa wwwy() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(1, 3, 3, 3)); }
-        [[nodiscard]] vec4fa wwwz() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(2, 3, 3, 3)); }
-        [[nodiscard]] vec4fa wwww() const noexcept { return _mm_permute_ps(m128, _MM_SHUFFLE(3, 3, 3, 3)); }
-#endif
+        [[nodiscard]] vec4fa xxx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 0, 0)>(m128); }
+        [[nodiscard]] vec4fa xxy() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 0, 0)>(m128); }
+        [[nodiscard]] vec4fa xxz() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 0, 0)>(m128); }
+        [[nodiscard]] vec4fa xyx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 1, 0)>(m128); }
+        [[nodiscard]] vec4fa xyy() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 1, 0)>(m128); }
+        [[nodiscard]] vec4fa xyz() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 1, 0)>(m128); }
+        [[nodiscard]] vec4fa xzx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 2, 0)>(m128); }
+        [[nodiscard]] vec4fa xzy() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 2, 0)>(m128); }
+        [[nodiscard]] vec4fa xzz() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 2, 0)>(m128); }
+        [[nodiscard]] vec4fa yxx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 0, 1)>(m128); }
+        [[nodiscard]] vec4fa yxy() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 0, 1)>(m128); }
+        [[nodiscard]] vec4fa yxz() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 0, 1)>(m128); }
+        [[nodiscard]] vec4fa yyx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 1, 1)>(m128); }
+        [[nodiscard]] vec4fa yyy() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 1, 1)>(m128); }
+        [[nodiscard]] vec4fa yyz() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 1, 1)>(m128); }
+        [[nodiscard]] vec4fa yzx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 2, 1)>(m128); }
+        [[nodiscard]] vec4fa yzy() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 2, 1)>(m128); }
+        [[nodiscard]] vec4fa yzz() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 2, 1)>(m128); }
+        [[nodiscard]] vec4fa zxx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 0, 2)>(m128); }
+        [[nodiscard]] vec4fa zxy() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 0, 2)>(m128); }
+        [[nodiscard]] vec4fa zxz() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 0, 2)>(m128); }
+        [[nodiscard]] vec4fa zyx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 1, 2)>(m128); }
+        [[nodiscard]] vec4fa zyy() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 1, 2)>(m128); }
+        [[nodiscard]] vec4fa zyz() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 1, 2)>(m128); }
+        [[nodiscard]] vec4fa zzx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 2, 2)>(m128); }
+        [[nodiscard]] vec4fa zzy() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 2, 2)>(m128); }
+        [[nodiscard]] vec4fa zzz() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 2, 2)>(m128); }
+
+        [[nodiscard]] vec4fa xxxx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 0, 0)>(m128); }
+        [[nodiscard]] vec4fa xxxy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 0, 0, 0)>(m128); }
+        [[nodiscard]] vec4fa xxxz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 0, 0, 0)>(m128); }
+        [[nodiscard]] vec4fa xxxw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 0, 0, 0)>(m128); }
+        [[nodiscard]] vec4fa xxyx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 0, 0)>(m128); }
+        [[nodiscard]] vec4fa xxyy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 1, 0, 0)>(m128); }
+        [[nodiscard]] vec4fa xxyz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 1, 0, 0)>(m128); }
+        [[nodiscard]] vec4fa xxyw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 1, 0, 0)>(m128); }
+        [[nodiscard]] vec4fa xxzx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 0, 0)>(m128); }
+        [[nodiscard]] vec4fa xxzy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 2, 0, 0)>(m128); }
+        [[nodiscard]] vec4fa xxzz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 2, 0, 0)>(m128); }
+        [[nodiscard]] vec4fa xxzw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 2, 0, 0)>(m128); }
+        [[nodiscard]] vec4fa xxwx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 3, 0, 0)>(m128); }
+        [[nodiscard]] vec4fa xxwy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 3, 0, 0)>(m128); }
+        [[nodiscard]] vec4fa xxwz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 3, 0, 0)>(m128); }
+        [[nodiscard]] vec4fa xxww() const noexcept { return detail::permute<_MM_SHUFFLE(3, 3, 0, 0)>(m128); }
+        [[nodiscard]] vec4fa xyxx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 1, 0)>(m128); }
+        [[nodiscard]] vec4fa xyxy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 0, 1, 0)>(m128); }
+        [[nodiscard]] vec4fa xyxz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 0, 1, 0)>(m128); }
+        [[nodiscard]] vec4fa xyxw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 0, 1, 0)>(m128); }
+        [[nodiscard]] vec4fa xyyx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 1, 0)>(m128); }
+        [[nodiscard]] vec4fa xyyy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 1, 1, 0)>(m128); }
+        [[nodiscard]] vec4fa xyyz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 1, 1, 0)>(m128); }
+        [[nodiscard]] vec4fa xyyw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 1, 1, 0)>(m128); }
+        [[nodiscard]] vec4fa xyzx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 1, 0)>(m128); }
+        [[nodiscard]] vec4fa xyzy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 2, 1, 0)>(m128); }
+        [[nodiscard]] vec4fa xyzz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 2, 1, 0)>(m128); }
+        [[nodiscard]] vec4fa xyzw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 2, 1, 0)>(m128); }
+        [[nodiscard]] vec4fa xywx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 3, 1, 0)>(m128); }
+        [[nodiscard]] vec4fa xywy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 3, 1, 0)>(m128); }
+        [[nodiscard]] vec4fa xywz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 3, 1, 0)>(m128); }
+        [[nodiscard]] vec4fa xyww() const noexcept { return detail::permute<_MM_SHUFFLE(3, 3, 1, 0)>(m128); }
+        [[nodiscard]] vec4fa xzxx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 2, 0)>(m128); }
+        [[nodiscard]] vec4fa xzxy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 0, 2, 0)>(m128); }
+        [[nodiscard]] vec4fa xzxz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 0, 2, 0)>(m128); }
+        [[nodiscard]] vec4fa xzxw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 0, 2, 0)>(m128); }
+        [[nodiscard]] vec4fa xzyx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 2, 0)>(m128); }
+        [[nodiscard]] vec4fa xzyy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 1, 2, 0)>(m128); }
+        [[nodiscard]] vec4fa xzyz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 1, 2, 0)>(m128); }
+        [[nodiscard]] vec4fa xzyw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 1, 2, 0)>(m128); }
+        [[nodiscard]] vec4fa xzzx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 2, 0)>(m128); }
+        [[nodiscard]] vec4fa xzzy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 2, 2, 0)>(m128); }
+        [[nodiscard]] vec4fa xzzz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 2, 2, 0)>(m128); }
+        [[nodiscard]] vec4fa xzzw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 2, 2, 0)>(m128); }
+        [[nodiscard]] vec4fa xzwx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 3, 2, 0)>(m128); }
+        [[nodiscard]] vec4fa xzwy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 3, 2, 0)>(m128); }
+        [[nodiscard]] vec4fa xzwz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 3, 2, 0)>(m128); }
+        [[nodiscard]] vec4fa xzww() const noexcept { return detail::permute<_MM_SHUFFLE(3, 3, 2, 0)>(m128); }
+        [[nodiscard]] vec4fa xwxx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 3, 0)>(m128); }
+        [[nodiscard]] vec4fa xwxy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 0, 3, 0)>(m128); }
+        [[nodiscard]] vec4fa xwxz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 0, 3, 0)>(m128); }
+        [[nodiscard]] vec4fa xwxw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 0, 3, 0)>(m128); }
+        [[nodiscard]] vec4fa xwyx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 3, 0)>(m128); }
+        [[nodiscard]] vec4fa xwyy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 1, 3, 0)>(m128); }
+        [[nodiscard]] vec4fa xwyz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 1, 3, 0)>(m128); }
+        [[nodiscard]] vec4fa xwyw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 1, 3, 0)>(m128); }
+        [[nodiscard]] vec4fa xwzx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 3, 0)>(m128); }
+        [[nodiscard]] vec4fa xwzy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 2, 3, 0)>(m128); }
+        [[nodiscard]] vec4fa xwzz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 2, 3, 0)>(m128); }
+        [[nodiscard]] vec4fa xwzw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 2, 3, 0)>(m128); }
+        [[nodiscard]] vec4fa xwwx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 3, 3, 0)>(m128); }
+        [[nodiscard]] vec4fa xwwy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 3, 3, 0)>(m128); }
+        [[nodiscard]] vec4fa xwwz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 3, 3, 0)>(m128); }
+        [[nodiscard]] vec4fa xwww() const noexcept { return detail::permute<_MM_SHUFFLE(3, 3, 3, 0)>(m128); }
+        [[nodiscard]] vec4fa yxxx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 0, 1)>(m128); }
+        [[nodiscard]] vec4fa yxxy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 0, 0, 1)>(m128); }
+        [[nodiscard]] vec4fa yxxz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 0, 0, 1)>(m128); }
+        [[nodiscard]] vec4fa yxxw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 0, 0, 1)>(m128); }
+        [[nodiscard]] vec4fa yxyx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 0, 1)>(m128); }
+        [[nodiscard]] vec4fa yxyy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 1, 0, 1)>(m128); }
+        [[nodiscard]] vec4fa yxyz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 1, 0, 1)>(m128); }
+        [[nodiscard]] vec4fa yxyw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 1, 0, 1)>(m128); }
+        [[nodiscard]] vec4fa yxzx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 0, 1)>(m128); }
+        [[nodiscard]] vec4fa yxzy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 2, 0, 1)>(m128); }
+        [[nodiscard]] vec4fa yxzz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 2, 0, 1)>(m128); }
+        [[nodiscard]] vec4fa yxzw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 2, 0, 1)>(m128); }
+        [[nodiscard]] vec4fa yxwx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 3, 0, 1)>(m128); }
+        [[nodiscard]] vec4fa yxwy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 3, 0, 1)>(m128); }
+        [[nodiscard]] vec4fa yxwz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 3, 0, 1)>(m128); }
+        [[nodiscard]] vec4fa yxww() const noexcept { return detail::permute<_MM_SHUFFLE(3, 3, 0, 1)>(m128); }
+        [[nodiscard]] vec4fa yyxx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 1, 1)>(m128); }
+        [[nodiscard]] vec4fa yyxy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 0, 1, 1)>(m128); }
+        [[nodiscard]] vec4fa yyxz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 0, 1, 1)>(m128); }
+        [[nodiscard]] vec4fa yyxw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 0, 1, 1)>(m128); }
+        [[nodiscard]] vec4fa yyyx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 1, 1)>(m128); }
+        [[nodiscard]] vec4fa yyyy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 1, 1, 1)>(m128); }
+        [[nodiscard]] vec4fa yyyz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 1, 1, 1)>(m128); }
+        [[nodiscard]] vec4fa yyyw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 1, 1, 1)>(m128); }
+        [[nodiscard]] vec4fa yyzx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 1, 1)>(m128); }
+        [[nodiscard]] vec4fa yyzy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 2, 1, 1)>(m128); }
+        [[nodiscard]] vec4fa yyzz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 2, 1, 1)>(m128); }
+        [[nodiscard]] vec4fa yyzw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 2, 1, 1)>(m128); }
+        [[nodiscard]] vec4fa yywx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 3, 1, 1)>(m128); }
+        [[nodiscard]] vec4fa yywy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 3, 1, 1)>(m128); }
+        [[nodiscard]] vec4fa yywz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 3, 1, 1)>(m128); }
+        [[nodiscard]] vec4fa yyww() const noexcept { return detail::permute<_MM_SHUFFLE(3, 3, 1, 1)>(m128); }
+        [[nodiscard]] vec4fa yzxx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 2, 1)>(m128); }
+        [[nodiscard]] vec4fa yzxy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 0, 2, 1)>(m128); }
+        [[nodiscard]] vec4fa yzxz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 0, 2, 1)>(m128); }
+        [[nodiscard]] vec4fa yzxw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 0, 2, 1)>(m128); }
+        [[nodiscard]] vec4fa yzyx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 2, 1)>(m128); }
+        [[nodiscard]] vec4fa yzyy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 1, 2, 1)>(m128); }
+        [[nodiscard]] vec4fa yzyz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 1, 2, 1)>(m128); }
+        [[nodiscard]] vec4fa yzyw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 1, 2, 1)>(m128); }
+        [[nodiscard]] vec4fa yzzx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 2, 1)>(m128); }
+        [[nodiscard]] vec4fa yzzy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 2, 2, 1)>(m128); }
+        [[nodiscard]] vec4fa yzzz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 2, 2, 1)>(m128); }
+        [[nodiscard]] vec4fa yzzw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 2, 2, 1)>(m128); }
+        [[nodiscard]] vec4fa yzwx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 3, 2, 1)>(m128); }
+        [[nodiscard]] vec4fa yzwy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 3, 2, 1)>(m128); }
+        [[nodiscard]] vec4fa yzwz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 3, 2, 1)>(m128); }
+        [[nodiscard]] vec4fa yzww() const noexcept { return detail::permute<_MM_SHUFFLE(3, 3, 2, 1)>(m128); }
+        [[nodiscard]] vec4fa ywxx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 3, 1)>(m128); }
+        [[nodiscard]] vec4fa ywxy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 0, 3, 1)>(m128); }
+        [[nodiscard]] vec4fa ywxz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 0, 3, 1)>(m128); }
+        [[nodiscard]] vec4fa ywxw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 0, 3, 1)>(m128); }
+        [[nodiscard]] vec4fa ywyx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 3, 1)>(m128); }
+        [[nodiscard]] vec4fa ywyy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 1, 3, 1)>(m128); }
+        [[nodiscard]] vec4fa ywyz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 1, 3, 1)>(m128); }
+        [[nodiscard]] vec4fa ywyw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 1, 3, 1)>(m128); }
+        [[nodiscard]] vec4fa ywzx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 3, 1)>(m128); }
+        [[nodiscard]] vec4fa ywzy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 2, 3, 1)>(m128); }
+        [[nodiscard]] vec4fa ywzz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 2, 3, 1)>(m128); }
+        [[nodiscard]] vec4fa ywzw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 2, 3, 1)>(m128); }
+        [[nodiscard]] vec4fa ywwx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 3, 3, 1)>(m128); }
+        [[nodiscard]] vec4fa ywwy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 3, 3, 1)>(m128); }
+        [[nodiscard]] vec4fa ywwz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 3, 3, 1)>(m128); }
+        [[nodiscard]] vec4fa ywww() const noexcept { return detail::permute<_MM_SHUFFLE(3, 3, 3, 1)>(m128); }
+        [[nodiscard]] vec4fa zxxx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 0, 2)>(m128); }
+        [[nodiscard]] vec4fa zxxy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 0, 0, 2)>(m128); }
+        [[nodiscard]] vec4fa zxxz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 0, 0, 2)>(m128); }
+        [[nodiscard]] vec4fa zxxw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 0, 0, 2)>(m128); }
+        [[nodiscard]] vec4fa zxyx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 0, 2)>(m128); }
+        [[nodiscard]] vec4fa zxyy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 1, 0, 2)>(m128); }
+        [[nodiscard]] vec4fa zxyz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 1, 0, 2)>(m128); }
+        [[nodiscard]] vec4fa zxyw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 1, 0, 2)>(m128); }
+        [[nodiscard]] vec4fa zxzx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 0, 2)>(m128); }
+        [[nodiscard]] vec4fa zxzy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 2, 0, 2)>(m128); }
+        [[nodiscard]] vec4fa zxzz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 2, 0, 2)>(m128); }
+        [[nodiscard]] vec4fa zxzw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 2, 0, 2)>(m128); }
+        [[nodiscard]] vec4fa zxwx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 3, 0, 2)>(m128); }
+        [[nodiscard]] vec4fa zxwy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 3, 0, 2)>(m128); }
+        [[nodiscard]] vec4fa zxwz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 3, 0, 2)>(m128); }
+        [[nodiscard]] vec4fa zxww() const noexcept { return detail::permute<_MM_SHUFFLE(3, 3, 0, 2)>(m128); }
+        [[nodiscard]] vec4fa zyxx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 1, 2)>(m128); }
+        [[nodiscard]] vec4fa zyxy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 0, 1, 2)>(m128); }
+        [[nodiscard]] vec4fa zyxz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 0, 1, 2)>(m128); }
+        [[nodiscard]] vec4fa zyxw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 0, 1, 2)>(m128); }
+        [[nodiscard]] vec4fa zyyx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 1, 2)>(m128); }
+        [[nodiscard]] vec4fa zyyy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 1, 1, 2)>(m128); }
+        [[nodiscard]] vec4fa zyyz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 1, 1, 2)>(m128); }
+        [[nodiscard]] vec4fa zyyw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 1, 1, 2)>(m128); }
+        [[nodiscard]] vec4fa zyzx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 1, 2)>(m128); }
+        [[nodiscard]] vec4fa zyzy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 2, 1, 2)>(m128); }
+        [[nodiscard]] vec4fa zyzz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 2, 1, 2)>(m128); }
+        [[nodiscard]] vec4fa zyzw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 2, 1, 2)>(m128); }
+        [[nodiscard]] vec4fa zywx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 3, 1, 2)>(m128); }
+        [[nodiscard]] vec4fa zywy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 3, 1, 2)>(m128); }
+        [[nodiscard]] vec4fa zywz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 3, 1, 2)>(m128); }
+        [[nodiscard]] vec4fa zyww() const noexcept { return detail::permute<_MM_SHUFFLE(3, 3, 1, 2)>(m128); }
+        [[nodiscard]] vec4fa zzxx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 2, 2)>(m128); }
+        [[nodiscard]] vec4fa zzxy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 0, 2, 2)>(m128); }
+        [[nodiscard]] vec4fa zzxz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 0, 2, 2)>(m128); }
+        [[nodiscard]] vec4fa zzxw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 0, 2, 2)>(m128); }
+        [[nodiscard]] vec4fa zzyx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 2, 2)>(m128); }
+        [[nodiscard]] vec4fa zzyy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 1, 2, 2)>(m128); }
+        [[nodiscard]] vec4fa zzyz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 1, 2, 2)>(m128); }
+        [[nodiscard]] vec4fa zzyw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 1, 2, 2)>(m128); }
+        [[nodiscard]] vec4fa zzzx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 2, 2)>(m128); }
+        [[nodiscard]] vec4fa zzzy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 2, 2, 2)>(m128); }
+        [[nodiscard]] vec4fa zzzz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 2, 2, 2)>(m128); }
+        [[nodiscard]] vec4fa zzzw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 2, 2, 2)>(m128); }
+        [[nodiscard]] vec4fa zzwx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 3, 2, 2)>(m128); }
+        [[nodiscard]] vec4fa zzwy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 3, 2, 2)>(m128); }
+        [[nodiscard]] vec4fa zzwz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 3, 2, 2)>(m128); }
+        [[nodiscard]] vec4fa zzww() const noexcept { return detail::permute<_MM_SHUFFLE(3, 3, 2, 2)>(m128); }
+        [[nodiscard]] vec4fa zwxx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 3, 2)>(m128); }
+        [[nodiscard]] vec4fa zwxy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 0, 3, 2)>(m128); }
+        [[nodiscard]] vec4fa zwxz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 0, 3, 2)>(m128); }
+        [[nodiscard]] vec4fa zwxw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 0, 3, 2)>(m128); }
+        [[nodiscard]] vec4fa zwyx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 3, 2)>(m128); }
+        [[nodiscard]] vec4fa zwyy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 1, 3, 2)>(m128); }
+        [[nodiscard]] vec4fa zwyz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 1, 3, 2)>(m128); }
+        [[nodiscard]] vec4fa zwyw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 1, 3, 2)>(m128); }
+        [[nodiscard]] vec4fa zwzx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 3, 2)>(m128); }
+        [[nodiscard]] vec4fa zwzy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 2, 3, 2)>(m128); }
+        [[nodiscard]] vec4fa zwzz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 2, 3, 2)>(m128); }
+        [[nodiscard]] vec4fa zwzw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 2, 3, 2)>(m128); }
+        [[nodiscard]] vec4fa zwwx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 3, 3, 2)>(m128); }
+        [[nodiscard]] vec4fa zwwy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 3, 3, 2)>(m128); }
+        [[nodiscard]] vec4fa zwwz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 3, 3, 2)>(m128); }
+        [[nodiscard]] vec4fa zwww() const noexcept { return detail::permute<_MM_SHUFFLE(3, 3, 3, 2)>(m128); }
+        [[nodiscard]] vec4fa wxxx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 0, 3)>(m128); }
+        [[nodiscard]] vec4fa wxxy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 0, 0, 3)>(m128); }
+        [[nodiscard]] vec4fa wxxz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 0, 0, 3)>(m128); }
+        [[nodiscard]] vec4fa wxxw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 0, 0, 3)>(m128); }
+        [[nodiscard]] vec4fa wxyx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 0, 3)>(m128); }
+        [[nodiscard]] vec4fa wxyy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 1, 0, 3)>(m128); }
+        [[nodiscard]] vec4fa wxyz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 1, 0, 3)>(m128); }
+        [[nodiscard]] vec4fa wxyw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 1, 0, 3)>(m128); }
+        [[nodiscard]] vec4fa wxzx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 0, 3)>(m128); }
+        [[nodiscard]] vec4fa wxzy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 2, 0, 3)>(m128); }
+        [[nodiscard]] vec4fa wxzz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 2, 0, 3)>(m128); }
+        [[nodiscard]] vec4fa wxzw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 2, 0, 3)>(m128); }
+        [[nodiscard]] vec4fa wxwx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 3, 0, 3)>(m128); }
+        [[nodiscard]] vec4fa wxwy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 3, 0, 3)>(m128); }
+        [[nodiscard]] vec4fa wxwz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 3, 0, 3)>(m128); }
+        [[nodiscard]] vec4fa wxww() const noexcept { return detail::permute<_MM_SHUFFLE(3, 3, 0, 3)>(m128); }
+        [[nodiscard]] vec4fa wyxx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 1, 3)>(m128); }
+        [[nodiscard]] vec4fa wyxy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 0, 1, 3)>(m128); }
+        [[nodiscard]] vec4fa wyxz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 0, 1, 3)>(m128); }
+        [[nodiscard]] vec4fa wyxw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 0, 1, 3)>(m128); }
+        [[nodiscard]] vec4fa wyyx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 1, 3)>(m128); }
+        [[nodiscard]] vec4fa wyyy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 1, 1, 3)>(m128); }
+        [[nodiscard]] vec4fa wyyz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 1, 1, 3)>(m128); }
+        [[nodiscard]] vec4fa wyyw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 1, 1, 3)>(m128); }
+        [[nodiscard]] vec4fa wyzx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 1, 3)>(m128); }
+        [[nodiscard]] vec4fa wyzy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 2, 1, 3)>(m128); }
+        [[nodiscard]] vec4fa wyzz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 2, 1, 3)>(m128); }
+        [[nodiscard]] vec4fa wyzw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 2, 1, 3)>(m128); }
+        [[nodiscard]] vec4fa wywx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 3, 1, 3)>(m128); }
+        [[nodiscard]] vec4fa wywy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 3, 1, 3)>(m128); }
+        [[nodiscard]] vec4fa wywz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 3, 1, 3)>(m128); }
+        [[nodiscard]] vec4fa wyww() const noexcept { return detail::permute<_MM_SHUFFLE(3, 3, 1, 3)>(m128); }
+        [[nodiscard]] vec4fa wzxx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 2, 3)>(m128); }
+        [[nodiscard]] vec4fa wzxy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 0, 2, 3)>(m128); }
+        [[nodiscard]] vec4fa wzxz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 0, 2, 3)>(m128); }
+        [[nodiscard]] vec4fa wzxw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 0, 2, 3)>(m128); }
+        [[nodiscard]] vec4fa wzyx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 2, 3)>(m128); }
+        [[nodiscard]] vec4fa wzyy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 1, 2, 3)>(m128); }
+        [[nodiscard]] vec4fa wzyz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 1, 2, 3)>(m128); }
+        [[nodiscard]] vec4fa wzyw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 1, 2, 3)>(m128); }
+        [[nodiscard]] vec4fa wzzx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 2, 3)>(m128); }
+        [[nodiscard]] vec4fa wzzy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 2, 2, 3)>(m128); }
+        [[nodiscard]] vec4fa wzzz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 2, 2, 3)>(m128); }
+        [[nodiscard]] vec4fa wzzw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 2, 2, 3)>(m128); }
+        [[nodiscard]] vec4fa wzwx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 3, 2, 3)>(m128); }
+        [[nodiscard]] vec4fa wzwy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 3, 2, 3)>(m128); }
+        [[nodiscard]] vec4fa wzwz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 3, 2, 3)>(m128); }
+        [[nodiscard]] vec4fa wzww() const noexcept { return detail::permute<_MM_SHUFFLE(3, 3, 2, 3)>(m128); }
+        [[nodiscard]] vec4fa wwxx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 0, 3, 3)>(m128); }
+        [[nodiscard]] vec4fa wwxy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 0, 3, 3)>(m128); }
+        [[nodiscard]] vec4fa wwxz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 0, 3, 3)>(m128); }
+        [[nodiscard]] vec4fa wwxw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 0, 3, 3)>(m128); }
+        [[nodiscard]] vec4fa wwyx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 1, 3, 3)>(m128); }
+        [[nodiscard]] vec4fa wwyy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 1, 3, 3)>(m128); }
+        [[nodiscard]] vec4fa wwyz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 1, 3, 3)>(m128); }
+        [[nodiscard]] vec4fa wwyw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 1, 3, 3)>(m128); }
+        [[nodiscard]] vec4fa wwzx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 2, 3, 3)>(m128); }
+        [[nodiscard]] vec4fa wwzy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 2, 3, 3)>(m128); }
+        [[nodiscard]] vec4fa wwzz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 2, 3, 3)>(m128); }
+        [[nodiscard]] vec4fa wwzw() const noexcept { return detail::permute<_MM_SHUFFLE(3, 2, 3, 3)>(m128); }
+        [[nodiscard]] vec4fa wwwx() const noexcept { return detail::permute<_MM_SHUFFLE(0, 3, 3, 3)>(m128); }
+        [[nodiscard]] vec4fa wwwy() const noexcept { return detail::permute<_MM_SHUFFLE(1, 3, 3, 3)>(m128); }
+        [[nodiscard]] vec4fa wwwz() const noexcept { return detail::permute<_MM_SHUFFLE(2, 3, 3, 3)>(m128); }
+        [[nodiscard]] vec4fa wwww() const noexcept { return detail::permute<_MM_SHUFFLE(3, 3, 3, 3)>(m128); }
     };
 
     ////////////////////////////////////////////////////////////////
     // Shuffle.
     ////////////////////////////////////////////////////////////////
 
-#ifdef __AVX__
     template<int32_t i0, int32_t i1, int32_t i2, int32_t i3>
-    vec4fa shuffle(const vec4fa& v) noexcept { return _mm_permute_ps(v, _MM_SHUFFLE(i3, i2, i1, i0)); }
-#endif
+    vec4fa shuffle(const vec4fa& v) noexcept { return detail::permute<_MM_SHUFFLE(i3, i2, i1, i0)>(v); }
 
     ////////////////////////////////////////////////////////////////
     // Arithmetic operators.
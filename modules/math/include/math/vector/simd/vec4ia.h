@@ -43,6 +43,8 @@ namespace math
 
         [[nodiscard]] vec4ia() noexcept : m128(_mm_set1_epi32(0)) {}
 
+        [[nodiscard]] explicit vec4ia(uninit_t) noexcept {}
+
         [[nodiscard]] explicit vec4ia(const int32_t v) noexcept : m128(_mm_set1_epi32(v)) {}
 
         [[nodiscard]] vec4ia(const int32_t x, const int32_t y, const int32_t z, const int32_t w) noexcept : m128(_mm_setr_epi32(x, y, z, w)) {}
@@ -51,15 +53,15 @@ namespace math
 
         [[nodiscard]] explicit vec4ia(const __m128 m128) noexcept : m128(_mm_castps_si128(m128)) {}
 
-        [[nodiscard]] vec4ia(const vec4ia& rhs) noexcept : m128(rhs.m128) {}
+        [[nodiscard]] vec4ia(const vec4ia& rhs) noexcept = default;
 
-        [[nodiscard]] explicit vec4ia(const vec<int32_t, 4>& rhs) noexcept : x(rhs.x), y(rhs.y), z(rhs.z), w(rhs.w) {}
+        [[nodiscard]] explicit vec4ia(const vec<int32_t, 4>& rhs) noexcept : m128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&rhs.x))) {}
 
         ////////////////////////////////////////////////////////////////
         // Assignment operators.
         ////////////////////////////////////////////////////////////////
 
-        vec4ia& operator=(const vec4ia& rhs) noexcept { m128 = rhs.m128; return *this; }
+        vec4ia& operator=(const vec4ia& rhs) noexcept = default;
 
         vec4ia& operator=(const int32_t rhs) noexcept { m128 = _mm_set1_epi32(rhs); return *this; }
 
@@ -75,6 +77,78 @@ namespace math
 
         static void storeu(void* ptr, const vec4ia& v) { _mm_storeu_si128(static_cast<__m128i*>(ptr), v.m128); }
 
+        /**
+         * @brief Load the lanes that are set in mask and zero the others. Memory of lanes that are not set is not accessed.
+         */
+        [[nodiscard]] static vec4ia loadu(const void* const ptr, const vec4ba& mask)
+        {
+#ifdef __AVX__
+            return vec4ia(_mm_castps_si128(_mm_maskload_ps(static_cast<const float*>(ptr), mask)));
+#else
+            const int32_t* src = static_cast<const int32_t*>(ptr);
+            vec4ia v;
+            for (size_t i = 0; i < 4; i++)
+                if (mask[i]) v[i] = src[i];
+            return v;
+#endif
+        }
+
+        /**
+         * @brief Load the first count elements, e.g. for the tail of a loop.
+         */
+        [[nodiscard]] static vec4ia loadu(const void* const ptr, const size_t count) { return loadu(ptr, vec4ba::first(count)); }
+
+        /**
+         * @brief Store the lanes that are set in mask. Memory of lanes that are not set is not accessed.
+         */
+        static void storeu(void* ptr, const vec4ia& v, const vec4ba& mask)
+        {
+#ifdef __AVX__
+            _mm_maskstore_ps(static_cast<float*>(ptr), mask, _mm_castsi128_ps(v.m128));
+#else
+            int32_t* dst = static_cast<int32_t*>(ptr);
+            for (size_t i = 0; i < 4; i++)
+                if (mask[i]) dst[i] = v[i];
+#endif
+        }
+
+        /**
+         * @brief Store the first count elements, e.g. for the tail of a loop.
+         */
+        static void storeu(void* ptr, const vec4ia& v, const size_t count) { storeu(ptr, v, vec4ba::first(count)); }
+
+        /**
+         * @brief Load base[indices[i]] into lane i.
+         */
+        [[nodiscard]] static vec4ia gather(const int32_t* base, const vec4ia& indices)
+        {
+#ifdef __AVX2__
+            return vec4ia(_mm_i32gather_epi32(base, indices, 4));
+#else
+            vec4ia v(uninit);
+            for (size_t i = 0; i < 4; i++) v[i] = base[indices[i]];
+            return v;
+#endif
+        }
+
+        /**
+         * @brief Store lane i to base[indices[i]]. Lanes are written in order, so for duplicate indices the highest lane wins.
+         */
+        static void scatter(int32_t* base, const vec4ia& indices, const vec4ia& v)
+        {
+#if defined(__AVX512F__) && defined(__AVX512VL__)
+            _mm_i32scatter_epi32(base, indices, v, 4);
+#else
+            for (size_t i = 0; i < 4; i++) base[indices[i]] = v[i];
+#endif
+        }
+
+        /**
+         * @brief Non-temporal store to aligned memory, bypassing the caches. Use for large outputs that are not read again soon.
+         * Other threads are only guaranteed to see the data after an _mm_sfence().
+         */
+        static void stream(void* ptr, const vec4ia& v) { _mm_stream_si128(static_cast<__m128i*>(ptr), v.m128); }
+
         ////////////////////////////////////////////////////////////////
         // Defaulted constructors and operators.
         ////////////////////////////////////////////////////////////////
@@ -95,7 +169,7 @@ namespace math
         
         [[nodiscard]] explicit operator __m128 () const noexcept { return _mm_castsi128_ps(m128); }
 
-        [[nodiscard]] explicit operator vec<int32_t, 4>() const noexcept { return vec<int32_t, 4>(x, y, z, w); }
+        [[nodiscard]] explicit operator vec<int32_t, 4>() const noexcept { vec<int32_t, 4> v(uninit); _mm_storeu_si128(reinterpret_cast<__m128i*>(&v.x), m128); return v; }
 
         ////////////////////////////////////////////////////////////////
         // Element access.
@@ -109,302 +183,298 @@ namespace math
         // Swizzling.
         ////////////////////////////////////////////////////////////////
 
-#ifdef __AVX__
-        [[nodiscard]] vec4ia xxx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 0, 0))); }
-        [[nodiscard]] vec4ia xxy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 0, 0))); }
-        [[nodiscard]] vec4ia xxz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 0, 0))); }
-        [[nodiscard]] vec4ia xyx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 1, 0))); }
-        [[nodiscard]] vec4ia xyy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 1, 0))); }
-        [[nodiscard]] vec4ia xyz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 1, 0))); }
-        [[nodiscard]] vec4ia xzx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 2, 0))); }
-        [[nodiscard]] vec4ia xzy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 2, 0))); }
-        [[nodiscard]] vec4ia xzz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 2, 0))); }
-        [[nodiscard]] vec4ia yxx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 0, 1))); }
-        [[nodiscard]] vec4ia yxy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 0, 1))); }
-        [[nodiscard]] vec4ia yxz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 0, 1))); }
-        [[nodiscard]] vec4ia yyx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 1, 1))); }
-        [[nodiscard]] vec4ia yyy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 1, 1))); }
-        [[nodiscard]] vec4ia yyz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 1, 1))); }
-        [[nodiscard]] vec4ia yzx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 2, 1))); }
-        [[nodiscard]] vec4ia yzy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 2, 1))); }
-        [[nodiscard]] vec4ia yzz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 2, 1))); }
-        [[nodiscard]] vec4ia zxx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 0, 2))); }
-        [[nodiscard]] vec4ia zxy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 0, 2))); }
-        [[nodiscard]] vec4ia zxz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 0, 2))); }
-        [[nodiscard]] vec4ia zyx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 1, 2))); }
-        [[nodiscard]] vec4ia zyy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 1, 2))); }
-        [[nodiscard]] vec4ia zyz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 1, 2))); }
-        [[nodiscard]] vec4ia zzx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 2, 2))); }
-        [[nodiscard]] vec4ia zzy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 2, 2))); }
-        [[nodiscard]] vec4ia zzz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 2, 2))); }
-
-        [[nodiscard]] vec4ia xxxx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 0, 0))); }
-        [[nodiscard]] vec4ia xxxy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 0, 0, 0))); }
-        [[nodiscard]] vec4ia xxxz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 0, 0, 0))); }
-        [[nodiscard]] vec4ia xxxw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 0, 0, 0))); }
-        [[nodiscard]] vec4ia xxyx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 0, 0))); }
-        [[nodiscard]] vec4ia xxyy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 1, 0, 0))); }
-        [[nodiscard]] vec4ia xxyz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 1, 0, 0))); }
-        [[nodiscard]] vec4ia xxyw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 1, 0, 0))); }
-        [[nodiscard]] vec4ia xxzx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 0, 0))); }
-        [[nodiscard]] vec4ia xxzy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 2, 0, 0))); }
-        [[nodiscard]] vec4ia xxzz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 2, 0, 0))); }
-        [[nodiscard]] vec4ia xxzw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 2, 0, 0))); }
-        [[nodiscard]] vec4ia xxwx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 3, 0, 0))); }
-        [[nodiscard]] vec4ia xxwy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 3, 0, 0))); }
-        [[nodiscard]] vec4ia xxwz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 3, 0, 0))); }
-        [[nodiscard]] vec4ia xxww() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 3, 0, 0))); }
-        [[nodiscard]] vec4ia xyxx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 1, 0))); }
-        [[nodiscard]] vec4ia xyxy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 0, 1, 0))); }
-        [[nodiscard]] vec4ia xyxz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 0, 1, 0))); }
-        [[nodiscard]] vec4ia xyxw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 0, 1, 0))); }
-        [[nodiscard]] vec4ia xyyx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 1, 0))); }
-        [[nodiscard]] vec4ia xyyy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 1, 1, 0))); }
-        [[nodiscard]] vec4ia xyyz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 1, 1, 0))); }
-        [[nodiscard]] vec4ia xyyw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 1, 1, 0))); }
-        [[nodiscard]] vec4ia xyzx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 1, 0))); }
-        [[nodiscard]] vec4ia xyzy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 2, 1, 0))); }
-        [[nodiscard]] vec4ia xyzz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 2, 1, 0))); }
-        [[nodiscard]] vec4ia xyzw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 2, 1, 0))); }
-        [[nodiscard]] vec4ia xywx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 3, 1, 0))); }
-        [[nodiscard]] vec4ia xywy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 3, 1, 0))); }
-        [[nodiscard]] vec4ia xywz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 3, 1, 0))); }
-        [[nodiscard]] vec4ia xyww() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 3, 1, 0))); }
-        [[nodiscard]] vec4ia xzxx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 2, 0))); }
-        [[nodiscard]] vec4ia xzxy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 0, 2, 0))); }
-        [[nodiscard]] vec4ia xzxz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 0, 2, 0))); }
-        [[nodiscard]] vec4ia xzxw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 0, 2, 0))); }
-        [[nodiscard]] vec4ia xzyx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 2, 0))); }
-        [[nodiscard]] vec4ia xzyy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 1, 2, 0))); }
-        [[nodiscard]] vec4ia xzyz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 1, 2, 0))); }
-        [[nodiscard]] vec4ia xzyw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 1, 2, 0))); }
-        [[nodiscard]] vec4ia xzzx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 2, 0))); }
-        [[nodiscard]] vec4ia xzzy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 2, 2, 0))); }
-        [[nodiscard]] vec4ia xzzz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 2, 2, 0))); }
-        [[nodiscard]] vec4ia xzzw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 2, 2, 0))); }
-        [[nodiscard]] vec4ia xzwx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 3, 2, 0))); }
-        [[nodiscard]] vec4ia xzwy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 3, 2, 0))); }
-        [[nodiscard]] vec4ia xzwz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 3, 2, 0))); }
-        [[nodiscard]] vec4ia xzww() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 3, 2, 0))); }
-        [[nodiscard]] vec4ia xwxx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 3, 0))); }
-        [[nodiscard]] vec4ia xwxy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 0, 3, 0))); }
-        [[nodiscard]] vec4ia xwxz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 0, 3, 0))); }
-        [[nodiscard]] vec4ia xwxw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 0, 3, 0))); }
-        [[nodiscard]] vec4ia xwyx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 3, 0))); }
-        [[nodiscard]] vec4ia xwyy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 1, 3, 0))); }
-        [[nodiscard]] vec4ia xwyz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 1, 3, 0))); }
-        [[nodiscard]] vec4ia xwyw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 1, 3, 0))); }
-        [[nodiscard]] vec4ia xwzx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 3, 0))); }
-        [[nodiscard]] vec4ia xwzy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 2, 3, 0))); }
-        [[nodiscard]] vec4ia xwzz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 2, 3, 0))); }
-        [[nodiscard]] vec4ia xwzw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 2, 3, 0))); }
-        [[nodiscard]] vec4ia xwwx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 3, 3, 0))); }
-        [[nodiscard]] vec4ia xwwy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 3, 3, 0))); }
-        [[nodiscard]] vec4ia xwwz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 3, 3, 0))); }
-        [[nodiscard]] vec4ia xwww() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 3, 3, 0))); }
-        [[nodiscard]] vec4ia yxxx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 0, 1))); }
-        [[nodiscard]] vec4ia yxxy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 0, 0, 1))); }
-        [[nodiscard]] vec4ia yxxz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 0, 0, 1))); }
-        [[nodiscard]] vec4ia yxxw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 0, 0, 1))); }
-        [[nodiscard]] vec4ia yxyx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 0, 1))); }
-        [[nodiscard]] vec4ia yxyy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 1, 0, 1))); }
-        [[nodiscard]] vec4ia yxyz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 1, 0, 1))); }
-        [[nodiscard]] vec4ia yxyw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 1, 0, 1))); }
-        [[nodiscard]] vec4ia yxzx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 0, 1))); }
-        [[nodiscard]] vec4ia yxzy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 2, 0, 1))); }
-        [[nodiscard]] vec4ia yxzz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 2, 0, 1))); }
-        [[nodiscard]] vec4ia yxzw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 2, 0, 1))); }
-        [[nodiscard]] vec4ia yxwx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 3, 0, 1))); }
-        [[nodiscard]] vec4ia yxwy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 3, 0, 1))); }
-        [[nodiscard]] vec4ia yxwz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 3, 0, 1))); }
-        [[nodiscard]] vec4ia yxww() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 3, 0, 1))); }
-        [[nodiscard]] vec4ia yyxx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 1, 1))); }
-        [[nodiscard]] vec4ia yyxy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 0, 1, 1))); }
-        [[nodiscard]] vec4ia yyxz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 0, 1, 1))); }
-        [[nodiscard]] vec4ia yyxw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 0, 1, 1))); }
-        [[nodiscard]] vec4ia yyyx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 1, 1))); }
-        [[nodiscard]] vec4ia yyyy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 1, 1, 1))); }
-        [[nodiscard]] vec4ia yyyz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 1, 1, 1))); }
-        [[nodiscard]] vec4ia yyyw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 1, 1, 1))); }
-        [[nodiscard]] vec4ia yyzx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 1, 1))); }
-        [[nodiscard]] vec4ia yyzy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 2, 1, 1))); }
-        [[nodiscard]] vec4ia yyzz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 2, 1, 1))); }
-        [[nodiscard]] vec4ia yyzw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 2, 1, 1))); }
-        [[nodiscard]] vec4ia yywx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 3, 1, 1))); }
-        [[nodiscard]] vec4ia yywy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 3, 1, 1))); }
-        [[nodiscard]] vec4ia yywz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 3, 1, 1))); }
-        [[nodiscard]] vec4ia yyww() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 3, 1, 1))); }
-        [[nodiscard]] vec4ia yzxx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 2, 1))); }
-        [[nodiscard]] vec4ia yzxy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 0, 2, 1))); }
-        [[nodiscard]] vec4ia yzxz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 0, 2, 1))); }
-        [[nodiscard]] vec4ia yzxw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 0, 2, 1))); }
-        [[nodiscard]] vec4ia yzyx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 2, 1))); }
-        [[nodiscard]] vec4ia yzyy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 1, 2, 1))); }
-        [[nodiscard]] vec4ia yzyz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 1, 2, 1))); }
-        [[nodiscard]] vec4ia yzyw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 1, 2, 1))); }
-        [[nodiscard]] vec4ia yzzx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 2, 1))); }
-        [[nodiscard]] vec4ia yzzy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 2, 2, 1))); }
-        [[nodiscard]] vec4ia yzzz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 2, 2, 1))); }
-        [[nodiscard]] vec4ia yzzw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 2, 2, 1))); }
-        [[nodiscard]] vec4ia yzwx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 3, 2, 1))); }
-        [[nodiscard]] vec4ia yzwy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 3, 2, 1))); }
-        [[nodiscard]] vec4ia yzwz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 3, 2, 1))); }
-        [[nodiscard]] vec4ia yzww() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 3, 2, 1))); }
-        [[nodiscard]] vec4ia ywxx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 3, 1))); }
-        [[nodiscard]] vec4ia ywxy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 0, 3, 1))); }
-        [[nodiscard]] vec4ia ywxz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 0, 3, 1))); }
-        [[nodiscard]] vec4ia ywxw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 0, 3, 1))); }
-        [[nodiscard]] vec4ia ywyx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 3, 1))); }
-        [[nodiscard]] vec4ia ywyy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 1, 3, 1))); }
-        [[nodiscard]] vec4ia ywyz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 1, 3, 1))); }
-        [[nodiscard]] vec4ia ywyw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 1, 3, 1))); }
-        [[nodiscard]] vec4ia ywzx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 3, 1))); }
-        [[nodiscard]] vec4ia ywzy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 2, 3, 1))); }
-        [[nodiscard]] vec4ia ywzz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 2, 3, 1))); }
-        [[nodiscard]] vec4ia ywzw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 2, 3, 1))); }
-        [[nodiscard]] vec4ia ywwx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 3, 3, 1))); }
-        [[nodiscard]] vec4ia ywwy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 3, 3, 1))); }
-        [[nodiscard]] vec4ia ywwz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 3, 3, 1))); }
-        [[nodiscard]] vec4ia ywww() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 3, 3, 1))); }
-        [[nodiscard]] vec4ia zxxx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 0, 2))); }
-        [[nodiscard]] vec4ia zxxy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 0, 0, 2))); }
-        [[nodiscard]] vec4ia zxxz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 0, 0, 2))); }
-        [[nodiscard]] vec4ia zxxw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 0, 0, 2))); }
-        [[nodiscard]] vec4ia zxyx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 0, 2))); }
-        [[nodiscard]] vec4ia zxyy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 1, 0, 2))); }
-        [[nodiscard]] vec4ia zxyz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 1, 0, 2))); }
-        [[nodiscard]] vec4ia zxyw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 1, 0, 2))); }
-        [[nodiscard]] vec4ia zxzx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 0, 2))); }
-        [[nodiscard]] vec4ia zxzy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 2, 0, 2))); }
-        [[nodiscard]] vec4ia zxzz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 2, 0, 2))); }
-        [[nodiscard]] vec4ia zxzw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 2, 0, 2))); }
-        [[nodiscard]] vec4ia zxwx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 3, 0, 2))); }
-        [[nodiscard]] vec4ia zxwy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 3, 0, 2))); }
-        [[nodiscard]] vec4ia zxwz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 3, 0, 2))); }
-        [[nodiscard]] vec4ia zxww() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 3, 0, 2))); }
-        [[nodiscard]] vec4ia zyxx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 1, 2))); }
-        [[nodiscard]] vec4ia zyxy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 0, 1, 2))); }
-        [[nodiscard]] vec4ia zyxz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 0, 1, 2))); }
-        [[nodiscard]] vec4ia zyxw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 0, 1, 2))); }
-        [[nodiscard]] vec4ia zyyx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 1, 2))); }
-        [[nodiscard]] vec4ia zyyy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 1, 1, 2))); }
-        [[nodiscard]] vec4ia zyyz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 1, 1, 2))); }
-        [[nodiscard]] vec4ia zyyw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 1, 1, 2))); }
-        [[nodiscard]] vec4ia zyzx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 1, 2))); }
-        [[nodiscard]] vec4ia zyzy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 2, 1, 2))); }
-        [[nodiscard]] vec4ia zyzz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 2, 1, 2))); }
-        [[nodiscard]] vec4ia zyzw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 2, 1, 2))); }
-        [[nodiscard]] vec4ia zywx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 3, 1, 2))); }
-        [[nodiscard]] vec4ia zywy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 3, 1, 2))); }
-        [[nodiscard]] vec4ia zywz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 3, 1, 2))); }
-        [[nodiscard]] vec4ia zyww() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 3, 1, 2))); }
-        [[nodiscard]] vec4ia zzxx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 2, 2))); }
-        [[nodiscard]] vec4ia zzxy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 0, 2, 2))); }
-        [[nodiscard]] vec4ia zzxz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 0, 2, 2))); }
-        [[nodiscard]] vec4ia zzxw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 0, 2, 2))); }
-        [[nodiscard]] vec4ia zzyx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 2, 2))); }
-        [[nodiscard]] vec4ia zzyy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 1, 2, 2))); }
-        [[nodiscard]] vec4ia zzyz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 1, 2, 2))); }
-        [[nodiscard]] vec4ia zzyw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 1, 2, 2))); }
-        [[nodiscard]] vec4ia zzzx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 2, 2))); }
-        [[nodiscard]] vec4ia zzzy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 2, 2, 2))); }
-        [[nodiscard]] vec4ia zzzz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 2, 2, 2))); }
-        [[nodiscard]] vec4ia zzzw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 2, 2, 2))); }
-        [[nodiscard]] vec4ia zzwx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 3, 2, 2))); }
-        [[nodiscard]] vec4ia zzwy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 3, 2, 2))); }
-        [[nodiscard]] vec4ia zzwz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 3, 2, 2))); }
-        [[nodiscard]] vec4ia zzww() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 3, 2, 2))); }
-        [[nodiscard]] vec4ia zwxx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 3, 2))); }
-        [[nodiscard]] vec4ia zwxy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 0, 3, 2))); }
-        [[nodiscard]] vec4ia zwxz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 0, 3, 2))); }
-        [[nodiscard]] vec4ia zwxw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 0, 3, 2))); }
-        [[nodiscard]] vec4ia zwyx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 3, 2))); }
-        [[nodiscard]] vec4ia zwyy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 1, 3, 2))); }
-        [[nodiscard]] vec4ia zwyz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 1, 3, 2))); }
-        [[nodiscard]] vec4ia zwyw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 1, 3, 2))); }
-        [[nodiscard]] vec4ia zwzx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 3, 2))); }
-        [[nodiscard]] vec4ia zwzy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 2, 3, 2))); }
-        [[nodiscard]] vec4ia zwzz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 2, 3, 2))); }
-        [[nodiscard]] vec4ia zwzw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 2, 3, 2))); }
-        [[nodiscard]] vec4ia zwwx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 3, 3, 2))); }
-        [[nodiscard]] vec4ia zwwy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 3, 3, 2))); }
-        [[nodiscard]] vec4ia zwwz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 3, 3, 2))); }
-        [[nodiscard]] vec4ia zwww() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 3, 3, 2))); }
-        [[nodiscard]] vec4ia wxxx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 0, 3))); }
-        [[nodiscard]] vec4ia wxxy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 0, 0, 3))); }
-        [[nodiscard]] vec4ia wxxz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 0, 0, 3))); }
-        [[nodiscard]] vec4ia wxxw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 0, 0, 3))); }
-        [[nodiscard]] vec4ia wxyx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 0, 3))); }
-        [[nodiscard]] vec4ia wxyy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 1, 0, 3))); }
-        [[nodiscard]] vec4ia wxyz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 1, 0, 3))); }
-        [[nodiscard]] vec4ia wxyw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 1, 0, 3))); }
-        [[nodiscard]] vec4ia wxzx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 0, 3))); }
-        [[nodiscard]] vec4ia wxzy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 2, 0, 3))); }
-        [[nodiscard]] vec4ia wxzz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 2, 0, 3))); }
-        [[nodiscard]] vec4ia wxzw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 2, 0, 3))); }
-        [[nodiscard]] vec4ia wxwx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 3, 0, 3))); }
-        [[nodiscard]] vec4ia wxwy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 3, 0, 3))); }
-        [[nodiscard]] vec4ia wxwz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 3, 0, 3))); }
-        [[nodiscard]] vec4ia wxww() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 3, 0, 3))); }
-        [[nodiscard]] vec4ia wyxx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 1, 3))); }
-        [[nodiscard]] vec4ia wyxy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 0, 1, 3))); }
-        [[nodiscard]] vec4ia wyxz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 0, 1, 3))); }
-        [[nodiscard]] vec4ia wyxw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 0, 1, 3))); }
-        [[nodiscard]] vec4ia wyyx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 1, 3))); }
-        [[nodiscard]] vec4ia wyyy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 1, 1, 3))); }
-        [[nodiscard]] vec4ia wyyz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 1, 1, 3))); }
-        [[nodiscard]] vec4ia wyyw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 1, 1, 3))); }
-        [[nodiscard]] vec4ia wyzx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 1, 3))); }
-        [[nodiscard]] vec4ia wyzy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 2, 1, 3))); }
-        [[nodiscard]] vec4ia wyzz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 2, 1, 3))); }
-        [[nodiscard]] vec4ia wyzw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 2, 1, 3))); }
-        [[nodiscard]] vec4ia wywx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 3, 1, 3))); }
-        [[nodiscard]] vec4ia wywy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 3, 1, 3))); }
-        [[nodiscard]] vec4ia wywz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 3, 1, 3))); }
-        [[nodiscard]] vec4ia wyww() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 3, 1, 3))); }
-        [[nodiscard]] vec4ia wzxx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 2, 3))); }
-        [[nodiscard]] vec4ia wzxy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 0, 2, 3))); }
-        [[nodiscard]] vec4ia wzxz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 0, 2, 3))); }
-        [[nodiscard]] vec4ia wzxw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 0, 2, 3))); }
-        [[nodiscard]] vec4ia wzyx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 2, 3))); }
-        [[nodiscard]] vec4ia wzyy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 1, 2, 3))); }
-        [[nodiscard]] vec4ia wzyz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 1, 2, 3))); }
-        [[nodiscard]] vec4ia wzyw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 1, 2, 3))); }
-        [[nodiscard]] vec4ia wzzx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 2, 3))); }
-        [[nodiscard]] vec4ia wzzy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 2, 2, 3))); }
-        [[nodiscard]] vec4ia wzzz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 2, 2, 3))); }
-        [[nodiscard]] vec4ia wzzw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 2, 2, 3))); }
-        [[nodiscard]] vec4ia wzwx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 3, 2, 3))); }
-        [[nodiscard]] vec4ia wzwy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 3, 2, 3))); }
-        [[nodiscard]] vec4ia wzwz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 3, 2, 3))); }
-        [[nodiscard]] vec4ia wzww() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 3, 2, 3))); }
-        [[nodiscard]] vec4ia wwxx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 0, 3, 3))); }
-        [[nodiscard]] vec4ia wwxy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 0, 3, 3))); }
-        [[nodiscard]] vec4ia wwxz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 0, 3, 3))); }
-        [[nodiscard]] vec4ia wwxw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 0, 3, 3))); }
-        [[nodiscard]] vec4ia wwyx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 1, 3, 3))); }
-        [[nodiscard]] vec4ia wwyy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 1, 3, 3))); }
-        [[nodiscard]] vec4ia wwyz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 1, 3, 3))); }
-        [[nodiscard]] vec4ia wwyw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 1, 3, 3))); }
-        [[nodiscard]] vec4ia wwzx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 2, 3, 3))); }
-        [[nodiscard]] vec4ia wwzy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 2, 3, 3))); }
-        [[nodiscard]] vec4ia wwzz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 2, 3, 3))); }
-        [[nodiscard]] vec4ia wwzw() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 2, 3, 3))); }
-        [[nodiscard]] vec4ia wwwx() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(0, 3, 3, 3))); }
-        [[nodiscard]] vec4ia wwwy() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(1, 3, 3, 3))); }
-        [[nodiscard]] vec4ia wwwz() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(2, 3, 3, 3))); }
-        [[nodiscard]] vec4ia wwww() const noexcept { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(m128), _MM_SHUFFLE(3, 3, 3, 3))); }
-#endif
+        [[nodiscard]] vec4ia xxx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xxy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xxz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xyx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xyy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xyz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xzx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xzy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xzz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yxx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yxy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yxz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yyx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yyy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yyz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yzx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yzy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yzz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zxx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zxy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zxz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zyx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zyy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zyz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zzx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zzy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zzz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 2, 2)>(_mm_castsi128_ps(m128))); }
+
+        [[nodiscard]] vec4ia xxxx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xxxy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 0, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xxxz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 0, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xxxw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 0, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xxyx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xxyy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 1, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xxyz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 1, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xxyw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 1, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xxzx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xxzy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 2, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xxzz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 2, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xxzw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 2, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xxwx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 3, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xxwy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 3, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xxwz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 3, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xxww() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 3, 0, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xyxx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xyxy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 0, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xyxz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 0, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xyxw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 0, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xyyx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xyyy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 1, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xyyz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 1, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xyyw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 1, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xyzx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xyzy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 2, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xyzz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 2, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xyzw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 2, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xywx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 3, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xywy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 3, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xywz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 3, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xyww() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 3, 1, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xzxx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xzxy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 0, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xzxz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 0, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xzxw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 0, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xzyx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xzyy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 1, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xzyz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 1, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xzyw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 1, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xzzx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xzzy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 2, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xzzz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 2, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xzzw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 2, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xzwx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 3, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xzwy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 3, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xzwz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 3, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xzww() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 3, 2, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xwxx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 3, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xwxy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 0, 3, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xwxz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 0, 3, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xwxw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 0, 3, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xwyx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 3, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xwyy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 1, 3, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xwyz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 1, 3, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xwyw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 1, 3, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xwzx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 3, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xwzy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 2, 3, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xwzz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 2, 3, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xwzw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 2, 3, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xwwx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 3, 3, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xwwy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 3, 3, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xwwz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 3, 3, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia xwww() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 3, 3, 0)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yxxx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yxxy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 0, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yxxz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 0, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yxxw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 0, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yxyx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yxyy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 1, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yxyz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 1, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yxyw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 1, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yxzx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yxzy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 2, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yxzz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 2, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yxzw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 2, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yxwx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 3, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yxwy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 3, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yxwz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 3, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yxww() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 3, 0, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yyxx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yyxy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 0, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yyxz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 0, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yyxw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 0, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yyyx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yyyy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 1, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yyyz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 1, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yyyw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 1, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yyzx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yyzy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 2, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yyzz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 2, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yyzw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 2, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yywx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 3, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yywy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 3, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yywz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 3, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yyww() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 3, 1, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yzxx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yzxy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 0, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yzxz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 0, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yzxw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 0, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yzyx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yzyy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 1, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yzyz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 1, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yzyw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 1, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yzzx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yzzy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 2, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yzzz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 2, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yzzw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 2, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yzwx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 3, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yzwy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 3, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yzwz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 3, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia yzww() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 3, 2, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia ywxx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 3, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia ywxy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 0, 3, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia ywxz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 0, 3, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia ywxw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 0, 3, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia ywyx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 3, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia ywyy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 1, 3, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia ywyz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 1, 3, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia ywyw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 1, 3, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia ywzx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 3, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia ywzy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 2, 3, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia ywzz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 2, 3, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia ywzw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 2, 3, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia ywwx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 3, 3, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia ywwy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 3, 3, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia ywwz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 3, 3, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia ywww() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 3, 3, 1)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zxxx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zxxy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 0, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zxxz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 0, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zxxw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 0, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zxyx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zxyy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 1, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zxyz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 1, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zxyw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 1, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zxzx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zxzy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 2, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zxzz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 2, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zxzw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 2, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zxwx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 3, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zxwy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 3, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zxwz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 3, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zxww() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 3, 0, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zyxx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zyxy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 0, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zyxz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 0, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zyxw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 0, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zyyx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zyyy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 1, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zyyz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 1, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zyyw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 1, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zyzx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zyzy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 2, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zyzz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 2, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zyzw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 2, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zywx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 3, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zywy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 3, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zywz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 3, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zyww() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 3, 1, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zzxx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zzxy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 0, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zzxz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 0, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zzxw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 0, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zzyx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zzyy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 1, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zzyz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 1, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zzyw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 1, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zzzx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zzzy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 2, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zzzz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 2, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zzzw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 2, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zzwx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 3, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zzwy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 3, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zzwz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 3, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zzww() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 3, 2, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zwxx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 3, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zwxy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 0, 3, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zwxz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 0, 3, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zwxw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 0, 3, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zwyx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 3, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zwyy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 1, 3, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zwyz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 1, 3, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zwyw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 1, 3, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zwzx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 3, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zwzy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 2, 3, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zwzz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 2, 3, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zwzw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 2, 3, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zwwx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 3, 3, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zwwy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 3, 3, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zwwz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 3, 3, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia zwww() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 3, 3, 2)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wxxx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 0, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wxxy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 0, 0, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wxxz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 0, 0, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wxxw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 0, 0, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wxyx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 0, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wxyy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 1, 0, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wxyz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 1, 0, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wxyw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 1, 0, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wxzx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 0, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wxzy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 2, 0, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wxzz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 2, 0, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wxzw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 2, 0, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wxwx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 3, 0, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wxwy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 3, 0, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wxwz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 3, 0, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wxww() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 3, 0, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wyxx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 1, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wyxy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 0, 1, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wyxz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 0, 1, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wyxw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 0, 1, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wyyx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 1, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wyyy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 1, 1, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wyyz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 1, 1, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wyyw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 1, 1, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wyzx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 1, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wyzy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 2, 1, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wyzz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 2, 1, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wyzw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 2, 1, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wywx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 3, 1, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wywy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 3, 1, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wywz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 3, 1, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wyww() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 3, 1, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wzxx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 2, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wzxy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 0, 2, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wzxz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 0, 2, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wzxw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 0, 2, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wzyx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 2, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wzyy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 1, 2, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wzyz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 1, 2, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wzyw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 1, 2, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wzzx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 2, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wzzy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 2, 2, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wzzz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 2, 2, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wzzw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 2, 2, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wzwx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 3, 2, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wzwy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 3, 2, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wzwz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 3, 2, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wzww() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 3, 2, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wwxx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 0, 3, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wwxy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 0, 3, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wwxz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 0, 3, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wwxw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 0, 3, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wwyx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 1, 3, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wwyy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 1, 3, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wwyz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 1, 3, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wwyw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 1, 3, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wwzx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 2, 3, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wwzy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 2, 3, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wwzz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 2, 3, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wwzw() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 2, 3, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wwwx() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(0, 3, 3, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wwwy() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(1, 3, 3, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wwwz() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(2, 3, 3, 3)>(_mm_castsi128_ps(m128))); }
+        [[nodiscard]] vec4ia wwww() const noexcept { return vec4ia(detail::permute<_MM_SHUFFLE(3, 3, 3, 3)>(_mm_castsi128_ps(m128))); }
     };
 
     ////////////////////////////////////////////////////////////////
     // Shuffle.
     ////////////////////////////////////////////////////////////////
 
-#ifdef __AVX__
     template<int32_t i0, int32_t i1, int32_t i2, int32_t i3>
-    [[nodiscard]] vec4ia shuffle(const vec4ia& v) { return vec4ia(_mm_permute_ps(_mm_castsi128_ps(v), _MM_SHUFFLE(i3, i2, i1, i0))); }
-#endif
+    [[nodiscard]] vec4ia shuffle(const vec4ia& v) { return vec4ia(detail::permute<_MM_SHUFFLE(i3, i2, i1, i0)>(_mm_castsi128_ps(v))); }
 
     ////////////////////////////////////////////////////////////////
     // Arithmetic operators.
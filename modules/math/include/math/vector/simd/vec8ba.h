@@ -12,7 +12,7 @@
 // Current target includes.
 ////////////////////////////////////////////////////////////////
 
-#include "math/vector/vector.h"
+#include "math/vector/vec8.h"
 
 namespace math
 {
@@ -42,6 +42,8 @@ namespace math
 
         [[nodiscard]] vec8ba() noexcept : m256(_mm256_set1_epi32(0)) {}
 
+        [[nodiscard]] explicit vec8ba(uninit_t) noexcept {}
+
         [[nodiscard]] explicit vec8ba(const bool b) noexcept : m256(_mm256_set1_epi32(0 - static_cast<int32_t>(b))) {}
 
         [[nodiscard]] vec8ba(const bool a, const bool b, const bool c, const bool d, const bool e, const bool f, const bool g, const bool h) noexcept : m256(_mm256_setr_epi32(0 - static_cast<int32_t>(a), 0 - static_cast<int32_t>(b), 0 - static_cast<int32_t>(c), 0 - static_cast<int32_t>(d), 0 - static_cast<int32_t>(e), 0 - static_cast<int32_t>(f), 0 - static_cast<int32_t>(g), 0 - static_cast<int32_t>(h))) {}
@@ -50,7 +52,7 @@ namespace math
 
         [[nodiscard]] explicit vec8ba(const __m256 m256) noexcept : m256(_mm256_castps_si256(m256)) {}
 
-        [[nodiscard]] vec8ba(const vec8ba & rhs) noexcept : m256(rhs.m256) {}
+        [[nodiscard]] vec8ba(const vec8ba& rhs) noexcept = default;
 
         [[nodiscard]] explicit vec8ba(const vec<bool, 8>& rhs) noexcept : m256(_mm256_setr_epi32(0 - static_cast<int32_t>(rhs[0]), 0 - static_cast<int32_t>(rhs[1]), 0 - static_cast<int32_t>(rhs[2]), 0 - static_cast<int32_t>(rhs[3]), 0 - static_cast<int32_t>(rhs[4]), 0 - static_cast<int32_t>(rhs[5]), 0 - static_cast<int32_t>(rhs[6]), 0 - static_cast<int32_t>(rhs[7]))) {}
 
@@ -58,7 +60,7 @@ namespace math
         // Assignment operators.
         ////////////////////////////////////////////////////////////////
 
-        vec8ba& operator=(const vec8ba& rhs) noexcept { m256 = rhs.m256; return *this; }
+        vec8ba& operator=(const vec8ba& rhs) noexcept = default;
 
         vec8ba& operator=(const bool rhs) noexcept { m256 = _mm256_set1_epi32(0 - static_cast<int32_t>(rhs)); return *this; }
 
@@ -91,6 +93,21 @@ namespace math
         [[nodiscard]] bool operator[](const size_t i) const { assert(i < 8); return static_cast<bool>((_mm256_movemask_ps(_mm256_castsi256_ps(m256)) >> i) & 0x1); }
 
         [[nodiscard]] int32_t& operator[](const size_t i) { assert(i < 8); return ints[i]; }
+
+        ////////////////////////////////////////////////////////////////
+        // Construct special values.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * @brief Mask with the first n lanes set, for loads and stores of loop tails.
+         */
+        [[nodiscard]] static vec8ba first(const size_t n) noexcept
+        {
+            assert(n <= 8);
+            // Sliding window over a table instead of a comparison, which would need AVX2.
+            static constexpr int32_t table[16] = {-1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0};
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(table + 8 - n));
+        }
     };
 
     ////////////////////////////////////////////////////////////////
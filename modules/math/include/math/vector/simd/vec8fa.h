@@ -14,6 +14,7 @@
 
 #include "math/vector/simd/vec4fa.h"
 #include "math/vector/simd/vec8ba.h"
+#include "math/vector/simd/vec8ia.h"
 
 namespace math
 {
@@ -42,6 +43,8 @@ namespace math
 
         [[nodiscard]] vec8fa() noexcept : m256(_mm256_set1_ps(0)) {}
 
+        [[nodiscard]] explicit vec8fa(uninit_t) noexcept {}
+
         [[nodiscard]] explicit vec8fa(const float v) noexcept : m256(_mm256_set1_ps(v)) {}
 
         [[nodiscard]] vec8fa(const float a, const float b, const float c, const float d, const float e, const float f, const float g, const float h) noexcept : m256(_mm256_setr_ps(a, b, c, d, e, f, g, h)) {}
@@ -50,19 +53,19 @@ namespace math
 
         [[nodiscard]] explicit vec8fa(const __m256i m256)  noexcept : m256(_mm256_castsi256_ps(m256)) {}
 
-        [[nodiscard]] vec8fa(const vec8fa& rhs) noexcept : m256(rhs.m256) {}
+        [[nodiscard]] vec8fa(const vec8fa& rhs) noexcept = default;
 
         [[nodiscard]] vec8fa(const __m128 low, const __m128 high) noexcept : m256(_mm256_set_m128(high, low)) {}
 
         [[nodiscard]] vec8fa(const vec4fa& low, const vec4fa& high) noexcept : m256(_mm256_set_m128(high, low)) {}
 
-        [[nodiscard]] explicit vec8fa(const vec<float, 8>& rhs) noexcept : m256(_mm256_setr_ps(rhs[0], rhs[1], rhs[2], rhs[3], rhs[4], rhs[5], rhs[6], rhs[7])) {}
+        [[nodiscard]] explicit vec8fa(const vec<float, 8>& rhs) noexcept : m256(_mm256_loadu_ps(&rhs.a)) {}
 
         ////////////////////////////////////////////////////////////////
         // Assignment operators.
         ////////////////////////////////////////////////////////////////
 
-        vec8fa& operator=(const vec8fa& rhs) noexcept { m256 = rhs.m256; return *this; }
+        vec8fa& operator=(const vec8fa& rhs) noexcept = default;
 
         vec8fa& operator=(const float rhs) noexcept { m256 = _mm256_set1_ps(rhs); return *this; }
 
@@ -78,6 +81,58 @@ namespace math
 
         static void storeu(void* ptr, const vec8fa& v) { _mm256_storeu_ps(static_cast<float*>(ptr), v.m256); }
 
+        /**
+         * @brief Load the lanes that are set in mask and zero the others. Memory of lanes that are not set is not accessed.
+         */
+        [[nodiscard]] static vec8fa loadu(const void* const ptr, const vec8ba& mask) { return _mm256_maskload_ps(static_cast<const float*>(ptr), mask); }
+
+        /**
+         * @brief Load the first count elements, e.g. for the tail of a loop.
+         */
+        [[nodiscard]] static vec8fa loadu(const void* const ptr, const size_t count) { return loadu(ptr, vec8ba::first(count)); }
+
+        /**
+         * @brief Store the lanes that are set in mask. Memory of lanes that are not set is not accessed.
+         */
+        static void storeu(void* ptr, const vec8fa& v, const vec8ba& mask) { _mm256_maskstore_ps(static_cast<float*>(ptr), mask, v.m256); }
+
+        /**
+         * @brief Store the first count elements, e.g. for the tail of a loop.
+         */
+        static void storeu(void* ptr, const vec8fa& v, const size_t count) { storeu(ptr, v, vec8ba::first(count)); }
+
+        /**
+         * @brief Load base[indices[i]] into lane i.
+         */
+        [[nodiscard]] static vec8fa gather(const float* base, const vec8ia& indices)
+        {
+#ifdef __AVX2__
+            return _mm256_i32gather_ps(base, indices, 4);
+#else
+            vec8fa v(uninit);
+            for (size_t i = 0; i < 8; i++) v[i] = base[indices[i]];
+            return v;
+#endif
+        }
+
+        /**
+         * @brief Store lane i to base[indices[i]]. Lanes are written in order, so for duplicate indices the highest lane wins.
+         */
+        static void scatter(float* base, const vec8ia& indices, const vec8fa& v)
+        {
+#if defined(__AVX512F__) && defined(__AVX512VL__)
+            _mm256_i32scatter_ps(base, indices, v, 4);
+#else
+            for (size_t i = 0; i < 8; i++) base[indices[i]] = v[i];
+#endif
+        }
+
+        /**
+         * @brief Non-temporal store to aligned memory, bypassing the caches. Use for large outputs that are not read again soon.
+         * Other threads are only guaranteed to see the data after an _mm_sfence().
+         */
+        static void stream(void* ptr, const vec8fa& v) { _mm256_stream_ps(static_cast<float*>(ptr), v.m256); }
+
         ////////////////////////////////////////////////////////////////
         // Defaulted constructors and operators.
         ////////////////////////////////////////////////////////////////
@@ -98,7 +153,7 @@ namespace math
 
         [[nodiscard]] explicit operator __m256i () const noexcept { return _mm256_castps_si256(m256); }
 
-        [[nodiscard]] explicit operator vec<float, 8>() const noexcept { return vec<float, 8>(data[0], data[1], data[2], data[3], data[4], data[5], data[6], data[7]); }
+        [[nodiscard]] explicit operator vec<float, 8>() const noexcept { vec<float, 8> v(uninit); _mm256_storeu_ps(&v.a, m256); return v; }
 
         ////////////////////////////////////////////////////////////////
         // Element access.
@@ -45,6 +45,8 @@ namespace math
 
         [[nodiscard]] vec8ia() noexcept : m256(_mm256_set1_epi32(0)) {}
 
+        [[nodiscard]] explicit vec8ia(uninit_t) noexcept {}
+
         [[nodiscard]] explicit vec8ia(const int32_t v) noexcept : m256(_mm256_set1_epi32(v)) {}
 
         [[nodiscard]] vec8ia(const int32_t a, const int32_t b, const int32_t c, const int32_t d, const int32_t e, const int32_t f, const int32_t g, const int32_t h) noexcept : m256(_mm256_setr_epi32(a, b, c, d, e, f, g, h)) {}
@@ -53,19 +55,19 @@ namespace math
 
         [[nodiscard]] explicit vec8ia(const __m256 m256) noexcept : m256(_mm256_castps_si256(m256)) {}
 
-        [[nodiscard]] vec8ia(const vec8ia& rhs) noexcept : m256(rhs.m256) {}
+        [[nodiscard]] vec8ia(const vec8ia& rhs) noexcept = default;
 
         [[nodiscard]] vec8ia(const __m128i low, const __m128i high) noexcept : m256(_mm256_set_m128i(high, low)) {}
 
         [[nodiscard]] vec8ia(const vec4ia& low, const vec4ia& high) noexcept : m256(_mm256_set_m128i(high, low)) {}
 
-        [[nodiscard]] explicit vec8ia(const vec<int32_t, 8>& rhs) noexcept : m256(_mm256_setr_epi32(rhs[0], rhs[1], rhs[2], rhs[3], rhs[4], rhs[5], rhs[6], rhs[7])) {}
+        [[nodiscard]] explicit vec8ia(const vec<int32_t, 8>& rhs) noexcept : m256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&rhs.a))) {}
 
         ////////////////////////////////////////////////////////////////
         // Assignment operators.
         ////////////////////////////////////////////////////////////////
 
-        vec8ia& operator=(const vec8ia& rhs) noexcept { m256 = rhs.m256; return *this; }
+        vec8ia& operator=(const vec8ia& rhs) noexcept = default;
 
         vec8ia& operator=(const int32_t rhs) noexcept { m256 = _mm256_set1_epi32(rhs); return *this; }
 
@@ -81,6 +83,58 @@ namespace math
 
         static void storeu(void* ptr, const vec8ia & v) { _mm256_storeu_si256(static_cast<__m256i*>(ptr), v.m256); }
 
+        /**
+         * @brief Load the lanes that are set in mask and zero the others. Memory of lanes that are not set is not accessed.
+         */
+        [[nodiscard]] static vec8ia loadu(const void* const ptr, const vec8ba& mask) { return vec8ia(_mm256_castps_si256(_mm256_maskload_ps(static_cast<const float*>(ptr), mask))); }
+
+        /**
+         * @brief Load the first count elements, e.g. for the tail of a loop.
+         */
+        [[nodiscard]] static vec8ia loadu(const void* const ptr, const size_t count) { return loadu(ptr, vec8ba::first(count)); }
+
+        /**
+         * @brief Store the lanes that are set in mask. Memory of lanes that are not set is not accessed.
+         */
+        static void storeu(void* ptr, const vec8ia& v, const vec8ba& mask) { _mm256_maskstore_ps(static_cast<float*>(ptr), mask, _mm256_castsi256_ps(v.m256)); }
+
+        /**
+         * @brief Store the first count elements, e.g. for the tail of a loop.
+         */
+        static void storeu(void* ptr, const vec8ia& v, const size_t count) { storeu(ptr, v, vec8ba::first(count)); }
+
+        /**
+         * @brief Load base[indices[i]] into lane i.
+         */
+        [[nodiscard]] static vec8ia gather(const int32_t* base, const vec8ia& indices)
+        {
+#ifdef __AVX2__
+            return vec8ia(_mm256_i32gather_epi32(base, indices, 4));
+#else
+            vec8ia v(uninit);
+            for (size_t i = 0; i < 8; i++) v[i] = base[indices[i]];
+            return v;
+#endif
+        }
+
+        /**
+         * @brief Store lane i to base[indices[i]]. Lanes are written in order, so for duplicate indices the highest lane wins.
+         */
+        static void scatter(int32_t* base, const vec8ia& indices, const vec8ia& v)
+        {
+#if defined(__AVX512F__) && defined(__AVX512VL__)
+            _mm256_i32scatter_epi32(base, indices, v, 4);
+#else
+            for (size_t i = 0; i < 8; i++) base[indices[i]] = v[i];
+#endif
+        }
+
+        /**
+         * @brief Non-temporal store to aligned memory, bypassing the caches. Use for large outputs that are not read again soon.
+         * Other threads are only guaranteed to see the data after an _mm_sfence().
+         */
+        static void stream(void* ptr, const vec8ia& v) { _mm256_stream_si256(static_cast<__m256i*>(ptr), v.m256); }
+
         ////////////////////////////////////////////////////////////////
         // Defaulted constructors and operators.
         ////////////////////////////////////////////////////////////////
@@ -101,7 +155,7 @@ namespace math
         
         [[nodiscard]] explicit operator __m256 () const noexcept { return _mm256_castsi256_ps(m256); }
 
-        [[nodiscard]] explicit operator vec<int32_t, 8>() const noexcept { return vec<int32_t, 8>(data[0], data[1], data[2], data[3], data[4], data[5], data[6], data[7]); }
+        [[nodiscard]] explicit operator vec<int32_t, 8>() const noexcept { vec<int32_t, 8> v(uninit); _mm256_storeu_si256(reinterpret_cast<__m256i*>(&v.a), m256); return v; }
 
         ////////////////////////////////////////////////////////////////
         // Element access.
@@ -30,38 +30,42 @@ namespace math
 
         // Default.
 
-        [[nodiscard]] vec() noexcept : x(0), y(0) {}
+        [[nodiscard]] constexpr vec() noexcept : x(0), y(0) {}
+
+        // Uninitialized.
+
+        [[nodiscard]] constexpr explicit vec(uninit_t) noexcept {}
 
         // From values.
 
-        [[nodiscard]] explicit vec(const T v) noexcept : x(v), y(v) {}
+        [[nodiscard]] constexpr explicit vec(const T v) noexcept : x(v), y(v) {}
 
-        [[nodiscard]] vec(const T x, const T y) noexcept : x(x), y(y) {}
+        [[nodiscard]] constexpr vec(const T x, const T y) noexcept : x(x), y(y) {}
 
         // From convertible values.
 
         template<std::convertible_to<T> U>
-        [[nodiscard]] explicit vec(const U v) : x(static_cast<T>(v)), y(static_cast<T>(v)) {}
+        [[nodiscard]] constexpr explicit vec(const U v) : x(static_cast<T>(v)), y(static_cast<T>(v)) {}
 
         template<std::convertible_to<T> U>
-        [[nodiscard]] vec(const U x, const U y) : x(static_cast<T>(x)), y(static_cast<T>(y)) {}
+        [[nodiscard]] constexpr vec(const U x, const U y) : x(static_cast<T>(x)), y(static_cast<T>(y)) {}
 
         // From pointer.
 
-        [[nodiscard]] explicit vec(const T* ptr) : x(ptr[0]), y(ptr[1]) {}
+        [[nodiscard]] constexpr explicit vec(const T* ptr) : x(ptr[0]), y(ptr[1]) {}
 
         // Copy.
 
-        [[nodiscard]] vec(const vec<T, 2>& rhs) noexcept : x(rhs.x), y(rhs.y) {}
+        [[nodiscard]] constexpr vec(const vec<T, 2>& rhs) noexcept = default;
 
         // Move.
 
-        [[nodiscard]] vec(vec<T, 2>&& rhs) noexcept : x(rhs.x), y(rhs.y) {}
+        [[nodiscard]] constexpr vec(vec<T, 2>&& rhs) noexcept = default;
 
         // Copy from convertible.
 
         template<std::convertible_to<T> U>
-        [[nodiscard]] explicit vec(const vec<U, 2>& rhs) : x(static_cast<T>(rhs.x)), y(static_cast<T>(rhs.y)) {}
+        [[nodiscard]] constexpr explicit vec(const vec<U, 2>& rhs) : x(static_cast<T>(rhs.x)), y(static_cast<T>(rhs.y)) {}
 
         // Move from convertible.
 
@@ -71,25 +75,25 @@ namespace math
 
         // Copy.
 
-        vec<T, 2>& operator=(const vec<T, 2>& rhs) noexcept { x = rhs.x; y = rhs.y; return *this; }
+        constexpr vec<T, 2>& operator=(const vec<T, 2>& rhs) noexcept = default;
 
         // Move.
 
-        vec<T, 2>& operator=(vec<T, 2>&& rhs) noexcept { x = rhs.x; y = rhs.y; return *this; }
+        constexpr vec<T, 2>& operator=(vec<T, 2>&& rhs) noexcept = default;
 
         // Assign from value.
 
-        vec<T, 2>& operator=(const T rhs) noexcept { x = rhs; y = rhs; return *this; }
+        constexpr vec<T, 2>& operator=(const T rhs) noexcept { x = rhs; y = rhs; return *this; }
 
         // Assign from convertible value.
 
         template<std::convertible_to<T> U>
-        vec<T, 2>& operator=(const U rhs) { x = static_cast<T>(rhs); y = static_cast<T>(rhs); return *this; }
+        constexpr vec<T, 2>& operator=(const U rhs) { x = static_cast<T>(rhs); y = static_cast<T>(rhs); return *this; }
 
         // Assign from convertible.
 
         template<std::convertible_to<T> U>
-        vec<T, 2>& operator=(const vec<U, 2>& rhs) { x = static_cast<T>(rhs.x); y = static_cast<T>(rhs.y); return *this; }
+        constexpr vec<T, 2>& operator=(const vec<U, 2>& rhs) { x = static_cast<T>(rhs.x); y = static_cast<T>(rhs.y); return *this; }
 
         ////////////////////////////////////////////////////////////////
         // Destructor.
@@ -101,18 +105,36 @@ namespace math
         // Element access.
         ////////////////////////////////////////////////////////////////
 
-        [[nodiscard]] const T& operator[](const size_t i) const { assert(i < 2); return (&x)[i]; }
-
-        [[nodiscard]] T& operator[](const size_t i) { assert(i < 2); return (&x)[i]; }
+        [[nodiscard]] constexpr const T& operator[](const size_t i) const
+        {
+            assert(i < 2);
+            if consteval
+            {
+                const T* const members[] = { &x, &y };
+                return *members[i];
+            }
+            return (&x)[i];
+        }
+
+        [[nodiscard]] constexpr T& operator[](const size_t i)
+        {
+            assert(i < 2);
+            if consteval
+            {
+                T* const members[] = { &x, &y };
+                return *members[i];
+            }
+            return (&x)[i];
+        }
 
         ////////////////////////////////////////////////////////////////
         // Swizzling.
         ////////////////////////////////////////////////////////////////
 
-        [[nodiscard]] vec<T, 2> xx() const noexcept { return vec<T, 2>(x, x); }
-        [[nodiscard]] vec<T, 2> xy() const noexcept { return vec<T, 2>(x, y); }
-        [[nodiscard]] vec<T, 2> yx() const noexcept { return vec<T, 2>(y, x); }
-        [[nodiscard]] vec<T, 2> yy() const noexcept { return vec<T, 2>(y, y); }
+        [[nodiscard]] constexpr vec<T, 2> xx() const noexcept { return vec<T, 2>(x, x); }
+        [[nodiscard]] constexpr vec<T, 2> xy() const noexcept { return vec<T, 2>(x, y); }
+        [[nodiscard]] constexpr vec<T, 2> yx() const noexcept { return vec<T, 2>(y, x); }
+        [[nodiscard]] constexpr vec<T, 2> yy() const noexcept { return vec<T, 2>(y, y); }
     };
 
     ////////////////////////////////////////////////////////////////
@@ -142,127 +164,127 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 2> operator+(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs.x + rhs.x, lhs.y + rhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator+(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs.x + rhs.x, lhs.y + rhs.y); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 2> operator+(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<T, 2>(lhs.x + rhs, lhs.y + rhs); }
+    [[nodiscard]] constexpr vec<T, 2> operator+(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<T, 2>(lhs.x + rhs, lhs.y + rhs); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 2> operator+(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs + rhs.x, lhs + rhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator+(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs + rhs.x, lhs + rhs.y); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 2> operator-(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs.x - rhs.x, lhs.y - rhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator-(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs.x - rhs.x, lhs.y - rhs.y); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 2> operator-(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<T, 2>(lhs.x - rhs, lhs.y - rhs); }
+    [[nodiscard]] constexpr vec<T, 2> operator-(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<T, 2>(lhs.x - rhs, lhs.y - rhs); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 2> operator-(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs - rhs.x, lhs - rhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator-(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs - rhs.x, lhs - rhs.y); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 2> operator-(const vec<T, 2>& lhs) noexcept { return vec<T, 2>(-lhs.x, -lhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator-(const vec<T, 2>& lhs) noexcept { return vec<T, 2>(-lhs.x, -lhs.y); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 2> operator*(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs.x * rhs.x, lhs.y * rhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator*(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs.x * rhs.x, lhs.y * rhs.y); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 2> operator*(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<T, 2>(lhs.x * rhs, lhs.y * rhs); }
+    [[nodiscard]] constexpr vec<T, 2> operator*(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<T, 2>(lhs.x * rhs, lhs.y * rhs); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 2> operator*(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs * rhs.x, lhs * rhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator*(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs * rhs.x, lhs * rhs.y); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 2> operator/(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs.x / rhs.x, lhs.y / rhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator/(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs.x / rhs.x, lhs.y / rhs.y); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 2> operator/(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<T, 2>(lhs.x / rhs, lhs.y / rhs); }
+    [[nodiscard]] constexpr vec<T, 2> operator/(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<T, 2>(lhs.x / rhs, lhs.y / rhs); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 2> operator/(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs / rhs.x, lhs / rhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator/(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs / rhs.x, lhs / rhs.y); }
 
     ////////////////////////////////////////////////////////////////
     // Comparison operators.
     ////////////////////////////////////////////////////////////////
 
     template<std::equality_comparable T>
-    [[nodiscard]] bool operator==(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return lhs.x == rhs.x && lhs.y == rhs.y; }
+    [[nodiscard]] constexpr bool operator==(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return lhs.x == rhs.x && lhs.y == rhs.y; }
 
     template<std::equality_comparable T>
-    [[nodiscard]] bool operator!=(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return lhs.x != rhs.x || lhs.y != rhs.y; }
+    [[nodiscard]] constexpr bool operator!=(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return lhs.x != rhs.x || lhs.y != rhs.y; }
 
     ////////////////////////////////////////////////////////////////
     // Per-element comparisons.
     ////////////////////////////////////////////////////////////////
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 2> cmpeq(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs.x == rhs.x, lhs.y == rhs.y); }
+    [[nodiscard]] constexpr vec<bool, 2> cmpeq(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs.x == rhs.x, lhs.y == rhs.y); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 2> cmpeq(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<bool, 2>(lhs.x == rhs, lhs.y == rhs); }
+    [[nodiscard]] constexpr vec<bool, 2> cmpeq(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<bool, 2>(lhs.x == rhs, lhs.y == rhs); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 2> cmpeq(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs == rhs.x, lhs == rhs.y); }
+    [[nodiscard]] constexpr vec<bool, 2> cmpeq(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs == rhs.x, lhs == rhs.y); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 2> cmpneq(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs.x != rhs.x, lhs.y != rhs.y); }
+    [[nodiscard]] constexpr vec<bool, 2> cmpneq(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs.x != rhs.x, lhs.y != rhs.y); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 2> cmpneq(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<bool, 2>(lhs.x != rhs, lhs.y != rhs); }
+    [[nodiscard]] constexpr vec<bool, 2> cmpneq(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<bool, 2>(lhs.x != rhs, lhs.y != rhs); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 2> cmpneq(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs != rhs.x, lhs != rhs.y); }
+    [[nodiscard]] constexpr vec<bool, 2> cmpneq(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs != rhs.x, lhs != rhs.y); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 2> cmplt(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs.x < rhs.x, lhs.y < rhs.y); }
+    [[nodiscard]] constexpr vec<bool, 2> cmplt(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs.x < rhs.x, lhs.y < rhs.y); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 2> cmplt(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<bool, 2>(lhs.x < rhs, lhs.y < rhs); }
+    [[nodiscard]] constexpr vec<bool, 2> cmplt(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<bool, 2>(lhs.x < rhs, lhs.y < rhs); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 2> cmplt(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs < rhs.x, lhs < rhs.y); }
+    [[nodiscard]] constexpr vec<bool, 2> cmplt(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs < rhs.x, lhs < rhs.y); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 2> cmpgt(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs.x > rhs.x, lhs.y > rhs.y); }
+    [[nodiscard]] constexpr vec<bool, 2> cmpgt(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs.x > rhs.x, lhs.y > rhs.y); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 2> cmpgt(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<bool, 2>(lhs.x > rhs, lhs.y > rhs); }
+    [[nodiscard]] constexpr vec<bool, 2> cmpgt(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<bool, 2>(lhs.x > rhs, lhs.y > rhs); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 2> cmpgt(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs > rhs.x, lhs > rhs.y); }
+    [[nodiscard]] constexpr vec<bool, 2> cmpgt(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs > rhs.x, lhs > rhs.y); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 2> cmple(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs.x <= rhs.x, lhs.y <= rhs.y); }
+    [[nodiscard]] constexpr vec<bool, 2> cmple(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs.x <= rhs.x, lhs.y <= rhs.y); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 2> cmple(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<bool, 2>(lhs.x <= rhs, lhs.y <= rhs); }
+    [[nodiscard]] constexpr vec<bool, 2> cmple(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<bool, 2>(lhs.x <= rhs, lhs.y <= rhs); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 2> cmple(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs <= rhs.x, lhs <= rhs.y); }
+    [[nodiscard]] constexpr vec<bool, 2> cmple(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs <= rhs.x, lhs <= rhs.y); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 2> cmpge(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs.x >= rhs.x, lhs.y >= rhs.y); }
+    [[nodiscard]] constexpr vec<bool, 2> cmpge(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs.x >= rhs.x, lhs.y >= rhs.y); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 2> cmpge(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<bool, 2>(lhs.x >= rhs, lhs.y >= rhs); }
+    [[nodiscard]] constexpr vec<bool, 2> cmpge(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<bool, 2>(lhs.x >= rhs, lhs.y >= rhs); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 2> cmpge(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs >= rhs.x, lhs >= rhs.y); }
+    [[nodiscard]] constexpr vec<bool, 2> cmpge(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<bool, 2>(lhs >= rhs.x, lhs >= rhs.y); }
 
     ////////////////////////////////////////////////////////////////
     // Dot product etc.
     ////////////////////////////////////////////////////////////////
 
     template<arithmetic T>
-    [[nodiscard]] T dot(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return lhs.x * rhs.x + lhs.y * rhs.y; }
+    [[nodiscard]] constexpr T dot(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return lhs.x * rhs.x + lhs.y * rhs.y; }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 2> cross(const vec<T, 2>& lhs) noexcept { return vec<T, 2>(-lhs.y, lhs.x); }
+    [[nodiscard]] constexpr vec<T, 2> cross(const vec<T, 2>& lhs) noexcept { return vec<T, 2>(-lhs.y, lhs.x); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 2> lerp(const vec<T, 2>& a, const vec<T, 2>& b, const vec<T, 2>& t) noexcept { return vec<T, 2>(lerp(a.x, b.x, t.x), lerp(a.y, b.y, t.y)); }
+    [[nodiscard]] constexpr vec<T, 2> lerp(const vec<T, 2>& a, const vec<T, 2>& b, const vec<T, 2>& t) noexcept { return vec<T, 2>(lerp(a.x, b.x, t.x), lerp(a.y, b.y, t.y)); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 2> lerp(const vec<T, 2>& a, const vec<T, 2>& b, const T t) noexcept { return vec<T, 2>(lerp( a.x, b.x, t), lerp(a.y, b.y, t)); }
+    [[nodiscard]] constexpr vec<T, 2> lerp(const vec<T, 2>& a, const vec<T, 2>& b, const T t) noexcept { return vec<T, 2>(lerp( a.x, b.x, t), lerp(a.y, b.y, t)); }
 
     ////////////////////////////////////////////////////////////////
     // Trigonometry.
@@ -400,7 +422,7 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<typename T>
-    [[nodiscard]] vec<T, 2> select(const vec<T, 2>& t, const vec<T, 2>& f, const vec<bool, 2>& b) noexcept { return vec<T, 2>(select(t.x, f.x, b.x), select(t.y, f.y, b.y)); }
+    [[nodiscard]] constexpr vec<T, 2> select(const vec<T, 2>& t, const vec<T, 2>& f, const vec<bool, 2>& b) noexcept { return vec<T, 2>(select(t.x, f.x, b.x), select(t.y, f.y, b.y)); }
 
     ////////////////////////////////////////////////////////////////
     // Multiply and add.
@@ -439,64 +461,64 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<std::integral T, std::integral U>
-    [[nodiscard]] vec<T, 2> operator<<(const vec<T, 2>& lhs, const vec<U, 2>& rhs) noexcept { return vec<T, 2>(lhs.x << rhs.x, lhs.y << rhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator<<(const vec<T, 2>& lhs, const vec<U, 2>& rhs) noexcept { return vec<T, 2>(lhs.x << rhs.x, lhs.y << rhs.y); }
 
     template<std::integral T, std::integral U>
-    [[nodiscard]] vec<T, 2> operator<<(const vec<T, 2>& lhs, const U rhs) noexcept { return vec<T, 2>(lhs.x << rhs, lhs.y << rhs); }
+    [[nodiscard]] constexpr vec<T, 2> operator<<(const vec<T, 2>& lhs, const U rhs) noexcept { return vec<T, 2>(lhs.x << rhs, lhs.y << rhs); }
 
     template<std::integral T, std::integral U>
-    [[nodiscard]] vec<T, 2> operator<<(const T lhs, const vec<U, 2>& rhs) noexcept { return vec<T, 2>(lhs << rhs.x, lhs << rhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator<<(const T lhs, const vec<U, 2>& rhs) noexcept { return vec<T, 2>(lhs << rhs.x, lhs << rhs.y); }
 
     template<std::integral T, std::integral U>
-    [[nodiscard]] vec<T, 2> operator>>(const vec<T, 2>& lhs, const vec<U, 2>& rhs) noexcept { return vec<T, 2>(lhs.x >> rhs.x, lhs.y >> rhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator>>(const vec<T, 2>& lhs, const vec<U, 2>& rhs) noexcept { return vec<T, 2>(lhs.x >> rhs.x, lhs.y >> rhs.y); }
 
     template<std::integral T, std::integral U>
-    [[nodiscard]] vec<T, 2> operator>>(const vec<T, 2>& lhs, const U rhs) noexcept { return vec<T, 2>(lhs.x >> rhs, lhs.y >> rhs); }
+    [[nodiscard]] constexpr vec<T, 2> operator>>(const vec<T, 2>& lhs, const U rhs) noexcept { return vec<T, 2>(lhs.x >> rhs, lhs.y >> rhs); }
 
     template<std::integral T, std::integral U>
-    [[nodiscard]] vec<T, 2> operator>>(const T lhs, const vec<U, 2>& rhs) noexcept { return vec<T, 2>(lhs >> rhs.x, lhs >> rhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator>>(const T lhs, const vec<U, 2>& rhs) noexcept { return vec<T, 2>(lhs >> rhs.x, lhs >> rhs.y); }
 
     ////////////////////////////////////////////////////////////////
     // Bitwise operators.
     ////////////////////////////////////////////////////////////////
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 2> operator|(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs.x | rhs.x, lhs.y | rhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator|(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs.x | rhs.x, lhs.y | rhs.y); }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 2> operator|(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<T, 2>(lhs.x | rhs, lhs.y | rhs); }
+    [[nodiscard]] constexpr vec<T, 2> operator|(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<T, 2>(lhs.x | rhs, lhs.y | rhs); }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 2> operator|(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs | rhs.x, lhs | rhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator|(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs | rhs.x, lhs | rhs.y); }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 2> operator&(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs.x & rhs.x, lhs.y & rhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator&(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs.x & rhs.x, lhs.y & rhs.y); }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 2> operator&(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<T, 2>(lhs.x & rhs, lhs.y & rhs); }
+    [[nodiscard]] constexpr vec<T, 2> operator&(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<T, 2>(lhs.x & rhs, lhs.y & rhs); }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 2> operator&(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs & rhs.x, lhs & rhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator&(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs & rhs.x, lhs & rhs.y); }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 2> operator^(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs.x ^ rhs.x, lhs.y ^ rhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator^(const vec<T, 2>& lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs.x ^ rhs.x, lhs.y ^ rhs.y); }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 2> operator^(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<T, 2>(lhs.x ^ rhs, lhs.y ^ rhs); }
+    [[nodiscard]] constexpr vec<T, 2> operator^(const vec<T, 2>& lhs, const T rhs) noexcept { return vec<T, 2>(lhs.x ^ rhs, lhs.y ^ rhs); }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 2> operator^(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs ^ rhs.x, lhs ^ rhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator^(const T lhs, const vec<T, 2>& rhs) noexcept { return vec<T, 2>(lhs ^ rhs.x, lhs ^ rhs.y); }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 2> operator~(const vec<T, 2>& lhs) noexcept { return vec<T, 2>(~lhs.x, ~lhs.y); }
+    [[nodiscard]] constexpr vec<T, 2> operator~(const vec<T, 2>& lhs) noexcept { return vec<T, 2>(~lhs.x, ~lhs.y); }
 
     ////////////////////////////////////////////////////////////////
     // Boolean vector reduction.
     ////////////////////////////////////////////////////////////////
 
-    [[nodiscard]] inline bool all(const vec<bool, 2>& lhs) { return lhs.x & lhs.y; }
+    [[nodiscard]] constexpr bool all(const vec<bool, 2>& lhs) { return lhs.x & lhs.y; }
 
-    [[nodiscard]] inline bool any(const vec<bool, 2>& lhs) { return lhs.x | lhs.y; }
+    [[nodiscard]] constexpr bool any(const vec<bool, 2>& lhs) { return lhs.x | lhs.y; }
 
     ////////////////////////////////////////////////////////////////
     // Output.
@@ -31,57 +31,61 @@ namespace math
 
         // Default.
 
-        [[nodiscard]] vec() noexcept : x(0), y(0), z(0) {}
+        [[nodiscard]] constexpr vec() noexcept : x(0), y(0), z(0) {}
+
+        // Uninitialized.
+
+        [[nodiscard]] constexpr explicit vec(uninit_t) noexcept {}
 
         // From values.
 
-        [[nodiscard]] explicit vec(const T v) noexcept : x(v), y(v), z(v) {}
+        [[nodiscard]] constexpr explicit vec(const T v) noexcept : x(v), y(v), z(v) {}
 
-        [[nodiscard]] vec(const T x, const T y) noexcept : x(x), y(y), z(0) {}
+        [[nodiscard]] constexpr vec(const T x, const T y) noexcept : x(x), y(y), z(0) {}
 
-        [[nodiscard]] vec(const T x, const T y, const T z) noexcept : x(x), y(y), z(z) {}
+        [[nodiscard]] constexpr vec(const T x, const T y, const T z) noexcept : x(x), y(y), z(z) {}
 
         // From convertible values.
 
         template<std::convertible_to<T> U>
-        [[nodiscard]] explicit vec(const U v) : x(static_cast<T>(v)), y(static_cast<T>(v)), z(static_cast<T>(v)) {}
+        [[nodiscard]] constexpr explicit vec(const U v) : x(static_cast<T>(v)), y(static_cast<T>(v)), z(static_cast<T>(v)) {}
 
         template<std::convertible_to<T> U>
-        [[nodiscard]] vec(const U x, const U y) : x(static_cast<T>(x)), y(static_cast<T>(y)), z(0) {}
+        [[nodiscard]] constexpr vec(const U x, const U y) : x(static_cast<T>(x)), y(static_cast<T>(y)), z(0) {}
 
         template<std::convertible_to<T> U>
-        [[nodiscard]] vec(const U x, const U y, const U z) : x(static_cast<T>(x)), y(static_cast<T>(y)), z(static_cast<T>(z)) {}
+        [[nodiscard]] constexpr vec(const U x, const U y, const U z) : x(static_cast<T>(x)), y(static_cast<T>(y)), z(static_cast<T>(z)) {}
 
         // From larger vector.
 
         // TODO: These methods must also be implemented for all other vector specializations. Also consider using convertible_to.
 
         template<size_t N2> requires (N2 > 3)
-        [[nodiscard]] vec(const vec<T, N2>& rhs) noexcept : x(rhs[0]), y(rhs[1]), z(rhs[2]) {}
+        [[nodiscard]] constexpr vec(const vec<T, N2>& rhs) noexcept : x(rhs[0]), y(rhs[1]), z(rhs[2]) {}
 
         // From pointer.
 
-        [[nodiscard]] explicit vec(const T* ptr) : x(ptr[0]), y(ptr[1]), z(ptr[2]) {}
+        [[nodiscard]] constexpr explicit vec(const T* ptr) : x(ptr[0]), y(ptr[1]), z(ptr[2]) {}
 
         // Copy.
 
-        [[nodiscard]] vec(const vec<T, 2>& rhs) noexcept : x(rhs.x), y(rhs.y), z(0) {}
+        [[nodiscard]] constexpr vec(const vec<T, 2>& rhs) noexcept : x(rhs.x), y(rhs.y), z(0) {}
 
-        [[nodiscard]] vec(const vec<T, 3>& rhs) noexcept : x(rhs.x), y(rhs.y), z(rhs.z) {}
+        [[nodiscard]] constexpr vec(const vec<T, 3>& rhs) noexcept = default;
 
         // Move.
 
-        [[nodiscard]] vec(vec<T, 2>&& rhs) noexcept : x(rhs.x), y(rhs.y), z(0) {}
+        [[nodiscard]] constexpr vec(vec<T, 2>&& rhs) noexcept : x(rhs.x), y(rhs.y), z(0) {}
 
-        [[nodiscard]] vec(vec<T, 3>&& rhs) noexcept : x(rhs.x), y(rhs.y), z(rhs.z) {}
+        [[nodiscard]] constexpr vec(vec<T, 3>&& rhs) noexcept = default;
 
         // Copy from convertible.
 
         template<std::convertible_to<T> U>
-        [[nodiscard]] explicit vec(const vec<U, 2>& rhs) : x(static_cast<T>(rhs.x)), y(static_cast<T>(rhs.y)), z(0) {}
+        [[nodiscard]] constexpr explicit vec(const vec<U, 2>& rhs) : x(static_cast<T>(rhs.x)), y(static_cast<T>(rhs.y)), z(0) {}
 
         template<std::convertible_to<T> U>
-        [[nodiscard]] explicit vec(const vec<U, 3>& rhs) : x(static_cast<T>(rhs.x)), y(static_cast<T>(rhs.y)), z(static_cast<T>(rhs.z)) {}
+        [[nodiscard]] constexpr explicit vec(const vec<U, 3>& rhs) : x(static_cast<T>(rhs.x)), y(static_cast<T>(rhs.y)), z(static_cast<T>(rhs.z)) {}
         
         // Move from convertible.
 
@@ -93,32 +97,32 @@ namespace math
 
         // Copy.
 
-        vec<T, 3>& operator=(const vec<T, 2>& rhs) noexcept { x = rhs.x; y = rhs.y; z = 0; return *this; }
+        constexpr vec<T, 3>& operator=(const vec<T, 2>& rhs) noexcept { x = rhs.x; y = rhs.y; z = 0; return *this; }
 
-        vec<T, 3>& operator=(const vec<T, 3>& rhs) noexcept { x = rhs.x; y = rhs.y; z = rhs.z; return *this; }
+        constexpr vec<T, 3>& operator=(const vec<T, 3>& rhs) noexcept = default;
 
         // Move.
 
-        vec<T, 3>& operator=(vec<T, 2>&& rhs) noexcept { x = rhs.x; y = rhs.y; z = 0; return *this; }
+        constexpr vec<T, 3>& operator=(vec<T, 2>&& rhs) noexcept { x = rhs.x; y = rhs.y; z = 0; return *this; }
 
-        vec<T, 3>& operator=(vec<T, 3>&& rhs) noexcept { x = rhs.x; y = rhs.y; z = rhs.z; return *this; }
+        constexpr vec<T, 3>& operator=(vec<T, 3>&& rhs) noexcept = default;
 
         // Assign from value.
 
-        vec<T, 3>& operator=(const T rhs) noexcept { x = rhs; y = rhs; z = rhs; return *this; }
+        constexpr vec<T, 3>& operator=(const T rhs) noexcept { x = rhs; y = rhs; z = rhs; return *this; }
 
         // Assign from convertible value.
 
         template<std::convertible_to<T> U>
-        vec<T, 3>& operator=(const U rhs) { x = static_cast<T>(rhs); y = static_cast<T>(rhs); z = static_cast<T>(rhs); return *this; }
+        constexpr vec<T, 3>& operator=(const U rhs) { x = static_cast<T>(rhs); y = static_cast<T>(rhs); z = static_cast<T>(rhs); return *this; }
 
         // Assign from convertible.
 
         template<std::convertible_to<T> U>
-        vec<T, 3>& operator=(const vec<U, 2>& rhs) { x = static_cast<T>(rhs.x); y = static_cast<T>(rhs.y); z = 0; return *this; }
+        constexpr vec<T, 3>& operator=(const vec<U, 2>& rhs) { x = static_cast<T>(rhs.x); y = static_cast<T>(rhs.y); z = 0; return *this; }
 
         template<std::convertible_to<T> U>
-        vec<T, 3>& operator=(const vec<U, 3>& rhs) { x = static_cast<T>(rhs.x); y = static_cast<T>(rhs.y); z = static_cast<T>(rhs.z); return *this; }
+        constexpr vec<T, 3>& operator=(const vec<U, 3>& rhs) { x = static_cast<T>(rhs.x); y = static_cast<T>(rhs.y); z = static_cast<T>(rhs.z); return *this; }
 
         ////////////////////////////////////////////////////////////////
         // Destructor.
@@ -130,51 +134,69 @@ namespace math
         // Element access.
         ////////////////////////////////////////////////////////////////
 
-        [[nodiscard]] const T& operator[](const size_t i) const { assert(i < 3); return (&x)[i]; }
-
-        [[nodiscard]] T& operator[](const size_t i) { assert(i < 3); return (&x)[i]; }
+        [[nodiscard]] constexpr const T& operator[](const size_t i) const
+        {
+            assert(i < 3);
+            if consteval
+            {
+                const T* const members[] = { &x, &y, &z };
+                return *members[i];
+            }
+            return (&x)[i];
+        }
+
+        [[nodiscard]] constexpr T& operator[](const size_t i)
+        {
+            assert(i < 3);
+            if consteval
+            {
+                T* const members[] = { &x, &y, &z };
+                return *members[i];
+            }
+            return (&x)[i];
+        }
 
         ////////////////////////////////////////////////////////////////
         // Swizzling.
         ////////////////////////////////////////////////////////////////
         
-        [[nodiscard]] vec<T, 2> xx() const noexcept { return vec<T, 2>(x, x); }
-        [[nodiscard]] vec<T, 2> xy() const noexcept { return vec<T, 2>(x, y); }
-        [[nodiscard]] vec<T, 2> xz() const noexcept { return vec<T, 2>(x, z); }
-        [[nodiscard]] vec<T, 2> yx() const noexcept { return vec<T, 2>(y, x); }
-        [[nodiscard]] vec<T, 2> yy() const noexcept { return vec<T, 2>(y, y); }
-        [[nodiscard]] vec<T, 2> yz() const noexcept { return vec<T, 2>(y, z); }
-        [[nodiscard]] vec<T, 2> zx() const noexcept { return vec<T, 2>(z, x); }
-        [[nodiscard]] vec<T, 2> zy() const noexcept { return vec<T, 2>(z, y); }
-        [[nodiscard]] vec<T, 2> zz() const noexcept { return vec<T, 2>(z, z); }
-
-        [[nodiscard]] vec<T, 3> xxx() const noexcept { return vec<T, 3>(x, x, x); }
-        [[nodiscard]] vec<T, 3> xxy() const noexcept { return vec<T, 3>(x, x, y); }
-        [[nodiscard]] vec<T, 3> xxz() const noexcept { return vec<T, 3>(x, x, z); }
-        [[nodiscard]] vec<T, 3> xyx() const noexcept { return vec<T, 3>(x, y, x); }
-        [[nodiscard]] vec<T, 3> xyy() const noexcept { return vec<T, 3>(x, y, y); }
-        [[nodiscard]] vec<T, 3> xyz() const noexcept { return vec<T, 3>(x, y, z); }
-        [[nodiscard]] vec<T, 3> xzx() const noexcept { return vec<T, 3>(x, z, x); }
-        [[nodiscard]] vec<T, 3> xzy() const noexcept { return vec<T, 3>(x, z, y); }
-        [[nodiscard]] vec<T, 3> xzz() const noexcept { return vec<T, 3>(x, z, z); }
-        [[nodiscard]] vec<T, 3> yxx() const noexcept { return vec<T, 3>(y, x, x); }
-        [[nodiscard]] vec<T, 3> yxy() const noexcept { return vec<T, 3>(y, x, y); }
-        [[nodiscard]] vec<T, 3> yxz() const noexcept { return vec<T, 3>(y, x, z); }
-        [[nodiscard]] vec<T, 3> yyx() const noexcept { return vec<T, 3>(y, y, x); }
-        [[nodiscard]] vec<T, 3> yyy() const noexcept { return vec<T, 3>(y, y, y); }
-        [[nodiscard]] vec<T, 3> yyz() const noexcept { return vec<T, 3>(y, y, z); }
-        [[nodiscard]] vec<T, 3> yzx() const noexcept { return vec<T, 3>(y, z, x); }
-        [[nodiscard]] vec<T, 3> yzy() const noexcept { return vec<T, 3>(y, z, y); }
-        [[nodiscard]] vec<T, 3> yzz() const noexcept { return vec<T, 3>(y, z, z); }
-        [[nodiscard]] vec<T, 3> zxx() const noexcept { return vec<T, 3>(z, x, x); }
-        [[nodiscard]] vec<T, 3> zxy() const noexcept { return vec<T, 3>(z, x, y); }
-        [[nodiscard]] vec<T, 3> zxz() const noexcept { return vec<T, 3>(z, x, z); }
-        [[nodiscard]] vec<T, 3> zyx() const noexcept { return vec<T, 3>(z, y, x); }
-        [[nodiscard]] vec<T, 3> zyy() const noexcept { return vec<T, 3>(z, y, y); }
-        [[nodiscard]] vec<T, 3> zyz() const noexcept { return vec<T, 3>(z, y, z); }
-        [[nodiscard]] vec<T, 3> zzx() const noexcept { return vec<T, 3>(z, z, x); }
-        [[nodiscard]] vec<T, 3> zzy() const noexcept { return vec<T, 3>(z, z, y); }
-        [[nodiscard]] vec<T, 3> zzz() const noexcept { return vec<T, 3>(z, z, z); }
+        [[nodiscard]] constexpr vec<T, 2> xx() const noexcept { return vec<T, 2>(x, x); }
+        [[nodiscard]] constexpr vec<T, 2> xy() const noexcept { return vec<T, 2>(x, y); }
+        [[nodiscard]] constexpr vec<T, 2> xz() const noexcept { return vec<T, 2>(x, z); }
+        [[nodiscard]] constexpr vec<T, 2> yx() const noexcept { return vec<T, 2>(y, x); }
+        [[nodiscard]] constexpr vec<T, 2> yy() const noexcept { return vec<T, 2>(y, y); }
+        [[nodiscard]] constexpr vec<T, 2> yz() const noexcept { return vec<T, 2>(y, z); }
+        [[nodiscard]] constexpr vec<T, 2> zx() const noexcept { return vec<T, 2>(z, x); }
+        [[nodiscard]] constexpr vec<T, 2> zy() const noexcept { return vec<T, 2>(z, y); }
+        [[nodiscard]] constexpr vec<T, 2> zz() const noexcept { return vec<T, 2>(z, z); }
+
+        [[nodiscard]] constexpr vec<T, 3> xxx() const noexcept { return vec<T, 3>(x, x, x); }
+        [[nodiscard]] constexpr vec<T, 3> xxy() const noexcept { return vec<T, 3>(x, x, y); }
+        [[nodiscard]] constexpr vec<T, 3> xxz() const noexcept { return vec<T, 3>(x, x, z); }
+        [[nodiscard]] constexpr vec<T, 3> xyx() const noexcept { return vec<T, 3>(x, y, x); }
+        [[nodiscard]] constexpr vec<T, 3> xyy() const noexcept { return vec<T, 3>(x, y, y); }
+        [[nodiscard]] constexpr vec<T, 3> xyz() const noexcept { return vec<T, 3>(x, y, z); }
+        [[nodiscard]] constexpr vec<T, 3> xzx() const noexcept { return vec<T, 3>(x, z, x); }
+        [[nodiscard]] constexpr vec<T, 3> xzy() const noexcept { return vec<T, 3>(x, z, y); }
+        [[nodiscard]] constexpr vec<T, 3> xzz() const noexcept { return vec<T, 3>(x, z, z); }
+        [[nodiscard]] constexpr vec<T, 3> yxx() const noexcept { return vec<T, 3>(y, x, x); }
+        [[nodiscard]] constexpr vec<T, 3> yxy() const noexcept { return vec<T, 3>(y, x, y); }
+        [[nodiscard]] constexpr vec<T, 3> yxz() const noexcept { return vec<T, 3>(y, x, z); }
+        [[nodiscard]] constexpr vec<T, 3> yyx() const noexcept { return vec<T, 3>(y, y, x); }
+        [[nodiscard]] constexpr vec<T, 3> yyy() const noexcept { return vec<T, 3>(y, y, y); }
+        [[nodiscard]] constexpr vec<T, 3> yyz() const noexcept { return vec<T, 3>(y, y, z); }
+        [[nodiscard]] constexpr vec<T, 3> yzx() const noexcept { return vec<T, 3>(y, z, x); }
+        [[nodiscard]] constexpr vec<T, 3> yzy() const noexcept { return vec<T, 3>(y, z, y); }
+        [[nodiscard]] constexpr vec<T, 3> yzz() const noexcept { return vec<T, 3>(y, z, z); }
+        [[nodiscard]] constexpr vec<T, 3> zxx() const noexcept { return vec<T, 3>(z, x, x); }
+        [[nodiscard]] constexpr vec<T, 3> zxy() const noexcept { return vec<T, 3>(z, x, y); }
+        [[nodiscard]] constexpr vec<T, 3> zxz() const noexcept { return vec<T, 3>(z, x, z); }
+        [[nodiscard]] constexpr vec<T, 3> zyx() const noexcept { return vec<T, 3>(z, y, x); }
+        [[nodiscard]] constexpr vec<T, 3> zyy() const noexcept { return vec<T, 3>(z, y, y); }
+        [[nodiscard]] constexpr vec<T, 3> zyz() const noexcept { return vec<T, 3>(z, y, z); }
+        [[nodiscard]] constexpr vec<T, 3> zzx() const noexcept { return vec<T, 3>(z, z, x); }
+        [[nodiscard]] constexpr vec<T, 3> zzy() const noexcept { return vec<T, 3>(z, z, y); }
+        [[nodiscard]] constexpr vec<T, 3> zzz() const noexcept { return vec<T, 3>(z, z, z); }
     };
 
     ////////////////////////////////////////////////////////////////
@@ -204,127 +226,127 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 3> operator+(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator+(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 3> operator+(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<T, 3>(lhs.x + rhs, lhs.y + rhs, lhs.z + rhs); }
+    [[nodiscard]] constexpr vec<T, 3> operator+(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<T, 3>(lhs.x + rhs, lhs.y + rhs, lhs.z + rhs); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 3> operator+(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs + rhs.x, lhs + rhs.y, lhs + rhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator+(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs + rhs.x, lhs + rhs.y, lhs + rhs.z); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 3> operator-(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator-(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 3> operator-(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<T, 3>(lhs.x - rhs, lhs.y - rhs, lhs.z - rhs); }
+    [[nodiscard]] constexpr vec<T, 3> operator-(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<T, 3>(lhs.x - rhs, lhs.y - rhs, lhs.z - rhs); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 3> operator-(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs - rhs.x, lhs - rhs.y, lhs - rhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator-(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs - rhs.x, lhs - rhs.y, lhs - rhs.z); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 3> operator-(const vec<T, 3>& lhs) noexcept { return vec<T, 3>(-lhs.x, -lhs.y, -lhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator-(const vec<T, 3>& lhs) noexcept { return vec<T, 3>(-lhs.x, -lhs.y, -lhs.z); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 3> operator*(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs.x * rhs.x, lhs.y * rhs.y, lhs.z * rhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator*(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs.x * rhs.x, lhs.y * rhs.y, lhs.z * rhs.z); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 3> operator*(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<T, 3>(lhs.x * rhs, lhs.y * rhs, lhs.z * rhs); }
+    [[nodiscard]] constexpr vec<T, 3> operator*(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<T, 3>(lhs.x * rhs, lhs.y * rhs, lhs.z * rhs); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 3> operator*(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs * rhs.x, lhs * rhs.y, lhs * rhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator*(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs * rhs.x, lhs * rhs.y, lhs * rhs.z); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 3> operator/(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs.x / rhs.x, lhs.y / rhs.y, lhs.z / rhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator/(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs.x / rhs.x, lhs.y / rhs.y, lhs.z / rhs.z); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 3> operator/(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<T, 3>(lhs.x / rhs, lhs.y / rhs, lhs.z / rhs); }
+    [[nodiscard]] constexpr vec<T, 3> operator/(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<T, 3>(lhs.x / rhs, lhs.y / rhs, lhs.z / rhs); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 3> operator/(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs / rhs.x, lhs / rhs.y, lhs / rhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator/(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs / rhs.x, lhs / rhs.y, lhs / rhs.z); }
 
     ////////////////////////////////////////////////////////////////
     // Comparison operators.
     ////////////////////////////////////////////////////////////////
 
     template<std::equality_comparable T>
-    [[nodiscard]] bool operator==(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return lhs.x == rhs.x && lhs.y == rhs.y && lhs.z == rhs.z; }
+    [[nodiscard]] constexpr bool operator==(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return lhs.x == rhs.x && lhs.y == rhs.y && lhs.z == rhs.z; }
 
     template<std::equality_comparable T>
-    [[nodiscard]] bool operator!=(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return lhs.x != rhs.x || lhs.y != rhs.y || lhs.z != rhs.z; }
+    [[nodiscard]] constexpr bool operator!=(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return lhs.x != rhs.x || lhs.y != rhs.y || lhs.z != rhs.z; }
 
     ////////////////////////////////////////////////////////////////
     // Per-element comparisons.
     ////////////////////////////////////////////////////////////////
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 3> cmpeq(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs.x == rhs.x, lhs.y == rhs.y, lhs.z == rhs.z); }
+    [[nodiscard]] constexpr vec<bool, 3> cmpeq(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs.x == rhs.x, lhs.y == rhs.y, lhs.z == rhs.z); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 3> cmpeq(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<bool, 3>(lhs.x == rhs, lhs.y == rhs, lhs.z == rhs); }
+    [[nodiscard]] constexpr vec<bool, 3> cmpeq(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<bool, 3>(lhs.x == rhs, lhs.y == rhs, lhs.z == rhs); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 3> cmpeq(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs == rhs.x, lhs == rhs.y, lhs == rhs.z); }
+    [[nodiscard]] constexpr vec<bool, 3> cmpeq(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs == rhs.x, lhs == rhs.y, lhs == rhs.z); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 3> cmpneq(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs.x != rhs.x, lhs.y != rhs.y, lhs.z != rhs.z); }
+    [[nodiscard]] constexpr vec<bool, 3> cmpneq(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs.x != rhs.x, lhs.y != rhs.y, lhs.z != rhs.z); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 3> cmpneq(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<bool, 3>(lhs.x != rhs, lhs.y != rhs, lhs.z != rhs); }
+    [[nodiscard]] constexpr vec<bool, 3> cmpneq(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<bool, 3>(lhs.x != rhs, lhs.y != rhs, lhs.z != rhs); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 3> cmpneq(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs != rhs.x, lhs != rhs.y, lhs != rhs.z); }
+    [[nodiscard]] constexpr vec<bool, 3> cmpneq(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs != rhs.x, lhs != rhs.y, lhs != rhs.z); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 3> cmplt(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs.x < rhs.x, lhs.y < rhs.y, lhs.z < rhs.z); }
+    [[nodiscard]] constexpr vec<bool, 3> cmplt(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs.x < rhs.x, lhs.y < rhs.y, lhs.z < rhs.z); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 3> cmplt(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<bool, 3>(lhs.x < rhs, lhs.y < rhs, lhs.z < rhs); }
+    [[nodiscard]] constexpr vec<bool, 3> cmplt(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<bool, 3>(lhs.x < rhs, lhs.y < rhs, lhs.z < rhs); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 3> cmplt(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs < rhs.x, lhs < rhs.y, lhs < rhs.z); }
+    [[nodiscard]] constexpr vec<bool, 3> cmplt(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs < rhs.x, lhs < rhs.y, lhs < rhs.z); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 3> cmpgt(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs.x > rhs.x, lhs.y > rhs.y, lhs.z > rhs.z); }
+    [[nodiscard]] constexpr vec<bool, 3> cmpgt(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs.x > rhs.x, lhs.y > rhs.y, lhs.z > rhs.z); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 3> cmpgt(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<bool, 3>(lhs.x > rhs, lhs.y > rhs, lhs.z > rhs); }
+    [[nodiscard]] constexpr vec<bool, 3> cmpgt(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<bool, 3>(lhs.x > rhs, lhs.y > rhs, lhs.z > rhs); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 3> cmpgt(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs > rhs.x, lhs > rhs.y, lhs > rhs.z); }
+    [[nodiscard]] constexpr vec<bool, 3> cmpgt(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs > rhs.x, lhs > rhs.y, lhs > rhs.z); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 3> cmple(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs.x <= rhs.x, lhs.y <= rhs.y, lhs.z <= rhs.z); }
+    [[nodiscard]] constexpr vec<bool, 3> cmple(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs.x <= rhs.x, lhs.y <= rhs.y, lhs.z <= rhs.z); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 3> cmple(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<bool, 3>(lhs.x <= rhs, lhs.y <= rhs, lhs.z <= rhs); }
+    [[nodiscard]] constexpr vec<bool, 3> cmple(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<bool, 3>(lhs.x <= rhs, lhs.y <= rhs, lhs.z <= rhs); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 3> cmple(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs <= rhs.x, lhs <= rhs.y, lhs <= rhs.z); }
+    [[nodiscard]] constexpr vec<bool, 3> cmple(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs <= rhs.x, lhs <= rhs.y, lhs <= rhs.z); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 3> cmpge(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs.x >= rhs.x, lhs.y >= rhs.y, lhs.z >= rhs.z); }
+    [[nodiscard]] constexpr vec<bool, 3> cmpge(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs.x >= rhs.x, lhs.y >= rhs.y, lhs.z >= rhs.z); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 3> cmpge(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<bool, 3>(lhs.x >= rhs, lhs.y >= rhs, lhs.z >= rhs); }
+    [[nodiscard]] constexpr vec<bool, 3> cmpge(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<bool, 3>(lhs.x >= rhs, lhs.y >= rhs, lhs.z >= rhs); }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 3> cmpge(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs >= rhs.x, lhs >= rhs.y, lhs >= rhs.z); }
+    [[nodiscard]] constexpr vec<bool, 3> cmpge(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<bool, 3>(lhs >= rhs.x, lhs >= rhs.y, lhs >= rhs.z); }
 
     ////////////////////////////////////////////////////////////////
     // Dot product etc.
     ////////////////////////////////////////////////////////////////
     
     template<arithmetic T>
-    [[nodiscard]] T dot(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z; }
+    [[nodiscard]] constexpr T dot(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z; }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 3> cross(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs.y * rhs.z - lhs.z * rhs.y, lhs.z * rhs.x - lhs.x * rhs.z, lhs.x * rhs.y - lhs.y * rhs.x); }
+    [[nodiscard]] constexpr vec<T, 3> cross(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs.y * rhs.z - lhs.z * rhs.y, lhs.z * rhs.x - lhs.x * rhs.z, lhs.x * rhs.y - lhs.y * rhs.x); }
     
     template<arithmetic T>
-    [[nodiscard]] vec<T, 3> lerp(const vec<T, 3>& a, const vec<T, 3>& b, const vec<T, 3>& t) noexcept { return vec<T, 3>(lerp(a.x, b.x, t.x), lerp(a.y, b.y, t.y), lerp(a.z, b.z, t.z)); }
+    [[nodiscard]] constexpr vec<T, 3> lerp(const vec<T, 3>& a, const vec<T, 3>& b, const vec<T, 3>& t) noexcept { return vec<T, 3>(lerp(a.x, b.x, t.x), lerp(a.y, b.y, t.y), lerp(a.z, b.z, t.z)); }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 3> lerp(const vec<T, 3>& a, const vec<T, 3>& b, const T t) noexcept { return vec<T, 3>(lerp(a.x, b.x, t), lerp(a.y, b.y, t), lerp(a.z, b.z, t)); }
+    [[nodiscard]] constexpr vec<T, 3> lerp(const vec<T, 3>& a, const vec<T, 3>& b, const T t) noexcept { return vec<T, 3>(lerp(a.x, b.x, t), lerp(a.y, b.y, t), lerp(a.z, b.z, t)); }
 
     ////////////////////////////////////////////////////////////////
     // Trigonometry.
@@ -456,7 +478,7 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<typename T>
-    [[nodiscard]] vec<T, 3> select(const vec<T, 3>& t, const vec<T, 3>& f, const vec<bool, 3>& b) noexcept { return vec<T, 3>(select(t.x, f.x, b.x), select(t.y, f.y, b.y), select(t.z, f.z, b.z)); }
+    [[nodiscard]] constexpr vec<T, 3> select(const vec<T, 3>& t, const vec<T, 3>& f, const vec<bool, 3>& b) noexcept { return vec<T, 3>(select(t.x, f.x, b.x), select(t.y, f.y, b.y), select(t.z, f.z, b.z)); }
 
     ////////////////////////////////////////////////////////////////
     // Multiply and add.
@@ -495,64 +517,64 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<std::integral T, std::integral U>
-    [[nodiscard]] vec<T, 3> operator<<(const vec<T, 3>& lhs, const vec<U, 3>& rhs) noexcept { return vec<T, 3>(lhs.x << rhs.x, lhs.y << rhs.y, lhs.z << rhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator<<(const vec<T, 3>& lhs, const vec<U, 3>& rhs) noexcept { return vec<T, 3>(lhs.x << rhs.x, lhs.y << rhs.y, lhs.z << rhs.z); }
 
     template<std::integral T, std::integral U>
-    [[nodiscard]] vec<T, 3> operator<<(const vec<T, 3>& lhs, const U rhs) noexcept { return vec<T, 3>(lhs.x << rhs, lhs.y << rhs, lhs.z << rhs); }
+    [[nodiscard]] constexpr vec<T, 3> operator<<(const vec<T, 3>& lhs, const U rhs) noexcept { return vec<T, 3>(lhs.x << rhs, lhs.y << rhs, lhs.z << rhs); }
 
     template<std::integral T, std::integral U>
-    [[nodiscard]] vec<T, 3> operator<<(const T lhs, const vec<U, 3>& rhs) noexcept { return vec<T, 3>(lhs << rhs.x, lhs << rhs.y, lhs << rhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator<<(const T lhs, const vec<U, 3>& rhs) noexcept { return vec<T, 3>(lhs << rhs.x, lhs << rhs.y, lhs << rhs.z); }
 
     template<std::integral T, std::integral U>
-    [[nodiscard]] vec<T, 3> operator>>(const vec<T, 3>& lhs, const vec<U, 3>& rhs) noexcept { return vec<T, 3>(lhs.x >> rhs.x, lhs.y >> rhs.y, lhs.z >> rhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator>>(const vec<T, 3>& lhs, const vec<U, 3>& rhs) noexcept { return vec<T, 3>(lhs.x >> rhs.x, lhs.y >> rhs.y, lhs.z >> rhs.z); }
 
     template<std::integral T, std::integral U>
-    [[nodiscard]] vec<T, 3> operator>>(const vec<T, 3>& lhs, const U rhs) noexcept { return vec<T, 3>(lhs.x >> rhs, lhs.y >> rhs, lhs.z >> rhs); }
+    [[nodiscard]] constexpr vec<T, 3> operator>>(const vec<T, 3>& lhs, const U rhs) noexcept { return vec<T, 3>(lhs.x >> rhs, lhs.y >> rhs, lhs.z >> rhs); }
 
     template<std::integral T, std::integral U>
-    [[nodiscard]] vec<T, 3> operator>>(const T lhs, const vec<U, 3>& rhs) noexcept { return vec<T, 3>(lhs >> rhs.x, lhs >> rhs.y, lhs >> rhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator>>(const T lhs, const vec<U, 3>& rhs) noexcept { return vec<T, 3>(lhs >> rhs.x, lhs >> rhs.y, lhs >> rhs.z); }
 
     ////////////////////////////////////////////////////////////////
     // Bitwise operators.
     ////////////////////////////////////////////////////////////////
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 3> operator|(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs.x | rhs.x, lhs.y | rhs.y, lhs.z | rhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator|(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs.x | rhs.x, lhs.y | rhs.y, lhs.z | rhs.z); }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 3> operator|(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<T, 3>(lhs.x | rhs, lhs.y | rhs, lhs.z | rhs); }
+    [[nodiscard]] constexpr vec<T, 3> operator|(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<T, 3>(lhs.x | rhs, lhs.y | rhs, lhs.z | rhs); }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 3> operator|(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs | rhs.x, lhs | rhs.y, lhs | rhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator|(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs | rhs.x, lhs | rhs.y, lhs | rhs.z); }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 3> operator&(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs.x & rhs.x, lhs.y & rhs.y, lhs.z & rhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator&(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs.x & rhs.x, lhs.y & rhs.y, lhs.z & rhs.z); }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 3> operator&(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<T, 3>(lhs.x & rhs, lhs.y & rhs, lhs.z & rhs); }
+    [[nodiscard]] constexpr vec<T, 3> operator&(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<T, 3>(lhs.x & rhs, lhs.y & rhs, lhs.z & rhs); }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 3> operator&(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs & rhs.x, lhs & rhs.y, lhs & rhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator&(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs & rhs.x, lhs & rhs.y, lhs & rhs.z); }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 3> operator^(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs.x ^ rhs.x, lhs.y ^ rhs.y, lhs.z ^ rhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator^(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs.x ^ rhs.x, lhs.y ^ rhs.y, lhs.z ^ rhs.z); }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 3> operator^(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<T, 3>(lhs.x ^ rhs, lhs.y ^ rhs, lhs.z ^ rhs); }
+    [[nodiscard]] constexpr vec<T, 3> operator^(const vec<T, 3>& lhs, const T rhs) noexcept { return vec<T, 3>(lhs.x ^ rhs, lhs.y ^ rhs, lhs.z ^ rhs); }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 3> operator^(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs ^ rhs.x, lhs ^ rhs.y, lhs ^ rhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator^(const T lhs, const vec<T, 3>& rhs) noexcept { return vec<T, 3>(lhs ^ rhs.x, lhs ^ rhs.y, lhs ^ rhs.z); }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 3> operator~(const vec<T, 3>& lhs) noexcept { return vec<T, 3>(~lhs.x, ~lhs.y, ~lhs.z); }
+    [[nodiscard]] constexpr vec<T, 3> operator~(const vec<T, 3>& lhs) noexcept { return vec<T, 3>(~lhs.x, ~lhs.y, ~lhs.z); }
 
     ////////////////////////////////////////////////////////////////
     // Boolean vector reduction.
     ////////////////////////////////////////////////////////////////
 
-    [[nodiscard]] inline bool all(const vec<bool, 3>& lhs) noexcept { return lhs.x & lhs.y & lhs.z; }
+    [[nodiscard]] constexpr bool all(const vec<bool, 3>& lhs) noexcept { return lhs.x & lhs.y & lhs.z; }
 
-    [[nodiscard]] inline bool any(const vec<bool, 3>& lhs) noexcept { return lhs.x | lhs.y | lhs.z; }
+    [[nodiscard]] constexpr bool any(const vec<bool, 3>& lhs) noexcept { return lhs.x | lhs.y | lhs.z; }
 
     ////////////////////////////////////////////////////////////////
     // Output.
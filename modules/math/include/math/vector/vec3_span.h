@@ -0,0 +1,29 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <span>
+
+namespace math
+{
+    /**=================================================================================================
+     * Struct: vec3_span
+     * =================================================================================================
+     * @struct  vec3_span
+     *
+     * @brief   Structure-of-arrays view on a range of 3-component vectors. All components must have the same size.
+     *
+     * @tparam  T   Component type, optionally const.
+    **/
+    template<typename T>
+    struct vec3_span
+    {
+        std::span<T> x, y, z;
+
+        [[nodiscard]] size_t size() const noexcept { return x.size(); }
+
+        [[nodiscard]] operator vec3_span<const T>() const noexcept { return { x, y, z }; }
+    };
+}
@@ -32,44 +32,48 @@ namespace math
 
         // Default.
 
-        [[nodiscard]] vec() noexcept : a(0), b(0), c(0), d(0), e(0), f(0), g(0), h(0) {}
+        [[nodiscard]] constexpr vec() noexcept : a(0), b(0), c(0), d(0), e(0), f(0), g(0), h(0) {}
+
+        // Uninitialized.
+
+        [[nodiscard]] constexpr explicit vec(uninit_t) noexcept {}
 
         // From values.
 
-        [[nodiscard]] explicit vec(const T v) noexcept : a(v), b(v), c(v), d(v), e(v), f(v), g(v), h(v) {}
+        [[nodiscard]] constexpr explicit vec(const T v) noexcept : a(v), b(v), c(v), d(v), e(v), f(v), g(v), h(v) {}
 
-        [[nodiscard]] vec(const T a, const T b, const T c, const T d, const T e, const T f, const T g, const T h) noexcept : a(a), b(b), c(c), d(d), e(e), f(f), g(g), h(h) {}
+        [[nodiscard]] constexpr vec(const T a, const T b, const T c, const T d, const T e, const T f, const T g, const T h) noexcept : a(a), b(b), c(c), d(d), e(e), f(f), g(g), h(h) {}
 
         // From convertible values.
 
         template<std::convertible_to<T> U>
-        [[nodiscard]] explicit vec(const U rhs) :
+        [[nodiscard]] constexpr explicit vec(const U rhs) :
             a(static_cast<T>(rhs)), b(static_cast<T>(rhs)), c(static_cast<T>(rhs)), d(static_cast<T>(rhs)),
             e(static_cast<T>(rhs)), f(static_cast<T>(rhs)), g(static_cast<T>(rhs)), h(static_cast<T>(rhs))
         {}
 
         template<std::convertible_to<T> U>
-        [[nodiscard]] vec(const U a, const U b, const U c, const U d, const U e, const U f, const U g, const U h) :
+        [[nodiscard]] constexpr vec(const U a, const U b, const U c, const U d, const U e, const U f, const U g, const U h) :
             a(static_cast<T>(a)), b(static_cast<T>(b)), c(static_cast<T>(c)), d(static_cast<T>(d)),
             e(static_cast<T>(e)), f(static_cast<T>(f)), g(static_cast<T>(g)), h(static_cast<T>(h))
         {}
 
         // From pointer.
 
-        [[nodiscard]] explicit vec(const T* ptr) : a(ptr[0]), b(ptr[1]), c(ptr[2]), d(ptr[3]), e(ptr[4]), f(ptr[5]), g(ptr[6]), h(ptr[7]) {}
+        [[nodiscard]] constexpr explicit vec(const T* ptr) : a(ptr[0]), b(ptr[1]), c(ptr[2]), d(ptr[3]), e(ptr[4]), f(ptr[5]), g(ptr[6]), h(ptr[7]) {}
 
         // Copy.
 
-        [[nodiscard]] vec(const vec<T, 8>& rhs) noexcept : a(rhs.a), b(rhs.b), c(rhs.c), d(rhs.d), e(rhs.e), f(rhs.f), g(rhs.g), h(rhs.h) {}
+        [[nodiscard]] constexpr vec(const vec<T, 8>& rhs) noexcept = default;
 
         // Move.
 
-        [[nodiscard]] vec(vec<T, 8>&& rhs) noexcept : a(rhs.a), b(rhs.b), c(rhs.c), d(rhs.d), e(rhs.e), f(rhs.f), g(rhs.g), h(rhs.h) {}
+        [[nodiscard]] constexpr vec(vec<T, 8>&& rhs) noexcept = default;
 
         // Copy from convertible.
 
         template<std::convertible_to<T> U>
-        [[nodiscard]] explicit vec(const vec<U, 8>& rhs) :
+        [[nodiscard]] constexpr explicit vec(const vec<U, 8>& rhs) :
             a(static_cast<T>(rhs.a)), b(static_cast<T>(rhs.b)), c(static_cast<T>(rhs.c)), d(static_cast<T>(rhs.d)),
             e(static_cast<T>(rhs.e)), f(static_cast<T>(rhs.f)), g(static_cast<T>(rhs.g)), h(static_cast<T>(rhs.h))
         {}
@@ -77,7 +81,7 @@ namespace math
         // Move from convertible.
         
         template<std::convertible_to<T> U>
-        [[nodiscard]] vec(vec<U, 8>&& rhs) :
+        [[nodiscard]] constexpr vec(vec<U, 8>&& rhs) :
             a(static_cast<T>(rhs.a)), b(static_cast<T>(rhs.b)), c(static_cast<T>(rhs.c)), d(static_cast<T>(rhs.d)),
             e(static_cast<T>(rhs.e)), f(static_cast<T>(rhs.f)), g(static_cast<T>(rhs.g)), h(static_cast<T>(rhs.h))
         {}
@@ -88,25 +92,15 @@ namespace math
 
         // Copy.
 
-        vec<T, 8>& operator=(const vec<T, 8>& rhs) noexcept
-        {
-            a = rhs.a; b = rhs.b; c = rhs.c; d = rhs.d;
-            e = rhs.e; f = rhs.f; g = rhs.g; h = rhs.h;
-            return *this;
-        }
+        constexpr vec<T, 8>& operator=(const vec<T, 8>& rhs) noexcept = default;
 
         // Move.
 
-        vec<T, 8>& operator=(vec<T, 8>&& rhs) noexcept
-        {
-            a = rhs.a; b = rhs.b; c = rhs.c; d = rhs.d;
-            e = rhs.e; f = rhs.f; g = rhs.g; h = rhs.h;
-            return *this;
-        }
+        constexpr vec<T, 8>& operator=(vec<T, 8>&& rhs) noexcept = default;
 
         // Assign from value.
 
-        vec<T, 8>& operator=(const T rhs) noexcept
+        constexpr vec<T, 8>& operator=(const T rhs) noexcept
         {
             a = rhs; b = rhs; c = rhs; d = rhs;
             e = rhs; f = rhs; g = rhs; h = rhs;
@@ -116,7 +110,7 @@ namespace math
         // Assign from convertible value.
 
         template<std::convertible_to<T> U>
-        vec<T, 8>& operator=(const U rhs)
+        constexpr vec<T, 8>& operator=(const U rhs)
         {
             a = static_cast<T>(rhs); b = static_cast<T>(rhs); c = static_cast<T>(rhs); d = static_cast<T>(rhs);
             e = static_cast<T>(rhs); f = static_cast<T>(rhs); g = static_cast<T>(rhs); h = static_cast<T>(rhs);
@@ -126,7 +120,7 @@ namespace math
         // Assign from convertible.
 
         template<std::convertible_to<T> U>
-        vec<T, 8>& operator=(const vec<U, 8>& rhs)
+        constexpr vec<T, 8>& operator=(const vec<U, 8>& rhs)
         {
             a = static_cast<T>(rhs.a); b = static_cast<T>(rhs.b); c = static_cast<T>(rhs.c); d = static_cast<T>(rhs.d);
             e = static_cast<T>(rhs.e); f = static_cast<T>(rhs.f); g = static_cast<T>(rhs.g); h = static_cast<T>(rhs.h);
@@ -143,9 +137,27 @@ namespace math
         // Element access.
         ////////////////////////////////////////////////////////////////
 
-        [[nodiscard]] const T& operator[](const size_t i) const { assert(i < 8); return (&a)[i]; }
+        [[nodiscard]] constexpr const T& operator[](const size_t i) const
+        {
+            assert(i < 8);
+            if consteval
+            {
+                const T* const members[] = { &a, &b, &c, &d, &e, &f, &g, &h };
+                return *members[i];
+            }
+            return (&a)[i];
+        }
 
-        [[nodiscard]] T& operator[](const size_t i) { assert(i < 8); return (&a)[i]; }
+        [[nodiscard]] constexpr T& operator[](const size_t i)
+        {
+            assert(i < 8);
+            if consteval
+            {
+                T* const members[] = { &a, &b, &c, &d, &e, &f, &g, &h };
+                return *members[i];
+            }
+            return (&a)[i];
+        }
     };
 
     ////////////////////////////////////////////////////////////////
@@ -211,7 +223,7 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 8> operator+(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator+(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a + rhs.a, lhs.b + rhs.b, lhs.c + rhs.c, lhs.d + rhs.d,
@@ -220,7 +232,7 @@ namespace math
     }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 8> operator+(const vec<T, 8>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator+(const vec<T, 8>& lhs, const T rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a + rhs, lhs.b + rhs, lhs.c + rhs, lhs.d + rhs,
@@ -229,7 +241,7 @@ namespace math
     }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 8> operator+(const T lhs, const vec<T, 8>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator+(const T lhs, const vec<T, 8>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs + rhs.a, lhs + rhs.b, lhs + rhs.c, lhs + rhs.d,
@@ -238,7 +250,7 @@ namespace math
     }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 8> operator-(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator-(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a - rhs.a, lhs.b - rhs.b, lhs.c - rhs.c, lhs.d - rhs.d,
@@ -247,7 +259,7 @@ namespace math
     }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 8> operator-(const vec<T, 8>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator-(const vec<T, 8>& lhs, const T rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a - rhs, lhs.b - rhs, lhs.c - rhs, lhs.d - rhs,
@@ -256,7 +268,7 @@ namespace math
     }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 8> operator-(const T lhs, const vec<T, 8>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator-(const T lhs, const vec<T, 8>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs - rhs.a, lhs - rhs.b, lhs - rhs.c, lhs - rhs.d,
@@ -265,7 +277,7 @@ namespace math
     }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 8> operator-(const vec<T, 8>& lhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator-(const vec<T, 8>& lhs) noexcept
     {
         return vec<T, 8>(
             -lhs.a, -lhs.b, -lhs.c, -lhs.d,
@@ -274,7 +286,7 @@ namespace math
     }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 8> operator*(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator*(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a * rhs.a, lhs.b * rhs.b, lhs.c * rhs.c, lhs.d * rhs.d,
@@ -283,7 +295,7 @@ namespace math
     }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 8> operator*(const vec<T, 8>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator*(const vec<T, 8>& lhs, const T rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a * rhs, lhs.b * rhs, lhs.c * rhs, lhs.d * rhs,
@@ -292,7 +304,7 @@ namespace math
     }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 8> operator*(const T lhs, const vec<T, 8>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator*(const T lhs, const vec<T, 8>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs * rhs.a, lhs * rhs.b, lhs * rhs.c, lhs * rhs.d,
@@ -301,7 +313,7 @@ namespace math
     }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 8> operator/(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator/(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a / rhs.a, lhs.b / rhs.b, lhs.c / rhs.c, lhs.d / rhs.d,
@@ -310,7 +322,7 @@ namespace math
     }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 8> operator/(const vec<T, 8>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator/(const vec<T, 8>& lhs, const T rhs) noexcept
     {
         const T inv = T(1) / rhs;
         return vec<T, 8>(
@@ -320,7 +332,7 @@ namespace math
     }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 8> operator/(const T lhs, const vec<T, 8>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator/(const T lhs, const vec<T, 8>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs / rhs.a, lhs / rhs.b, lhs / rhs.c, lhs / rhs.d,
@@ -333,14 +345,14 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<std::equality_comparable T>
-    [[nodiscard]] bool operator==(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
+    [[nodiscard]] constexpr bool operator==(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
     {
         return lhs.a == rhs.a && lhs.b == rhs.b && lhs.c == rhs.c && lhs.d == rhs.d && 
             lhs.e == rhs.e && lhs.f == rhs.f && lhs.g == rhs.g && lhs.h == rhs.h;
     }
 
     template<std::equality_comparable T>
-    [[nodiscard]] bool operator!=(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
+    [[nodiscard]] constexpr bool operator!=(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
     {
         return lhs.a == rhs.a || lhs.b == rhs.b || lhs.c == rhs.c || lhs.d == rhs.d || 
             lhs.e == rhs.e || lhs.f == rhs.f || lhs.g == rhs.g || lhs.h == rhs.h;
@@ -351,7 +363,7 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 8> cmpeq(const vec<T, 4>& lhs, const vec<T, 4>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, 8> cmpeq(const vec<T, 4>& lhs, const vec<T, 4>& rhs) noexcept
     {
         return vec<bool, 8>(
             lhs.a == rhs.a, lhs.b == rhs.b, lhs.c == rhs.c, lhs.d == rhs.d,
@@ -360,7 +372,7 @@ namespace math
     }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 8> cmpeq(const vec<T, 4>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, 8> cmpeq(const vec<T, 4>& lhs, const T rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a == rhs, lhs.b == rhs, lhs.c == rhs, lhs.d == rhs,
@@ -369,7 +381,7 @@ namespace math
     }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 8> cmpeq(const T lhs, const vec<T, 4>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, 8> cmpeq(const T lhs, const vec<T, 4>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs == rhs.a, lhs == rhs.b, lhs == rhs.c, lhs == rhs.d,
@@ -378,7 +390,7 @@ namespace math
     }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 8> cmpneq(const vec<T, 4>& lhs, const vec<T, 4>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, 8> cmpneq(const vec<T, 4>& lhs, const vec<T, 4>& rhs) noexcept
     {
         return vec<bool, 8>(
             lhs.a != rhs.a, lhs.b != rhs.b, lhs.c != rhs.c, lhs.d != rhs.d,
@@ -387,7 +399,7 @@ namespace math
     }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 8> cmpneq(const vec<T, 4>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, 8> cmpneq(const vec<T, 4>& lhs, const T rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a != rhs, lhs.b != rhs, lhs.c != rhs, lhs.d != rhs,
@@ -396,7 +408,7 @@ namespace math
     }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 8> cmpneq(const T lhs, const vec<T, 4>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, 8> cmpneq(const T lhs, const vec<T, 4>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs != rhs.a, lhs != rhs.b, lhs != rhs.c, lhs != rhs.d,
@@ -405,7 +417,7 @@ namespace math
     }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 8> cmplt(const vec<T, 4>& lhs, const vec<T, 4>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, 8> cmplt(const vec<T, 4>& lhs, const vec<T, 4>& rhs) noexcept
     {
         return vec<bool, 8>(
             lhs.a < rhs.a, lhs.b < rhs.b, lhs.c < rhs.c, lhs.d < rhs.d,
@@ -414,7 +426,7 @@ namespace math
     }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 8> cmplt(const vec<T, 4>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, 8> cmplt(const vec<T, 4>& lhs, const T rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a < rhs, lhs.b < rhs, lhs.c < rhs, lhs.d < rhs,
@@ -423,7 +435,7 @@ namespace math
     }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 8> cmplt(const T lhs, const vec<T, 4>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, 8> cmplt(const T lhs, const vec<T, 4>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs < rhs.a, lhs < rhs.b, lhs < rhs.c, lhs < rhs.d,
@@ -432,7 +444,7 @@ namespace math
     }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 8> cmpgt(const vec<T, 4>& lhs, const vec<T, 4>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, 8> cmpgt(const vec<T, 4>& lhs, const vec<T, 4>& rhs) noexcept
     {
         return vec<bool, 8>(
             lhs.a > rhs.a, lhs.b > rhs.b, lhs.c > rhs.c, lhs.d > rhs.d,
@@ -441,7 +453,7 @@ namespace math
     }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 8> cmpgt(const vec<T, 4>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, 8> cmpgt(const vec<T, 4>& lhs, const T rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a > rhs, lhs.b > rhs, lhs.c > rhs, lhs.d > rhs,
@@ -450,7 +462,7 @@ namespace math
     }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 8> cmpgt(const T lhs, const vec<T, 4>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, 8> cmpgt(const T lhs, const vec<T, 4>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs > rhs.a, lhs > rhs.b, lhs > rhs.c, lhs > rhs.d,
@@ -459,7 +471,7 @@ namespace math
     }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 8> cmple(const vec<T, 4>& lhs, const vec<T, 4>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, 8> cmple(const vec<T, 4>& lhs, const vec<T, 4>& rhs) noexcept
     {
         return vec<bool, 8>(
             lhs.a <= rhs.a, lhs.b <= rhs.b, lhs.c <= rhs.c, lhs.d <= rhs.d,
@@ -468,7 +480,7 @@ namespace math
     }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 8> cmple(const vec<T, 4>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, 8> cmple(const vec<T, 4>& lhs, const T rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a <= rhs, lhs.b <= rhs, lhs.c <= rhs, lhs.d <= rhs,
@@ -477,7 +489,7 @@ namespace math
     }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 8> cmple(const T lhs, const vec<T, 4>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, 8> cmple(const T lhs, const vec<T, 4>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs <= rhs.a, lhs <= rhs.b, lhs <= rhs.c, lhs <= rhs.d,
@@ -486,7 +498,7 @@ namespace math
     }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 8> cmpge(const vec<T, 4>& lhs, const vec<T, 4>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, 8> cmpge(const vec<T, 4>& lhs, const vec<T, 4>& rhs) noexcept
     {
         return vec<bool, 8>(
             lhs.a >= rhs.a, lhs.b >= rhs.b, lhs.c >= rhs.c, lhs.d >= rhs.d,
@@ -495,7 +507,7 @@ namespace math
     }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 8> cmpge(const vec<T, 4>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, 8> cmpge(const vec<T, 4>& lhs, const T rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a >= rhs, lhs.b >= rhs, lhs.c >= rhs, lhs.d >= rhs,
@@ -504,7 +516,7 @@ namespace math
     }
 
     template<std::totally_ordered T>
-    [[nodiscard]] vec<bool, 8> cmpge(const T lhs, const vec<T, 4>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, 8> cmpge(const T lhs, const vec<T, 4>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs >= rhs.a, lhs >= rhs.b, lhs >= rhs.c, lhs >= rhs.d,
@@ -517,14 +529,14 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<arithmetic T>
-    [[nodiscard]] T dot(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
+    [[nodiscard]] constexpr T dot(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
     {
         return lhs.a * rhs.a + lhs.b * rhs.b + lhs.c * rhs.c + lhs.d * rhs.d +
             lhs.e * rhs.e + lhs.f * rhs.f + lhs.g * rhs.g + lhs.h * rhs.h;
     }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 8> lerp(const vec<T, 8>& a, const vec<T, 8>& b, const vec<T, 8>& t) noexcept
+    [[nodiscard]] constexpr vec<T, 8> lerp(const vec<T, 8>& a, const vec<T, 8>& b, const vec<T, 8>& t) noexcept
     {
         return vec<T, 8>(
             lerp(a.a, b.a, t.a), lerp(a.b, b.b, t.b), lerp(a.c, b.c, t.c), lerp(a.d, b.d, t.d),
@@ -533,7 +545,7 @@ namespace math
     }
 
     template<arithmetic T>
-    [[nodiscard]] vec<T, 8> lerp(const vec<T, 8>& a, const vec<T, 8>& b, const T t) noexcept
+    [[nodiscard]] constexpr vec<T, 8> lerp(const vec<T, 8>& a, const vec<T, 8>& b, const T t) noexcept
     {
         return vec<T, 8>(
             lerp(a.a, b.a, t), lerp(a.b, b.b, t), lerp(a.c, b.c, t), lerp(a.d, b.d, t),
@@ -881,7 +893,7 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<typename T>
-    [[nodiscard]] vec<T, 8> select(const vec<T, 8>& t, const vec<T, 8>& f, const vec<bool, 8>& b) noexcept
+    [[nodiscard]] constexpr vec<T, 8> select(const vec<T, 8>& t, const vec<T, 8>& f, const vec<bool, 8>& b) noexcept
     {
         return vec<T, 8>(
             select(t.a, f.a, b.a), select(t.b, f.b, b.b), select(t.c, f.c, b.c), select(t.d, f.d, b.d),
@@ -950,7 +962,7 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<std::integral T, std::integral U>
-    [[nodiscard]] vec<T, 8> operator<<(const vec<T, 8>& lhs, const vec<U, 8>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator<<(const vec<T, 8>& lhs, const vec<U, 8>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a << rhs.a, lhs.b << rhs.b, lhs.c << rhs.c, lhs.d << rhs.d,
@@ -959,7 +971,7 @@ namespace math
     }
 
     template<std::integral T, std::integral U>
-    [[nodiscard]] vec<T, 8> operator<<(const vec<T, 8>& lhs, const U rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator<<(const vec<T, 8>& lhs, const U rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a << rhs, lhs.b << rhs, lhs.c << rhs, lhs.d << rhs,
@@ -968,7 +980,7 @@ namespace math
     }
 
     template<std::integral T, std::integral U>
-    [[nodiscard]] vec<T, 8> operator<<(const T lhs, const vec<U, 8>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator<<(const T lhs, const vec<U, 8>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs << rhs.a, lhs << rhs.b, lhs << rhs.c, lhs << rhs.d,
@@ -977,7 +989,7 @@ namespace math
     }
 
     template<std::integral T, std::integral U>
-    [[nodiscard]] vec<T, 8> operator>>(const vec<T, 8>& lhs, const vec<U, 8>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator>>(const vec<T, 8>& lhs, const vec<U, 8>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a >> rhs.a, lhs.b >> rhs.b, lhs.c >> rhs.c, lhs.d >> rhs.d,
@@ -986,7 +998,7 @@ namespace math
     }
 
     template<std::integral T, std::integral U>
-    [[nodiscard]] vec<T, 8> operator>>(const vec<T, 8>& lhs, const U rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator>>(const vec<T, 8>& lhs, const U rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a >> rhs, lhs.b >> rhs, lhs.c >> rhs, lhs.d >> rhs,
@@ -995,7 +1007,7 @@ namespace math
     }
 
     template<std::integral T, std::integral U>
-    [[nodiscard]] vec<T, 8> operator>>(const T lhs, const vec<U, 8>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator>>(const T lhs, const vec<U, 8>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs >> rhs.a, lhs >> rhs.b, lhs >> rhs.c, lhs >> rhs.d,
@@ -1008,7 +1020,7 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 8> operator|(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator|(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a | rhs.a, lhs.b | rhs.b, lhs.c | rhs.c, lhs.d | rhs.d,
@@ -1017,7 +1029,7 @@ namespace math
     }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 8> operator|(const vec<T, 8>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator|(const vec<T, 8>& lhs, const T rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a | rhs, lhs.b | rhs, lhs.c | rhs, lhs.d | rhs,
@@ -1026,7 +1038,7 @@ namespace math
     }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 8> operator|(const T lhs, const vec<T, 8>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator|(const T lhs, const vec<T, 8>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs | rhs.a, lhs | rhs.b, lhs | rhs.c, lhs | rhs.d,
@@ -1035,7 +1047,7 @@ namespace math
     }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 8> operator&(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator&(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a & rhs.a, lhs.b & rhs.b, lhs.c & rhs.c, lhs.d & rhs.d,
@@ -1044,7 +1056,7 @@ namespace math
     }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 8> operator&(const vec<T, 8>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator&(const vec<T, 8>& lhs, const T rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a & rhs, lhs.b & rhs, lhs.c & rhs, lhs.d & rhs,
@@ -1053,7 +1065,7 @@ namespace math
     }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 8> operator&(const T lhs, const vec<T, 8>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator&(const T lhs, const vec<T, 8>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs & rhs.a, lhs & rhs.b, lhs & rhs.c, lhs & rhs.d,
@@ -1062,7 +1074,7 @@ namespace math
     }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 8> operator^(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator^(const vec<T, 8>& lhs, const vec<T, 8>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a ^ rhs.a, lhs.b ^ rhs.b, lhs.c ^ rhs.c, lhs.d ^ rhs.d,
@@ -1071,7 +1083,7 @@ namespace math
     }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 8> operator^(const vec<T, 8>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator^(const vec<T, 8>& lhs, const T rhs) noexcept
     {
         return vec<T, 8>(
             lhs.a ^ rhs, lhs.b ^ rhs, lhs.c ^ rhs, lhs.d ^ rhs,
@@ -1080,7 +1092,7 @@ namespace math
     }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 8> operator^(const T lhs, const vec<T, 8>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, 8> operator^(const T lhs, const vec<T, 8>& rhs) noexcept
     {
         return vec<T, 8>(
             lhs ^ rhs.a, lhs ^ rhs.b, lhs ^ rhs.c, lhs ^ rhs.d,
@@ -1089,15 +1101,15 @@ namespace math
     }
 
     template<std::integral T>
-    [[nodiscard]] vec<T, 8> operator~(const vec<T, 8>& lhs) noexcept { return vec<T, 8>(~lhs.a, ~lhs.b, ~lhs.c, ~lhs.d, ~lhs.e, ~lhs.f, ~lhs.g, ~lhs.h); }
+    [[nodiscard]] constexpr vec<T, 8> operator~(const vec<T, 8>& lhs) noexcept { return vec<T, 8>(~lhs.a, ~lhs.b, ~lhs.c, ~lhs.d, ~lhs.e, ~lhs.f, ~lhs.g, ~lhs.h); }
 
     ////////////////////////////////////////////////////////////////
     // Boolean vector reduction.
     ////////////////////////////////////////////////////////////////
 
-    [[nodiscard]] inline bool all(const vec<bool, 8>& lhs) noexcept { return lhs.a & lhs.b & lhs.c & lhs.d & lhs.e & lhs.f & lhs.g & lhs.h; }
+    [[nodiscard]] constexpr bool all(const vec<bool, 8>& lhs) noexcept { return lhs.a & lhs.b & lhs.c & lhs.d & lhs.e & lhs.f & lhs.g & lhs.h; }
 
-    [[nodiscard]] inline bool any(const vec<bool, 8>& lhs) noexcept { return lhs.a | lhs.b | lhs.c | lhs.d | lhs.e | lhs.f | lhs.g | lhs.h; }
+    [[nodiscard]] constexpr bool any(const vec<bool, 8>& lhs) noexcept { return lhs.a | lhs.b | lhs.c | lhs.d | lhs.e | lhs.f | lhs.g | lhs.h; }
 
     ////////////////////////////////////////////////////////////////
     // Output.
@@ -15,6 +15,7 @@
 
 #include "math/math_functions.h"
 #include "math/math_type_traits.h"
+#include "math/uninit.h"
 
 namespace math
 {
@@ -31,7 +32,7 @@ namespace math
     template<typename T, size_t N>
     struct vec
     {
-        static inline size_t size = N;
+        static constexpr size_t size = N;
         using element_type = T;
 
         std::array<T, N> data;
@@ -43,11 +44,15 @@ namespace math
 
         // Default.
 
-        [[nodiscard]] vec() noexcept : data() { }
+        [[nodiscard]] constexpr vec() noexcept : data() { }
+
+        // Uninitialized.
+
+        [[nodiscard]] constexpr explicit vec(uninit_t) noexcept {}
 
         // From values.
 
-        [[nodiscard]] explicit vec(const T v) noexcept
+        [[nodiscard]] constexpr explicit vec(const T v) noexcept
         {
             for (size_t i = 0; i < N; i++)
                 data[i] = v;
@@ -56,14 +61,14 @@ namespace math
         // From convertible values.
 
         template<std::convertible_to<T> U>
-        [[nodiscard]] explicit vec(const U v) noexcept
+        [[nodiscard]] constexpr explicit vec(const U v) noexcept
         {
             for (size_t i = 0; i < N; i++)
                 data[i] = static_cast<T>(v);
         }
 
         template<std::convertible_to<T> U, std::convertible_to<T>... Us> // TODO: requires sizeof...(Us) < N - 1
-        [[nodiscard]] vec(const U v, const Us... vs) noexcept
+        [[nodiscard]] constexpr vec(const U v, const Us... vs) noexcept
         {
             data[0] = static_cast<T>(v);
             size_t i = 0;
@@ -72,23 +77,23 @@ namespace math
 
         // From pointer.
 
-        [[nodiscard]] explicit vec(const T* ptr) noexcept
+        [[nodiscard]] constexpr explicit vec(const T* ptr) noexcept
         {
             std::copy(ptr, ptr + N, &(data[0]));
         }
         // TODO: U* ptr
         // Copy.
         
-        [[nodiscard]] vec(const vec<T, N>& rhs) noexcept : data(rhs.data) {}
+        [[nodiscard]] constexpr vec(const vec<T, N>& rhs) noexcept = default;
 
         // Move.
 
-        [[nodiscard]] vec(vec<T, N>&& rhs) noexcept : data(std::move(rhs.data)) {}
+        [[nodiscard]] constexpr vec(vec<T, N>&& rhs) noexcept = default;
 
         // Copy from convertible.
 
         template<std::convertible_to<T> U>
-        [[nodiscard]] explicit vec(const vec<U, N>& rhs)
+        [[nodiscard]] constexpr explicit vec(const vec<U, N>& rhs)
         {
             for (size_t i = 0; i < N; i++)
                 data[i] = static_cast<T>(rhs.data[i]);
@@ -102,23 +107,15 @@ namespace math
 
         // Copy.
 
-        vec<T, N>& operator=(const vec<T, N>& rhs) noexcept
-        {
-            data = rhs.data;
-            return *this;
-        }
+        constexpr vec<T, N>& operator=(const vec<T, N>& rhs) noexcept = default;
 
         // Move.
 
-        vec<T, N>& operator=(vec<T, N>&& rhs) noexcept
-        {
-            data = std::move(rhs.data);
-            return *this;
-        }
+        constexpr vec<T, N>& operator=(vec<T, N>&& rhs) noexcept = default;
 
         // Assign from value.
 
-        vec<T, N>& operator=(const T rhs) noexcept
+        constexpr vec<T, N>& operator=(const T rhs) noexcept
         {
             for (size_t i = 0; i < N; i++)
                 data[i] = rhs;
@@ -128,7 +125,7 @@ namespace math
         // Assign from convertible value.
         template<std::convertible_to<T> U>
 
-        vec<T, N>& operator=(const U rhs) noexcept
+        constexpr vec<T, N>& operator=(const U rhs) noexcept
         {
             for (size_t i = 0; i < N; i++)
                 data[i] = static_cast<T>(rhs);
@@ -138,7 +135,7 @@ namespace math
         // Assign from convertible.
 
         template<std::convertible_to<T> U>
-        vec<T, N>& operator=(const vec<U, N>& rhs)
+        constexpr vec<T, N>& operator=(const vec<U, N>& rhs)
         {
             for (size_t i = 0; i < N; i++)
                 data[i] = static_cast<T>(rhs.data[i]);
@@ -155,9 +152,9 @@ namespace math
         // Element access.
         ////////////////////////////////////////////////////////////////
 
-        [[nodiscard]] const T& operator[](const size_t i) const { assert(i < N); return data[i]; }
+        [[nodiscard]] constexpr const T& operator[](const size_t i) const { assert(i < N); return data[i]; }
 
-        [[nodiscard]] T& operator[](const size_t i) { assert(i < N); return data[i]; }
+        [[nodiscard]] constexpr T& operator[](const size_t i) { assert(i < N); return data[i]; }
     };
 
     ////////////////////////////////////////////////////////////////
@@ -165,25 +162,25 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<element_type_constructible T>
-    [[nodiscard]] T zero() noexcept { return T(typename T::element_type(0)); }
+    [[nodiscard]] constexpr T zero() noexcept { return T(typename T::element_type(0)); }
 
     template<element_type_constructible T>
-    [[nodiscard]] T one() noexcept { return T(typename T::element_type(1)); }
+    [[nodiscard]] constexpr T one() noexcept { return T(typename T::element_type(1)); }
 
     template<element_type_constructible T>
-    [[nodiscard]] T highest() noexcept { return T(std::numeric_limits<typename T::element_type>::max()); }
+    [[nodiscard]] constexpr T highest() noexcept { return T(std::numeric_limits<typename T::element_type>::max()); }
 
     template<element_type_constructible T>
-    [[nodiscard]] T lowest() noexcept { return T(std::numeric_limits<typename T::element_type>::lowest()); }
+    [[nodiscard]] constexpr T lowest() noexcept { return T(std::numeric_limits<typename T::element_type>::lowest()); }
 
     template<element_type_constructible T>
-    [[nodiscard]] T pos_infinity() noexcept { return T(std::numeric_limits<typename T::element_type>::infinity()); }
+    [[nodiscard]] constexpr T pos_infinity() noexcept { return T(std::numeric_limits<typename T::element_type>::infinity()); }
 
     template<element_type_constructible T>
-    [[nodiscard]] T neg_infinity() noexcept { return T(-std::numeric_limits<typename T::element_type>::infinity()); }
+    [[nodiscard]] constexpr T neg_infinity() noexcept { return T(-std::numeric_limits<typename T::element_type>::infinity()); }
 
     template<element_type_constructible T>
-    [[nodiscard]] T NaN() noexcept { return T(std::numeric_limits<typename T::element_type>::quiet_NaN()); }
+    [[nodiscard]] constexpr T NaN() noexcept { return T(std::numeric_limits<typename T::element_type>::quiet_NaN()); }
 
     ////////////////////////////////////////////////////////////////
     // Check for special values.
@@ -248,19 +245,19 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<size_t ... Indices, template<typename, size_t> class V, typename T, size_t N> requires std::is_same_v<V<T, N>, vec<T, N>>
-    [[nodiscard]] auto shuffle(const V<T, N>& v)
+    [[nodiscard]] constexpr auto shuffle(const V<T, N>& v)
     {
         return vec<T, sizeof...(Indices)>(v[Indices]...);
     }
 
     template<std::integral ... Indices, template<typename, size_t> class V, typename T, size_t N> requires std::is_same_v<V<T, N>, vec<T, N>>
-    [[nodiscard]] auto shuffle_v(const V<T, N>& v, const Indices... i)
+    [[nodiscard]] constexpr auto shuffle_v(const V<T, N>& v, const Indices... i)
     {
         return vec<T, sizeof...(Indices)>(v[i]...);
     }
 
     template<typename T, std::integral I, size_t N>
-    [[nodiscard]] auto shuffle_v(const vec<T, N>& v, const vec<I, N>& indices)
+    [[nodiscard]] constexpr auto shuffle_v(const vec<T, N>& v, const vec<I, N>& indices)
     {
         vec<T, N> v2;
         for (I i = 0; i < N; ++i)
@@ -273,7 +270,7 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<arithmetic T, size_t N>
-    [[nodiscard]] vec<T, N> operator+(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator+(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -282,7 +279,7 @@ namespace math
     }
 
     template<arithmetic T, size_t N>
-    [[nodiscard]] vec<T, N> operator+(const vec<T, N>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator+(const vec<T, N>& lhs, const T rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -291,7 +288,7 @@ namespace math
     }
 
     template<arithmetic T, size_t N>
-    [[nodiscard]] vec<T, N> operator+(const T lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator+(const T lhs, const vec<T, N>& rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -300,7 +297,7 @@ namespace math
     }
 
     template<arithmetic T, size_t N>
-    [[nodiscard]] vec<T, N> operator-(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator-(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -309,7 +306,7 @@ namespace math
     }
 
     template<arithmetic T, size_t N>
-    [[nodiscard]] vec<T, N> operator-(const vec<T, N>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator-(const vec<T, N>& lhs, const T rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -318,7 +315,7 @@ namespace math
     }
 
     template<arithmetic T, size_t N>
-    [[nodiscard]] vec<T, N> operator-(const T lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator-(const T lhs, const vec<T, N>& rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -327,7 +324,7 @@ namespace math
     }
 
     template<arithmetic T, size_t N>
-    [[nodiscard]] vec<T, N> operator-(const vec<T, N>& lhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator-(const vec<T, N>& lhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -336,7 +333,7 @@ namespace math
     }
 
     template<arithmetic T, size_t N>
-    [[nodiscard]] vec<T, N> operator*(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator*(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -345,7 +342,7 @@ namespace math
     }
 
     template<arithmetic T, size_t N>
-    [[nodiscard]] vec<T, N> operator*(const vec<T, N>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator*(const vec<T, N>& lhs, const T rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -354,7 +351,7 @@ namespace math
     }
 
     template<arithmetic T, size_t N>
-    [[nodiscard]] vec<T, N> operator*(const T lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator*(const T lhs, const vec<T, N>& rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -363,7 +360,7 @@ namespace math
     }
 
     template<arithmetic T, size_t N>
-    [[nodiscard]] vec<T, N> operator/(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator/(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -372,7 +369,7 @@ namespace math
     }
 
     template<arithmetic T, size_t N>
-    [[nodiscard]] vec<T, N> operator/(const vec<T, N>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator/(const vec<T, N>& lhs, const T rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -381,7 +378,7 @@ namespace math
     }
 
     template<arithmetic T, size_t N>
-    [[nodiscard]] vec<T, N> operator/(const T lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator/(const T lhs, const vec<T, N>& rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -390,35 +387,35 @@ namespace math
     }
 
     template<arithmetic T, size_t N>
-    vec<T, N>& operator+=(vec<T, N>& lhs, const vec<T, N>& rhs) noexcept { return lhs = lhs + rhs; }
+    constexpr vec<T, N>& operator+=(vec<T, N>& lhs, const vec<T, N>& rhs) noexcept { return lhs = lhs + rhs; }
 
     template<arithmetic T, size_t N>
-    vec<T, N>& operator+=(vec<T, N>& lhs, const T rhs) noexcept { return lhs = lhs + rhs; }
+    constexpr vec<T, N>& operator+=(vec<T, N>& lhs, const T rhs) noexcept { return lhs = lhs + rhs; }
 
     template<arithmetic T, size_t N>
-    vec<T, N>& operator-=(vec<T, N>& lhs, const vec<T, N>& rhs) noexcept { return lhs = lhs - rhs; }
+    constexpr vec<T, N>& operator-=(vec<T, N>& lhs, const vec<T, N>& rhs) noexcept { return lhs = lhs - rhs; }
 
     template<arithmetic T, size_t N>
-    vec<T, N>& operator-=(vec<T, N>& lhs, const T rhs) noexcept { return lhs = lhs - rhs; }
+    constexpr vec<T, N>& operator-=(vec<T, N>& lhs, const T rhs) noexcept { return lhs = lhs - rhs; }
 
     template<arithmetic T, size_t N>
-    vec<T, N>& operator*=(vec<T, N>& lhs, const vec<T, N>& rhs) noexcept { return lhs = lhs * rhs; }
+    constexpr vec<T, N>& operator*=(vec<T, N>& lhs, const vec<T, N>& rhs) noexcept { return lhs = lhs * rhs; }
 
     template<arithmetic T, size_t N>
-    vec<T, N>& operator*=(vec<T, N>& lhs, const T rhs) noexcept { return lhs = lhs * rhs; }
+    constexpr vec<T, N>& operator*=(vec<T, N>& lhs, const T rhs) noexcept { return lhs = lhs * rhs; }
 
     template<arithmetic T, size_t N>
-    vec<T, N>& operator/=(vec<T, N>& lhs, const vec<T, N>& rhs) noexcept { return lhs = lhs / rhs; }
+    constexpr vec<T, N>& operator/=(vec<T, N>& lhs, const vec<T, N>& rhs) noexcept { return lhs = lhs / rhs; }
 
     template<arithmetic T, size_t N>
-    vec<T, N>& operator/=(vec<T, N>& lhs, const T rhs) noexcept { return lhs = lhs / rhs; }
+    constexpr vec<T, N>& operator/=(vec<T, N>& lhs, const T rhs) noexcept { return lhs = lhs / rhs; }
 
     ////////////////////////////////////////////////////////////////
     // Comparison operators.
     ////////////////////////////////////////////////////////////////
 
     template<std::equality_comparable T, size_t N>
-    [[nodiscard]] bool operator==(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr bool operator==(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
     {
         for (size_t i = 0; i < N; i++)
             if (lhs[i] != rhs[i])
@@ -427,7 +424,7 @@ namespace math
     }
 
     template<std::equality_comparable T, size_t N>
-    [[nodiscard]] bool operator!=(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr bool operator!=(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
     {
         for (size_t i = 0; i < N; i++)
             if (lhs[i] == rhs[i])
@@ -440,7 +437,7 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<std::totally_ordered T, size_t N>
-    [[nodiscard]] vec<bool, N> cmpeq(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, N> cmpeq(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
     {
         vec<bool, N> b;
         for (size_t i = 0; i < N; i++)
@@ -449,7 +446,7 @@ namespace math
     }
 
     template<std::totally_ordered T, size_t N>
-    [[nodiscard]] vec<bool, N> cmpeq(const vec<T, N>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, N> cmpeq(const vec<T, N>& lhs, const T rhs) noexcept
     {
         vec<bool, N> b;
         for (size_t i = 0; i < N; i++)
@@ -458,7 +455,7 @@ namespace math
     }
 
     template<std::totally_ordered T, size_t N>
-    [[nodiscard]] vec<bool, N> cmpeq(const T lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, N> cmpeq(const T lhs, const vec<T, N>& rhs) noexcept
     {
         vec<bool, N> b;
         for (size_t i = 0; i < N; i++)
@@ -467,7 +464,7 @@ namespace math
     }
 
     template<std::totally_ordered T, size_t N>
-    [[nodiscard]] vec<bool, N> cmpneq(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, N> cmpneq(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
     {
         vec<bool, N> b;
         for (size_t i = 0; i < N; i++)
@@ -476,7 +473,7 @@ namespace math
     }
 
     template<std::totally_ordered T, size_t N>
-    [[nodiscard]] vec<bool, N> cmpneq(const vec<T, N>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, N> cmpneq(const vec<T, N>& lhs, const T rhs) noexcept
     {
         vec<bool, N> b;
         for (size_t i = 0; i < N; i++)
@@ -485,7 +482,7 @@ namespace math
     }
 
     template<std::totally_ordered T, size_t N>
-    [[nodiscard]] vec<bool, N> cmpneq(const T lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, N> cmpneq(const T lhs, const vec<T, N>& rhs) noexcept
     {
         vec<bool, N> b;
         for (size_t i = 0; i < N; i++)
@@ -494,7 +491,7 @@ namespace math
     }
 
     template<std::totally_ordered T, size_t N>
-    [[nodiscard]] vec<bool, N> cmplt(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, N> cmplt(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
     {
         vec<bool, N> b;
         for (size_t i = 0; i < N; i++)
@@ -503,7 +500,7 @@ namespace math
     }
 
     template<std::totally_ordered T, size_t N>
-    [[nodiscard]] vec<bool, N> cmplt(const vec<T, N>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, N> cmplt(const vec<T, N>& lhs, const T rhs) noexcept
     {
         vec<bool, N> b;
         for (size_t i = 0; i < N; i++)
@@ -512,7 +509,7 @@ namespace math
     }
 
     template<std::totally_ordered T, size_t N>
-    [[nodiscard]] vec<bool, N> cmplt(const T lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, N> cmplt(const T lhs, const vec<T, N>& rhs) noexcept
     {
         vec<bool, N> b;
         for (size_t i = 0; i < N; i++)
@@ -521,7 +518,7 @@ namespace math
     }
 
     template<std::totally_ordered T, size_t N>
-    [[nodiscard]] vec<bool, N> cmpgt(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, N> cmpgt(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
     {
         vec<bool, N> b;
         for (size_t i = 0; i < N; i++)
@@ -530,7 +527,7 @@ namespace math
     }
 
     template<std::totally_ordered T, size_t N>
-    [[nodiscard]] vec<bool, N> cmpgt(const vec<T, N>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, N> cmpgt(const vec<T, N>& lhs, const T rhs) noexcept
     {
         vec<bool, N> b;
         for (size_t i = 0; i < N; i++)
@@ -539,7 +536,7 @@ namespace math
     }
 
     template<std::totally_ordered T, size_t N>
-    [[nodiscard]] vec<bool, N> cmpgt(const T lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, N> cmpgt(const T lhs, const vec<T, N>& rhs) noexcept
     {
         vec<bool, N> b;
         for (size_t i = 0; i < N; i++)
@@ -548,7 +545,7 @@ namespace math
     }
 
     template<std::totally_ordered T, size_t N>
-    [[nodiscard]] vec<bool, N> cmple(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, N> cmple(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
     {
         vec<bool, N> b;
         for (size_t i = 0; i < N; i++)
@@ -557,7 +554,7 @@ namespace math
     }
 
     template<std::totally_ordered T, size_t N>
-    [[nodiscard]] vec<bool, N> cmple(const vec<T, N>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, N> cmple(const vec<T, N>& lhs, const T rhs) noexcept
     {
         vec<bool, N> b;
         for (size_t i = 0; i < N; i++)
@@ -566,7 +563,7 @@ namespace math
     }
 
     template<std::totally_ordered T, size_t N>
-    [[nodiscard]] vec<bool, N> cmple(const T lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, N> cmple(const T lhs, const vec<T, N>& rhs) noexcept
     {
         vec<bool, N> b;
         for (size_t i = 0; i < N; i++)
@@ -575,7 +572,7 @@ namespace math
     }
 
     template<std::totally_ordered T, size_t N>
-    [[nodiscard]] vec<bool, N> cmpge(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, N> cmpge(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
     {
         vec<bool, N> b;
         for (size_t i = 0; i < N; i++)
@@ -584,7 +581,7 @@ namespace math
     }
 
     template<std::totally_ordered T, size_t N>
-    [[nodiscard]] vec<bool, N> cmpge(const vec<T, N>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, N> cmpge(const vec<T, N>& lhs, const T rhs) noexcept
     {
         vec<bool, N> b;
         for (size_t i = 0; i < N; i++)
@@ -593,7 +590,7 @@ namespace math
     }
 
     template<std::totally_ordered T, size_t N>
-    [[nodiscard]] vec<bool, N> cmpge(const T lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<bool, N> cmpge(const T lhs, const vec<T, N>& rhs) noexcept
     {
         vec<bool, N> b;
         for (size_t i = 0; i < N; i++)
@@ -740,7 +737,7 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<arithmetic T, size_t N>
-    [[nodiscard]] T dot(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr T dot(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
     {
         T s(0);
         for (size_t i = 0; i < N; i++)
@@ -752,7 +749,7 @@ namespace math
     [[nodiscard]] T length(const vec<T, N>& lhs) noexcept { return sqrt(dot(lhs, lhs)); }
 
     template<std::floating_point T, size_t N>
-    [[nodiscard]] T sqr_length(const vec<T, N>& lhs) noexcept { return dot(lhs, lhs); }
+    [[nodiscard]] constexpr T sqr_length(const vec<T, N>& lhs) noexcept { return dot(lhs, lhs); }
 
     template<std::floating_point T, size_t N>
     [[nodiscard]] T rcp_length(const vec<T, N>& lhs) noexcept { return rsqrt(dot(lhs, lhs)); }
@@ -767,7 +764,7 @@ namespace math
     [[nodiscard]] T distance(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept { return length(lhs - rhs); }
 
     template<arithmetic T, size_t N>
-    [[nodiscard]] vec<T, N> lerp(const vec<T, N>& a, const vec<T, N>& b, const vec<T, N>& t) noexcept
+    [[nodiscard]] constexpr vec<T, N> lerp(const vec<T, N>& a, const vec<T, N>& b, const vec<T, N>& t) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -776,7 +773,7 @@ namespace math
     }
 
     template<arithmetic T, size_t N>
-    [[nodiscard]] vec<T, N> lerp(const vec<T, N>& a, const vec<T, N>& b, const T t) noexcept
+    [[nodiscard]] constexpr vec<T, N> lerp(const vec<T, N>& a, const vec<T, N>& b, const T t) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -1024,7 +1021,7 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<typename T, size_t N>
-    [[nodiscard]] vec<T, N> select(const vec<T, N>& t, const vec<T, N>& f, const vec<bool, N>& b) noexcept
+    [[nodiscard]] constexpr vec<T, N> select(const vec<T, N>& t, const vec<T, N>& f, const vec<bool, N>& b) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -1077,7 +1074,7 @@ namespace math
     ////////////////////////////////////////////////////////////////
 
     template<std::integral T, std::integral U, size_t N>
-    [[nodiscard]] vec<T, N> operator<<(const vec<T, N>& lhs, const vec<U, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator<<(const vec<T, N>& lhs, const vec<U, N>& rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -1086,7 +1083,7 @@ namespace math
     }
 
     template<std::integral T, std::integral U, size_t N>
-    [[nodiscard]] vec<T, N> operator<<(const vec<T, N>& lhs, const U rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator<<(const vec<T, N>& lhs, const U rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -1095,7 +1092,7 @@ namespace math
     }
 
     template<std::integral T, std::integral U, size_t N>
-    [[nodiscard]] vec<T, N> operator<<(const T lhs, const vec<U, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator<<(const T lhs, const vec<U, N>& rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -1104,7 +1101,7 @@ namespace math
     }
 
     template<std::integral T, std::integral U, size_t N>
-    [[nodiscard]] vec<T, N> operator>>(const vec<T, N>& lhs, const vec<U, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator>>(const vec<T, N>& lhs, const vec<U, N>& rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -1113,7 +1110,7 @@ namespace math
     }
 
     template<std::integral T, std::integral U, size_t N>
-    [[nodiscard]] vec<T, N> operator>>(const vec<T, N>& lhs, const U rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator>>(const vec<T, N>& lhs, const U rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -1122,7 +1119,7 @@ namespace math
     }
 
     template<std::integral T, std::integral U, size_t N>
-    [[nodiscard]] vec<T, N> operator>>(const T lhs, const vec<U, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator>>(const T lhs, const vec<U, N>& rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -1131,23 +1128,23 @@ namespace math
     }
 
     template<std::integral T, std::integral U, size_t N>
-    [[nodiscard]] vec<T, N>& operator<<=(vec<T, N>& lhs, const vec<U, N>& rhs) noexcept { return lhs = lhs << rhs; }
+    [[nodiscard]] constexpr vec<T, N>& operator<<=(vec<T, N>& lhs, const vec<U, N>& rhs) noexcept { return lhs = lhs << rhs; }
 
     template<std::integral T, std::integral U, size_t N>
-    [[nodiscard]] vec<T, N>& operator<<=(vec<T, N>& lhs, const U rhs) noexcept { return lhs = lhs << rhs; }
+    [[nodiscard]] constexpr vec<T, N>& operator<<=(vec<T, N>& lhs, const U rhs) noexcept { return lhs = lhs << rhs; }
 
     template<std::integral T, std::integral U, size_t N>
-    [[nodiscard]] vec<T, N>& operator>>=(vec<T, N>& lhs, const vec<U, N>& rhs) noexcept { return lhs = lhs >> rhs; }
+    [[nodiscard]] constexpr vec<T, N>& operator>>=(vec<T, N>& lhs, const vec<U, N>& rhs) noexcept { return lhs = lhs >> rhs; }
 
     template<std::integral T, std::integral U, size_t N>
-    [[nodiscard]] vec<T, N>& operator>>=(vec<T, N>& lhs, const U rhs) noexcept { return lhs = lhs >> rhs; }
+    [[nodiscard]] constexpr vec<T, N>& operator>>=(vec<T, N>& lhs, const U rhs) noexcept { return lhs = lhs >> rhs; }
 
     ////////////////////////////////////////////////////////////////
     // Bitwise operators.
     ////////////////////////////////////////////////////////////////
 
     template<std::integral T, size_t N>
-    [[nodiscard]] vec<T, N> operator|(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator|(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -1156,7 +1153,7 @@ namespace math
     }
 
     template<std::integral T, size_t N>
-    [[nodiscard]] vec<T, N> operator|(const vec<T, N>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator|(const vec<T, N>& lhs, const T rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -1165,7 +1162,7 @@ namespace math
     }
 
     template<std::integral T, size_t N>
-    [[nodiscard]] vec<T, N> operator|(const T lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator|(const T lhs, const vec<T, N>& rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -1174,7 +1171,7 @@ namespace math
     }
 
     template<std::integral T, size_t N>
-    [[nodiscard]] vec<T, N> operator&(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator&(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -1183,7 +1180,7 @@ namespace math
     }
 
     template<std::integral T, size_t N>
-    [[nodiscard]] vec<T, N> operator&(const vec<T, N>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator&(const vec<T, N>& lhs, const T rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -1192,7 +1189,7 @@ namespace math
     }
 
     template<std::integral T, size_t N>
-    [[nodiscard]] vec<T, N> operator&(const T lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator&(const T lhs, const vec<T, N>& rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -1201,7 +1198,7 @@ namespace math
     }
 
     template<std::integral T, size_t N>
-    [[nodiscard]] vec<T, N> operator^(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator^(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -1210,7 +1207,7 @@ namespace math
     }
 
     template<std::integral T, size_t N>
-    [[nodiscard]] vec<T, N> operator^(const vec<T, N>& lhs, const T rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator^(const vec<T, N>& lhs, const T rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -1219,7 +1216,7 @@ namespace math
     }
     
     template<std::integral T, size_t N>
-    [[nodiscard]] vec<T, N> operator^(const T lhs, const vec<T, N>& rhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator^(const T lhs, const vec<T, N>& rhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -1228,7 +1225,7 @@ namespace math
     }
 
     template<std::integral T, size_t N>
-    [[nodiscard]] vec<T, N> operator~(const vec<T, N>& lhs) noexcept
+    [[nodiscard]] constexpr vec<T, N> operator~(const vec<T, N>& lhs) noexcept
     {
         vec<T, N> v;
         for (size_t i = 0; i < N; i++)
@@ -1237,29 +1234,29 @@ namespace math
     }
 
     template<std::integral T, size_t N>
-    [[nodiscard]] vec<T, N>& operator|=(vec<T, N>& lhs, const vec<T, N>& rhs) noexcept { return lhs = lhs | rhs; }
+    [[nodiscard]] constexpr vec<T, N>& operator|=(vec<T, N>& lhs, const vec<T, N>& rhs) noexcept { return lhs = lhs | rhs; }
 
     template<std::integral T, size_t N>
-    [[nodiscard]] vec<T, N>& operator|=(vec<T, N>& lhs, const T rhs) noexcept { return lhs = lhs | rhs; }
+    [[nodiscard]] constexpr vec<T, N>& operator|=(vec<T, N>& lhs, const T rhs) noexcept { return lhs = lhs | rhs; }
 
     template<std::integral T, size_t N>
-    [[nodiscard]] vec<T, N>& operator&=(vec<T, N>& lhs, const vec<T, N>& rhs) noexcept { return lhs = lhs & rhs; }
+    [[nodiscard]] constexpr vec<T, N>& operator&=(vec<T, N>& lhs, const vec<T, N>& rhs) noexcept { return lhs = lhs & rhs; }
 
     template<std::integral T, size_t N>
-    [[nodiscard]] vec<T, N>& operator&=(vec<T, N>& lhs, const T rhs) noexcept { return lhs = lhs & rhs; }
+    [[nodiscard]] constexpr vec<T, N>& operator&=(vec<T, N>& lhs, const T rhs) noexcept { return lhs = lhs & rhs; }
 
     template<std::integral T, size_t N>
-    [[nodiscard]] vec<T, N>& operator^=(vec<T, N>& lhs, const vec<T, N>& rhs) noexcept { return lhs = lhs ^ rhs; }
+    [[nodiscard]] constexpr vec<T, N>& operator^=(vec<T, N>& lhs, const vec<T, N>& rhs) noexcept { return lhs = lhs ^ rhs; }
 
     template<std::integral T, size_t N>
-    [[nodiscard]] vec<T, N>& operator^=(vec<T, N>& lhs, const T rhs) noexcept { return lhs = lhs ^ rhs; }
+    [[nodiscard]] constexpr vec<T, N>& operator^=(vec<T, N>& lhs, const T rhs) noexcept { return lhs = lhs ^ rhs; }
 
     ////////////////////////////////////////////////////////////////
     // Boolean vector reduction.
     ////////////////////////////////////////////////////////////////
 
     template<size_t N>
-    [[nodiscard]] bool all(const vec<bool, N>& lhs) noexcept
+    [[nodiscard]] constexpr bool all(const vec<bool, N>& lhs) noexcept
     {
         for (size_t i = 0; i < N; i++)
             if (!lhs[i])
@@ -1268,7 +1265,7 @@ namespace math
     }
 
     template<size_t N>
-    [[nodiscard]] bool any(const vec<bool, N>& lhs) noexcept
+    [[nodiscard]] constexpr bool any(const vec<bool, N>& lhs) noexcept
     {
         for (size_t i = 0; i < N; i++)
             if (lhs[i])
@@ -1277,7 +1274,7 @@ namespace math
     }
 
     template<size_t N>
-    [[nodiscard]] bool none(const vec<bool, N>& lhs) noexcept { return !any(lhs); }
+    [[nodiscard]] constexpr bool none(const vec<bool, N>& lhs) noexcept { return !any(lhs); }
 
     ////////////////////////////////////////////////////////////////
     // Output.
@@ -0,0 +1,118 @@
+#include "math/dispatch.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cassert>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/compilation_info.h"
+#include "kernels/kernels.h"
+
+namespace math
+{
+    namespace
+    {
+        ////////////////////////////////////////////////////////////////
+        // Generic kernels.
+        ////////////////////////////////////////////////////////////////
+
+        template<bool Point>
+        void transform_generic(const kernels::transform_args& a) noexcept
+        {
+            const float* m = a.m;
+            for (size_t i = 0; i < a.n; i++)
+            {
+                const float x = a.x[i], y = a.y[i], z = a.z[i];
+                a.ox[i] = m[0] * x + m[1] * y + m[2] * z + (Point ? m[3] : 0.0f);
+                a.oy[i] = m[4] * x + m[5] * y + m[6] * z + (Point ? m[7] : 0.0f);
+                a.oz[i] = m[8] * x + m[9] * y + m[10] * z + (Point ? m[11] : 0.0f);
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////
+        // Dispatch table.
+        ////////////////////////////////////////////////////////////////
+
+        struct dispatch_table
+        {
+            isa_level isa;
+            kernels::transform_fn transform_points;
+            kernels::transform_fn transform_directions;
+        };
+
+        [[nodiscard]] dispatch_table make_table(const isa_level isa) noexcept
+        {
+            switch (isa)
+            {
+            case isa_level::sse4_1: return { isa, kernels::transform_points_sse4_1, kernels::transform_directions_sse4_1 };
+            case isa_level::avx2: return { isa, kernels::transform_points_avx2, kernels::transform_directions_avx2 };
+            case isa_level::avx512: return { isa, kernels::transform_points_avx512, kernels::transform_directions_avx512 };
+            default: return { isa_level::generic, transform_generic<true>, transform_generic<false> };
+            }
+        }
+
+        [[nodiscard]] dispatch_table& table() noexcept
+        {
+            static dispatch_table t = make_table(best_isa());
+            return t;
+        }
+
+        [[nodiscard]] kernels::transform_args make_args(const matrix<float, 3, 4>& m, const vec3_span<const float>& in, const vec3_span<float>& out) noexcept
+        {
+            assert(in.y.size() == in.size() && in.z.size() == in.size());
+            assert(out.size() >= in.size() && out.y.size() >= in.size() && out.z.size() >= in.size());
+            return { &m.r0.x, in.x.data(), in.y.data(), in.z.data(), out.x.data(), out.y.data(), out.z.data(), in.size() };
+        }
+    }
+
+    const char* to_string(const isa_level isa) noexcept
+    {
+        switch (isa)
+        {
+        case isa_level::sse4_1: return "SSE4.1";
+        case isa_level::avx2: return "AVX2+FMA";
+        case isa_level::avx512: return "AVX-512";
+        default: return "generic";
+        }
+    }
+
+    isa_level best_isa() noexcept
+    {
+        static const isa_level isa = [] {
+            const cpu_features f = detect_cpu_features();
+            if (f.avx512f && f.avx512vl) return isa_level::avx512;
+            if (f.avx2 && f.fma) return isa_level::avx2;
+            if (f.sse4_1) return isa_level::sse4_1;
+            return isa_level::generic;
+        }();
+        return isa;
+    }
+
+    isa_level active_isa() noexcept { return table().isa; }
+
+    bool set_isa(const isa_level isa) noexcept
+    {
+        if (isa > best_isa()) return false;
+        table() = make_table(isa);
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Kernels.
+    ////////////////////////////////////////////////////////////////
+
+    void transform_points(const matrix<float, 3, 4>& m, const vec3_span<const float>& in, const vec3_span<float>& out) noexcept
+    {
+        table().transform_points(make_args(m, in, out));
+    }
+
+    void transform_directions(const matrix<float, 3, 4>& m, const vec3_span<const float>& in, const vec3_span<float>& out) noexcept
+    {
+        table().transform_directions(make_args(m, in, out));
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+
+/*
+ * Interface between the dispatcher and the per-ISA kernel translation units.
+ *
+ * The kernel translation units are compiled with extra target flags. They must not include math headers or use any other
+ * inline function with external linkage: the linker keeps an arbitrary copy of such functions, which could then contain
+ * instructions the CPU does not support. All helpers in the kernel translation units are therefore in an anonymous namespace.
+ */
+
+namespace math::kernels
+{
+    struct transform_args
+    {
+        // Row-major 3x4 affine transform.
+        const float* m;
+        const float* x;
+        const float* y;
+        const float* z;
+        float* ox;
+        float* oy;
+        float* oz;
+        size_t n;
+    };
+
+    using transform_fn = void (*)(const transform_args&) noexcept;
+
+    void transform_points_sse4_1(const transform_args& args) noexcept;
+    void transform_directions_sse4_1(const transform_args& args) noexcept;
+
+    void transform_points_avx2(const transform_args& args) noexcept;
+    void transform_directions_avx2(const transform_args& args) noexcept;
+
+    void transform_points_avx512(const transform_args& args) noexcept;
+    void transform_directions_avx512(const transform_args& args) noexcept;
+}
@@ -0,0 +1,50 @@
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <immintrin.h>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "kernels/transform_kernel.h"
+
+namespace math::kernels
+{
+    namespace
+    {
+        struct avx2_ops
+        {
+            using reg = __m256;
+            static constexpr size_t width = 8;
+
+            static reg set1(const float v) noexcept { return _mm256_set1_ps(v); }
+
+            static reg mul(const reg a, const reg b) noexcept { return _mm256_mul_ps(a, b); }
+
+            static reg madd(const reg a, const reg b, const reg c) noexcept { return _mm256_fmadd_ps(a, b, c); }
+
+            [[nodiscard]] static __m256i tail_mask(const size_t count) noexcept
+            {
+                return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(count)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            }
+
+            static reg load(const float* ptr, const size_t count) noexcept
+            {
+                if (count == width) return _mm256_loadu_ps(ptr);
+                return _mm256_maskload_ps(ptr, tail_mask(count));
+            }
+
+            static void store(float* ptr, const reg v, const size_t count) noexcept
+            {
+                if (count == width) return _mm256_storeu_ps(ptr, v);
+                _mm256_maskstore_ps(ptr, tail_mask(count), v);
+            }
+        };
+    }
+
+    void transform_points_avx2(const transform_args& args) noexcept { transform<avx2_ops, true>(args); }
+
+    void transform_directions_avx2(const transform_args& args) noexcept { transform<avx2_ops, false>(args); }
+}
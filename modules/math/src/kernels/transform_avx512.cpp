@@ -0,0 +1,43 @@
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <immintrin.h>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "kernels/transform_kernel.h"
+
+namespace math::kernels
+{
+    namespace
+    {
+        struct avx512_ops
+        {
+            using reg = __m512;
+            static constexpr size_t width = 16;
+
+            static reg set1(const float v) noexcept { return _mm512_set1_ps(v); }
+
+            static reg mul(const reg a, const reg b) noexcept { return _mm512_mul_ps(a, b); }
+
+            static reg madd(const reg a, const reg b, const reg c) noexcept { return _mm512_fmadd_ps(a, b, c); }
+
+            static reg load(const float* ptr, const size_t count) noexcept
+            {
+                return _mm512_maskz_loadu_ps(static_cast<__mmask16>((1u << count) - 1), ptr);
+            }
+
+            static void store(float* ptr, const reg v, const size_t count) noexcept
+            {
+                _mm512_mask_storeu_ps(ptr, static_cast<__mmask16>((1u << count) - 1), v);
+            }
+        };
+    }
+
+    void transform_points_avx512(const transform_args& args) noexcept { transform<avx512_ops, true>(args); }
+
+    void transform_directions_avx512(const transform_args& args) noexcept { transform<avx512_ops, false>(args); }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "kernels/kernels.h"
+
+namespace math::kernels
+{
+    namespace
+    {
+        /**
+         * @brief Affine transform of W points or directions per iteration. Ops provides the register type and operations of
+         * one instruction set. Since Ops is declared in an anonymous namespace, every instantiation has internal linkage.
+         */
+        template<typename Ops, bool Point>
+        void transform(const transform_args& a) noexcept
+        {
+            using reg = typename Ops::reg;
+            constexpr size_t W = Ops::width;
+
+            const reg m00 = Ops::set1(a.m[0]), m01 = Ops::set1(a.m[1]), m02 = Ops::set1(a.m[2]), m03 = Ops::set1(a.m[3]);
+            const reg m10 = Ops::set1(a.m[4]), m11 = Ops::set1(a.m[5]), m12 = Ops::set1(a.m[6]), m13 = Ops::set1(a.m[7]);
+            const reg m20 = Ops::set1(a.m[8]), m21 = Ops::set1(a.m[9]), m22 = Ops::set1(a.m[10]), m23 = Ops::set1(a.m[11]);
+
+            const auto row = [](const reg& c0, const reg& c1, const reg& c2, const reg& c3, const reg& x, const reg& y, const reg& z) {
+                if constexpr (Point)
+                    return Ops::madd(c0, x, Ops::madd(c1, y, Ops::madd(c2, z, c3)));
+                else
+                    return Ops::madd(c0, x, Ops::madd(c1, y, Ops::mul(c2, z)));
+            };
+
+            // All inputs are loaded before anything is stored, so the output may alias the input.
+            const auto step = [&](const size_t i, const size_t count) {
+                const reg x = Ops::load(a.x + i, count);
+                const reg y = Ops::load(a.y + i, count);
+                const reg z = Ops::load(a.z + i, count);
+                Ops::store(a.ox + i, row(m00, m01, m02, m03, x, y, z), count);
+                Ops::store(a.oy + i, row(m10, m11, m12, m13, x, y, z), count);
+                Ops::store(a.oz + i, row(m20, m21, m22, m23, x, y, z), count);
+            };
+
+            size_t i = 0;
+            for (; i + W <= a.n; i += W) step(i, W);
+            if (i < a.n) step(i, a.n - i);
+        }
+    }
+}
@@ -0,0 +1,49 @@
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <immintrin.h>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "kernels/transform_kernel.h"
+
+namespace math::kernels
+{
+    namespace
+    {
+        struct sse4_1_ops
+        {
+            using reg = __m128;
+            static constexpr size_t width = 4;
+
+            static reg set1(const float v) noexcept { return _mm_set1_ps(v); }
+
+            static reg mul(const reg a, const reg b) noexcept { return _mm_mul_ps(a, b); }
+
+            static reg madd(const reg a, const reg b, const reg c) noexcept { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+
+            static reg load(const float* ptr, const size_t count) noexcept
+            {
+                if (count == width) return _mm_loadu_ps(ptr);
+                alignas(16) float tmp[width] = {};
+                for (size_t i = 0; i < count; i++) tmp[i] = ptr[i];
+                return _mm_load_ps(tmp);
+            }
+
+            static void store(float* ptr, const reg v, const size_t count) noexcept
+            {
+                if (count == width) return _mm_storeu_ps(ptr, v);
+                alignas(16) float tmp[width];
+                _mm_store_ps(tmp, v);
+                for (size_t i = 0; i < count; i++) ptr[i] = tmp[i];
+            }
+        };
+    }
+
+    void transform_points_sse4_1(const transform_args& args) noexcept { transform<sse4_1_ops, true>(args); }
+
+    void transform_directions_sse4_1(const transform_args& args) noexcept { transform<sse4_1_ops, false>(args); }
+}
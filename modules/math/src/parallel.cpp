@@ -0,0 +1,258 @@
+#include "math/parallel.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+
+namespace math
+{
+    namespace
+    {
+        // True while the thread runs a task of the pool or of detail::run_tasks. Parallel calls from tasks run serially instead
+        // of waiting for the pool, which would deadlock.
+        thread_local bool inside_task = false;
+
+        /**
+         * @brief Sets inside_task for the lifetime of the object and restores it afterwards, also when a task throws.
+         */
+        struct task_scope
+        {
+            task_scope() noexcept : outer(std::exchange(inside_task, true)) {}
+
+            ~task_scope() noexcept { inside_task = outer; }
+
+            task_scope(const task_scope&) = delete;
+
+            task_scope& operator=(const task_scope&) = delete;
+
+            bool outer;
+        };
+
+        ////////////////////////////////////////////////////////////////
+        // Shares of a job.
+        ////////////////////////////////////////////////////////////////
+
+        // The share of each thread is a range of task indices packed into one atomic, begin in the low and end in the high 32
+        // bits. The owner takes tasks from the front, other threads steal from the back.
+
+        [[nodiscard]] constexpr uint64_t pack(const uint64_t begin, const uint64_t end) noexcept { return begin | end << 32; }
+
+        [[nodiscard]] std::optional<size_t> pop_front(std::atomic<uint64_t>& share) noexcept
+        {
+            uint64_t v = share.load(std::memory_order_relaxed);
+            while (true)
+            {
+                const uint64_t begin = v & 0xffffffff, end = v >> 32;
+                if (begin >= end) return std::nullopt;
+                if (share.compare_exchange_weak(v, pack(begin + 1, end), std::memory_order_relaxed)) return begin;
+            }
+        }
+
+        [[nodiscard]] std::optional<size_t> steal_back(std::atomic<uint64_t>& share) noexcept
+        {
+            uint64_t v = share.load(std::memory_order_relaxed);
+            while (true)
+            {
+                const uint64_t begin = v & 0xffffffff, end = v >> 32;
+                if (begin >= end) return std::nullopt;
+                if (share.compare_exchange_weak(v, pack(begin, end - 1), std::memory_order_relaxed)) return end - 1;
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////
+        // Thread pool.
+        ////////////////////////////////////////////////////////////////
+
+        class thread_pool final : public executor
+        {
+        public:
+            explicit thread_pool(const size_t threads) : shares(std::make_unique<std::atomic<uint64_t>[]>(std::max<size_t>(threads, 1)))
+            {
+                for (size_t i = 1; i < threads; i++) workers.emplace_back([this, i] { work(i); });
+            }
+
+            thread_pool(const thread_pool&) = delete;
+
+            thread_pool& operator=(const thread_pool&) = delete;
+
+            ~thread_pool() noexcept override
+            {
+                {
+                    std::scoped_lock lock(mutex);
+                    stop = true;
+                }
+                wake.notify_all();
+                for (auto& w : workers) w.join();
+            }
+
+            [[nodiscard]] size_t concurrency() const noexcept override { return workers.size() + 1; }
+
+            void run(const size_t count, const std::function<void(size_t)>& task) override
+            {
+                assert(count <= 0xffffffff);
+
+                // Run serially if there are no workers, if called from a task, or if another thread is using the pool.
+                std::unique_lock busy(submit, std::defer_lock);
+                if (workers.empty() || inside_task || !busy.try_lock())
+                {
+                    for (size_t i = 0; i < count; i++) task(i);
+                    return;
+                }
+
+                const size_t threads = concurrency();
+                for (size_t t = 0; t < threads; t++) shares[t].store(pack(count * t / threads, count * (t + 1) / threads), std::memory_order_relaxed);
+
+                {
+                    std::scoped_lock lock(mutex);
+                    current = &task;
+                    error   = nullptr;
+                    active  = workers.size();
+                    generation++;
+                }
+                wake.notify_all();
+
+                execute(0);
+
+                std::unique_lock lock(mutex);
+                done.wait(lock, [this] { return active == 0; });
+                current = nullptr;
+                if (error) std::rethrow_exception(std::exchange(error, nullptr));
+            }
+
+        private:
+            void work(const size_t self)
+            {
+                uint64_t seen = 0;
+                std::unique_lock lock(mutex);
+                while (true)
+                {
+                    wake.wait(lock, [&] { return stop || generation != seen; });
+                    if (stop) return;
+                    seen = generation;
+
+                    lock.unlock();
+                    execute(self);
+                    lock.lock();
+
+                    if (--active == 0) done.notify_one();
+                }
+            }
+
+            /**
+             * @brief Run the tasks of the own share, then steal from the others until all shares are empty.
+             */
+            void execute(const size_t self)
+            {
+                inside_task = true;
+                const auto call = [&](const size_t i) {
+                    try
+                    {
+                        (*current)(i);
+                    }
+                    catch (...)
+                    {
+                        std::scoped_lock lock(error_mutex);
+                        if (!error) error = std::current_exception();
+                    }
+                };
+
+                const size_t threads = concurrency();
+                while (const auto i = pop_front(shares[self])) call(*i);
+                for (size_t t = 1; t < threads; t++)
+                    while (const auto i = steal_back(shares[(self + t) % threads])) call(*i);
+                inside_task = false;
+            }
+
+            std::vector<std::thread>                 workers;
+            std::unique_ptr<std::atomic<uint64_t>[]> shares;
+
+            /** @brief Held by the thread that submitted the current job. */
+            std::mutex submit;
+
+            /** @brief Protects the job state below. */
+            std::mutex                         mutex;
+            std::condition_variable            wake;
+            std::condition_variable            done;
+            const std::function<void(size_t)>* current    = nullptr;
+            uint64_t                           generation = 0;
+            size_t                             active     = 0;
+            bool                               stop       = false;
+
+            std::mutex         error_mutex;
+            std::exception_ptr error;
+        };
+
+        ////////////////////////////////////////////////////////////////
+        // Configuration.
+        ////////////////////////////////////////////////////////////////
+
+        struct configuration
+        {
+            std::mutex                   mutex;
+            size_t                       threads  = 0;
+            std::unique_ptr<thread_pool> pool;
+            executor*                    external = nullptr;
+        };
+
+        [[nodiscard]] configuration& config() noexcept
+        {
+            static configuration c;
+            return c;
+        }
+    }
+
+    namespace detail
+    {
+        void run_tasks(executor& e, const size_t count, const std::function<void(size_t)>& task)
+        {
+            if (inside_task)
+            {
+                for (size_t i = 0; i < count; i++) task(i);
+                return;
+            }
+
+            // External executors know nothing about inside_task, so it is set around each task here.
+            e.run(count, [&task](const size_t i) {
+                const task_scope scope;
+                task(i);
+            });
+        }
+    }
+
+    void set_thread_count(const size_t count)
+    {
+        auto&            c = config();
+        std::scoped_lock lock(c.mutex);
+        c.threads = count;
+        c.pool.reset();
+    }
+
+    size_t thread_count() { return current_executor().concurrency(); }
+
+    void set_executor(executor* e) noexcept
+    {
+        auto&            c = config();
+        std::scoped_lock lock(c.mutex);
+        c.external = e;
+    }
+
+    executor& current_executor()
+    {
+        auto&            c = config();
+        std::scoped_lock lock(c.mutex);
+        if (c.external) return *c.external;
+        if (!c.pool) c.pool = std::make_unique<thread_pool>(c.threads ? c.threads : std::max(1u, std::thread::hardware_concurrency()));
+        return *c.pool;
+    }
+}
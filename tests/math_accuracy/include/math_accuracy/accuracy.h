@@ -0,0 +1,229 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace accuracy
+{
+    ////////////////////////////////////////////////////////////////
+    // Settings.
+    ////////////////////////////////////////////////////////////////
+
+    struct options
+    {
+        /** @brief Only check functions whose "type function" name contains this string. */
+        std::string filter;
+
+        /** @brief Check every step-th float bit pattern. 1 checks all 2^32 of them. */
+        uint64_t step = 1;
+
+        /** @brief Number of random samples for double precision and vector functions. */
+        uint64_t samples = uint64_t(1) << 26;
+
+        /** @brief Number of worker threads. */
+        unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    };
+
+    [[nodiscard]] inline options& settings() noexcept
+    {
+        static options o;
+        return o;
+    }
+
+    [[nodiscard]] inline bool enabled(const std::string_view name) noexcept
+    {
+        return settings().filter.empty() || name.find(settings().filter) != std::string_view::npos;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Error statistics.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Distance between two adjacent values of type T around x. Denormals all have the same spacing.
+     */
+    template<std::floating_point T>
+    [[nodiscard]] long double ulp(const T x) noexcept
+    {
+        const int e = std::max(std::ilogb(x), std::numeric_limits<T>::min_exponent - 1);
+        return std::ldexp(1.0L, e - (std::numeric_limits<T>::digits - 1));
+    }
+
+    struct stats
+    {
+        /** @brief Largest error in ulps over all inputs with a finite result, and the input it occurred at. For vector
+         * functions the input is the component with the largest error. */
+        double max_ulp = 0;
+        double worst   = 0;
+
+        double   sum_ulp = 0;
+        uint64_t count   = 0;
+
+        /** @brief Inputs for which exactly one of the result and the reference is NaN, and the first such input. */
+        uint64_t nan_mismatch = 0;
+        double   nan_example  = 0;
+
+        /** @brief Inputs for which the result or the reference is infinite, but they differ. */
+        uint64_t inf_mismatch = 0;
+        double   inf_example  = 0;
+
+        /** @brief Inputs for which both are zero, but with a different sign. */
+        uint64_t zero_mismatch = 0;
+        double   zero_example  = 0;
+
+        void merge(const stats& rhs) noexcept
+        {
+            if (rhs.max_ulp > max_ulp || (count == 0 && rhs.count))
+            {
+                max_ulp = rhs.max_ulp;
+                worst   = rhs.worst;
+            }
+            sum_ulp += rhs.sum_ulp;
+            count += rhs.count;
+            if (!nan_mismatch) nan_example = rhs.nan_example;
+            if (!inf_mismatch) inf_example = rhs.inf_example;
+            if (!zero_mismatch) zero_example = rhs.zero_example;
+            nan_mismatch += rhs.nan_mismatch;
+            inf_mismatch += rhs.inf_mismatch;
+            zero_mismatch += rhs.zero_mismatch;
+        }
+
+        /**
+         * @brief Compare a result against the reference, which must be more precise than T.
+         */
+        template<std::floating_point T>
+        void check(const T input, const T result, const long double reference) noexcept
+        {
+            const T ref = static_cast<T>(reference);
+            if (std::isnan(ref) || std::isnan(result))
+            {
+                if (std::isnan(ref) != std::isnan(result) && !nan_mismatch++) nan_example = input;
+                return;
+            }
+
+            if (std::isinf(ref) || std::isinf(result))
+            {
+                if (ref != result && !inf_mismatch++) inf_example = input;
+                return;
+            }
+
+            if (ref == 0 && result == 0 && std::signbit(ref) != std::signbit(result) && !zero_mismatch++) zero_example = input;
+
+            const double err = static_cast<double>(std::abs(static_cast<long double>(result) - reference) / ulp(ref));
+            sum_ulp += err;
+            count++;
+            if (err > max_ulp)
+            {
+                max_ulp = err;
+                worst   = input;
+            }
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////
+    // Sweeps.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Call f(chunk, stats) for every chunk in [0, chunks), spread over settings().threads threads, and merge the
+     * statistics of all threads.
+     */
+    template<typename F>
+    [[nodiscard]] stats parallel(const uint64_t chunks, F&& f)
+    {
+        std::atomic<uint64_t>    next = 0;
+        std::vector<stats>       partial(settings().threads);
+        std::vector<std::thread> threads;
+        for (unsigned t = 0; t < settings().threads; t++)
+        {
+            threads.emplace_back([&, t] {
+                for (uint64_t c = next++; c < chunks; c = next++) f(c, partial[t]);
+            });
+        }
+
+        stats s;
+        for (unsigned t = 0; t < settings().threads; t++)
+        {
+            threads[t].join();
+            s.merge(partial[t]);
+        }
+        return s;
+    }
+
+    /**
+     * @brief Deterministic 64-bit hash of i (splitmix64), so that random samples do not depend on the number of threads.
+     */
+    [[nodiscard]] constexpr uint64_t random(uint64_t i) noexcept
+    {
+        i += 0x9e3779b97f4a7c15ull;
+        i = (i ^ (i >> 30)) * 0xbf58476d1ce4e5b9ull;
+        i = (i ^ (i >> 27)) * 0x94d049bb133111ebull;
+        return i ^ (i >> 31);
+    }
+
+    /**
+     * @brief Apply f to the elements of in, S::size elements at a time. n must be a multiple of S::size.
+     */
+    template<typename S, typename T, typename F>
+    void apply(const T* in, T* out, const size_t n, F&& f)
+    {
+        if constexpr (std::floating_point<S>)
+        {
+            for (size_t i = 0; i < n; i++) out[i] = f(in[i]);
+        }
+        else
+        {
+            for (size_t i = 0; i < n; i += S::size) S::storeu(out + i, f(S::loadu(in + i)));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Reporting.
+    ////////////////////////////////////////////////////////////////
+
+    inline void report(const std::string& name, const stats& s)
+    {
+        std::printf("%-28s max %12.3f ulp at %-14.7g mean %10.4f ulp", name.c_str(), s.max_ulp, s.worst, s.count ? s.sum_ulp / static_cast<double>(s.count) : 0.0);
+        if (s.nan_mismatch) std::printf("  nan: %llu (e.g. %g)", static_cast<unsigned long long>(s.nan_mismatch), s.nan_example);
+        if (s.inf_mismatch) std::printf("  inf: %llu (e.g. %g)", static_cast<unsigned long long>(s.inf_mismatch), s.inf_example);
+        if (s.zero_mismatch) std::printf("  -0: %llu (e.g. %g)", static_cast<unsigned long long>(s.zero_mismatch), s.zero_example);
+        std::printf("\n");
+    }
+
+    /**
+     * @brief Evaluate f on zeros, denormals, infinities and NaN and print every input where the result differs from the
+     * reference in class (NaN, infinite, zero, denormal, normal) or sign.
+     */
+    template<typename S, std::floating_point T, typename F, typename R>
+    void special_values(F&& f, R&& reference)
+    {
+        using limits = std::numeric_limits<T>;
+
+        // Padded with ones to a multiple of the widest SIMD type.
+        std::vector<T> in = {T(0), -T(0), limits::denorm_min(), -limits::denorm_min(), limits::min() - limits::denorm_min(), limits::min(),
+                             T(1), T(-1), limits::max(), limits::lowest(), limits::infinity(), -limits::infinity(), limits::quiet_NaN()};
+        in.resize(16, T(1));
+        std::vector<T> out(in.size());
+        apply<S>(in.data(), out.data(), in.size(), f);
+
+        for (size_t i = 0; i < 13; i++)
+        {
+            const T ref = static_cast<T>(reference(in[i]));
+            if (std::fpclassify(ref) == std::fpclassify(out[i]) && (std::isnan(ref) || std::signbit(ref) == std::signbit(out[i]))) continue;
+            std::printf("%28s f(%g) = %g, expected %g\n", "", static_cast<double>(in[i]), static_cast<double>(out[i]), static_cast<double>(ref));
+        }
+    }
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+/**
+ * @brief Check the double precision functions on double and each double SIMD type against a long double reference, over
+ * settings().samples random bit patterns.
+ */
+void doubleAccuracy();
@@ -0,0 +1,7 @@
+#pragma once
+
+/**
+ * @brief Check the single precision functions on float and each float SIMD type against a double precision reference,
+ * over all (or every settings().step-th) float bit patterns.
+ */
+void floatAccuracy();
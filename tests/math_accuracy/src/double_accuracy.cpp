@@ -0,0 +1,84 @@
+#include "math_accuracy/double_accuracy.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <bit>
+#include <cmath>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/include_all.h"
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math_accuracy/accuracy.h"
+
+namespace
+{
+    constexpr uint64_t chunk_size = 1 << 14;
+
+    /**
+     * @brief Compare f against reference over random double bit patterns, which covers every exponent equally often.
+     */
+    template<typename S, typename F, typename R>
+    void sweep(const std::string& type, const std::string& function, F&& f, R&& reference)
+    {
+        const std::string name = type + " " + function;
+        if (!accuracy::enabled(name)) return;
+
+        const uint64_t chunks = (accuracy::settings().samples + chunk_size - 1) / chunk_size;
+
+        const auto s = accuracy::parallel(chunks, [&](const uint64_t chunk, accuracy::stats& stats) {
+            std::vector<double> in(chunk_size), out(chunk_size);
+            for (size_t i = 0; i < chunk_size; i++) in[i] = std::bit_cast<double>(accuracy::random(chunk * chunk_size + i));
+
+            accuracy::apply<S>(in.data(), out.data(), chunk_size, f);
+            for (size_t i = 0; i < chunk_size; i++) stats.check(in[i], out[i], reference(static_cast<long double>(in[i])));
+        });
+
+        accuracy::report(name, s);
+        accuracy::special_values<S, double>(f, [&](const double x) { return reference(static_cast<long double>(x)); });
+    }
+
+    template<typename S>
+    void run(const std::string& type)
+    {
+        sweep<S>(type, "sqrt", [](const auto& x) { return math::sqrt(x); }, [](const long double x) { return std::sqrt(x); });
+        sweep<S>(type, "rsqrt", [](const auto& x) { return math::rsqrt(x); }, [](const long double x) { return 1.0L / std::sqrt(x); });
+        if constexpr (std::floating_point<S>) sweep<S>(type, "rcp", [](const auto& x) { return math::rcp(x); }, [](const long double x) { return 1.0L / x; });
+
+        sweep<S>(type, "exp", [](const auto& x) { return math::exp(x); }, [](const long double x) { return std::exp(x); });
+        sweep<S>(type, "exp2", [](const auto& x) { return math::exp2(x); }, [](const long double x) { return std::exp2(x); });
+        sweep<S>(type, "log", [](const auto& x) { return math::log(x); }, [](const long double x) { return std::log(x); });
+        sweep<S>(type, "log2", [](const auto& x) { return math::log2(x); }, [](const long double x) { return std::log2(x); });
+        sweep<S>(type, "log10", [](const auto& x) { return math::log10(x); }, [](const long double x) { return std::log10(x); });
+        sweep<S>(type, "pow(x, 2.4)", [](const auto& x) { return math::pow(x, 2.4); }, [](const long double x) { return std::pow(x, static_cast<long double>(2.4)); });
+
+        sweep<S>(type, "sin", [](const auto& x) { return math::sin(x); }, [](const long double x) { return std::sin(x); });
+        sweep<S>(type, "cos", [](const auto& x) { return math::cos(x); }, [](const long double x) { return std::cos(x); });
+        sweep<S>(type, "tan", [](const auto& x) { return math::tan(x); }, [](const long double x) { return std::tan(x); });
+        sweep<S>(type, "asin", [](const auto& x) { return math::asin(x); }, [](const long double x) { return std::asin(x); });
+        sweep<S>(type, "acos", [](const auto& x) { return math::acos(x); }, [](const long double x) { return std::acos(x); });
+        sweep<S>(type, "atan", [](const auto& x) { return math::atan(x); }, [](const long double x) { return std::atan(x); });
+        sweep<S>(type, "sinh", [](const auto& x) { return math::sinh(x); }, [](const long double x) { return std::sinh(x); });
+        sweep<S>(type, "cosh", [](const auto& x) { return math::cosh(x); }, [](const long double x) { return std::cosh(x); });
+        sweep<S>(type, "tanh", [](const auto& x) { return math::tanh(x); }, [](const long double x) { return std::tanh(x); });
+    }
+}  // namespace
+
+void doubleAccuracy()
+{
+    run<double>("double");
+    run<math::vec2da>("vec2da");
+#ifdef __AVX__
+    run<math::vec4da>("vec4da");
+#endif
+}
@@ -0,0 +1,136 @@
+#include "math_accuracy/float_accuracy.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <bit>
+#include <cmath>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/include_all.h"
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math_accuracy/accuracy.h"
+
+namespace
+{
+    constexpr uint64_t chunk_size = 1 << 16;
+
+    /**
+     * @brief Compare f against reference over the float bit patterns 0, step, 2 * step, ...
+     */
+    template<typename S, typename F, typename R>
+    void sweep(const std::string& type, const std::string& function, F&& f, R&& reference)
+    {
+        const std::string name = type + " " + function;
+        if (!accuracy::enabled(name)) return;
+
+        const uint64_t step   = accuracy::settings().step;
+        const uint64_t total  = ((uint64_t(1) << 32) + step - 1) / step;
+        const uint64_t chunks = (total + chunk_size - 1) / chunk_size;
+
+        const auto s = accuracy::parallel(chunks, [&](const uint64_t chunk, accuracy::stats& stats) {
+            std::vector<float> in(chunk_size), out(chunk_size);
+            const uint64_t     first = chunk * chunk_size;
+            const size_t       n     = static_cast<size_t>(std::min(chunk_size, total - first));
+            for (size_t i = 0; i < chunk_size; i++) in[i] = std::bit_cast<float>(static_cast<uint32_t>(std::min(first + i, total - 1) * step));
+
+            accuracy::apply<S>(in.data(), out.data(), chunk_size, f);
+            for (size_t i = 0; i < n; i++) stats.check(in[i], out[i], static_cast<long double>(reference(static_cast<double>(in[i]))));
+        });
+
+        accuracy::report(name, s);
+        accuracy::special_values<S, float>(f, [&](const float x) { return reference(static_cast<double>(x)); });
+    }
+
+    /**
+     * @brief Compare normalize against a double precision reference over random vectors with lengths from 2^-30 to 2^30.
+     */
+    template<typename V>
+    void sweep_normalize(const std::string& type)
+    {
+        const std::string name = type + " normalize";
+        if (!accuracy::enabled(name)) return;
+
+        constexpr size_t n      = math::vec<float, V::size>::size;
+        const uint64_t   chunks = (accuracy::settings().samples + chunk_size - 1) / chunk_size;
+
+        const auto s = accuracy::parallel(chunks, [&](const uint64_t chunk, accuracy::stats& stats) {
+            for (uint64_t i = chunk * chunk_size; i < (chunk + 1) * chunk_size; i++)
+            {
+                const uint64_t    r     = accuracy::random(i);
+                const int         scale = static_cast<int>(r % 61) - 30;
+                math::vec<float, n> v;
+                for (size_t j = 0; j < n; j++)
+                {
+                    // Uniform in [-1, 1), scaled by 2^scale.
+                    const auto u = static_cast<int32_t>(accuracy::random(i * n + j + (uint64_t(1) << 40)) >> 40) - (1 << 23);
+                    v[j]         = std::ldexp(static_cast<float>(u) / float(1 << 23), scale);
+                }
+
+                double sqr_length = 0;
+                for (size_t j = 0; j < n; j++) sqr_length += static_cast<double>(v[j]) * v[j];
+                if (sqr_length == 0) continue;
+
+                const auto result = static_cast<math::vec<float, n>>(math::normalize(V(v)));
+                for (size_t j = 0; j < n; j++) stats.check(v[j], result[j], static_cast<long double>(v[j] / std::sqrt(sqr_length)));
+            }
+        });
+
+        accuracy::report(name, s);
+    }
+
+    template<typename S>
+    void run(const std::string& type)
+    {
+        sweep<S>(type, "sqrt", [](const auto& x) { return math::sqrt(x); }, [](const double x) { return std::sqrt(x); });
+        sweep<S>(type, "rsqrt", [](const auto& x) { return math::rsqrt(x); }, [](const double x) { return 1.0 / std::sqrt(x); });
+        if constexpr (std::floating_point<S>) sweep<S>(type, "rcp", [](const auto& x) { return math::rcp(x); }, [](const double x) { return 1.0 / x; });
+
+        sweep<S>(type, "exp", [](const auto& x) { return math::exp(x); }, [](const double x) { return std::exp(x); });
+        sweep<S>(type, "exp2", [](const auto& x) { return math::exp2(x); }, [](const double x) { return std::exp2(x); });
+        sweep<S>(type, "log", [](const auto& x) { return math::log(x); }, [](const double x) { return std::log(x); });
+        sweep<S>(type, "log2", [](const auto& x) { return math::log2(x); }, [](const double x) { return std::log2(x); });
+        sweep<S>(type, "log10", [](const auto& x) { return math::log10(x); }, [](const double x) { return std::log10(x); });
+        sweep<S>(type, "pow(x, 2.4)", [](const auto& x) { return math::pow(x, 2.4f); }, [](const double x) { return std::pow(x, static_cast<double>(2.4f)); });
+
+        sweep<S>(type, "sin", [](const auto& x) { return math::sin(x); }, [](const double x) { return std::sin(x); });
+        sweep<S>(type, "cos", [](const auto& x) { return math::cos(x); }, [](const double x) { return std::cos(x); });
+        sweep<S>(type, "tan", [](const auto& x) { return math::tan(x); }, [](const double x) { return std::tan(x); });
+        sweep<S>(type, "asin", [](const auto& x) { return math::asin(x); }, [](const double x) { return std::asin(x); });
+        sweep<S>(type, "acos", [](const auto& x) { return math::acos(x); }, [](const double x) { return std::acos(x); });
+        sweep<S>(type, "atan", [](const auto& x) { return math::atan(x); }, [](const double x) { return std::atan(x); });
+        sweep<S>(type, "sinh", [](const auto& x) { return math::sinh(x); }, [](const double x) { return std::sinh(x); });
+        sweep<S>(type, "cosh", [](const auto& x) { return math::cosh(x); }, [](const double x) { return std::cosh(x); });
+        sweep<S>(type, "tanh", [](const auto& x) { return math::tanh(x); }, [](const double x) { return std::tanh(x); });
+    }
+}  // namespace
+
+void floatAccuracy()
+{
+    run<float>("float");
+    run<math::vec4fa>("vec4fa");
+#ifdef __AVX__
+    run<math::vec8fa>("vec8fa");
+#endif
+#ifdef __AVX512F__
+    run<math::vec16fa>("vec16fa");
+#endif
+
+    sweep_normalize<math::float3>("float3");
+    sweep_normalize<math::float4>("float4");
+    sweep_normalize<math::vec3fa>("vec3fa");
+    sweep_normalize<math::vec4fa>("vec4fa");
+#ifdef __AVX__
+    sweep_normalize<math::vec8fa>("vec8fa");
+#endif
+}
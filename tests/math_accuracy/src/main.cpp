@@ -0,0 +1,45 @@
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math_accuracy/accuracy.h"
+#include "math_accuracy/double_accuracy.h"
+#include "math_accuracy/float_accuracy.h"
+
+int main(int argc, char** argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string_view arg = argv[i];
+        if (arg == "--filter" && i + 1 < argc)
+            accuracy::settings().filter = argv[++i];
+        else if (arg == "--step" && i + 1 < argc)
+            accuracy::settings().step = std::max<uint64_t>(1, std::strtoull(argv[++i], nullptr, 10));
+        else if (arg == "--samples" && i + 1 < argc)
+            accuracy::settings().samples = std::max<uint64_t>(1, std::strtoull(argv[++i], nullptr, 10));
+        else if (arg == "--threads" && i + 1 < argc)
+            accuracy::settings().threads = std::max(1u, static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10)));
+        else
+        {
+            std::fprintf(stderr, "usage: %s [--filter <substring>] [--step <n>] [--samples <n>] [--threads <n>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::printf("%u threads, float step %llu, %llu samples\n",
+                accuracy::settings().threads,
+                static_cast<unsigned long long>(accuracy::settings().step),
+                static_cast<unsigned long long>(accuracy::settings().samples));
+
+    floatAccuracy();
+    doubleAccuracy();
+    return 0;
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+/**
+ * @brief Union, center, clamp, containment, area and transform over arrays of AABBs.
+ */
+void aabbOps();
@@ -0,0 +1,394 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+#ifdef __linux__
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace bench
+{
+    ////////////////////////////////////////////////////////////////
+    // Settings and results.
+    ////////////////////////////////////////////////////////////////
+
+    struct options
+    {
+        /** @brief Only run benchmarks whose name contains this string. */
+        std::string filter;
+
+        /** @brief If not empty, write all results to this file as JSON. */
+        std::string json;
+
+        /** @brief Run the side-by-side comparison of generic and SIMD types instead of the regular benchmarks. */
+        bool compare = false;
+
+        /** @brief Read the hardware performance counters, if the system allows it. */
+        bool counters = true;
+    };
+
+    [[nodiscard]] inline options& settings() noexcept
+    {
+        static options o;
+        return o;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Hardware performance counters.
+    ////////////////////////////////////////////////////////////////
+
+    enum class counter : size_t
+    {
+        cycles,
+        instructions,
+        l1d_misses,
+        llc_misses,
+        branch_misses
+    };
+
+    inline constexpr size_t counter_count = 5;
+
+    inline constexpr std::array<const char*, counter_count> counter_names = {"cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses"};
+
+    /**
+     * @brief Counter values of one measurement. NaN for counters that could not be opened.
+     */
+    using counter_values = std::array<double, counter_count>;
+
+    [[nodiscard]] inline counter_values no_counters() noexcept
+    {
+        counter_values values;
+        values.fill(std::numeric_limits<double>::quiet_NaN());
+        return values;
+    }
+
+    /**
+     * @brief Set of perf_event_open counters for the calling thread, user space only. Each counter is opened separately, so
+     * that a counter the CPU or hypervisor does not support leaves the others working. In containers perf_event_open is
+     * usually denied entirely, in which case all values are NaN and only timings are reported. When there are more counters
+     * than hardware registers the kernel multiplexes them, and the values are scaled up by the fraction of the time they ran.
+     */
+    class counters
+    {
+    public:
+        counters()
+        {
+#ifdef __linux__
+            const std::array<std::pair<uint32_t, uint64_t>, counter_count> events = {{
+              {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+              {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+              {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+              {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+              {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+            }};
+
+            for (size_t i = 0; i < counter_count; i++)
+            {
+                perf_event_attr attr{};
+                attr.type           = events[i].first;
+                attr.size           = sizeof(perf_event_attr);
+                attr.config         = events[i].second;
+                attr.disabled       = 1;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv     = 1;
+                attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+                fds[i]              = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+                if (fds[i] < 0 && error.empty()) error = std::strerror(errno);
+            }
+#else
+            error = "not supported on this platform";
+#endif
+        }
+
+        counters(const counters&) = delete;
+
+        counters& operator=(const counters&) = delete;
+
+        ~counters()
+        {
+#ifdef __linux__
+            for (const int fd : fds)
+                if (fd >= 0) close(fd);
+#endif
+        }
+
+        [[nodiscard]] bool any() const noexcept { return std::ranges::any_of(fds, [](const int fd) { return fd >= 0; }); }
+
+        /**
+         * @brief Reason the first counter that could not be opened failed, empty if all were opened.
+         */
+        [[nodiscard]] const std::string& failure() const noexcept { return error; }
+
+        void start() noexcept
+        {
+#ifdef __linux__
+            for (const int fd : fds)
+            {
+                if (fd < 0) continue;
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+#endif
+        }
+
+        [[nodiscard]] counter_values stop() noexcept
+        {
+            auto values = no_counters();
+#ifdef __linux__
+            for (size_t i = 0; i < counter_count; i++)
+            {
+                if (fds[i] < 0) continue;
+                ioctl(fds[i], PERF_EVENT_IOC_DISABLE, 0);
+
+                // Value, time enabled and time running. A counter that never ran has no value.
+                uint64_t data[3] = {};
+                if (read(fds[i], data, sizeof(data)) != sizeof(data) || data[2] == 0) continue;
+                values[i] = static_cast<double>(data[0]);
+                if (data[2] < data[1]) values[i] *= static_cast<double>(data[1]) / static_cast<double>(data[2]);
+            }
+#endif
+            return values;
+        }
+
+    private:
+        std::array<int, counter_count> fds = {-1, -1, -1, -1, -1};
+
+        std::string error;
+    };
+
+    /**
+     * @brief Counters shared by all benchmarks. Opened on first use, and only if settings().counters is set.
+     */
+    [[nodiscard]] inline counters* perf()
+    {
+        static counters* c = [] () -> counters* {
+            if (!settings().counters) return nullptr;
+            static counters instance;
+            if (!instance.failure().empty())
+                std::printf("hardware counters %s: %s\n", instance.any() ? "partially unavailable" : "unavailable, reporting timings only", instance.failure().c_str());
+            return instance.any() ? &instance : nullptr;
+        }();
+        return c;
+    }
+
+    /**
+     * @brief Counter values of the fastest run of the last call to measure.
+     */
+    [[nodiscard]] inline counter_values& last_counters() noexcept
+    {
+        static counter_values values = no_counters();
+        return values;
+    }
+
+    struct result
+    {
+        std::string name;
+
+        /** @brief Fastest run in nanoseconds. */
+        double ns = 0;
+
+        /** @brief Number of operations per run, e.g. the number of elements processed. */
+        size_t ops = 0;
+
+        /** @brief Number of bytes read and written per run. Zero if not meaningful. */
+        size_t bytes = 0;
+
+        /** @brief Hardware counters of the fastest run, NaN if unavailable. */
+        counter_values counters = no_counters();
+    };
+
+    [[nodiscard]] inline std::vector<result>& results() noexcept
+    {
+        static std::vector<result> r;
+        return r;
+    }
+
+    [[nodiscard]] inline bool enabled(const std::string_view name) noexcept
+    {
+        return settings().filter.empty() || name.find(settings().filter) != std::string_view::npos;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Timing.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Prevent the compiler from optimizing away a value or the stores that produced it.
+     */
+    template<typename T>
+    void do_not_optimize(const T& value) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "g"(&value) : "memory");
+#else
+        static_cast<void>(*reinterpret_cast<const volatile char*>(&value));
+#endif
+    }
+
+    /**
+     * @brief Run f a number of times and return the fastest run in nanoseconds. The hardware counters of that run are
+     * stored in last_counters().
+     */
+    template<typename F>
+    [[nodiscard]] double measure(F&& f, const size_t runs = 15)
+    {
+        counters* c    = perf();
+        double    best = std::numeric_limits<double>::max();
+        for (size_t i = 0; i < runs; i++)
+        {
+            if (c) c->start();
+            const auto start = std::chrono::steady_clock::now();
+            f();
+            const auto end = std::chrono::steady_clock::now();
+            const auto values = c ? c->stop() : no_counters();
+
+            const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+            if (ns < best)
+            {
+                best            = ns;
+                last_counters() = values;
+            }
+        }
+        return best;
+    }
+
+    /**
+     * @brief Time stamp counter ticks per nanosecond, calibrated once against steady_clock. The counter runs at the nominal
+     * frequency of the CPU, so ops/cycle derived from it is an estimate when the core clocks up or down. It is only used when
+     * the cycles counter is unavailable.
+     */
+    [[nodiscard]] inline double ticks_per_ns()
+    {
+        static const double ticks = [] {
+            const auto     start = std::chrono::steady_clock::now();
+            const uint64_t t0    = __rdtsc();
+            while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(20)) {}
+            const uint64_t t1  = __rdtsc();
+            const auto     end = std::chrono::steady_clock::now();
+            return static_cast<double>(t1 - t0) / std::chrono::duration<double, std::nano>(end - start).count();
+        }();
+        return ticks;
+    }
+
+    /**
+     * @brief Operations per core cycle, from the cycles counter if it is available and from the time stamp counter otherwise.
+     */
+    [[nodiscard]] inline double ops_per_cycle(const size_t ops, const double ns, const counter_values& c)
+    {
+        const double cycles = c[static_cast<size_t>(counter::cycles)];
+        return static_cast<double>(ops) / (std::isnan(cycles) ? ns * ticks_per_ns() : cycles);
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Reporting.
+    ////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Print and record a measurement. The hardware counters are taken from last_counters() and printed per operation.
+     */
+    inline void report(const std::string_view name, const double ns, const size_t ops, const size_t bytes = 0)
+    {
+        if (!enabled(name)) return;
+
+        const auto& c = last_counters();
+        std::printf("%-56.*s %10.3f ns/op %8.3f ops/cycle", static_cast<int>(name.size()), name.data(), ns / static_cast<double>(ops), ops_per_cycle(ops, ns, c));
+        if (bytes) std::printf(" %8.2f GB/s", static_cast<double>(bytes) / ns);
+
+        const auto  per_op = [&](const counter i) { return c[static_cast<size_t>(i)] / static_cast<double>(ops); };
+        if (!std::isnan(c[static_cast<size_t>(counter::cycles)]))
+            std::printf(" %8.2f cyc", per_op(counter::cycles));
+        if (!std::isnan(c[static_cast<size_t>(counter::instructions)]))
+        {
+            std::printf(" %8.2f ins", per_op(counter::instructions));
+            if (!std::isnan(c[static_cast<size_t>(counter::cycles)]))
+                std::printf(" %5.2f IPC", c[static_cast<size_t>(counter::instructions)] / c[static_cast<size_t>(counter::cycles)]);
+        }
+        if (!std::isnan(c[static_cast<size_t>(counter::l1d_misses)])) std::printf(" %7.3f L1D miss", per_op(counter::l1d_misses));
+        if (!std::isnan(c[static_cast<size_t>(counter::llc_misses)])) std::printf(" %7.3f LLC miss", per_op(counter::llc_misses));
+        if (!std::isnan(c[static_cast<size_t>(counter::branch_misses)])) std::printf(" %7.3f br miss", per_op(counter::branch_misses));
+        std::printf("\n");
+
+        results().push_back(result{std::string(name), ns, ops, bytes, c});
+    }
+
+    /**
+     * @brief Measure and report f, if name passes the filter. f performs ops operations, reading and writing bytes bytes.
+     */
+    template<typename F>
+    void run(const std::string& name, const size_t ops, const size_t bytes, F&& f)
+    {
+        if (!enabled(name)) return;
+        report(name, measure(f), ops, bytes);
+    }
+
+    /**
+     * @brief Write all reported results to the JSON file in settings(). Returns false if the file could not be written.
+     */
+    [[nodiscard]] inline bool write_json()
+    {
+        if (settings().json.empty()) return true;
+
+        FILE* file = std::fopen(settings().json.c_str(), "w");
+        if (!file) return false;
+
+        std::fprintf(file, "{\n  \"ticks_per_ns\": %.6f,\n  \"results\": [", ticks_per_ns());
+        for (size_t i = 0; i < results().size(); i++)
+        {
+            const auto& r = results()[i];
+            std::string name;
+            for (const char c : r.name)
+            {
+                if (c == '"' || c == '\\') name += '\\';
+                name += c;
+            }
+
+            std::fprintf(file,
+                         "%s\n    {\"name\": \"%s\", \"ns\": %.3f, \"ops\": %zu, \"bytes\": %zu, \"ns_per_op\": %.6f, \"ops_per_cycle\": %.6f, \"gb_per_s\": %.6f",
+                         i ? "," : "",
+                         name.c_str(),
+                         r.ns,
+                         r.ops,
+                         r.bytes,
+                         r.ns / static_cast<double>(r.ops),
+                         ops_per_cycle(r.ops, r.ns, r.counters),
+                         static_cast<double>(r.bytes) / r.ns);
+
+            // Counters per operation, null if unavailable.
+            for (size_t j = 0; j < counter_count; j++)
+            {
+                if (std::isnan(r.counters[j]))
+                    std::fprintf(file, ", \"%s\": null", counter_names[j]);
+                else
+                    std::fprintf(file, ", \"%s\": %.6f", counter_names[j], r.counters[j] / static_cast<double>(r.ops));
+            }
+            std::fprintf(file, "}");
+        }
+        std::fprintf(file, "\n  ]\n}\n");
+
+        return std::fclose(file) == 0;
+    }
+}
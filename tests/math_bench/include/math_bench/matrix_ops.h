@@ -0,0 +1,6 @@
+#pragma once
+
+/**
+ * @brief Multiply, transpose, invert and transform over arrays of the generic and SIMD matrix types.
+ */
+void matrixOps();
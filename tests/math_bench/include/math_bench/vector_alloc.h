@@ -0,0 +1,6 @@
+#pragma once
+
+/**
+ * @brief Allocate and fill a large std::vector<float3>, with and without value-initialization of its elements.
+ */
+void vectorAlloc();
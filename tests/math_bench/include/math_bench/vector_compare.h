@@ -0,0 +1,7 @@
+#pragma once
+
+/**
+ * @brief Run the same operations on each generic vector type and the SIMD type of equal width, also converting from and
+ * to the generic type per element, and print the timings side by side.
+ */
+void vectorCompare();
@@ -0,0 +1,6 @@
+#pragma once
+
+/**
+ * @brief Resize and copy std::vector<float3> and compare against a copy of float3 that is not trivially copyable.
+ */
+void vectorCopy();
@@ -0,0 +1,6 @@
+#pragma once
+
+/**
+ * @brief Compare eager and lazy evaluation of a * b + c * d - e on vec<double, N> for N = 16..64.
+ */
+void vectorExpression();
@@ -0,0 +1,7 @@
+#pragma once
+
+/**
+ * @brief Arithmetic, min/max, dot, length, normalize and cross over arrays of the generic and SIMD vector types, and the
+ * batched span functions on float3.
+ */
+void vectorOps();
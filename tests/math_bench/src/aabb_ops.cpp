@@ -0,0 +1,90 @@
+#include "math_bench/aabb_ops.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/include_all.h"
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math_bench/bench.h"
+
+namespace
+{
+    constexpr size_t count = 4096;
+
+    template<typename V>
+    void run(const std::string& type)
+    {
+        using T = typename V::element_type;
+        using A = math::AABB<V>;
+
+        std::vector<A> a(count), b(count), out(count);
+        std::vector<V> points(count), vout(count);
+        std::vector<T> scalars(count);
+        std::vector<char> flags(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            for (size_t j = 0; j < V::size; j++)
+            {
+                a[i].lower[j]  = static_cast<T>((i + j) % 7);
+                a[i].upper[j]  = a[i].lower[j] + static_cast<T>(1 + j);
+                b[i].lower[j]  = static_cast<T>((i * 3 + j) % 5);
+                b[i].upper[j]  = b[i].lower[j] + static_cast<T>(2 + j);
+                points[i][j] = static_cast<T>((i + 2 * j) % 9);
+            }
+        }
+
+        bench::run(type + " union", count, count * 3 * sizeof(A), [&] {
+            for (size_t i = 0; i < count; i++) out[i] = a[i] + b[i];
+            bench::do_not_optimize(out.data());
+        });
+
+        bench::run(type + " clamp", count, count * 3 * sizeof(A), [&] {
+            for (size_t i = 0; i < count; i++) out[i] = math::clamp(a[i], b[i]);
+            bench::do_not_optimize(out.data());
+        });
+
+        bench::run(type + " center", count, count * (sizeof(A) + sizeof(V)), [&] {
+            for (size_t i = 0; i < count; i++) vout[i] = math::center(a[i]);
+            bench::do_not_optimize(vout.data());
+        });
+
+        bench::run(type + " area", count, count * (sizeof(A) + sizeof(T)), [&] {
+            for (size_t i = 0; i < count; i++) scalars[i] = math::area(a[i]);
+            bench::do_not_optimize(scalars.data());
+        });
+
+        bench::run(type + " inside point", count, count * (sizeof(A) + sizeof(V) + 1), [&] {
+            for (size_t i = 0; i < count; i++) flags[i] = math::inside(points[i], a[i]);
+            bench::do_not_optimize(flags.data());
+        });
+
+        bench::run(type + " inside aabb", count, count * (2 * sizeof(A) + 1), [&] {
+            for (size_t i = 0; i < count; i++) flags[i] = math::inside(a[i], b[i]);
+            bench::do_not_optimize(flags.data());
+        });
+
+        const auto m = math::translation(math::vec<T, 3>(1, 2, 3)) * math::rotation_y(T(0.5));
+        bench::run(type + " transform", count, count * 2 * sizeof(A), [&] {
+            for (size_t i = 0; i < count; i++) out[i] = a[i] * m;
+            bench::do_not_optimize(out.data());
+        });
+    }
+}  // namespace
+
+void aabbOps()
+{
+    run<math::float3>("aabb float3");
+    run<math::double3>("aabb double3");
+}
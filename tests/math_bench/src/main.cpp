@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <string_view>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math_bench/aabb_ops.h"
+#include "math_bench/bench.h"
+#include "math_bench/matrix_ops.h"
+#include "math_bench/vector_alloc.h"
+#include "math_bench/vector_compare.h"
+#include "math_bench/vector_copy.h"
+#include "math_bench/vector_expression.h"
+#include "math_bench/vector_ops.h"
+
+int main(int argc, char** argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string_view arg = argv[i];
+        if (arg == "--filter" && i + 1 < argc)
+            bench::settings().filter = argv[++i];
+        else if (arg == "--json" && i + 1 < argc)
+            bench::settings().json = argv[++i];
+        else if (arg == "--compare")
+            bench::settings().compare = true;
+        else if (arg == "--no-counters")
+            bench::settings().counters = false;
+        else
+        {
+            std::fprintf(stderr, "usage: %s [--filter <substring>] [--json <path>] [--compare] [--no-counters]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (bench::settings().compare)
+        vectorCompare();
+    else
+    {
+        vectorAlloc();
+        vectorCopy();
+        vectorExpression();
+        vectorOps();
+        matrixOps();
+        aabbOps();
+    }
+
+    if (!bench::write_json())
+    {
+        std::fprintf(stderr, "failed to write %s\n", bench::settings().json.c_str());
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,164 @@
+#include "math_bench/matrix_ops.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/include_all.h"
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math_bench/bench.h"
+
+namespace
+{
+    // Three arrays of 1024 matrices of at most 128 bytes stay in L2.
+    constexpr size_t count = 1024;
+
+    /**
+     * @brief Diagonally dominant, so that every matrix is invertible.
+     */
+    template<typename M>
+    [[nodiscard]] M make(const size_t i)
+    {
+        M m(typename M::element_type(0));
+        for (size_t r = 0; r < M::column_type::size; r++)
+            for (size_t c = 0; c < M::row_type::size; c++)
+                m[r][c] = static_cast<typename M::element_type>((r == c ? 8 : 0) + (i + r * 3 + c) % 5);
+        return m;
+    }
+
+    template<typename M>
+    [[nodiscard]] std::vector<M> make_array(const size_t offset)
+    {
+        std::vector<M> ms;
+        ms.reserve(count);
+        for (size_t i = 0; i < count; i++) ms.push_back(make<M>(i + offset));
+        return ms;
+    }
+
+    /**
+     * @brief Run f(a[i], b[i]) over all matrices and store the results.
+     */
+    template<typename M, typename R, typename F>
+    void binary(const std::string& name, const std::vector<M>& a, const std::vector<M>& b, std::vector<R>& out, F&& f)
+    {
+        bench::run(name, count, count * (2 * sizeof(M) + sizeof(R)), [&] {
+            for (size_t i = 0; i < count; i++) out[i] = f(a[i], b[i]);
+            bench::do_not_optimize(out.data());
+        });
+    }
+
+    template<typename M, typename R, typename F>
+    void unary(const std::string& name, const std::vector<M>& a, std::vector<R>& out, F&& f)
+    {
+        bench::run(name, count, count * (sizeof(M) + sizeof(R)), [&] {
+            for (size_t i = 0; i < count; i++) out[i] = f(a[i]);
+            bench::do_not_optimize(out.data());
+        });
+    }
+
+    template<typename M, typename V>
+    void transform(const std::string& name, const std::vector<M>& a, const std::vector<V>& v, std::vector<V>& out)
+    {
+        bench::run(name, count, count * (sizeof(M) + 2 * sizeof(V)), [&] {
+            for (size_t i = 0; i < count; i++) out[i] = a[i] * v[i];
+            bench::do_not_optimize(out.data());
+        });
+    }
+
+    template<typename V>
+    [[nodiscard]] std::vector<V> make_vectors()
+    {
+        std::vector<V> vs(count);
+        for (size_t i = 0; i < count; i++)
+            for (size_t j = 0; j < V::size; j++) vs[i][j] = static_cast<typename V::element_type>(1 + (i + j) % 7);
+        return vs;
+    }
+
+    void generic()
+    {
+        {
+            using M      = math::matrix<float, 3, 3>;
+            const auto a = make_array<M>(0), b = make_array<M>(1);
+            std::vector<M> out(count, M(0.0f));
+            binary("float3x3 mul", a, b, out, [](const M& l, const M& r) { return l * r; });
+            unary("float3x3 transpose", a, out, [](const M& l) { return math::transpose(l); });
+        }
+
+        {
+            using M      = math::matrix<double, 4, 4>;
+            const auto a = make_array<M>(0), b = make_array<M>(1);
+            std::vector<M> out(count, M(0.0));
+            binary("double4x4 mul", a, b, out, [](const M& l, const M& r) { return l * r; });
+            unary("double4x4 transpose", a, out, [](const M& l) { return math::transpose(l); });
+        }
+
+        {
+            using M      = math::matrix<float, 4, 4>;
+            const auto a = make_array<M>(0), b = make_array<M>(1);
+            const auto v = make_vectors<math::float4>();
+            std::vector<M>            out(count, M(0.0f));
+            std::vector<math::float4> vout(count);
+            binary("float4x4 mul", a, b, out, [](const M& l, const M& r) { return l * r; });
+            unary("float4x4 transpose", a, out, [](const M& l) { return math::transpose(l); });
+            unary("float4x4 invert", a, out, [](const M& l) { return math::invert(l); });
+            transform("float4x4 mul float4", a, v, vout);
+        }
+
+        {
+            using M      = math::matrix<float, 3, 4>;
+            const auto a = make_array<M>(0), b = make_array<M>(1);
+            const auto v = make_vectors<math::float3>();
+            std::vector<M>            out(count, M(0.0f));
+            std::vector<math::float3> vout(count);
+            binary("float3x4 mul", a, b, out, [](const M& l, const M& r) { return l * r; });
+            unary("float3x4 invert", a, out, [](const M& l) { return math::invert(l); });
+            transform("float3x4 transform_point", a, v, vout);
+        }
+    }
+
+    void simd()
+    {
+        {
+            using M = math::mat4x4fa;
+            std::vector<M> a, b;
+            for (const auto& m : make_array<math::matrix<float, 4, 4>>(0)) a.emplace_back(m);
+            for (const auto& m : make_array<math::matrix<float, 4, 4>>(1)) b.emplace_back(m);
+            const auto     v = make_vectors<math::vec4fa>();
+            std::vector<M> out(a);
+            std::vector<math::vec4fa> vout(count);
+            binary("mat4x4fa mul", a, b, out, [](const M& l, const M& r) { return l * r; });
+            unary("mat4x4fa transpose", a, out, [](const M& l) { return math::transpose(l); });
+            transform("mat4x4fa mul vec4fa", a, v, vout);
+        }
+
+        {
+            using M = math::mat3x4fa;
+            std::vector<M> a, b;
+            for (const auto& m : make_array<math::matrix<float, 3, 4>>(0)) a.emplace_back(m);
+            for (const auto& m : make_array<math::matrix<float, 3, 4>>(1)) b.emplace_back(m);
+            const auto     v = make_vectors<math::vec3fa>();
+            std::vector<M> out(a);
+            std::vector<math::vec3fa> vout(count);
+            binary("mat3x4fa mul", a, b, out, [](const M& l, const M& r) { return l * r; });
+            unary("mat3x4fa invert", a, out, [](const M& l) { return math::invert(l); });
+            transform("mat3x4fa transform_point", a, v, vout);
+        }
+    }
+}  // namespace
+
+void matrixOps()
+{
+    generic();
+    simd();
+}
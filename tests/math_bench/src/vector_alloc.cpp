@@ -0,0 +1,43 @@
+#include "math_bench/vector_alloc.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/include_all.h"
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math_bench/bench.h"
+
+namespace
+{
+    template<typename A>
+    void run(const std::string& name, const size_t count)
+    {
+        const double ns = bench::measure(
+          [&] {
+              std::vector<math::float3, A> dst(count);
+              for (size_t i = 0; i < count; i++) dst[i] = math::float3(static_cast<float>(i));
+              bench::do_not_optimize(dst.data());
+          },
+          5);
+        bench::report(name, ns, count);
+    }
+}  // namespace
+
+void vectorAlloc()
+{
+    constexpr size_t count = 16 * 1024 * 1024;
+    run<std::allocator<math::float3>>("float3 allocate + fill", count);
+    run<math::default_init_allocator<math::float3>>("float3 allocate uninit + fill", count);
+}
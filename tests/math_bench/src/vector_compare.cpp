@@ -0,0 +1,139 @@
+#include "math_bench/vector_compare.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/include_all.h"
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math_bench/bench.h"
+
+namespace
+{
+    // Large enough to spill out of L2, so that the SIMD types also pay for their larger footprint (e.g. vec3fa is 16 bytes).
+    constexpr size_t count = 1 << 16;
+
+    /**
+     * @brief Time f over two arrays of In, storing the results in out.
+     */
+    template<typename In, typename Out, typename F>
+    [[nodiscard]] double time(const std::vector<In>& a, const std::vector<In>& b, std::vector<Out>& out, F&& f)
+    {
+        return bench::measure([&] {
+            for (size_t i = 0; i < count; i++) out[i] = f(a[i], b[i]);
+            bench::do_not_optimize(out.data());
+        });
+    }
+
+    template<typename G, typename S>
+    class comparison
+    {
+    public:
+        using T = typename G::element_type;
+
+        explicit comparison(std::string type) : type(std::move(type)), ga(count), gb(count), sa(count), sb(count)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                for (size_t j = 0; j < G::size; j++)
+                {
+                    ga[i][j] = static_cast<T>(1 + (i + j) % 7);
+                    gb[i][j] = static_cast<T>(2 + (i * 3 + j) % 5);
+                }
+                sa[i] = S(ga[i]);
+                sb[i] = S(gb[i]);
+            }
+        }
+
+        /**
+         * @brief Time f on the generic type, on the SIMD type and on the generic type with a conversion to the SIMD type
+         * and back around each call. f takes two vectors and returns a vector or a scalar.
+         */
+        template<typename F>
+        void run(const std::string& op, F&& f)
+        {
+            const std::string name = type + " " + op;
+            if (!bench::enabled(name)) return;
+
+            using GR = decltype(f(ga[0], gb[0]));
+            using SR = decltype(f(sa[0], sb[0]));
+            constexpr bool scalar = std::is_arithmetic_v<SR>;
+
+            std::vector<GR> gout(count);
+            std::vector<SR> sout(count, SR(0));
+            const double    generic          = time(ga, gb, gout, f);
+            const auto      generic_counters = bench::last_counters();
+            const double    simd             = time(sa, sb, sout, f);
+            const auto      simd_counters    = bench::last_counters();
+            const double    convert          = time(ga, gb, gout, [&](const G& l, const G& r) {
+                if constexpr (scalar)
+                    return f(S(l), S(r));
+                else
+                    return static_cast<G>(f(S(l), S(r)));
+            });
+            const auto      convert_counters = bench::last_counters();
+
+            std::printf("%-28s %12.3f %12.3f %12.3f %10.2fx %10.2fx\n",
+                        name.c_str(),
+                        generic / count,
+                        simd / count,
+                        convert / count,
+                        generic / simd,
+                        generic / convert);
+
+            const size_t out_size = scalar ? sizeof(T) : sizeof(G);
+            bench::results().push_back(bench::result{name + " generic", generic, count, count * (2 * sizeof(G) + out_size), generic_counters});
+            bench::results().push_back(bench::result{name + " simd", simd, count, count * (2 * sizeof(S) + (scalar ? sizeof(T) : sizeof(S))), simd_counters});
+            bench::results().push_back(bench::result{name + " convert", convert, count, count * (2 * sizeof(G) + out_size), convert_counters});
+        }
+
+    private:
+        std::string    type;
+        std::vector<G> ga, gb;
+        std::vector<S> sa, sb;
+    };
+
+    template<typename G, typename S>
+    void compare(const std::string& type)
+    {
+        using T = typename G::element_type;
+        comparison<G, S> c(type);
+
+        c.run("normalize", [](const auto& l, const auto&) { return math::normalize(l); });
+        c.run("dot", [](const auto& l, const auto& r) { return math::dot(l, r); });
+        c.run("reduce_add", [](const auto& l, const auto&) { return math::reduce_add(l); });
+        if constexpr (G::size == 3) c.run("cross", [](const auto& l, const auto& r) { return math::cross(l, r); });
+        c.run("min", [](const auto& l, const auto& r) { return math::min(l, r); });
+        c.run("max", [](const auto& l, const auto& r) { return math::max(l, r); });
+        c.run("clamp", [](const auto& l, const auto& r) { return math::clamp(l, r, T(4)); });
+        c.run("lerp", [](const auto& l, const auto& r) { return math::lerp(l, r, T(0.25)); });
+    }
+}  // namespace
+
+void vectorCompare()
+{
+    std::printf("%-28s %12s %12s %12s %11s %11s\n", "ns/op", "generic", "simd", "convert", "simd gain", "conv gain");
+
+    compare<math::float3, math::vec3fa>("float3 / vec3fa");
+    compare<math::float4, math::vec4fa>("float4 / vec4fa");
+    compare<math::double2, math::vec2da>("double2 / vec2da");
+#ifdef __AVX__
+    compare<math::vec<float, 8>, math::vec8fa>("float8 / vec8fa");
+    compare<math::double3, math::vec3da>("double3 / vec3da");
+    compare<math::double4, math::vec4da>("double4 / vec4da");
+#endif
+}
@@ -0,0 +1,84 @@
+#include "math_bench/vector_copy.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/include_all.h"
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math_bench/bench.h"
+
+namespace
+{
+    /**
+     * @brief float3 with user-provided copy and move operations, as vec<T, 3> had before it became trivially copyable.
+     */
+    struct legacy_float3 : math::float3
+    {
+        legacy_float3() noexcept = default;
+
+        legacy_float3(const legacy_float3& rhs) noexcept : math::float3(rhs.x, rhs.y, rhs.z) {}
+
+        legacy_float3(legacy_float3&& rhs) noexcept : math::float3(rhs.x, rhs.y, rhs.z) {}
+
+        legacy_float3& operator=(const legacy_float3& rhs) noexcept { x = rhs.x; y = rhs.y; z = rhs.z; return *this; }
+
+        legacy_float3& operator=(legacy_float3&& rhs) noexcept { x = rhs.x; y = rhs.y; z = rhs.z; return *this; }
+    };
+
+    static_assert(!std::is_trivially_copyable_v<legacy_float3>);
+
+    template<typename T>
+    void run(const std::string& name, const size_t count)
+    {
+        const std::vector<T> src(count);
+
+        const double copy = bench::measure([&] {
+            std::vector<T> dst(src);
+            bench::do_not_optimize(dst.data());
+        });
+        bench::report(name + " copy", copy, count);
+
+        const double assign = bench::measure([&] {
+            static std::vector<T> dst(count);
+            dst = src;
+            bench::do_not_optimize(dst.data());
+        });
+        bench::report(name + " assign", assign, count);
+
+        // Growing by push_back relocates all elements on every reallocation.
+        const double grow = bench::measure([&] {
+            std::vector<T> dst;
+            for (size_t i = 0; i < count; i++) dst.push_back(src[i]);
+            bench::do_not_optimize(dst.data());
+        });
+        bench::report(name + " push_back", grow, count);
+
+        const double resize = bench::measure([&] {
+            std::vector<T> dst(src);
+            dst.resize(count * 2);
+            bench::do_not_optimize(dst.data());
+        });
+        bench::report(name + " resize", resize, count);
+    }
+}  // namespace
+
+void vectorCopy()
+{
+    for (const size_t count : {1024u, 1024u * 1024u})
+    {
+        run<math::float3>("float3 [" + std::to_string(count) + "]", count);
+        run<legacy_float3>("legacy_float3 [" + std::to_string(count) + "]", count);
+    }
+}
@@ -0,0 +1,52 @@
+#include "math_bench/vector_expression.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/include_all.h"
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math_bench/bench.h"
+
+namespace
+{
+    template<size_t N>
+    void run()
+    {
+        // Keep the working set in cache, so that the time is dominated by the arithmetic.
+        constexpr size_t count = 4096 / N;
+        using V                = math::vec<double, N>;
+        std::vector<V> a(count, V(1.5)), b(count, V(-2.0)), c(count, V(0.25)), d(count, V(3.0)), e(count, V(0.5)), out(count);
+
+        const double eager = bench::measure([&] {
+            for (size_t i = 0; i < count; i++) out[i] = a[i] * b[i] + c[i] * d[i] - e[i];
+            bench::do_not_optimize(out.data());
+        });
+        bench::report("eager a * b + c * d - e [N = " + std::to_string(N) + "]", eager, count);
+
+        const double lazy = bench::measure([&] {
+            for (size_t i = 0; i < count; i++) out[i] = math::lazy(a[i]) * b[i] + math::lazy(c[i]) * d[i] - e[i];
+            bench::do_not_optimize(out.data());
+        });
+        bench::report("lazy  a * b + c * d - e [N = " + std::to_string(N) + "]", lazy, count);
+    }
+}  // namespace
+
+void vectorExpression()
+{
+    run<16>();
+    run<32>();
+    run<48>();
+    run<64>();
+}
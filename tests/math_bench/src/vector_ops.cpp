@@ -0,0 +1,266 @@
+#include "math_bench/vector_ops.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <concepts>
+#include <span>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "math/include_all.h"
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "math_bench/bench.h"
+
+namespace
+{
+    // Three arrays of 4096 vectors of at most 32 bytes stay in L2, so that the time is dominated by the arithmetic.
+    constexpr size_t count = 4096;
+
+    template<typename V>
+    void run(const std::string& type)
+    {
+        using T = typename V::element_type;
+
+        std::vector<V> a(count), b(count), out(count);
+        std::vector<T> scalars(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            for (size_t j = 0; j < V::size; j++)
+            {
+                a[i][j] = static_cast<T>(1 + (i + j) % 7);
+                b[i][j] = static_cast<T>(2 + (i * 3 + j) % 5);
+            }
+        }
+
+        // Reads two vectors and writes one.
+        const size_t binary = count * 3 * sizeof(V);
+        // Reads one or two vectors and writes one scalar.
+        const size_t unary_scalar  = count * (sizeof(V) + sizeof(T));
+        const size_t binary_scalar = count * (2 * sizeof(V) + sizeof(T));
+
+        const auto binary_op = [&](const std::string& name, auto&& f) {
+            bench::run(type + " " + name, count, binary, [&] {
+                for (size_t i = 0; i < count; i++) out[i] = f(a[i], b[i]);
+                bench::do_not_optimize(out.data());
+            });
+        };
+
+        binary_op("add", [](const V& l, const V& r) { return l + r; });
+        binary_op("sub", [](const V& l, const V& r) { return l - r; });
+        binary_op("mul", [](const V& l, const V& r) { return l * r; });
+        binary_op("min", [](const V& l, const V& r) { return math::min(l, r); });
+        binary_op("max", [](const V& l, const V& r) { return math::max(l, r); });
+
+        bench::run(type + " dot", count, binary_scalar, [&] {
+            for (size_t i = 0; i < count; i++) scalars[i] = math::dot(a[i], b[i]);
+            bench::do_not_optimize(scalars.data());
+        });
+
+        if constexpr (std::floating_point<T>)
+        {
+            binary_op("div", [](const V& l, const V& r) { return l / r; });
+            binary_op("madd", [](const V& l, const V& r) { return math::madd(l, r, l); });
+            binary_op("lerp", [](const V& l, const V& r) { return math::lerp(l, r, T(0.25)); });
+
+            bench::run(type + " length", count, unary_scalar, [&] {
+                for (size_t i = 0; i < count; i++) scalars[i] = math::length(a[i]);
+                bench::do_not_optimize(scalars.data());
+            });
+
+            bench::run(type + " normalize", count, 2 * count * sizeof(V), [&] {
+                for (size_t i = 0; i < count; i++) out[i] = math::normalize(a[i]);
+                bench::do_not_optimize(out.data());
+            });
+
+            if constexpr (V::size == 3) binary_op("cross", [](const V& l, const V& r) { return math::cross(l, r); });
+        }
+    }
+
+    /**
+     * @brief The span functions in vec3_batch.h, half_batch.h and pack_batch.h, to compare against the per-vector loops over float3.
+     */
+    void batched()
+    {
+        std::vector<math::float3> a(count), b(count), out(count);
+        std::vector<float>        scalars(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            a[i] = math::float3(static_cast<float>(1 + i % 7), static_cast<float>(2 + i % 5), static_cast<float>(3 + i % 3));
+            b[i] = math::float3(static_cast<float>(2 + i % 5), static_cast<float>(1 + i % 3), static_cast<float>(4 + i % 7));
+        }
+
+        bench::run("float3 normalize_all", count, 2 * count * sizeof(math::float3), [&] {
+            math::normalize_all(a, out);
+            bench::do_not_optimize(out.data());
+        });
+
+        bench::run("float3 length_all", count, count * (sizeof(math::float3) + sizeof(float)), [&] {
+            math::length_all(a, scalars);
+            bench::do_not_optimize(scalars.data());
+        });
+
+        bench::run("float3 dot_all", count, count * (2 * sizeof(math::float3) + sizeof(float)), [&] {
+            math::dot_all(a, b, scalars);
+            bench::do_not_optimize(scalars.data());
+        });
+
+        bench::run("float3 distance_all", count, count * (2 * sizeof(math::float3) + sizeof(float)), [&] {
+            math::distance_all(a, b, scalars);
+            bench::do_not_optimize(scalars.data());
+        });
+
+        std::vector<math::half3> halfs(count);
+        bench::run("float3 to half3", count, count * (sizeof(math::float3) + sizeof(math::half3)), [&] {
+            math::convert(a, halfs);
+            bench::do_not_optimize(halfs.data());
+        });
+
+        bench::run("half3 to float3", count, count * (sizeof(math::float3) + sizeof(math::half3)), [&] {
+            math::convert(halfs, out);
+            bench::do_not_optimize(out.data());
+        });
+
+        std::vector<uint32_t> packed(count);
+        bench::run("float3 pack_r11g11b10f", count, count * (sizeof(math::float3) + sizeof(uint32_t)), [&] {
+            math::pack_r11g11b10f(a, packed);
+            bench::do_not_optimize(packed.data());
+        });
+
+        bench::run("float3 unpack_r11g11b10f", count, count * (sizeof(math::float3) + sizeof(uint32_t)), [&] {
+            math::unpack_r11g11b10f(packed, out);
+            bench::do_not_optimize(out.data());
+        });
+
+        std::vector<math::float4> colors(count);
+        std::vector<math::ubyte4> bytes(count);
+        for (size_t i = 0; i < count; i++) colors[i] = math::float4(a[i].x, a[i].y, a[i].z, 7.0f) / 7.0f;
+        bench::run("float4 pack_unorm ubyte4", count, count * (sizeof(math::float4) + sizeof(math::ubyte4)), [&] {
+            math::pack_unorm(colors, bytes);
+            bench::do_not_optimize(bytes.data());
+        });
+
+        bench::run("float4 pack_unorm ubyte4 loop", count, count * (sizeof(math::float4) + sizeof(math::ubyte4)), [&] {
+            for (size_t i = 0; i < count; i++) bytes[i] = math::pack_unorm<uint8_t>(colors[i]);
+            bench::do_not_optimize(bytes.data());
+        });
+
+        bench::run("float4 pack_rgb10a2", count, count * (sizeof(math::float4) + sizeof(uint32_t)), [&] {
+            math::pack_rgb10a2(colors, packed);
+            bench::do_not_optimize(packed.data());
+        });
+
+        std::vector<math::short2> octahedral(count);
+        bench::run("float3 pack_octahedral short2", count, count * (sizeof(math::float3) + sizeof(math::short2)), [&] {
+            math::pack_octahedral(a, octahedral);
+            bench::do_not_optimize(octahedral.data());
+        });
+
+        bench::run("float3 pack_octahedral short2 loop", count, count * (sizeof(math::float3) + sizeof(math::short2)), [&] {
+            for (size_t i = 0; i < count; i++) octahedral[i] = math::pack_octahedral<int16_t>(a[i]);
+            bench::do_not_optimize(octahedral.data());
+        });
+
+        bench::run("float3 pack_octahedral_precise short2", count, count * (sizeof(math::float3) + sizeof(math::short2)), [&] {
+            math::pack_octahedral_precise(a, octahedral);
+            bench::do_not_optimize(octahedral.data());
+        });
+
+        bench::run("float3 pack_octahedral_precise short2 loop", count, count * (sizeof(math::float3) + sizeof(math::short2)), [&] {
+            for (size_t i = 0; i < count; i++) octahedral[i] = math::pack_octahedral_precise<int16_t>(a[i]);
+            bench::do_not_optimize(octahedral.data());
+        });
+
+        bench::run("float3 unpack_octahedral short2", count, count * (sizeof(math::float3) + sizeof(math::short2)), [&] {
+            math::unpack_octahedral(octahedral, out);
+            bench::do_not_optimize(out.data());
+        });
+    }
+
+    /**
+     * @brief The reductions in reduce_batch.h, against plain loops. The arrays are large enough to be split over multiple threads.
+     */
+    void reductions()
+    {
+        constexpr size_t          n = size_t(1) << 20;
+        std::vector<float>        v(n);
+        std::vector<math::float3> points(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            v[i]      = static_cast<float>(i % 1000) * 0.001f;
+            points[i] = math::float3(static_cast<float>(i % 7), static_cast<float>(i % 5), static_cast<float>(i % 3));
+        }
+
+        float sum = 0;
+        bench::run("float reduce_add naive", n, n * sizeof(float), [&] {
+            sum = math::reduce_add(v, math::summation::naive);
+            bench::do_not_optimize(&sum);
+        });
+
+        bench::run("float reduce_add pairwise", n, n * sizeof(float), [&] {
+            sum = math::reduce_add(v, math::summation::pairwise);
+            bench::do_not_optimize(&sum);
+        });
+
+        bench::run("float reduce_add kahan", n, n * sizeof(float), [&] {
+            sum = math::reduce_add(v, math::summation::kahan);
+            bench::do_not_optimize(&sum);
+        });
+
+        bench::run("float reduce_add loop", n, n * sizeof(float), [&] {
+            sum = 0;
+            for (const auto x : v) sum += x;
+            bench::do_not_optimize(&sum);
+        });
+
+        bench::run("float reduce_min", n, n * sizeof(float), [&] {
+            sum = math::reduce_min(v);
+            bench::do_not_optimize(&sum);
+        });
+
+        math::AABB<math::float3> box;
+        bench::run("float3 bounds", n, n * sizeof(math::float3), [&] {
+            box = math::bounds(std::span<const math::float3>(points));
+            bench::do_not_optimize(&box);
+        });
+
+        bench::run("float3 bounds loop", n, n * sizeof(math::float3), [&] {
+            box = math::AABB<math::float3>(math::pos_infinity<math::float3>(), math::neg_infinity<math::float3>());
+            for (const auto& p : points) box = math::AABB<math::float3>(math::min(box.lower, p), math::max(box.upper, p));
+            bench::do_not_optimize(&box);
+        });
+    }
+}  // namespace
+
+void vectorOps()
+{
+    run<math::float2>("float2");
+    run<math::float3>("float3");
+    run<math::float4>("float4");
+    run<math::vec<float, 8>>("float8");
+    run<math::double3>("double3");
+    run<math::double4>("double4");
+    run<math::int3>("int3");
+    run<math::int4>("int4");
+
+    run<math::vec2da>("vec2da");
+    run<math::vec3fa>("vec3fa");
+    run<math::vec4fa>("vec4fa");
+#ifdef __AVX__
+    run<math::vec8fa>("vec8fa");
+    run<math::vec3da>("vec3da");
+    run<math::vec4da>("vec4da");
+#endif
+
+    batched();
+    reductions();
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "bettertest/mixins/compare_mixin.h"
+#include "bettertest/tests/unit_test.h"
+
+class DualQuaternionSkinning : public bt::UnitTest<DualQuaternionSkinning, bt::CompareMixin>
+{
+public:
+    void operator()() override;
+};
@@ -0,0 +1,60 @@
+#include "math_test/batch_dispatch.h"
+
+#include <vector>
+
+#include "math/include_all.h"
+
+namespace
+{
+    struct points
+    {
+        std::vector<float> x, y, z;
+
+        explicit points(const size_t n) : x(n), y(n), z(n) {}
+
+        [[nodiscard]] math::vec3_span<float> span() { return { x, y, z }; }
+
+        [[nodiscard]] math::float3 operator[](const size_t i) const { return math::float3(x[i], y[i], z[i]); }
+    };
+}  // namespace
+
+void BatchDispatch::operator()()
+{
+    const auto r = math::rotation_from_quat(math::normalize(math::float4(0.3f, -0.5f, 0.2f, 0.8f)));
+    const math::mat3x4f m(math::translation(math::float3(1, -2, 3)) * r * math::scale(math::float3(2, 3, 4)));
+
+    const math::cpu_features f = math::detect_cpu_features();
+    compareEQ(math::best_isa() >= math::isa_level::avx2, f.avx2 && f.fma);
+    compareTrue(math::active_isa() == math::best_isa());
+    if (math::best_isa() != math::isa_level::avx512) compareTrue(!math::set_isa(math::isa_level::avx512));
+
+    // Every available kernel, for sizes with and without a tail.
+    for (int isa = 0; isa <= static_cast<int>(math::best_isa()); isa++)
+    {
+        compareTrue(math::set_isa(static_cast<math::isa_level>(isa)));
+        for (const size_t n : {0, 1, 5, 16, 37})
+        {
+            points in(n), pout(n), dout(n);
+            for (size_t i = 0; i < n; i++)
+            {
+                in.x[i] = static_cast<float>(i) * 0.5f - 3.0f;
+                in.y[i] = static_cast<float>(i % 7) - 2.0f;
+                in.z[i] = 1.0f / static_cast<float>(i + 1);
+            }
+
+            math::transform_points(m, in.span(), pout.span());
+            math::transform_directions(m, in.span(), dout.span());
+            for (size_t i = 0; i < n; i++)
+            {
+                compareLT(math::length(pout[i] - math::transform_point(m, in[i])), 1e-5f);
+                compareLT(math::length(dout[i] - math::transform_direction(m, in[i])), 1e-5f);
+            }
+
+            // In place.
+            math::transform_points(m, in.span(), in.span());
+            for (size_t i = 0; i < n; i++) compareEQ(in[i], pout[i]);
+        }
+    }
+
+    compareTrue(math::set_isa(math::best_isa()));
+}
@@ -0,0 +1,56 @@
+#include "math_test/constant_evaluation.h"
+
+#include "math/include_all.h"
+
+namespace
+{
+    // Vectors.
+    constexpr math::float3 a(1, 2, 3);
+    constexpr math::float3 b(4, 5, 6);
+    static_assert(a + b == math::float3(5, 7, 9));
+    static_assert(a * 2.0f - b == math::float3(-2, -1, 0));
+    static_assert(-a / 2.0f == math::float3(-0.5f, -1, -1.5f));
+    static_assert(math::dot(a, b) == 32.0f);
+    static_assert(math::cross(a, b) == math::float3(-3, 6, -3));
+    static_assert(math::sqr_length(math::float4(1, 2, 2, 4)) == 25.0f);
+    static_assert(a[2] == 3.0f && a.zyx() == math::float3(3, 2, 1));
+    static_assert(math::all(math::cmplt(a, b)));
+    static_assert(math::vec<int32_t, 8>(1) + math::vec<int32_t, 8>(2) == math::vec<int32_t, 8>(3));
+    static_assert(math::dot(math::floatN<5>(1), math::floatN<5>(2)) == 10.0f);
+
+    constexpr math::float2 table[] = { math::float2(0, 1), math::float2(1, 0), math::float2(0, -1), math::float2(-1, 0) };
+    static_assert(table[2].y == -1.0f);
+
+    constexpr math::float3 accumulate()
+    {
+        math::float3 v;
+        for (const auto& t : table) v += math::float3(t.x, t.y, 1.0f);
+        return v;
+    }
+    static_assert(accumulate() == math::float3(0, 0, 4));
+
+    // Matrices.
+    constexpr auto identity = math::identity<math::mat4x4f>();
+    constexpr auto transform = math::translation(math::float3(1, 2, 3)) * math::scale(math::float3(2, 2, 2));
+    static_assert(identity * math::float4(1, 2, 3, 4) == math::float4(1, 2, 3, 4));
+    static_assert(transform * math::float3(1, 1, 1) == math::float3(3, 4, 5));
+    static_assert(math::transpose(transform)[3] == math::float4(1, 2, 3, 1));
+    static_assert(math::identity<math::mat3x3f>()[1] == math::float3(0, 1, 0));
+
+    constexpr math::matrix<int32_t, 2, 3> m(1, 2, 3, 4, 5, 6);
+    static_assert(math::transpose(m)[2] == math::vec<int32_t, 2>(3, 6));
+    static_assert((m * 2)[1] == math::vec<int32_t, 3>(8, 10, 12));
+
+    // AABBs.
+    constexpr math::AABB<math::float3> box(math::float3(-1), math::float3(1, 2, 3));
+    static_assert(box[1] == math::float3(1, 2, 3));
+    static_assert(box == math::AABB<math::float3>(math::float3(-1), math::float3(1, 2, 3)));
+}  // namespace
+
+void ConstantEvaluation::operator()()
+{
+    // Everything is checked at compile time. Make sure the constants are also usable at runtime.
+    compareEQ(accumulate(), math::float3(0, 0, 4));
+    compareEQ(transform[0][3], 1.0f);
+    compareEQ(box.lower, math::float3(-1));
+}
@@ -0,0 +1,49 @@
+#include "math_test/dual_quaternion_skinning.h"
+
+#include <vector>
+
+#include "math/include_all.h"
+
+namespace
+{
+    float maxError(const math::float3& a, const math::float3& b) { return math::reduce_max(math::abs(a - b)); }
+}  // namespace
+
+void DualQuaternionSkinning::operator()()
+{
+    const auto         r0 = math::quat_from_axis_angle(math::float3(0, 1, 0), 0.5f);
+    const auto         r1 = math::quat_from_axis_angle(math::normalize(math::float3(1, 0, 1)), -1.2f);
+    const math::float3 t0(1, 2, 3), t1(-4, 0, 0.5f);
+    const math::dual_quatf a(r0, t0);
+    // Negated dual quaternion represents the same transform, skinning must handle the opposite hemisphere.
+    const math::dual_quatf b = math::dual_quatf(r1, t1) * -1.0f;
+    const math::float3     p(0.5f, -1, 2);
+
+    // Generic dual quaternion transforms match the equivalent matrices.
+    compareLT(maxError(math::transform_point(a, p), math::translation(t0) * math::rotation_from_quat(r0) * p), 1e-5f);
+    compareLT(maxError(math::transform_point(a * b, p), math::transform_point(a, math::transform_point(b, p))), 1e-5f);
+    compareLT(maxError(math::transform_from_dual_quat(a) * p, math::transform_point(a, p)), 1e-5f);
+
+    const std::vector<math::dual_quatf> bones = {a, b};
+    const std::vector<math::uint4>      indices = {{0, 0, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}};
+    const std::vector<math::float4>     weights = {{1, 0, 0, 0}, {1, 0, 0, 0}, {0.5f, 0.5f, 0, 0}};
+    const std::vector<math::float3>     positions(3, p);
+    const std::vector<math::float3>     normals(3, math::normalize(math::float3(1, 1, 0)));
+    std::vector<math::float3>           outPositions(3), outNormals(3);
+    math::skin(bones, indices, weights, positions, normals, outPositions, outNormals);
+
+    // Single influences reproduce the bone transform.
+    compareLT(maxError(outPositions[0], math::transform_point(a, p)), 1e-5f);
+    compareLT(maxError(outPositions[1], math::transform_point(b, p)), 1e-5f);
+    compareLT(maxError(outNormals[1], math::transform_direction(b, normals[1])), 1e-5f);
+
+    // Blends match the normalized generic blend, and normals stay unit length.
+    const auto blend = math::normalize(a * 0.5f + b * -0.5f);
+    compareLT(maxError(outPositions[2], math::transform_point(blend, p)), 1e-5f);
+    compareLT(math::abs(math::length(outNormals[2]) - 1.0f), 1e-5f);
+
+    // Positions only.
+    std::vector<math::float3> outPositions2(3);
+    math::skin(bones, indices, weights, positions, outPositions2);
+    compareTrue(outPositions == outPositions2);
+}
@@ -0,0 +1,132 @@
+#include "math_test/float16.h"
+
+#include <bit>
+#include <cmath>
+#include <immintrin.h>
+#include <random>
+#include <vector>
+
+#include "math/include_all.h"
+
+namespace
+{
+    // Conversions in constant expressions use the software path.
+    static_assert(math::float16(1.0f).bits == 0x3c00);
+    static_assert(math::float16(-2.0f).bits == 0xc000);
+    static_assert(math::float16(65504.0f).bits == 0x7bff);
+    static_assert(math::float16(65519.0f).bits == 0x7bff);
+    static_assert(math::float16(65520.0f).bits == 0x7c00);
+    static_assert(math::float16(0x1p-24f).bits == 0x0001);
+    static_assert(math::float16(0x1p-25f).bits == 0x0000);
+    static_assert(float(math::float16::from_bits(0x0001)) == 0x1p-24f);
+    static_assert(std::bit_cast<uint32_t>(float(math::float16::from_bits(0x7c01))) == 0x7fc02000);
+    static_assert(math::float16(std::bit_cast<float>(0xff800001)).bits == 0xfe00);
+    static_assert(float(std::numeric_limits<math::float16>::max()) == 65504.0f);
+    static_assert(float(std::numeric_limits<math::float16>::epsilon()) == 0x1p-10f);
+    static_assert(sizeof(math::half3) == 6);
+}
+
+void Float16::operator()()
+{
+    // Every half converts to float and back unchanged, except that NaN becomes quiet. The software conversion gives the same
+    // bits as F16C, including the NaN payloads.
+    {
+        size_t wrong = 0;
+        for (uint32_t b = 0; b < 0x10000; b++)
+        {
+            const auto     h = math::float16::from_bits(static_cast<uint16_t>(b));
+            const uint32_t f = std::bit_cast<uint32_t>(float(h));
+            wrong += f != std::bit_cast<uint32_t>(math::detail::half_bits_to_float(h.bits));
+#ifdef __F16C__
+            wrong += f != std::bit_cast<uint32_t>(_cvtsh_ss(h.bits));
+#endif
+            const bool nan = (b & 0x7c00) == 0x7c00 && (b & 0x3ff);
+            wrong += math::float16(float(h)).bits != (nan ? b | 0x200 : b);
+        }
+        compareEQ(wrong, size_t(0));
+    }
+
+    // Values halfway between two halfs round to the even one. The software conversion gives the same result as F16C.
+    {
+        size_t wrong = 0;
+        for (uint16_t b = 0; b < 0x7bff; b++)
+        {
+            const float mid  = (float(math::float16::from_bits(b)) + float(math::float16::from_bits(b + 1))) / 2;
+            const auto  even = static_cast<uint16_t>(b & 1 ? b + 1 : b);
+            wrong += math::float16(mid).bits != even;
+            wrong += math::float16(-mid).bits != (even | 0x8000);
+            wrong += math::detail::float_to_half_bits(mid) != even;
+        }
+        compareEQ(wrong, size_t(0));
+
+        wrong = 0;
+        for (uint64_t b = 0; b < (uint64_t(1) << 32); b += 4099)
+        {
+            const float f = std::bit_cast<float>(static_cast<uint32_t>(b));
+            wrong += math::float16(f).bits != math::detail::float_to_half_bits(f);
+#ifdef __F16C__
+            wrong += _cvtss_sh(f, _MM_FROUND_TO_NEAREST_INT) != math::detail::float_to_half_bits(f);
+#endif
+        }
+        compareEQ(wrong, size_t(0));
+
+        // NaN payloads, quiet and signaling.
+        wrong = 0;
+        for (uint32_t m = 1; m < 0x800000; m += 127)
+        {
+            for (const uint32_t sign : {0u, 0x80000000u})
+            {
+                const float    f = std::bit_cast<float>(sign | 0x7f800000 | m);
+                const uint16_t h = math::float16(f).bits;
+                wrong += h != (sign >> 16 | 0x7e00 | m >> 13);
+                wrong += h != math::detail::float_to_half_bits(f);
+#ifdef __F16C__
+                wrong += _cvtss_sh(f, _MM_FROUND_TO_NEAREST_INT) != h;
+#endif
+            }
+        }
+        compareEQ(wrong, size_t(0));
+    }
+
+    // Span conversions match the scalar ones, including the tail.
+    {
+        constexpr size_t                      n = 1027;
+        std::mt19937                          rng(3);
+        std::uniform_real_distribution<float> ud(-70000.0f, 70000.0f);
+        std::vector<float>                    f(n), back(n);
+        std::vector<math::half>               h(n);
+        for (auto& x : f) x = ud(rng) * std::pow(2.0f, static_cast<float>(static_cast<int>(rng() % 40)) - 30.0f);
+
+        math::convert(f, h);
+        size_t wrong = 0;
+        for (size_t i = 0; i < n; i++) wrong += h[i].bits != math::float16(f[i]).bits;
+        compareEQ(wrong, size_t(0));
+
+        math::convert(h, back);
+        wrong = 0;
+        for (size_t i = 0; i < n; i++) wrong += back[i] != float(h[i]);
+        compareEQ(wrong, size_t(0));
+
+        std::vector<math::float3> v(n / 3), vback(n / 3);
+        std::vector<math::half3>  vh(n / 3);
+        for (size_t i = 0; i < v.size(); i++) v[i] = math::float3(f[3 * i], f[3 * i + 1], f[3 * i + 2]);
+        math::convert(v, vh);
+        math::convert(vh, vback);
+        wrong = 0;
+        for (size_t i = 0; i < v.size(); i++) wrong += vback[i] != math::float3(back[3 * i], back[3 * i + 1], back[3 * i + 2]);
+        compareEQ(wrong, size_t(0));
+    }
+
+    // Vectors of halfs compute in float and round the result.
+    {
+        const math::half3 a(1.0f, 2.0f, 3.0f);
+        const math::half3 b = a + a * a;
+        compareTrue(b == math::half3(2.0f, 6.0f, 12.0f));
+        compareTrue(math::float3(a) == math::float3(1, 2, 3));
+        compareTrue(math::half3(math::float3(1.0f / 3.0f)).x == math::half(1.0f / 3.0f));
+
+        math::half h = 2048.0f;
+        h += 1.0f;
+        compareEQ(float(h), 2048.0f);
+    }
+}
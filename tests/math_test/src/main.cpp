@@ -10,10 +10,29 @@
 // Current target includes.
 ////////////////////////////////////////////////////////////////
 
+#include "math_test/batch_dispatch.h"
+#include "math_test/constant_evaluation.h"
+#include "math_test/dual_quaternion_skinning.h"
+#include "math_test/float16.h"
+#include "math_test/matrix_affine.h"
+#include "math_test/matrix_decompose.h"
+#include "math_test/parallel.h"
+#include "math_test/quaternion.h"
+#include "math_test/quaternion_batch.h"
+#include "math_test/reduce_batch.h"
+#include "math_test/simd_batch.h"
+#include "math_test/simd_memory.h"
+#include "math_test/simd_type.h"
+#include "math_test/uninit.h"
 #include "math_test/vector_add.h"
+#include "math_test/vector_batch.h"
 #include "math_test/vector_div.h"
 #include "math_test/vector_equals.h"
+#include "math_test/vector_expression.h"
 #include "math_test/vector_mul.h"
+#include "math_test/vector_pack.h"
+#include "math_test/vector_simd16.h"
+#include "math_test/vector_simd_double.h"
 #include "math_test/vector_sub.h"
 
 #ifdef WIN32
@@ -33,6 +52,6 @@ int main(int argc, char** argv)
     }
 #endif
 
-    bt::run<VectorAdd, VectorDiv, VectorEquals, VectorMul, VectorSub>(argc, argv, "cppql");
+    bt::run<BatchDispatch, ConstantEvaluation, DualQuaternionSkinning, Float16, MatrixAffine, MatrixDecompose, Parallel, Quaternion, QuaternionBatch, ReduceBatch, SimdBatch, SimdMemory, SimdType, Uninit, VectorAdd, VectorBatch, VectorDiv, VectorEquals, VectorExpression, VectorMul, VectorPack, VectorSimd16, VectorSimdDouble, VectorSub>(argc, argv, "cppql");
     return 0;
 }
@@ -0,0 +1,50 @@
+#include "math_test/matrix_affine.h"
+
+#include "math/include_all.h"
+
+namespace
+{
+    float maxError(const math::mat3x4f& a, const math::mat3x4f& b)
+    {
+        float err = 0;
+        for (size_t i = 0; i < 3; i++)
+            for (size_t j = 0; j < 4; j++) err = std::max(err, std::abs(a[i][j] - b[i][j]));
+        return err;
+    }
+
+    float maxError(const math::float3& a, const math::float3& b)
+    {
+        return std::max({std::abs(a.x - b.x), std::abs(a.y - b.y), std::abs(a.z - b.z)});
+    }
+}  // namespace
+
+void MatrixAffine::operator()()
+{
+    const auto r = math::rotation_from_quat(math::normalize(math::float4(0.3f, -0.5f, 0.2f, 0.8f)));
+    const auto m0 = math::translation(math::float3(1, -2, 3)) * r * math::scale(math::float3(2, 3, 4));
+    const auto m1 = math::translation(math::float3(-4, 0.5f, 2)) * math::scale(math::float3(0.5f, -1, 2)) * r;
+    const math::mat3x4f a0(m0), a1(m1);
+    const math::float3  p(0.25f, -3, 7);
+
+    compareEQ(sizeof(math::mat3x4f), 12 * sizeof(float));
+    compareEQ(static_cast<math::mat4x4f>(a0).r3, math::float4(0, 0, 0, 1));
+
+    // Compose and transform match the full 4x4 matrices.
+    compareLT(maxError(a0 * a1, math::mat3x4f(m0 * m1)), 1e-5f);
+    compareLT(maxError(a0 * p, m0 * p), 1e-5f);
+    compareLT(maxError(math::transform_direction(a0, p), (m0 * math::float4(p, 0)).xyz()), 1e-5f);
+
+    // Inverse.
+    compareLT(maxError(math::invert(a0) * a0, math::affine_identity<float>()), 1e-5f);
+    compareLT(maxError(a1 * math::invert(a1), math::affine_identity<float>()), 1e-5f);
+
+    // SIMD version matches generic version.
+    {
+        const math::mat3x4fa b0(a0), b1(a1);
+        compareLT(maxError(static_cast<math::mat3x4f>(b0 * b1), a0 * a1), 1e-5f);
+        compareLT(maxError(static_cast<math::float3>(b0 * math::vec3fa(p)), a0 * p), 1e-5f);
+        compareLT(maxError(static_cast<math::float3>(math::transform_direction(b0, math::vec3fa(p))), math::transform_direction(a0, p)), 1e-5f);
+        compareLT(maxError(static_cast<math::mat3x4f>(math::invert(b1)), math::invert(a1)), 1e-5f);
+        compareEQ(static_cast<math::mat4x4f>(static_cast<math::mat4x4fa>(b0)).r3, math::float4(0, 0, 0, 1));
+    }
+}
@@ -0,0 +1,91 @@
+#include "math_test/matrix_decompose.h"
+
+#include <vector>
+
+#include "math/include_all.h"
+
+namespace
+{
+    float maxError(const math::mat4x4f& a, const math::mat4x4f& b)
+    {
+        float err = 0;
+        for (size_t i = 0; i < 4; i++)
+            for (size_t j = 0; j < 4; j++) err = std::max(err, std::abs(a[i][j] - b[i][j]));
+        return err;
+    }
+}  // namespace
+
+void MatrixDecompose::operator()()
+{
+    const auto t = math::translation(math::float3(1, -2, 3));
+    const auto r = math::rotation_from_quat(math::normalize(math::float4(0.3f, -0.5f, 0.2f, 0.8f)));
+
+    // Pure scale.
+    {
+        const auto         m = t * r * math::scale(math::float3(2, 3, 4));
+        math::float3       translation;
+        math::float4       rotation;
+        math::mat3x3f      stretch;
+        math::decompose(m, translation, rotation, stretch);
+        compareEQ(translation, math::float3(1, -2, 3));
+        compareLT(maxError(math::rotation_from_quat(rotation), r), 1e-5f);
+        compareLT(std::abs(stretch[0][0] - 2.0f), 1e-5f);
+        compareLT(std::abs(stretch[1][1] - 3.0f), 1e-5f);
+        compareLT(std::abs(stretch[2][2] - 4.0f), 1e-5f);
+    }
+
+    // Shear and negative scale. Rotation must stay proper, the reflection ends up in the stretch.
+    {
+        const math::mat4x4f s(2.0f, 0.3f, 0, 0, 0.3f, -1.5f, 0.1f, 0, 0, 0.1f, 0.7f, 0, 0, 0, 0, 1);
+        const auto          m = t * r * s;
+        math::mat4x4f       mt, mr, ms;
+        math::decompose(m, mt, mr, ms);
+        compareLT(maxError(mt * mr * ms, m), 1e-5f);
+        compareLT(std::abs(math::dot(mr.r0.xyz(), math::cross(mr.r1.xyz(), mr.r2.xyz())) - 1.0f), 1e-5f);
+        compareEQ(ms[0][1], ms[1][0]);
+        compareEQ(ms[1][2], ms[2][1]);
+        compareEQ(ms[0][2], ms[2][0]);
+    }
+
+    // Nearly singular. The determinant is far above the smallest float, but lost in round-off relative to the rows.
+    {
+        const math::mat4x4f m(1, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1e-9f, 0, 0, 0, 0, 1);
+        math::float3        translation;
+        math::float4        rotation;
+        math::mat3x3f       stretch;
+        math::decompose(m, translation, rotation, stretch);
+        compareEQ(rotation, math::float4(0, 0, 0, 1));
+        for (size_t i = 0; i < 3; i++)
+            for (size_t j = 0; j < 3; j++) compareEQ(stretch[i][j], 0.5f * (m[i][j] + m[j][i]));
+    }
+
+    // Uniformly tiny scale is not singular.
+    {
+        const auto    m = t * r * math::scale(math::float3(1e-6f, 2e-6f, 1e-6f));
+        math::float3  translation;
+        math::float4  rotation;
+        math::mat3x3f stretch;
+        math::decompose(m, translation, rotation, stretch);
+        compareLT(maxError(math::rotation_from_quat(rotation), r), 1e-5f);
+        compareLT(std::abs(stretch[1][1] - 2e-6f), 1e-11f);
+    }
+
+    // Batch version matches single version.
+    {
+        const std::vector<math::mat4x4f> transforms(17, t * r * math::scale(math::float3(-1, 2, 1)));
+        std::vector<math::float3>        translations(transforms.size());
+        std::vector<math::float4>        rotations(transforms.size());
+        std::vector<math::mat3x3f>       stretches(transforms.size());
+        math::decompose(transforms, translations, rotations, stretches);
+
+        math::float3  translation;
+        math::float4  rotation;
+        math::mat3x3f stretch;
+        math::decompose(transforms.front(), translation, rotation, stretch);
+        for (size_t i = 0; i < transforms.size(); i++)
+        {
+            compareEQ(translations[i], translation);
+            compareEQ(rotations[i], rotation);
+        }
+    }
+}
@@ -0,0 +1,140 @@
+#include "math_test/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "math/include_all.h"
+
+namespace
+{
+    /**
+     * @brief Runs all tasks on the calling thread, in reverse, and counts the calls to run.
+     */
+    class serial_executor final : public math::executor
+    {
+    public:
+        [[nodiscard]] size_t concurrency() const noexcept override { return 3; }
+
+        void run(const size_t count, const std::function<void(size_t)>& task) override
+        {
+            runs++;
+            for (size_t i = count; i > 0; i--) task(i - 1);
+        }
+
+        size_t runs = 0;
+    };
+}
+
+void Parallel::operator()()
+{
+    // More threads than cores, so that the pool is exercised on any machine.
+    math::set_thread_count(4);
+    compareEQ(math::thread_count(), size_t(4));
+
+    // Every index is visited exactly once.
+    {
+        std::vector<std::atomic<int>> visits(100003);
+        math::parallel_for({3, visits.size()}, 1000, [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) visits[i]++;
+        });
+        size_t wrong = 0;
+        for (size_t i = 0; i < visits.size(); i++) wrong += visits[i] != (i >= 3 ? 1 : 0);
+        compareEQ(wrong, size_t(0));
+    }
+
+    // Integer reductions are exact for any split.
+    {
+        std::vector<uint64_t> v(1 << 20);
+        std::iota(v.begin(), v.end(), uint64_t(1));
+        const auto sum = math::parallel_reduce(
+          {0, v.size()}, 1024, uint64_t(0), [&](const size_t begin, const size_t end) { return std::accumulate(v.begin() + begin, v.begin() + end, uint64_t(0)); }, std::plus<>());
+        compareEQ(sum, uint64_t(v.size()) * (v.size() + 1) / 2);
+        compareEQ(math::parallel_reduce({5, 5}, 1, uint64_t(7), [](size_t, size_t) { return uint64_t(0); }, std::plus<>()), uint64_t(7));
+    }
+
+    // Nested loops run the inner loop on the calling thread instead of deadlocking.
+    {
+        std::atomic<size_t> count = 0;
+        math::parallel_for({0, 64}, 1, [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++)
+                math::parallel_for({0, 100}, 1, [&](const size_t b, const size_t e) { count += e - b; });
+        });
+        compareEQ(count.load(), size_t(6400));
+    }
+
+    // Exceptions are rethrown on the calling thread, after which the pool is still usable.
+    {
+        bool caught = false;
+        try
+        {
+            math::parallel_for({0, 1000}, 10, [](const size_t begin, size_t) {
+                if (begin == 0) throw std::runtime_error("task");
+            });
+        }
+        catch (const std::runtime_error&)
+        {
+            caught = true;
+        }
+        compareTrue(caught);
+
+        std::atomic<size_t> count = 0;
+        math::parallel_for({0, 1000}, 10, [&](const size_t begin, const size_t end) { count += end - begin; });
+        compareEQ(count.load(), size_t(1000));
+    }
+
+    // Reductions over spans give the same result on the pool as on one thread.
+    {
+        std::mt19937                          rng(5);
+        std::uniform_real_distribution<float> ud(-100.0f, 100.0f);
+        std::vector<math::float3>             points((size_t(1) << 20) + 7);
+        for (auto& p : points) p = math::float3(ud(rng), ud(rng), ud(rng));
+        std::vector<float> v(points.size());
+        for (size_t i = 0; i < v.size(); i++) v[i] = points[i].x + 100.0f;
+
+        const auto box = math::bounds(std::span<const math::float3>(points));
+        const auto min = math::reduce_min(v);
+        const auto sum = math::reduce_add(v);
+
+        math::set_thread_count(1);
+        compareEQ(math::thread_count(), size_t(1));
+        compareTrue(math::bounds(std::span<const math::float3>(points)) == box);
+        compareEQ(math::reduce_min(v), min);
+        compareLT(std::abs(math::reduce_add(v) - sum) / sum, 1e-6f);
+    }
+
+    // External executor.
+    {
+        serial_executor e;
+        math::set_executor(&e);
+        compareEQ(math::thread_count(), size_t(3));
+
+        std::vector<int> visits(10000);
+        math::parallel_for({0, visits.size()}, 100, [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) visits[i]++;
+        });
+        compareEQ(e.runs, size_t(1));
+        compareEQ(std::count(visits.begin(), visits.end(), 1), std::ptrdiff_t(visits.size()));
+
+        // Ranges smaller than two grains do not use the executor.
+        math::parallel_for({0, 150}, 100, [](size_t, size_t) {});
+        compareEQ(e.runs, size_t(1));
+
+        // Nested loops run serially and do not call the executor again.
+        size_t count = 0;
+        math::parallel_for({0, 300}, 100, [&](size_t, size_t) {
+            math::parallel_for({0, 1000}, 10, [&](const size_t begin, const size_t end) { count += end - begin; });
+        });
+        compareEQ(e.runs, size_t(2));
+        compareEQ(count, size_t(3000));
+
+        math::set_executor(nullptr);
+    }
+
+    math::set_thread_count(0);
+}
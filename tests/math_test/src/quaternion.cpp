@@ -0,0 +1,37 @@
+#include "math_test/quaternion.h"
+
+#include "math/include_all.h"
+
+namespace
+{
+    float maxError(const math::float3& a, const math::float3& b) { return math::reduce_max(math::abs(a - b)); }
+}  // namespace
+
+void Quaternion::operator()()
+{
+    const auto a = math::quat_from_axis_angle(math::float3(0, 0, 1), math::m_pi / 2);
+    const auto b = math::quat_from_axis_angle(math::normalize(math::float3(1, 2, -1)), 0.7f);
+    const math::float3 v(1, -2, 3);
+
+    // Rotation of a vector matches the rotation matrix.
+    compareLT(maxError(a * math::float3(1, 0, 0), math::float3(0, 1, 0)), 1e-6f);
+    compareLT(maxError(b * v, math::rotation_from_quat(b) * v), 1e-5f);
+
+    // Product composes rotations: (a * b) * v == a * (b * v).
+    compareLT(maxError((a * b) * v, a * (b * v)), 1e-5f);
+    compareLT(maxError(math::inverse(b) * (b * v), v), 1e-5f);
+
+    // SIMD implementation matches the generic one.
+    const math::quatfa af(a), bf(b);
+    const auto         ab  = static_cast<math::quatf>(af * bf);
+    const auto         ab2 = a * b;
+    compareLT(math::abs(ab.x - ab2.x) + math::abs(ab.y - ab2.y) + math::abs(ab.z - ab2.z) + math::abs(ab.w - ab2.w), 1e-6f);
+    compareLT(maxError(static_cast<math::float3>(bf * math::vec3fa(v)), b * v), 1e-5f);
+    compareLT(maxError(static_cast<math::float3>(static_cast<math::vec3fa>(math::rotation_from_quat(bf) * math::vec4fa(v.x, v.y, v.z, 1.0f))), b * v), 1e-5f);
+
+    // Interpolation hits the end points and stays normalized.
+    compareLT(math::abs(math::dot(math::slerp(a, b, 1.0f), b) - 1.0f), 1e-5f);
+    compareLT(math::abs(math::length(math::slerp(a, b, 0.3f)) - 1.0f), 1e-5f);
+    compareLT(math::abs(math::length(math::nlerp(af, bf, 0.3f)) - 1.0f), 1e-5f);
+    compareLT(math::abs(math::dot(math::slerp(af, bf, 0.3f), math::quatfa(math::slerp(a, b, 0.3f))) - 1.0f), 1e-5f);
+}
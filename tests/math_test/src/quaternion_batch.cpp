@@ -0,0 +1,76 @@
+#include "math_test/quaternion_batch.h"
+
+#include <random>
+#include <vector>
+
+#include "math/include_all.h"
+
+namespace
+{
+    struct SoA
+    {
+        explicit SoA(const size_t n) : x(n), y(n), z(n), w(n) {}
+
+        std::vector<float> x, y, z, w;
+
+        [[nodiscard]] math::quat_span<float> span() { return {x, y, z, w}; }
+
+        [[nodiscard]] math::quatd get(const size_t i) const { return math::quatd(x[i], y[i], z[i], w[i]); }
+
+        void set(const size_t i, const math::quatd& q)
+        {
+            x[i] = static_cast<float>(q.x);
+            y[i] = static_cast<float>(q.y);
+            z[i] = static_cast<float>(q.z);
+            w[i] = static_cast<float>(q.w);
+        }
+    };
+
+    // Angle of the rotation between two unit quaternions.
+    double angle(const math::quatd& a, const math::quatd& b)
+    {
+        const auto b2 = math::dot(a, b) < 0 ? -b : b;
+        return 4.0 * std::asin(std::min(1.0, math::length(a - b2) / 2.0));
+    }
+}  // namespace
+
+void QuaternionBatch::operator()()
+{
+    // Odd size to exercise the scalar tail.
+    constexpr size_t                       n = 4099;
+    std::mt19937                           rng(42);
+    std::normal_distribution<double>       nd;
+    std::uniform_real_distribution<float>  ud(0.0f, 1.0f);
+    SoA                                    a(n), b(n), out(n);
+    std::vector<float>                     t(n);
+
+    for (size_t i = 0; i < n; i++)
+    {
+        const auto qa = math::normalize(math::quatd(nd(rng), nd(rng), nd(rng), nd(rng)));
+        auto       qb = math::normalize(math::quatd(nd(rng), nd(rng), nd(rng), nd(rng)));
+        // Also test nearly identical rotations on either hemisphere.
+        if (i % 3 == 1) qb = math::normalize(qa + math::quatd(nd(rng), nd(rng), nd(rng), nd(rng)) * 1e-3);
+        if (i % 3 == 2) qb = -math::normalize(qa + math::quatd(nd(rng), nd(rng), nd(rng), nd(rng)) * 1e-3);
+        a.set(i, qa);
+        b.set(i, qb);
+        t[i] = ud(rng);
+    }
+
+    double maxSlerp = 0, maxNlerp = 0;
+    math::slerp(a.span(), b.span(), t, out.span());
+    for (size_t i = 0; i < n; i++)
+        maxSlerp = std::max(maxSlerp, angle(out.get(i), math::slerp(a.get(i), b.get(i), static_cast<double>(t[i]))));
+    math::nlerp(a.span(), b.span(), t, out.span());
+    for (size_t i = 0; i < n; i++)
+        maxNlerp = std::max(maxNlerp, angle(out.get(i), math::nlerp(a.get(i), b.get(i), static_cast<double>(t[i]))));
+
+    compareLT(maxSlerp, 2e-6);
+    compareLT(maxNlerp, 2e-6);
+
+    // Uniform factor matches per-element factors.
+    SoA out2(n);
+    math::slerp(a.span(), b.span(), std::vector<float>(n, 0.25f), out.span());
+    math::slerp(a.span(), b.span(), 0.25f, out2.span());
+    compareTrue(out.x == out2.x);
+    compareTrue(out.w == out2.w);
+}
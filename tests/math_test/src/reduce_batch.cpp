@@ -0,0 +1,85 @@
+#include "math_test/reduce_batch.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "math/include_all.h"
+
+void ReduceBatch::operator()()
+{
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    std::mt19937    rng(11);
+
+    // Sums of many positive values, where naive summation loses precision.
+    {
+        constexpr size_t                      n = (size_t(1) << 20) + 5;
+        std::uniform_real_distribution<float> ud(0.0f, 1.0f);
+        std::vector<float>                    v(n);
+        double                                ref = 0;
+        for (auto& x : v)
+        {
+            x = ud(rng);
+            ref += x;
+        }
+
+        const auto error = [&](const math::summation s) { return std::abs(math::reduce_add(v, s) - ref) / ref; };
+        compareLT(error(math::summation::naive), 1e-4);
+        compareLT(error(math::summation::pairwise), 1e-6);
+        compareLT(error(math::summation::kahan), 1.2e-7);
+
+        // Small enough for a single pairwise block.
+        const std::span<const float> head(v.data(), 1001);
+        double                       headRef = 0;
+        for (const auto x : head) headRef += x;
+        compareLT(std::abs(math::reduce_add(head) - headRef) / headRef, 1e-6);
+    }
+
+    // Minimum and maximum with odd sizes to exercise the tail, and NaN elements that must be skipped.
+    for (const size_t n : {size_t(1), size_t(7), size_t(1027)})
+    {
+        std::uniform_real_distribution<float> ud(-100.0f, 100.0f);
+        std::vector<float>                    v(n);
+        for (auto& x : v) x = ud(rng);
+        const auto [lo, hi] = std::minmax_element(v.begin(), v.end());
+        compareEQ(math::reduce_min(v), *lo);
+        compareEQ(math::reduce_max(v), *hi);
+
+        if (n > 1)
+        {
+            const float l = *lo, h = *hi;
+            std::replace_if(v.begin(), v.end(), [&](const float x) { return x != l && x != h; }, std::numeric_limits<float>::quiet_NaN());
+            compareEQ(math::reduce_min(v), l);
+            compareEQ(math::reduce_max(v), h);
+        }
+    }
+
+    // Bounds of points.
+    for (const size_t n : {size_t(1), size_t(3), size_t(1027)})
+    {
+        std::uniform_real_distribution<float> ud(-100.0f, 100.0f);
+        std::vector<math::float3>             v(n);
+        math::float3                          lo(inf), hi(-inf);
+        for (auto& p : v)
+        {
+            p  = math::float3(ud(rng), ud(rng), ud(rng));
+            lo = math::min(lo, p);
+            hi = math::max(hi, p);
+        }
+
+        const auto box = math::bounds(std::span<const math::float3>(v));
+        compareTrue(box.lower == lo);
+        compareTrue(box.upper == hi);
+        compareTrue(math::reduce_min(std::span<const math::float3>(v)) == lo);
+        compareTrue(math::reduce_max(std::span<const math::float3>(v)) == hi);
+    }
+
+    // Empty spans return the identity of the reduction.
+    compareEQ(math::reduce_add(std::span<const float>()), 0.0f);
+    compareEQ(math::reduce_min(std::span<const float>()), inf);
+    compareEQ(math::reduce_max(std::span<const float>()), -inf);
+    const auto empty = math::bounds(std::span<const math::float3>());
+    compareTrue(empty.lower == math::float3(inf));
+    compareTrue(empty.upper == math::float3(-inf));
+}
@@ -0,0 +1,111 @@
+#include "math_test/simd_batch.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "math/include_all.h"
+
+namespace
+{
+    // Clamp every element to [lo, hi] and return the sum. Written once for all element types and widths.
+    template<typename T>
+    T clampSum(std::vector<T>& values, const T lo, const T hi)
+    {
+        using B = math::batch<T>;
+        constexpr size_t W = math::batch_width_v<T>;
+
+        B      sum;
+        size_t i = 0;
+        for (; i + W <= values.size(); i += W)
+        {
+            const B v = math::clamp(B::loadu(values.data() + i), B(lo), B(hi));
+            B::storeu(values.data() + i, v);
+            sum = sum + v;
+        }
+
+        // Tail. Lanes past the end are loaded as zero, which is inside [lo, hi] for the ranges used below.
+        const size_t rem = values.size() - i;
+        if (rem)
+        {
+            const B v = math::clamp(math::batch_load_partial(values.data() + i, rem), B(lo), B(hi));
+            math::batch_store_partial(values.data() + i, v, rem);
+            sum = sum + v;
+        }
+
+        return math::reduce_add(sum);
+    }
+
+    // a * s + b, with lanes where a < 0 replaced by b.
+    template<typename T>
+    void maddPositive(const T* a, const T* b, T* out, const size_t n, const T s)
+    {
+        using B = math::batch<T>;
+        constexpr size_t W = math::batch_width_v<T>;
+
+        for (size_t i = 0; i < n; i += W)
+        {
+            const size_t count = std::min(W, n - i);
+            const B      va    = math::batch_load_partial(a + i, count);
+            const B      vb    = math::batch_load_partial(b + i, count);
+            const auto   neg   = math::cmplt(va, B(0));
+            math::batch_store_partial(out + i, math::select(vb, math::madd(va, B(s), vb), neg), count);
+        }
+    }
+}  // namespace
+
+void SimdBatch::operator()()
+{
+#if defined(__AVX512F__)
+    static_assert(math::batch_width_v<float> == 16 && math::batch_width_v<int32_t> == 16);
+    static_assert(std::is_same_v<math::batch_mask<float>, math::vec16ba>);
+#elif defined(__AVX__)
+    static_assert(math::batch_width_v<float> == 8);
+    static_assert(std::is_same_v<math::batch_mask<float>, math::vec8ba>);
+#else
+    static_assert(math::batch_width_v<float> == 4);
+#endif
+#if defined(__AVX2__) && !defined(__AVX512F__)
+    static_assert(math::batch_width_v<int32_t> == 8);
+#elif !defined(__AVX2__)
+    static_assert(math::batch_width_v<int32_t> == 4);
+#endif
+#ifdef __AVX__
+    static_assert(math::batch_width_v<double> == 4);
+#else
+    static_assert(math::batch_width_v<double> == 2);
+#endif
+    static_assert(math::batch_width_v<int64_t> == 1);
+
+    // Sizes with and without a tail.
+    for (const size_t n : {3, 8, 29})
+    {
+        std::vector<float>   f(n);
+        std::vector<int32_t> i(n);
+        for (size_t j = 0; j < n; j++)
+        {
+            f[j] = static_cast<float>(j) - 10.0f;
+            i[j] = static_cast<int32_t>(j) * 3 - 20;
+        }
+
+        float   fexp = 0;
+        int32_t iexp = 0;
+        for (size_t j = 0; j < n; j++)
+        {
+            fexp += std::clamp(f[j], -4.0f, 6.0f);
+            iexp += std::clamp(i[j], -7, 25);
+        }
+
+        compareEQ(clampSum(f, -4.0f, 6.0f), fexp);
+        compareEQ(clampSum(i, -7, 25), iexp);
+        compareEQ(std::accumulate(f.begin(), f.end(), 0.0f), fexp);
+        compareEQ(std::accumulate(i.begin(), i.end(), 0), iexp);
+
+        std::vector<float> b(n, 1.0f), out(n + 1, -100.0f);
+        std::vector<float> a(n);
+        for (size_t j = 0; j < n; j++) a[j] = static_cast<float>(j % 5) - 2.0f;
+        maddPositive(a.data(), b.data(), out.data(), n, 2.0f);
+        for (size_t j = 0; j < n; j++) compareEQ(out[j], a[j] < 0 ? 1.0f : a[j] * 2.0f + 1.0f);
+        compareEQ(out[n], -100.0f);
+    }
+}
@@ -0,0 +1,88 @@
+#include "math_test/simd_memory.h"
+
+#include <numeric>
+
+#include "math/include_all.h"
+
+namespace
+{
+    /**
+     * @brief Runs the masked load/store, gather, scatter and stream checks for one SIMD type.
+     */
+    template<typename S, typename I, typename Test>
+    void check(Test& test)
+    {
+        using T = typename S::element_type;
+        constexpr size_t n = S::size;
+
+        alignas(64) T src[n];
+        for (size_t i = 0; i < n; i++) src[i] = static_cast<T>(i + 1);
+
+        // Masked loads zero the remaining lanes, masked stores leave the remaining memory untouched.
+        for (size_t count = 0; count <= n; count++)
+        {
+            const S v = S::loadu(src, count);
+            for (size_t i = 0; i < n; i++) test.compareEQ(v[i], i < count ? src[i] : T(0));
+
+            T dst[n];
+            std::fill(dst, dst + n, T(-1));
+            S::storeu(dst, v, count);
+            for (size_t i = 0; i < n; i++) test.compareEQ(dst[i], i < count ? src[i] : T(-1));
+        }
+
+        // Gather the elements in reverse order, then scatter them back.
+        alignas(64) int32_t idx[n];
+        for (size_t i = 0; i < n; i++) idx[i] = static_cast<int32_t>(n - 1 - i);
+        const I indices = I::load(idx);
+        const S reversed = S::gather(src, indices);
+        for (size_t i = 0; i < n; i++) test.compareEQ(reversed[i], src[n - 1 - i]);
+
+        T dst[n];
+        S::scatter(dst, indices, reversed);
+        for (size_t i = 0; i < n; i++) test.compareEQ(dst[i], src[i]);
+
+        // With duplicate indices the highest lane wins.
+        T single[1] = {T(0)};
+        S::scatter(single, I(0), S::load(src));
+        test.compareEQ(single[0], src[n - 1]);
+
+        alignas(64) T streamed[n];
+        S::stream(streamed, reversed);
+        _mm_sfence();
+        for (size_t i = 0; i < n; i++) test.compareEQ(streamed[i], reversed[i]);
+    }
+}  // namespace
+
+void SimdMemory::operator()()
+{
+    check<math::vec4fa, math::vec4ia>(*this);
+    check<math::vec4ia, math::vec4ia>(*this);
+#ifdef __AVX__
+    check<math::vec8fa, math::vec8ia>(*this);
+    check<math::vec8ia, math::vec8ia>(*this);
+#endif
+#ifdef __AVX512F__
+    check<math::vec16fa, math::vec16ia>(*this);
+    check<math::vec16ia, math::vec16ia>(*this);
+#endif
+
+    // Masks for the tails.
+    compareTrue(math::none(math::vec4ba::first(0)));
+    compareTrue(math::vec4ba::first(3)[2] && !math::vec4ba::first(3)[3]);
+#ifdef __AVX__
+    compareTrue(math::all(math::vec8ba::first(8)));
+    compareTrue(math::vec8ba::first(5)[4] && !math::vec8ba::first(5)[5]);
+    compareTrue(math::vec4dba::first(1) == math::vec4dba(true, false, false, false));
+#endif
+    compareTrue(math::vec2dba::first(1) == math::vec2dba(true, false));
+
+    // Partial batches of doubles go through the masked loads as well.
+    const double d[3] = {1.5, 2.5, 3.5};
+    const math::batch<double> b = math::batch_load_partial(d, 1, 7.0);
+    compareEQ(b[0], 1.5);
+    compareEQ(b[1], 7.0);
+    double out[3] = {0.0, 0.0, 0.0};
+    math::batch_store_partial(out, b, 1);
+    compareEQ(out[0], 1.5);
+    compareEQ(out[1], 0.0);
+}
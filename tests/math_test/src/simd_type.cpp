@@ -0,0 +1,51 @@
+#include "math_test/simd_type.h"
+
+#include "math/include_all.h"
+
+namespace
+{
+    // Written once against vec<T, N>, runs on the SIMD type where there is one.
+    template<typename T, size_t N>
+    math::vec<T, N> scaleAdd(const math::vec<T, N>& a, const math::vec<T, N>& b, const T s)
+    {
+        const auto va = math::to_simd(a);
+        const auto vb = math::to_simd(b);
+        return math::from_simd(va * s + vb);
+    }
+}  // namespace
+
+void SimdType::operator()()
+{
+    static_assert(std::is_same_v<math::simd_t<float, 4>, math::vec4fa>);
+    static_assert(std::is_same_v<math::simd_t<int32_t, 4>, math::vec4ia>);
+    static_assert(std::is_same_v<math::simd_t<float, 3>, math::float3>);
+    static_assert(std::is_same_v<math::simd_t<double, 2>, math::vec2da>);
+    static_assert(std::is_same_v<math::simd_t<double, 3>, math::double3>);
+    static_assert(!math::has_simd_v<float, 5>);
+#ifdef __AVX__
+    static_assert(std::is_same_v<math::simd_t<double, 4>, math::vec4da>);
+    static_assert(std::is_same_v<math::simd_t<float, 8>, math::vec8fa>);
+#endif
+#ifdef __AVX2__
+    static_assert(std::is_same_v<math::simd_t<int32_t, 8>, math::vec8ia>);
+#endif
+
+    // Round trip.
+    const math::float4 f4(1.5f, -2, 3, 4.25f);
+    const math::int4   i4(1, -2, 3, 0x7fffffff);
+    compareEQ(math::from_simd(math::to_simd(f4)), f4);
+    compareEQ(math::from_simd(math::to_simd(i4)), i4);
+    compareEQ(math::to_simd(f4).w, 4.25f);
+    compareEQ(math::to_simd(i4).w, 0x7fffffff);
+
+    const math::vec<float, 8> f8(1, 2, 3, 4, 5, 6, 7, 8);
+    const math::vec<int32_t, 8> i8(-1, -2, -3, -4, 5, 6, 7, 8);
+    compareEQ(math::from_simd(math::to_simd(f8)), f8);
+    compareEQ(math::from_simd(math::to_simd(i8)), i8);
+
+    // Generic algorithm.
+    compareEQ(scaleAdd(f4, math::float4(1), 2.0f), math::float4(4, -3, 7, 9.5f));
+    compareEQ(scaleAdd(i4 * math::int4(1, 1, 1, 0), math::int4(1), 3), math::int4(4, -5, 10, 1));
+    compareEQ(scaleAdd(f8, math::vec<float, 8>(0), 0.5f), math::vec<float, 8>(0.5f, 1, 1.5f, 2, 2.5f, 3, 3.5f, 4));
+    compareEQ(scaleAdd(math::float3(1, 2, 3), math::float3(1), 2.0f), math::float3(3, 5, 7));
+}
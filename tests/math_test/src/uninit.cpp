@@ -0,0 +1,66 @@
+#include "math_test/uninit.h"
+
+#include <type_traits>
+#include <vector>
+
+#include "math/include_all.h"
+
+namespace
+{
+    template<typename... Ts>
+    constexpr bool uninit_constructible = (std::is_nothrow_constructible_v<Ts, math::uninit_t> && ...) && (!std::is_convertible_v<math::uninit_t, Ts> && ...);
+
+    static_assert(uninit_constructible<math::float2, math::float3, math::float4, math::vec<float, 8>, math::floatN<5>, math::int3>);
+    static_assert(uninit_constructible<math::mat3x3f, math::mat3x4f, math::mat4x4f, math::AABB<math::float3>>);
+    static_assert(uninit_constructible<math::vec3fa, math::vec4fa, math::vec4ia, math::vec4ba, math::mat3x4fa, math::mat4x4fa>);
+#ifdef __AVX__
+    static_assert(uninit_constructible<math::vec8fa, math::vec8ia>);
+#endif
+
+    // Arrays of the value types can be copied and relocated with memcpy.
+    template<typename... Ts>
+    constexpr bool memcpy_safe = (math::is_memcpy_safe_v<Ts> && ...);
+
+    static_assert(memcpy_safe<math::float2, math::float3, math::float4, math::vec<float, 8>, math::double3, math::int3, math::ubyte4, math::floatN<5>>);
+    static_assert(memcpy_safe<math::mat3x3f, math::mat3x4f, math::mat4x4f, math::matrix<double, 2, 5>>);
+    static_assert(memcpy_safe<math::AABB<math::float2>, math::AABB<math::float3>, math::AABB<math::int3>, math::quatf, math::dual_quatf>);
+    static_assert(memcpy_safe<math::vec3fa, math::vec4fa, math::vec3ia, math::vec4ia, math::vec3ba, math::vec4ba, math::vec2da, math::vec2dba>);
+    static_assert(memcpy_safe<math::quatfa, math::mat3x4fa, math::mat4x4fa>);
+#ifdef __AVX__
+    static_assert(memcpy_safe<math::vec8fa, math::vec8ia, math::vec8ba, math::vec3da, math::vec4da, math::vec3dba, math::vec4dba>);
+#endif
+#ifdef __AVX512F__
+    static_assert(memcpy_safe<math::vec16fa, math::vec16ia, math::vec16ba>);
+#endif
+}  // namespace
+
+void Uninit::operator()()
+{
+    // Uninitialized objects can be assigned to like any other.
+    {
+        math::mat3x3f m(math::uninit);
+        m = math::mat3x3f(2.0f);
+        compareEQ(m[1], math::float3(2));
+
+        math::vec4fa v(math::uninit);
+        v = math::vec4fa(1, 2, 3, 4);
+        compareEQ(v.w, 4.0f);
+    }
+
+    // Default construction still zero-initializes.
+    compareEQ(math::float3(), math::float3(0));
+    compareEQ(math::mat3x3f()[2], math::float3(0));
+
+    // The allocator only skips initialization when no value is given.
+    {
+        std::vector<math::float3, math::default_init_allocator<math::float3>> v(17, math::float3(1, 2, 3));
+        compareEQ(v[16], math::float3(1, 2, 3));
+        v.resize(33);
+        v.push_back(math::float3(4));
+        compareEQ(v.size(), static_cast<size_t>(34));
+        compareEQ(v[33], math::float3(4));
+
+        std::vector<int, math::default_init_allocator<int>> ints(8, 5);
+        compareEQ(ints[7], 5);
+    }
+}
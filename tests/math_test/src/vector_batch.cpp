@@ -0,0 +1,72 @@
+#include "math_test/vector_batch.h"
+
+#include <random>
+#include <vector>
+
+#include "math/include_all.h"
+
+void VectorBatch::operator()()
+{
+    // Odd size to exercise the scalar tail.
+    constexpr size_t                      n = 1027;
+    std::mt19937                          rng(7);
+    std::uniform_real_distribution<float> ud(-100.0f, 100.0f);
+    std::vector<math::float3>             a(n), b(n), out(n);
+    std::vector<float>                    s(n);
+
+    for (size_t i = 0; i < n; i++)
+    {
+        a[i] = math::float3(ud(rng), ud(rng), ud(rng));
+        b[i] = math::float3(ud(rng), ud(rng), ud(rng));
+    }
+
+    // Compare against double precision, relative to the magnitude of the result.
+    double maxNormalize = 0, maxLength = 0, maxDot = 0, maxDistance = 0;
+
+    math::normalize_all(a, out);
+    for (size_t i = 0; i < n; i++)
+        maxNormalize = std::max(maxNormalize, math::length(math::double3(out[i]) - math::normalize(math::double3(a[i]))));
+
+    math::length_all(a, s);
+    for (size_t i = 0; i < n; i++)
+    {
+        const double l = math::length(math::double3(a[i]));
+        maxLength      = std::max(maxLength, std::abs(s[i] - l) / l);
+    }
+
+    math::dot_all(a, b, s);
+    for (size_t i = 0; i < n; i++)
+    {
+        // Cancellation makes the relative error of a dot product unbounded, so compare against the product of the lengths.
+        const double d = math::dot(math::double3(a[i]), math::double3(b[i]));
+        maxDot         = std::max(maxDot, std::abs(s[i] - d) / (math::length(math::double3(a[i])) * math::length(math::double3(b[i]))));
+    }
+
+    math::distance_all(a, b, s);
+    for (size_t i = 0; i < n; i++)
+    {
+        const double d = math::distance(math::double3(a[i]), math::double3(b[i]));
+        maxDistance    = std::max(maxDistance, std::abs(s[i] - d) / d);
+    }
+
+    compareLT(maxNormalize, 5e-7);
+    compareLT(maxLength, 3e-7);
+    compareLT(maxDot, 3e-7);
+    compareLT(maxDistance, 3e-7);
+
+    // In place matches out of place.
+    auto inplace = a;
+    math::normalize_all(inplace);
+    compareTrue(inplace == out);
+
+    // Zero length vectors.
+    std::vector<math::float3> zeros(9, math::float3(0.0f));
+    math::length_all(zeros, s);
+    for (size_t i = 0; i < 9; i++) compareEQ(s[i], 0.0f);
+    math::distance_all(zeros, zeros, s);
+    for (size_t i = 0; i < 9; i++) compareEQ(s[i], 0.0f);
+
+    // Empty spans.
+    math::normalize_all(std::span<math::float3>());
+    math::length_all({}, {});
+}
@@ -0,0 +1,58 @@
+#include "math_test/vector_expression.h"
+
+#include <type_traits>
+
+#include "math/include_all.h"
+
+namespace
+{
+    template<size_t N>
+    math::vec<double, N> sequence(const double start, const double step)
+    {
+        math::vec<double, N> v;
+        for (size_t i = 0; i < N; i++) v[i] = start + step * static_cast<double>(i);
+        return v;
+    }
+}  // namespace
+
+void VectorExpression::operator()()
+{
+    const auto a = sequence<16>(1, 0.5);
+    const auto b = sequence<16>(-3, 0.25);
+    const auto c = sequence<16>(2, -1);
+    const auto d = sequence<16>(0.5, 2);
+    const auto e = sequence<16>(7, 0.125);
+
+    // Lazy results match the eager operators.
+    {
+        const math::vec<double, 16> r = math::lazy(a) * b + math::lazy(c) * d - e;
+        compareEQ(r, a * b + c * d - e);
+        compareEQ(math::eval(-math::lazy(a) / 2.0 + b), -a / 2.0 + b);
+        compareEQ(math::eval(2.0 * math::lazy(a) - 1.0), 2.0 * a - 1.0);
+        compareEQ(math::eval(c - math::lazy(a) * b), c - a * b);
+    }
+
+    // Products that are added to something become a single madd node.
+    {
+        using madd_t = decltype(math::lazy(a) * b + c);
+        compareTrue(std::is_same_v<madd_t, math::expr::fused_madd<math::expr::terminal<math::vec<double, 16>>, math::expr::terminal<math::vec<double, 16>>, math::expr::terminal<math::vec<double, 16>>>>);
+        using msub_t = decltype(math::lazy(a) * b - c);
+        compareTrue(std::is_same_v<typename msub_t::result_type, math::vec<double, 16>>);
+        compareEQ(math::eval(math::lazy(a) * 3.0 + 1.0), a * 3.0 + 1.0);
+        compareEQ(math::eval(math::lazy(a) * b - c), a * b - c);
+    }
+
+    // Specialized vectors and matrices.
+    {
+        const math::float3 x(1, 2, 3), y(4, 5, 6);
+        compareEQ(math::eval(math::lazy(x) * y + x), x * y + x);
+
+        const math::mat3x3f m(1, 2, 3, 4, 5, 6, 7, 8, 9);
+        const math::mat3x3f n = math::lazy(m) * 2.0f - m;
+        compareEQ(n[2], math::float3(7, 8, 9));
+
+        const math::mat4x4f p(2.0f);
+        const math::mat4x4f q = math::lazy(p) * p + 1.0f;
+        compareEQ(q[3], math::float4(5));
+    }
+}
@@ -0,0 +1,229 @@
+#include "math_test/vector_pack.h"
+
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "math/include_all.h"
+
+namespace
+{
+    template<typename T>
+    [[nodiscard]] bool same_bits(const std::vector<T>& a, const std::vector<T>& b)
+    {
+        return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+    }
+
+    // Angle between two directions in degrees, computed in double so that small errors are not lost.
+    [[nodiscard]] double angle(const math::float3& a, const math::float3& b)
+    {
+        const math::double3 da(a.x, a.y, a.z), db(b.x, b.y, b.z);
+        return std::atan2(math::length(math::cross(da, db)), math::dot(da, db)) * 180.0 / std::numbers::pi;
+    }
+}
+
+void VectorPack::operator()()
+{
+    constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+    constexpr float inf = std::numeric_limits<float>::infinity();
+
+    // Clamping, rounding to nearest even and NaN.
+    compareTrue(math::pack_unorm<uint8_t>(math::float4(0.0f, 0.5f, 1.0f, 2.0f)) == math::ubyte4(0, 128, 255, 255));
+    compareTrue(math::pack_unorm<uint8_t>(math::float4(-1.0f, nan, 1.5f / 255.0f, 2.5f / 255.0f)) == math::ubyte4(0, 0, 2, 2));
+    compareTrue(math::pack_snorm<int8_t>(math::float4(-1.0f, -2.0f, 0.5f, nan)) == math::sbyte4(-127, -127, 64, 0));
+    compareTrue(math::pack_unorm<uint16_t>(math::float4(1.0f, 0.0f, 0.25f, 3.0f)) == math::ushort4(65535, 0, 16384, 65535));
+    compareTrue(math::unpack_snorm(math::sbyte4(-128, -127, 0, 127)) == math::float4(-1.0f, -1.0f, 0.0f, 1.0f));
+    compareTrue(math::unpack_unorm(math::ushort4(0, 65535, 0, 65535)) == math::float4(0.0f, 1.0f, 0.0f, 1.0f));
+
+    // Every integer survives unpacking and packing.
+    {
+        size_t wrong = 0;
+        for (int i = 0; i < 256; i++)
+        {
+            const auto u = static_cast<uint8_t>(i);
+            const auto s = static_cast<int8_t>(i - 128);
+            wrong += math::pack_unorm<uint8_t>(math::unpack_unorm(math::ubyte4(u))) != math::ubyte4(u);
+            wrong += math::pack_snorm<int8_t>(math::unpack_snorm(math::sbyte4(s))) != math::sbyte4(s == -128 ? -127 : s);
+        }
+        for (int i = 0; i < 65536; i++)
+        {
+            const auto u = static_cast<uint16_t>(i);
+            const auto s = static_cast<int16_t>(i - 32768);
+            wrong += math::pack_unorm<uint16_t>(math::unpack_unorm(math::ushort4(u))) != math::ushort4(u);
+            wrong += math::pack_snorm<int16_t>(math::unpack_snorm(math::short4(s))) != math::short4(s == -32768 ? -32767 : s);
+        }
+        compareEQ(wrong, size_t(0));
+    }
+
+    // RGB10A2.
+    compareEQ(math::pack_rgb10a2(math::float4(1.0f, 0.0f, 1.0f, 1.0f)), 0x3ffu | 0x3ffu << 20 | 3u << 30);
+    compareEQ(math::pack_rgb10a2(math::float4(0.5f, 2.0f, -1.0f, 1.0f / 3.0f)), 512u | 1023u << 10 | 1u << 30);
+    compareTrue(math::unpack_rgb10a2(0x3ffu << 10 | 2u << 30) == math::float4(0.0f, 1.0f, 0.0f, 2.0f / 3.0f));
+
+    // R11G11B10F: every finite value survives unpacking and packing, values halfway between two round to the even one.
+    {
+        size_t wrong = 0;
+        for (uint32_t c = 0; c < 0x7c0; c++)
+        {
+            const float f = math::detail::unsigned_small_float_to_float<6>(c);
+            wrong += math::detail::float_to_unsigned_small_float<6>(f) != c;
+            if (c + 1 < 0x7c0)
+            {
+                const float mid = (f + math::detail::unsigned_small_float_to_float<6>(c + 1)) / 2;
+                wrong += math::detail::float_to_unsigned_small_float<6>(mid) != (c & 1 ? c + 1 : c);
+            }
+        }
+        for (uint32_t c = 0; c < 0x3e0; c++)
+        {
+            const float f = math::detail::unsigned_small_float_to_float<5>(c);
+            wrong += math::detail::float_to_unsigned_small_float<5>(f) != c;
+        }
+        compareEQ(wrong, size_t(0));
+
+        compareEQ(math::pack_r11g11b10f(math::float3(1.0f, 65024.0f, 64512.0f)), 0x3c0u | 0x7bfu << 11 | 0x3dfu << 22);
+        compareEQ(math::pack_r11g11b10f(math::float3(-1.0f, 1e9f, inf)), 0x7bfu << 11 | 0x3e0u << 22);
+        const auto special = math::unpack_r11g11b10f(math::pack_r11g11b10f(math::float3(nan, -0.0f, 0x1p-18f)));
+        compareTrue(std::isnan(special.x));
+        compareEQ(std::bit_cast<uint32_t>(special.y), 0u);
+        compareEQ(special.z, 0x1p-18f);
+    }
+
+    // Span versions give the same bits as the scalar ones, including the tail.
+    {
+        constexpr size_t                      n = 1027;
+        std::mt19937                          rng(9);
+        std::uniform_real_distribution<float> ud(-1.5f, 1.5f);
+        std::vector<math::float4>             colors(n);
+        std::vector<math::float3>             hdr(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            colors[i] = math::float4(ud(rng), ud(rng), ud(rng), i % 97 ? ud(rng) : nan);
+            for (size_t j = 0; j < 3; j++) hdr[i][j] = ud(rng) * std::ldexp(1.0f, static_cast<int>(rng() % 44) - 26);
+        }
+        hdr[5]  = math::float3(nan, inf, -inf);
+        hdr[13] = math::float3(1e9f, -0.0f, 0.0f);
+
+        std::vector<math::ubyte4>  ub(n), ubRef(n);
+        std::vector<math::ushort4> us(n), usRef(n);
+        std::vector<math::sbyte4>  sb(n), sbRef(n);
+        std::vector<math::short4>  ss(n), ssRef(n);
+        std::vector<uint32_t>      p(n), pRef(n);
+        std::vector<math::float4>  f4(n), f4Ref(n);
+        std::vector<math::float3>  f3(n), f3Ref(n);
+
+        math::pack_unorm(colors, ub);
+        math::pack_unorm(colors, us);
+        math::pack_snorm(colors, sb);
+        math::pack_snorm(colors, ss);
+        for (size_t i = 0; i < n; i++)
+        {
+            ubRef[i] = math::pack_unorm<uint8_t>(colors[i]);
+            usRef[i] = math::pack_unorm<uint16_t>(colors[i]);
+            sbRef[i] = math::pack_snorm<int8_t>(colors[i]);
+            ssRef[i] = math::pack_snorm<int16_t>(colors[i]);
+        }
+        compareTrue(same_bits(ub, ubRef));
+        compareTrue(same_bits(us, usRef));
+        compareTrue(same_bits(sb, sbRef));
+        compareTrue(same_bits(ss, ssRef));
+
+        math::unpack_unorm(ub, f4);
+        for (size_t i = 0; i < n; i++) f4Ref[i] = math::unpack_unorm(ub[i]);
+        compareTrue(same_bits(f4, f4Ref));
+        math::unpack_unorm(us, f4);
+        for (size_t i = 0; i < n; i++) f4Ref[i] = math::unpack_unorm(us[i]);
+        compareTrue(same_bits(f4, f4Ref));
+        math::unpack_snorm(sb, f4);
+        for (size_t i = 0; i < n; i++) f4Ref[i] = math::unpack_snorm(sb[i]);
+        compareTrue(same_bits(f4, f4Ref));
+        math::unpack_snorm(ss, f4);
+        for (size_t i = 0; i < n; i++) f4Ref[i] = math::unpack_snorm(ss[i]);
+        compareTrue(same_bits(f4, f4Ref));
+
+        math::pack_rgb10a2(colors, p);
+        for (size_t i = 0; i < n; i++) pRef[i] = math::pack_rgb10a2(colors[i]);
+        compareTrue(same_bits(p, pRef));
+        math::unpack_rgb10a2(p, f4);
+        for (size_t i = 0; i < n; i++) f4Ref[i] = math::unpack_rgb10a2(p[i]);
+        compareTrue(same_bits(f4, f4Ref));
+
+        math::pack_r11g11b10f(hdr, p);
+        for (size_t i = 0; i < n; i++) pRef[i] = math::pack_r11g11b10f(hdr[i]);
+        compareTrue(same_bits(p, pRef));
+        math::unpack_r11g11b10f(p, f3);
+        for (size_t i = 0; i < n; i++) f3Ref[i] = math::unpack_r11g11b10f(p[i]);
+        compareTrue(same_bits(f3, f3Ref));
+    }
+
+    // Octahedral unit vectors.
+    {
+        compareTrue(math::pack_octahedral<int16_t>(math::float3(0, 0, 1)) == math::short2(0, 0));
+        compareTrue(math::pack_octahedral<int16_t>(math::float3(0, 0, -1)) == math::short2(32767, 32767));
+        compareTrue(math::pack_octahedral<int8_t>(math::float3(-2, 0, 0)) == math::sbyte2(-127, 0));
+        compareTrue(math::unpack_octahedral(math::short2(32767, 32767)) == math::float3(0, 0, -1));
+        compareTrue(math::unpack_octahedral(math::sbyte2(0, -128)) == math::float3(0, -1, 0));
+        compareTrue(math::pack_octahedral<int16_t>(math::float3(0)) == math::short2(0, 0));
+        compareTrue(math::pack_octahedral_precise<int16_t>(math::float3(0)) == math::short2(0, 0));
+
+        constexpr size_t                n = 65539;
+        std::mt19937                    rng(11);
+        std::normal_distribution<float> nd;
+        std::vector<math::float3>       dirs(n);
+        for (auto& d : dirs) d = math::float3(nd(rng), nd(rng), nd(rng)) * (0.5f + static_cast<float>(rng() % 4));
+        dirs[3] = math::float3(0, 0, -1);
+        dirs[4] = math::float3(1, 0, 0);
+
+        // Largest angular error in degrees. Choosing the rounding lowers it by about a third.
+        double fast8 = 0, precise8 = 0, fast16 = 0, precise16 = 0;
+        for (const auto& d : dirs)
+        {
+            fast8     = std::max(fast8, angle(d, math::unpack_octahedral(math::pack_octahedral<int8_t>(d))));
+            precise8  = std::max(precise8, angle(d, math::unpack_octahedral(math::pack_octahedral_precise<int8_t>(d))));
+            fast16    = std::max(fast16, angle(d, math::unpack_octahedral(math::pack_octahedral<int16_t>(d))));
+            precise16 = std::max(precise16, angle(d, math::unpack_octahedral(math::pack_octahedral_precise<int16_t>(d))));
+        }
+        compareLT(fast8, 1.0);
+        compareLT(precise8, 0.7);
+        compareLT(fast16, 0.004);
+        compareLT(precise16, 0.0026);
+
+        // The span versions give the same bits, except that the precise one can pick another candidate when two are
+        // equally close, and unpacking normalizes with a slightly different rounding.
+        dirs[9] = math::float3(0);
+        std::vector<math::sbyte2> b(n), bRef(n);
+        std::vector<math::short2> s(n), sRef(n);
+        std::vector<math::float3> f(n);
+        math::pack_octahedral(dirs, b);
+        math::pack_octahedral(dirs, s);
+        for (size_t i = 0; i < n; i++)
+        {
+            bRef[i] = math::pack_octahedral<int8_t>(dirs[i]);
+            sRef[i] = math::pack_octahedral<int16_t>(dirs[i]);
+        }
+        compareTrue(same_bits(b, bRef));
+        compareTrue(same_bits(s, sRef));
+
+        math::pack_octahedral_precise(dirs, b);
+        math::pack_octahedral_precise(dirs, s);
+        double worse = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            if (i == 9) continue;
+            worse = std::max(worse, angle(dirs[i], math::unpack_octahedral(b[i])) - angle(dirs[i], math::unpack_octahedral(math::pack_octahedral_precise<int8_t>(dirs[i]))));
+            worse = std::max(worse, angle(dirs[i], math::unpack_octahedral(s[i])) - angle(dirs[i], math::unpack_octahedral(math::pack_octahedral_precise<int16_t>(dirs[i]))));
+        }
+        compareLT(worse, 1e-4);
+        compareTrue(b[9] == math::sbyte2(0, 0) && s[9] == math::short2(0, 0));
+
+        double diff = 0;
+        math::unpack_octahedral(b, f);
+        for (size_t i = 0; i < n; i++) diff = std::max(diff, angle(f[i], math::unpack_octahedral(b[i])));
+        math::unpack_octahedral(s, f);
+        for (size_t i = 0; i < n; i++) diff = std::max(diff, angle(f[i], math::unpack_octahedral(s[i])));
+        compareLT(diff, 1e-4);
+    }
+}
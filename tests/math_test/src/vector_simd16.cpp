@@ -0,0 +1,63 @@
+#include "math_test/vector_simd16.h"
+
+#include <numeric>
+
+#include "math/include_all.h"
+
+void VectorSimd16::operator()()
+{
+#ifdef __AVX512F__
+    alignas(64) float   f[16];
+    alignas(64) int32_t i[16];
+    for (int32_t j = 0; j < 16; j++)
+    {
+        f[j] = static_cast<float>(j) - 7.5f;
+        i[j] = j * 3 - 20;
+    }
+
+    const math::vec16fa a = math::vec16fa::load(f);
+    const math::vec16ia b = math::vec16ia::load(i);
+
+    // Arithmetic and reductions.
+    compareEQ(math::reduce_add(a), 0.0f);
+    compareEQ(math::reduce_min(a), -7.5f);
+    compareEQ(math::reduce_max(a), 7.5f);
+    compareEQ(math::reduce_add(b), std::accumulate(i, i + 16, 0));
+    compareEQ(math::reduce_max(b), 25);
+    compareEQ((a * 2.0f + 1.0f)[3], -8.0f);
+    compareEQ(math::madd(a, a, math::vec16fa(1.0f))[15], 7.5f * 7.5f + 1.0f);
+    compareEQ((b * b - b)[0], 420);
+    compareEQ((-b)[1], 17);
+    compareEQ(math::abs(b)[0], 20);
+    compareEQ((~b)[0], 19);
+    compareEQ((b / 4)[1], -4);
+    compareEQ(math::floor(a)[0], -8.0f);
+    compareEQ(math::dot(a, math::vec16fa(1.0f)), 0.0f);
+
+    // Masks.
+    const math::vec16ba neg = math::cmplt(a, 0.0f);
+    compareEQ(neg.k, 0x00ff);
+    compareTrue(math::any(neg) && !math::all(neg) && math::all(neg | !neg) && math::none(neg & !neg));
+    compareTrue(math::cmpge(b, 4) == math::vec16ba(static_cast<__mmask16>(0xff00)));
+    compareEQ(math::select(math::vec16fa(1.0f), math::vec16fa(2.0f), neg)[0], 1.0f);
+    compareEQ(math::select(math::vec16fa(1.0f), math::vec16fa(2.0f), neg)[8], 2.0f);
+    compareEQ(math::select(math::vec16ia(1), math::vec16ia(2), neg)[15], 2);
+
+    // Masked tails do not touch memory past count.
+    float out[17];
+    std::fill(out, out + 17, -1.0f);
+    math::vec16fa::storeu(out, math::vec16fa::loadu(f, size_t{5}), size_t{5});
+    compareEQ(out[4], f[4]);
+    compareEQ(out[5], -1.0f);
+    compareEQ(math::vec16fa::loadu(f, size_t{5})[5], 0.0f);
+    compareEQ(math::vec16ia::loadu(i, math::vec16ba::first(3))[2], i[2]);
+
+    // Conversion.
+    const math::vec<float, 16> g = static_cast<math::vec<float, 16>>(a);
+    compareEQ(g[9], f[9]);
+    compareTrue(math::vec16fa(g) == a);
+    compareTrue(math::vec16fa(a.low(), a.high()) == a);
+    compareTrue(math::vec16ia(b.low(), b.high()) == b);
+    compareEQ(static_cast<math::vec<int32_t, 16>>(b)[15], 25);
+#endif
+}
@@ -0,0 +1,97 @@
+#include "math_test/vector_simd_double.h"
+
+#include <cmath>
+
+#include "math/include_all.h"
+
+void VectorSimdDouble::operator()()
+{
+    // Values that are not representable as floats, so that any loss of precision shows up.
+    constexpr double a = 1.0 + 1e-12;
+    constexpr double b = 2.0 - 1e-12;
+
+    // vec2da.
+    {
+        const math::vec2da v(a, b);
+        const math::vec2da w(3.0, -4.0);
+        compareEQ((v + w).x, a + 3.0);
+        compareEQ((v * w).y, b * -4.0);
+        compareEQ((-w).y, 4.0);
+        compareEQ(math::abs(w).y, 4.0);
+        compareEQ(math::dot(v, w), a * 3.0 + b * -4.0);
+        compareEQ(math::length(w), 5.0);
+        compareLT(std::abs(math::normalize(w).x - 0.6), 1e-15);
+        compareEQ(math::reduce_min(w), -4.0);
+        compareEQ(math::reduce_max(w), 3.0);
+        compareEQ(math::madd(v, w, v).x, a * 3.0 + a);
+        compareEQ(v.yx().x, b);
+        compareEQ((math::shuffle<1, 1>(v)).x, b);
+        compareEQ(static_cast<math::double2>(v), math::double2(a, b));
+        compareEQ(math::vec2da(math::double2(a, b)).y, b);
+
+        const math::vec2dba lt = math::cmplt(w, 0.0);
+        compareTrue(!lt[0] && lt[1]);
+        compareTrue(math::any(lt) && !math::all(lt) && math::all(lt | !lt) && math::none(lt & !lt));
+        compareEQ(math::select(v, w, lt), math::vec2da(3.0, b));
+        compareTrue(v == math::vec2da(a, b));
+        compareTrue(v != w);
+    }
+
+#ifdef __AVX__
+    // vec4da.
+    {
+        const math::vec4da v(a, b, 3.0, -4.0);
+        const math::vec4da w(1.0, 2.0, 3.0, 4.0);
+        compareEQ(math::reduce_add(w), 10.0);
+        compareEQ(math::reduce_mul(w), 24.0);
+        compareEQ(math::reduce_min(v), -4.0);
+        compareEQ(math::reduce_max(v), 3.0);
+        compareEQ(math::dot(v, w), a + b * 2.0 + 9.0 - 16.0);
+        compareEQ((v - w).x, a - 1.0);
+        compareEQ((v / w).w, -1.0);
+        compareEQ(math::sqrt(w * w).z, 3.0);
+        compareEQ(v.wzyx().w, a);
+        compareEQ(v.wwww().x, -4.0);
+        compareEQ(math::shuffle<3, 2, 1, 0>(v).y, 3.0);
+        compareEQ(math::floor(v).x, 1.0);
+        compareEQ(math::ceil(v).x, 2.0);
+        compareEQ(static_cast<math::double4>(v), math::double4(a, b, 3.0, -4.0));
+        compareEQ(math::vec4da(math::double4(a, b, 3.0, -4.0)), v);
+
+        const math::vec4dba gt = math::cmpgt(v, w);
+        compareTrue(gt == math::vec4dba(a > 1.0, false, false, false));
+        compareTrue(math::any(gt) && !math::all(gt) && math::all(!math::cmpneq(gt, gt)));
+        compareEQ(math::select(v, w, gt), math::vec4da(a, 2.0, 3.0, 4.0));
+        compareTrue(math::all(math::cmpeq(math::clamp(v, 0.0, 2.0), math::vec4da(a, b, 2.0, 0.0))));
+
+        alignas(32) double buffer[4];
+        math::vec4da::store(buffer, v);
+        compareEQ(buffer[1], b);
+        compareEQ(math::vec4da::load(buffer), v);
+    }
+
+    // vec3da.
+    {
+        const math::vec3da x(1.0, 0.0, 0.0);
+        const math::vec3da y(0.0, 1.0, 0.0);
+        compareEQ(math::cross(x, y), math::vec3da(0.0, 0.0, 1.0));
+        compareEQ(math::cross(y, x), math::vec3da(0.0, 0.0, -1.0));
+
+        // The padding lane does not take part in reductions or comparisons.
+        const math::vec3da v(a, b, -2.0, 100.0);
+        compareEQ(math::reduce_add(v), a + b - 2.0);
+        compareEQ(math::reduce_max(v), b);
+        compareEQ(math::dot(v, v), a * a + b * b + 4.0);
+        compareEQ(math::length(math::vec3da(2.0, 3.0, 6.0)), 7.0);
+        compareLT(std::abs(math::normalize(math::vec3da(2.0, 3.0, 6.0)).z - 6.0 / 7.0), 1e-15);
+        compareTrue(math::all(math::cmplt(v, 10.0)));
+        compareTrue(v == math::vec3da(a, b, -2.0, 0.0));
+        compareEQ(v.zyx().x, -2.0);
+        compareEQ(static_cast<math::double3>(v), math::double3(a, b, -2.0));
+
+        const math::double3 p(a, b, 3.0);
+        const math::double3 q(-1.0, b, a);
+        compareEQ(static_cast<math::double3>(math::cross(math::vec3da(p), math::vec3da(q))), math::cross(p, q));
+    }
+#endif
+}